@@ -1,6 +1,12 @@
 #include <cmath>
 #include <iostream>
+#include <rosetta/arrow.h>
+#include <rosetta/delta.h>
+#include <rosetta/index.h>
 #include <rosetta/introspectable.h>
+#include <rosetta/kernels.h>
+#include <rosetta/query.h>
+#include <rosetta/table.h>
 #include <sstream>
 
 // Define a Vector3D class
@@ -40,6 +46,7 @@ public:
 
 // 1. Register the new type Vector3D
 REGISTER_TYPE(Vector3D);
+REGISTER_BINARY_RAW(Vector3D); // binary encoding: its three floats
 
 // 2. Example class that uses Vector3D as a member
 class GameObject : public rosetta::Introspectable {
@@ -102,10 +109,10 @@ public:
 // 3. Registration implementation
 void GameObject::registerIntrospection(rosetta::TypeRegistrar<GameObject> reg)
 {
-    reg.member("name", &GameObject::name)
+    reg.member_observable("name", &GameObject::name) // changes sent to subscribers
         .member("position", &GameObject::position) // Vector3D member
         .member("velocity", &GameObject::velocity) // Vector3D member
-        .member("health", &GameObject::health)
+        .member_observable("health", &GameObject::health)
         .method("getName", &GameObject::getName)
         .method("setName", &GameObject::setName)
         .method("getPosition", &GameObject::getPosition) // Returns Vector3D
@@ -161,5 +168,107 @@ int main()
     auto final_pos = std::any_cast<Vector3D>(player.callMethod("getPosition"));
     std::cout << "Final position: " << final_pos.toString() << std::endl;
 
+    // Store many objects column by column and scan a single member
+    std::cout << std::endl << "=== Columnar Table ===" << std::endl;
+    rosetta::Table<GameObject> objects;
+    objects.reserve(1000);
+    for (int i = 0; i < 1000; ++i) {
+        objects.push_back(GameObject("Npc" + std::to_string(i), Vector3D(float(i), 0.0f, 0.0f)));
+    }
+    objects[0].setMemberValue("health", 50.0f);
+
+    float total_health = 0;
+    for (float health : objects.column<float>("health")) {
+        total_health += health;
+    }
+    std::cout << "Rows: " << objects.size() << ", total health: " << total_health << std::endl;
+    std::cout << "Row 0: " << objects.get(0).getInfo() << std::endl;
+
+    // Vectorised kernels over a column
+    const char* simd = rosetta::kernels::simdLevelName(rosetta::kernels::simdLevel());
+    std::cout << std::endl << "=== Column Kernels (" << simd << ") ===" << std::endl;
+    auto health = objects.column<float>("health");
+    auto [lowest, highest] = rosetta::kernels::minMax(health);
+    auto moments = rosetta::kernels::meanVariance(health);
+    std::cout << "Health in [" << lowest << ", " << highest << "], mean " << moments.mean
+              << ", variance " << moments.variance << std::endl;
+    rosetta::kernels::clamp(health, 75.0f, 100.0f);
+    std::cout << "Total health after clamping to [75, 100]: " << rosetta::kernels::sum(health)
+              << std::endl;
+
+    std::cout << std::endl << "=== Queries ===" << std::endl;
+    const auto weakest = rosetta::Query<GameObject>()
+                             .where("health < 80 && name != ''")
+                             .orderBy("health, name")
+                             .limit(3)
+                             .indices(objects);
+    for (std::size_t row : weakest) {
+        std::cout << "Row " << row << ": health " << objects.get(row).getHealth() << std::endl;
+    }
+    std::cout << "Objects at full health: "
+              << rosetta::Query<GameObject>().where("health == 100").count(objects) << std::endl;
+
+    std::cout << std::endl << "=== Indexes ===" << std::endl;
+    std::vector<GameObject> scene;
+    for (int i = 0; i < 100; ++i) {
+        scene.emplace_back("Object" + std::to_string(i), Vector3D(float(i), 0.0f, 0.0f));
+    }
+    rosetta::Index<GameObject> by_name(rosetta::IndexKind::Hash, {"name"});
+    rosetta::Index<GameObject> by_health(rosetta::IndexKind::Ordered, {"health"});
+    by_name.insert(scene);
+    by_health.insert(scene);
+    scene[42].setMemberValue("health", 10.0f); // re-indexed
+    for (GameObject *object : by_health.range(0, 50)) {
+        std::cout << "Weak: " << object->getName() << std::endl;
+    }
+    std::cout << "Object7 found: " << by_name.lookup("Object7").size() << std::endl;
+
+    // Exchange with Arrow consumers through the C data interface
+    std::cout << std::endl << "=== Arrow ===" << std::endl;
+    ArrowSchema schema;
+    ArrowArray array;
+    rosetta::toArrow(objects, &schema, &array);
+    for (int64_t i = 0; i < schema.n_children; ++i) {
+        std::cout << "Column " << schema.children[i]->name << ": " << schema.children[i]->format
+                  << std::endl;
+    }
+    rosetta::Table<GameObject> copy;
+    rosetta::appendFromArrow(copy, &schema, &array);
+    array.release(&array);
+    schema.release(&schema);
+    std::cout << "Copied rows: " << copy.size() << ", row 0: " << copy.get(0).getInfo()
+              << std::endl;
+
+    // Send only the members that changed to a mirror
+    std::cout << std::endl << "=== Delta Sync ===" << std::endl;
+    GameObject mirror = player;
+    rosetta::DirtyTracker<GameObject> tracker;
+    tracker.track(player);
+    player.setMemberValue("health", 25.0f);
+    player.move(Vector3D(1.0f, 0.0f, 0.0f));
+    tracker.markDirty(player, "position"); // written directly
+    const auto delta = tracker.collectDelta(player);
+    rosetta::applyDelta(mirror, delta);
+    std::cout << "Delta of " << delta.size() << " bytes (full: " << player.toBinary().size()
+              << "), mirror: " << mirror.getInfo() << std::endl;
+
+    std::cout << std::endl << "=== Property Changes ===" << std::endl;
+    const auto subscription = rosetta::subscribePropertyChanged(
+        player, [](std::span<const rosetta::PropertyChange> changes) {
+            std::cout << changes.size() << " change(s):";
+            for (const auto& change : changes) {
+                std::cout << " " << change.member->name;
+            }
+            std::cout << std::endl;
+        });
+    player.setMemberValue("health", 20.0f); // delivered now
+    {
+        rosetta::PropertyBatch frame; // delivered once, at the end of the frame
+        player.setMemberValue("health", 15.0f);
+        player.setMemberValue("health", 10.0f);
+        player.setMemberValue("name", std::string("Champion"));
+    }
+    rosetta::unsubscribePropertyChanged(player, subscription);
+
     return 0;
 }
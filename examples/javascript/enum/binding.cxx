@@ -21,6 +21,17 @@ REGISTER_ENUM_4(Priority, Low, Medium, High, Critical);
 // ENUM_VALUE(Critical)
 // END_ENUM_REGISTRATION()
 
+// Method 3: Flags, combined with | (in C++ and in JavaScript)
+enum class Access { None = 0, Read = 1, Write = 2, Exec = 4 };
+ROSETTA_ENUM_FLAGS(Access)
+BEGIN_ENUM_REGISTRATION(Access)
+    ENUM_FLAGS()
+    ENUM_VALUE(None)
+    ENUM_VALUE(Read)
+    ENUM_VALUE(Write)
+    ENUM_VALUE(Exec)
+END_ENUM_REGISTRATION()
+
 // For plain enums (not enum class), use REGISTER_PLAIN_ENUM:
 // enum Color { Red, Green, Blue };
 // REGISTER_PLAIN_ENUM(Color, Red, Green, Blue);
@@ -29,7 +40,7 @@ REGISTER_ENUM_4(Priority, Low, Medium, High, Critical);
 class Task : public rosetta::Introspectable {
     INTROSPECTABLE(Task)
 public:
-    Task() : status_(Status::Pending), priority_(Priority::Medium) {}
+    Task() : status_(Status::Pending), priority_(Priority::Medium), access_(Access::Read) {}
 
     Status getStatus() const { return status_; }
     void   setStatus(Status s) { status_ = s; }
@@ -42,9 +53,19 @@ public:
         return info->getName(static_cast<int64_t>(status_));
     }
 
+    Access getAccess() const { return access_; }
+    void   setAccess(Access a) { access_ = a; }
+    bool   canWrite() const { return hasFlag(access_, Access::Write); }
+
+    std::string getAccessName() const {
+        const auto *info = rosetta::EnumRegistry::instance().getEnumInfo<Access>();
+        return info->format(static_cast<int64_t>(access_)); // e.g. "Read|Write"
+    }
+
 private:
     Status   status_;
     Priority priority_;
+    Access   access_;
 };
 
 void Task::registerIntrospection(rosetta::TypeRegistrar<Task> reg) {
@@ -55,7 +76,11 @@ void Task::registerIntrospection(rosetta::TypeRegistrar<Task> reg) {
         .method("setStatus", &Task::setStatus)
         .method("getPriority", &Task::getPriority)
         .method("setPriority", &Task::setPriority)
-        .method("getStatusName", &Task::getStatusName);
+        .method("getStatusName", &Task::getStatusName)
+        .method("getAccess", &Task::getAccess)
+        .method("setAccess", &Task::setAccess)
+        .method("canWrite", &Task::canWrite)
+        .method("getAccessName", &Task::getAccessName);
 }
 
 // JavaScript binding
@@ -65,6 +90,7 @@ Napi::Object Init(Napi::Env env, Napi::Object exports) {
     // Register enums first
     rosetta::registerEnumType<Status>(generator);
     rosetta::registerEnumType<Priority>(generator);
+    rosetta::registerEnumType<Access>(generator);
 
     // Then bind class
     generator.bind_class<Task>();
@@ -32,4 +32,10 @@ try {
     rosetta.Status.NewValue = 99; // Throws error
 } catch (e) {
     console.log('Cannot modify enum');
-}
\ No newline at end of file
+}
+
+// Flags combine with |, names too
+task.setAccess(rosetta.Access.Read | rosetta.Access.Write);
+console.log('Access:', task.getAccessName(), task.canWrite()); // "Read|Write" true
+task.setAccess('Read|Exec');
+console.log('Access:', task.getAccess()); // 5
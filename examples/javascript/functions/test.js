@@ -2,4 +2,14 @@ const rosetta = require('./build/Release/rosetta');
 
 console.log(rosetta.add(20, 3));  // 23
 console.log(rosetta.greet("World"));  // "Hello, World"
-console.log(rosetta.calculateDistance(0, 0, 3, 4));  // 5.0
\ No newline at end of file
+console.log(rosetta.calculateDistance(0, 0, 3, 4));  // 5.0
+
+// Vectorized variants (all-numeric signatures only)
+const x1 = new Float64Array([0, 1, 2]);
+const y1 = new Float64Array([0, 0, 0]);
+console.log(rosetta.calculateDistance.map(x1, y1, 3, 4));  // Float64Array [5, 4.47.., 4.12..]
+console.log(rosetta.add.map(new Int32Array([1, 2, 3]), 10));  // Int32Array [11, 12, 13]
+
+rosetta.calculateDistance.mapAsync(new Float64Array(1e6), 0, 3, 4).then(d => {
+    console.log(d.length, d[0]);  // 1000000 5
+});
@@ -8,7 +8,7 @@ int main()
 {
     // Create Lua state
     sol::state lua;
-    lua.open_libraries(sol::lib::base, sol::lib::package);
+    lua.open_libraries(sol::lib::base, sol::lib::package, sol::lib::ffi);
 
     std::cout << "=== Automatic Lua Bindings Demo ===" << std::endl;
 
@@ -16,6 +16,11 @@ int main()
     rosetta::LuaGenerator generator(lua);
     generator.bind_classes<Person, Vehicle>().add_utilities();
 
+    // Under LuaJIT, also expose the object layouts to the FFI (obj:ffi())
+    if (generator.has_ffi()) {
+        generator.bind_ffi<Person>().bind_ffi<Vehicle>();
+    }
+
     std::cout << "Classes bound to Lua successfully!" << std::endl;
     std::cout << "Running Lua test script..." << std::endl;
 
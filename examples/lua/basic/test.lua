@@ -153,4 +153,13 @@ if not status then
 end
 print()
 
+-- Test 13: LuaJIT FFI access (only when running under LuaJIT)
+if person.ffi then
+    print("13. FFI access...")
+    local p = person:ffi()
+    p.age = p.age + 1
+    print("Age through FFI: " .. tonumber(p.age) .. " (binding: " .. person.age .. ")")
+    print()
+end
+
 print("=== All tests completed successfully! ===")
\ No newline at end of file
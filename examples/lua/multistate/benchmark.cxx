@@ -0,0 +1,97 @@
+// examples/lua/multistate/benchmark.cxx
+//
+// Per-state bind time and memory when creating many Lua VMs:
+//   - LuaGenerator: every class is analyzed again for each state
+//   - LuaBindingPlan: analyzed once, then applied to each state (also on threads)
+#include "../../classes_demo.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <rosetta/generators/lua.h>
+#include <sol/sol.hpp>
+#include <thread>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+static double microseconds(Clock::duration d)
+{
+    return std::chrono::duration<double, std::micro>(d).count();
+}
+
+int main(int argc, char** argv)
+{
+    const int states = argc > 1 ? std::atoi(argv[1]) : 1000;
+    const int workers = argc > 2 ? std::atoi(argv[2]) : std::thread::hardware_concurrency();
+
+    std::cout << "=== Lua multi-state binding benchmark (" << states << " states) ===\n";
+
+    // Baseline: an empty state
+    size_t empty_memory = 0;
+    {
+        sol::state lua;
+        empty_memory = lua.memory_used();
+    }
+
+    // 1. LuaGenerator for each state
+    {
+        size_t memory = 0;
+        auto start = Clock::now();
+        for (int i = 0; i < states; ++i) {
+            sol::state lua;
+            rosetta::LuaGenerator generator(lua);
+            generator.bind_classes<Person, Vehicle>().add_utilities();
+            memory = lua.memory_used();
+        }
+        auto elapsed = microseconds(Clock::now() - start);
+        std::cout << "LuaGenerator:   " << elapsed / states << " us/state, "
+                  << (memory - empty_memory) / 1024.0 << " KB/state\n";
+    }
+
+    // 2. Shared plan, built once
+    auto start = Clock::now();
+    auto builder = std::make_shared<rosetta::LuaBindingPlan>();
+    builder->add_classes<Person, Vehicle>().add_functions().add_utilities();
+    std::shared_ptr<const rosetta::LuaBindingPlan> plan = builder;
+    std::cout << "Plan built in " << microseconds(Clock::now() - start) << " us\n";
+
+    {
+        size_t memory = 0;
+        start = Clock::now();
+        for (int i = 0; i < states; ++i) {
+            sol::state lua;
+            plan->apply(lua);
+            memory = lua.memory_used();
+        }
+        auto elapsed = microseconds(Clock::now() - start);
+        std::cout << "LuaBindingPlan: " << elapsed / states << " us/state, "
+                  << (memory - empty_memory) / 1024.0 << " KB/state\n";
+    }
+
+    // 3. Same plan, one VM per worker thread
+    {
+        const int per_worker = std::max(1, states / std::max(1, workers));
+        start = Clock::now();
+        std::vector<std::thread> threads;
+        for (int w = 0; w < workers; ++w) {
+            threads.emplace_back([plan, per_worker] {
+                for (int i = 0; i < per_worker; ++i) {
+                    sol::state lua;
+                    lua.open_libraries(sol::lib::base);
+                    plan->apply(lua);
+                    lua.script("local p = Person.new(\"Bob\", 42, 1.8) p.age = p.age + 1");
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        auto elapsed = microseconds(Clock::now() - start);
+        std::cout << "LuaBindingPlan on " << workers << " threads: "
+                  << elapsed / (per_worker * workers) << " us/state (wall clock)\n";
+    }
+
+    return 0;
+}
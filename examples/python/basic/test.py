@@ -1,3 +1,4 @@
+import pickle
 import pyrosetta as rosetta
 
 # Create objects using constructors
@@ -38,4 +39,7 @@ print("Person as JSON:", person.to_json())
 # Module utilities
 print("Available classes:", rosetta.get_all_classes())
 default_person = rosetta.create_person()
-default_vehicle = rosetta.create_vehicle()
\ No newline at end of file
+default_vehicle = rosetta.create_vehicle()
+# Pickle support (also used by multiprocessing and the copy module)
+clone = pickle.loads(pickle.dumps(person, protocol=5))
+print("Unpickled person:", clone.name, clone.age)
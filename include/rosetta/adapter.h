@@ -63,11 +63,11 @@ namespace rosetta {
         // Manual implementation instead of INTROSPECTABLE macro
         static rosetta::TypeInfo &getStaticTypeInfoImpl() {
             static rosetta::TypeInfo info(TypeNameTrait<OriginalType>::name);
-            static bool              initialized = false;
-            if (!initialized) {
+            static const bool        initialized = [] {
                 registerIntrospection(rosetta::TypeRegistrar<Adapter<OriginalType>>(info));
-                initialized = true;
-            }
+                return true;
+            }();
+            (void)initialized;
             return info;
         }
 
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <ranges>
+#include <rosetta/arrow_traits.h>
+#include <rosetta/query.h>
+#include <rosetta/table.h>
+#include <type_traits>
+#include <vector>
+
+namespace rosetta {
+
+    namespace detail {
+
+        template <typename Element, bool Indirect = is_query_indirect_v<Element>>
+        struct ArrowObject {
+            using type = Element;
+        };
+        template <typename Element> struct ArrowObject<Element, true> {
+            using type = std::remove_cvref_t<decltype(*std::declval<Element>())>;
+        };
+
+        // T of a range of T or of pointers to T
+        template <typename R>
+        using arrow_object_t =
+            typename ArrowObject<std::remove_cvref_t<std::ranges::range_value_t<R>>>::type;
+
+        template <typename R>
+        concept ArrowObjectRange =
+            std::ranges::input_range<R> && IntrospectableClass<arrow_object_t<R>>;
+
+    } // namespace detail
+
+    /**
+     * @brief Export a table through the Arrow C data interface, as a struct
+     * array whose children are the columns (in registration order) that have an
+     * Arrow type (see ArrowTraits). The caller owns `schema` and `array`, and
+     * releases them with their release callback (consumers such as pyarrow,
+     * polars or DuckDB do it when they import them).
+     *
+     * Numeric columns are shared with the table (no copy) when an `owner` is
+     * given: it is kept alive by the array, and rows must not be added to or
+     * removed from the table while the array is alive. Without owner, and for
+     * the other columns, the values are copied.
+     *
+     * @example
+     * ```cpp
+     * ArrowSchema schema;
+     * ArrowArray  array;
+     * toArrow(objects, &schema, &array);
+     * // ... hand them to an Arrow consumer, or
+     * auto copies = fromArrow<GameObject>(&schema, &array);
+     * array.release(&array);
+     * schema.release(&schema);
+     * ```
+     */
+    template <typename T>
+    void toArrow(const Table<T> &table, ArrowSchema *schema, ArrowArray *array,
+                 std::shared_ptr<const void> owner = {});
+
+    /**
+     * @brief Export (copy) a range of objects or of pointers to objects, as a
+     * struct array of their members
+     */
+    template <detail::ArrowObjectRange R>
+    void toArrow(R &&objects, ArrowSchema *schema, ArrowArray *array);
+
+    /**
+     * @brief Objects from an Arrow struct array (children are matched to the
+     * members by name, null rows are default objects). The array is not
+     * released.
+     * @throws std::runtime_error if the array is not a struct, or a child cannot
+     * be converted to its member
+     */
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    std::vector<T> fromArrow(const ArrowSchema *schema, const ArrowArray *array);
+
+    /**
+     * @brief Append the rows of an Arrow struct array to a table, column by
+     * column (see fromArrow)
+     */
+    template <typename T>
+    void appendFromArrow(Table<T> &table, const ArrowSchema *schema, const ArrowArray *array);
+
+    /**
+     * @brief Export a table as an Arrow C stream of a single batch (see toArrow)
+     */
+    template <typename T>
+    void toArrowStream(const Table<T> &table, ArrowArrayStream *stream,
+                       std::shared_ptr<const void> owner = {});
+
+    /**
+     * @brief Append all the batches of an Arrow C stream to a table, then
+     * release the stream
+     * @throws std::runtime_error if the stream reports an error
+     */
+    template <typename T> void appendFromArrowStream(Table<T> &table, ArrowArrayStream *stream);
+
+} // namespace rosetta
+
+#include "inline/arrow.hxx"
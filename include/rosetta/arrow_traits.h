@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <rosetta/binary.h>
+#include <rosetta/info.h>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// Arrow C data interface (https://arrow.apache.org/docs/format/CDataInterface.html),
+// declared as in the specification so that other Arrow headers can be mixed in
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+    // Array type description
+    const char *format;
+    const char *name;
+    const char *metadata;
+    int64_t     flags;
+    int64_t     n_children;
+    struct ArrowSchema **children;
+    struct ArrowSchema  *dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowSchema *);
+    // Opaque producer-specific data
+    void *private_data;
+};
+
+struct ArrowArray {
+    // Array data description
+    int64_t      length;
+    int64_t      null_count;
+    int64_t      offset;
+    int64_t      n_buffers;
+    int64_t      n_children;
+    const void **buffers;
+    struct ArrowArray **children;
+    struct ArrowArray  *dictionary;
+
+    // Release callback
+    void (*release)(struct ArrowArray *);
+    // Opaque producer-specific data
+    void *private_data;
+};
+
+#endif // ARROW_C_DATA_INTERFACE
+
+#ifndef ARROW_C_STREAM_INTERFACE
+#define ARROW_C_STREAM_INTERFACE
+
+struct ArrowArrayStream {
+    // Callbacks providing stream functionality
+    int (*get_schema)(struct ArrowArrayStream *, struct ArrowSchema *out);
+    int (*get_next)(struct ArrowArrayStream *, struct ArrowArray *out);
+    const char *(*get_last_error)(struct ArrowArrayStream *);
+
+    // Release callback
+    void (*release)(struct ArrowArrayStream *);
+    // Opaque producer-specific data
+    void *private_data;
+};
+
+#endif // ARROW_C_STREAM_INTERFACE
+
+namespace rosetta {
+
+    namespace detail {
+
+        // Memory behind an exported ArrowSchema (its private_data)
+        struct ArrowSchemaData {
+            std::string                               format;
+            std::string                               name;
+            std::vector<std::unique_ptr<ArrowSchema>> children;
+            std::vector<ArrowSchema *>                child_pointers;
+        };
+
+        // Memory behind an exported ArrowArray (its private_data)
+        struct ArrowArrayData {
+            std::vector<std::vector<std::uint8_t>>   owned; // buffers allocated by the export
+            std::vector<const void *>                buffers;
+            std::vector<std::unique_ptr<ArrowArray>> children;
+            std::vector<ArrowArray *>                child_pointers;
+            std::shared_ptr<const void>              keep_alive; // owner of shared buffers
+        };
+
+        ArrowSchemaData &initArrowSchema(ArrowSchema &schema, std::string format,
+                                         std::string_view name, std::size_t children);
+        ArrowArrayData  &initArrowArray(ArrowArray &array, std::size_t length,
+                                        std::size_t buffers, std::size_t children);
+
+        /**
+         * @brief Zeroed buffer owned by the array, set as its buffer `index`
+         */
+        void *allocateArrowBuffer(ArrowArrayData &data, std::size_t index, std::size_t bytes);
+
+        /**
+         * @brief Is the element at `index` (offset included) not null?
+         */
+        bool arrowIsValid(const ArrowArray &array, std::int64_t index);
+
+        /**
+         * @brief Deep copy of a schema exported by rosetta (e.g. for streams)
+         */
+        void copyArrowSchema(const ArrowSchema &source, ArrowSchema &copy);
+
+    } // namespace detail
+
+    /**
+     * @brief Arrow C data interface codec of a C++ type, selected at compile
+     * time (see JsonTraits). Specializations provide
+     *
+     * - `exportValues(values, count, name, schema, array)`: fill an Arrow
+     *   column with the `count` values at the addresses `values[i]`;
+     * - `importValues(schema, array, first, count, values)`: read the elements
+     *   [first, first + count) of a column (array offset excluded) into the
+     *   values at `values[i]` (nullptr addresses and null elements are skipped).
+     *
+     * Supported: arithmetic types and enums (Arrow integers and floats, any of
+     * them on import), bool (bit-packed), std::string (utf8 or large_utf8),
+     * std::vector (list or large_list) and std::array (fixed_size_list) of
+     * supported types, and introspectable classes (struct of their supported
+     * members).
+     */
+    template <typename T> struct ArrowTraits {
+        static constexpr bool supported = false;
+    };
+
+    template <typename T>
+    inline constexpr bool is_arrow_exportable_v = ArrowTraits<std::remove_cv_t<T>>::supported;
+
+    /**
+     * @brief Export objects as an Arrow struct column of their members (those
+     * whose type has no Arrow equivalent are skipped)
+     */
+    void exportObjectsArrow(const TypeInfo &type_info, const void *const *objects,
+                            std::size_t count, std::string_view name, ArrowSchema &schema,
+                            ArrowArray &array);
+
+    /**
+     * @brief Read an Arrow struct column into objects: children are matched to
+     * members by name, unknown children are skipped and missing members keep
+     * their value
+     * @throws std::runtime_error if the column is not a struct, or a child
+     * cannot be converted to its member
+     */
+    void importObjectsArrow(const TypeInfo &type_info, const ArrowSchema &schema,
+                            const ArrowArray &array, std::int64_t first, std::size_t count,
+                            void *const *objects);
+
+} // namespace rosetta
+
+#include "inline/arrow_traits.hxx"
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <rosetta/enum_registry.h>
+#include <rosetta/info.h>
+#include <rosetta/observable.h>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace rosetta {
+
+    /**
+     * @brief Appends little-endian binary data to a byte buffer.
+     *
+     * Large contiguous blocks (numeric vectors) can be handed to an optional
+     * out-of-band sink instead of being copied into the buffer (e.g. pickle
+     * protocol 5 buffers): only a marker is written in that case.
+     */
+    class BinaryWriter {
+    public:
+        /**
+         * @brief Called for each contiguous block. Return true to take the block
+         * out of band, false to have it copied inline.
+         */
+        using OutOfBandSink = std::function<bool(const void *data, std::size_t bytes)>;
+
+        explicit BinaryWriter(std::vector<std::uint8_t> &buffer, OutOfBandSink sink = nullptr);
+
+        /**
+         * @brief Write an arithmetic (or enum) value with a fixed width
+         */
+        template <typename T> void write(T value);
+
+        void writeBytes(const void *data, std::size_t bytes);
+        void writeString(const std::string &value);
+
+        /**
+         * @brief Write `count` contiguous elements, possibly out of band
+         */
+        template <typename T> void writeArray(const T *data, std::size_t count);
+
+        std::vector<std::uint8_t> &buffer();
+
+    private:
+        std::vector<std::uint8_t> &buffer_;
+        OutOfBandSink              sink_;
+    };
+
+    /**
+     * @brief Reads data written by BinaryWriter
+     */
+    class BinaryReader {
+    public:
+        /**
+         * @brief Returns the next out-of-band block, which must be `bytes` long
+         */
+        using OutOfBandSource = std::function<const void *(std::size_t bytes)>;
+
+        BinaryReader(const void *data, std::size_t size, OutOfBandSource source = nullptr);
+
+        template <typename T> T read();
+
+        void        readBytes(void *out, std::size_t bytes);
+        std::string readString();
+
+        /**
+         * @brief Read `count` contiguous elements written by writeArray
+         */
+        template <typename T> void readArray(T *out, std::size_t count);
+
+        /**
+         * @brief Same, resizing `out` once the block is known to hold `count`
+         * elements (a corrupt count throws instead of allocating)
+         */
+        template <typename T> void readArray(std::vector<T> &out, std::uint64_t count);
+
+        std::size_t remaining() const;
+        bool        atEnd() const;
+
+    private:
+        const std::uint8_t *data_;
+        std::size_t         size_;
+        std::size_t         pos_ = 0;
+        OutOfBandSource     source_;
+    };
+
+    /**
+     * @brief Binary codec of a C++ type, selected at compile time.
+     * Specializations provide `encode(BinaryWriter&, const T&)` and
+     * `decode(BinaryReader&, T&)`. Supported: arithmetic types, enums (values
+     * checked against the EnumRegistry when decoding), std::string, introspectable
+     * classes (nested encodeObject), trivially copyable classes opted in with
+     * BinaryRaw (raw bytes), std::vector and std::array of supported types.
+     */
+    template <typename T> struct BinaryTraits {
+        static constexpr bool supported = false;
+    };
+
+    /**
+     * @brief Opt-in raw encoding of a trivially copyable class without a
+     * TypeInfo: its object representation is written as is (same ABI on both
+     * ends), e.g. struct Vec3 { double x, y, z; }. Not for classes holding
+     * pointers or views (std::string_view, std::span...): their addresses
+     * would be written. See REGISTER_BINARY_RAW.
+     */
+    template <typename T> struct BinaryRaw : std::false_type {};
+
+    template <typename T>
+    inline constexpr bool is_binary_serializable_v = BinaryTraits<std::remove_cv_t<T>>::supported;
+
+    /**
+     * @brief Version of the layout written by writeBinaryHeader/encodeObject
+     */
+    inline constexpr std::uint16_t binary_format_version = 1;
+
+    /**
+     * @brief Fingerprint of the serialized layout of a type (class name, member
+     * names and types, in registration order)
+     */
+    std::uint64_t binarySchemaHash(const TypeInfo &type_info);
+
+    /**
+     * @brief Write the header of a standalone encoding: magic "RSTB", format
+     * version, schema hash
+     */
+    void writeBinaryHeader(const TypeInfo &type_info, BinaryWriter &writer);
+
+    /**
+     * @brief Check a header written by writeBinaryHeader
+     * @throws std::runtime_error if it is not rosetta binary data, or if it was
+     * written by another format version or for another schema
+     */
+    void readBinaryHeader(const TypeInfo &type_info, BinaryReader &reader);
+
+    /**
+     * @brief Encode all the members of `obj` (in registration order). Runs of
+     * adjacent members whose encoding is their memory representation (see
+     * MemberInfo::binary_raw) are copied with a single memcpy.
+     * @throws std::runtime_error if a member type has no binary codec
+     */
+    void encodeObject(const TypeInfo &type_info, const void *obj, BinaryWriter &writer);
+
+    /**
+     * @brief Decode members written by encodeObject into `obj`
+     */
+    void decodeObject(const TypeInfo &type_info, void *obj, BinaryReader &reader);
+
+    /**
+     * @brief True if all the members of the type can be (de)serialized
+     */
+    bool isBinarySerializable(const TypeInfo &type_info);
+
+} // namespace rosetta
+
+/**
+ * @brief Encode a trivially copyable class as raw bytes (see BinaryRaw), at
+ * global scope.
+ * Usage: REGISTER_BINARY_RAW(Vector3D);
+ */
+#define REGISTER_BINARY_RAW(TypeName)                                                             \
+    template <> struct rosetta::BinaryRaw<TypeName> : std::true_type {                             \
+        static_assert(std::is_trivially_copyable_v<TypeName>,                                      \
+                      "Only trivially copyable classes can be encoded as raw bytes");              \
+    }
+
+#include "inline/binary.hxx"
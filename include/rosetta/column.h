@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <rosetta/info.h>
+#include <type_traits>
+#include <typeindex>
+#include <vector>
+
+namespace rosetta {
+
+    // Declared in types.h
+    enum class NumericType : unsigned char;
+    template <typename T> constexpr NumericType numericTypeOf();
+
+    // The numeric type traits live here rather than in types.h (which includes
+    // this header), as the columns need them
+
+    /**
+     * @brief True for the arithmetic types that have a NumericType (i.e. not bool)
+     */
+    template <typename T>
+    inline constexpr bool is_numeric_v =
+        std::is_arithmetic_v<T> && !std::is_same_v<std::remove_cv_t<T>, bool>;
+
+    /**
+     * @brief True for the types that have a NumericType, hence a vectorized or
+     * column path: is_numeric_v without long double
+     */
+    template <typename T>
+    inline constexpr bool is_vectorizable_v =
+        is_numeric_v<T> && !std::is_same_v<std::remove_cv_t<T>, long double>;
+
+    /**
+     * @brief Contiguous storage of the values of one member for a set of rows
+     * (see Table). Created from MemberInfo::make_column.
+     */
+    class ColumnStorage {
+    public:
+        virtual ~ColumnStorage() = default;
+
+        virtual std::type_index elementType() const       = 0;
+        virtual std::size_t     size() const              = 0;
+        virtual void            reserve(std::size_t rows) = 0;
+        virtual void            clear()                   = 0;
+        virtual void            erase(std::size_t row)    = 0;
+
+        /**
+         * @brief Element type of the columns of numbers (not bool), e.g. for
+         * TypedArrays or NumPy arrays
+         */
+        virtual std::optional<NumericType> numericType() const = 0;
+
+        /**
+         * @brief Append the member of `obj` (an instance of the registered class)
+         */
+        virtual void pushFrom(const void *obj) = 0;
+        /**
+         * @brief Overwrite a row with the member of `obj`
+         */
+        virtual void storeFrom(std::size_t row, const void *obj) = 0;
+        /**
+         * @brief Copy a row into the member of `obj`
+         */
+        virtual void loadInto(std::size_t row, void *obj) const = 0;
+
+        virtual Arg  get(std::size_t row) const             = 0;
+        virtual void set(std::size_t row, const Arg &value) = 0;
+
+        /**
+         * @brief Address of the first element (elements are contiguous)
+         */
+        virtual void       *data()       = 0;
+        virtual const void *data() const = 0;
+
+        virtual std::unique_ptr<ColumnStorage> clone() const = 0;
+    };
+
+    namespace detail {
+
+        // Elements of bool columns (std::vector<bool> is not contiguous)
+        struct BoolCell {
+            bool value = false;
+        };
+
+        template <typename M>
+        using column_cell_t = std::conditional_t<std::is_same_v<M, bool>, BoolCell, M>;
+
+    } // namespace detail
+
+    /**
+     * @brief Column of a `M Class::*` member, stored in a std::vector
+     */
+    template <typename Class, typename M> class TypedColumn final : public ColumnStorage {
+    public:
+        explicit TypedColumn(M Class::*member);
+
+        std::type_index elementType() const override { return typeid(M); }
+        std::size_t     size() const override { return values_.size(); }
+        void            reserve(std::size_t rows) override { values_.reserve(rows); }
+        void            clear() override { values_.clear(); }
+        void            erase(std::size_t row) override;
+
+        std::optional<NumericType> numericType() const override;
+
+        void pushFrom(const void *obj) override;
+        void storeFrom(std::size_t row, const void *obj) override;
+        void loadInto(std::size_t row, void *obj) const override;
+
+        Arg  get(std::size_t row) const override;
+        void set(std::size_t row, const Arg &value) override;
+
+        void       *data() override { return values_.data(); }
+        const void *data() const override { return values_.data(); }
+
+        std::unique_ptr<ColumnStorage> clone() const override;
+
+    private:
+        using Cell = detail::column_cell_t<M>;
+
+        static const M &value(const Cell &cell);
+        static M       &value(Cell &cell);
+
+        M Class::*       member_;
+        std::vector<Cell> values_;
+    };
+
+} // namespace rosetta
+
+#include "inline/column.hxx"
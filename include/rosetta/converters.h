@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <any>
+#include <cstddef>
+#include <rosetta/enum_registry.h>
+#include <rosetta/introspectable.h>
+#include <rosetta/types.h>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+namespace rosetta {
+
+    /**
+     * @brief How a C++ type is represented in the scripting languages.
+     *
+     * The generators (JS, Python, Lua) implement their conversions per kind
+     * (see ScriptConverter), so a type classified here is handled the same way
+     * by every generator, and an optimization of a kind (buffers, enums...)
+     * is written once per generator instead of once per type.
+     */
+    enum class ValueKind : unsigned char {
+        Bool,
+        Integer,  // signed integral types
+        Unsigned, // unsigned integral types
+        Float,
+        String,
+        Enum,          // enums registered in the EnumRegistry
+        NumericVector, // std::vector of arithmetic types (bool excluded)
+        Vector,        // std::vector of any other convertible type
+        Object,        // Introspectable classes (bound by the generators)
+        Other
+    };
+
+    template <typename T> constexpr ValueKind valueKindOf();
+
+    /**
+     * @brief Conversion of T for one generator (`Backend`).
+     *
+     * Each generator defines a backend type with:
+     * - `Value`: its script value type, `Input`: how it receives one
+     * - `Context` (optional): what it needs to create a value
+     * - `ToScript` / `FromScript`: the matching type-erased function pointers
+     *
+     * and specializes ScriptConverter<Backend, T, Kind> for each kind it
+     * supports, providing `static Value to([Context,] const T &)` and
+     * `static T from(Input)`. The primary template is empty: T is then not
+     * convertible by this backend.
+     */
+    template <typename Backend, typename T, ValueKind Kind = valueKindOf<T>()>
+    struct ScriptConverter {};
+
+    template <typename Backend, typename T>
+    inline constexpr bool has_script_converter_v =
+        requires { &ScriptConverter<Backend, T>::from; };
+
+    /**
+     * @brief Type-erased conversions of one C++ type (held in a std::any), as
+     * plain function pointers: registering a type resolves them once, calling
+     * them involves no lookup.
+     */
+    template <typename Backend> struct ConverterEntry {
+        typename Backend::ToScript   to_script   = nullptr;
+        typename Backend::FromScript from_script = nullptr;
+        ValueKind                    kind        = ValueKind::Other;
+        const std::type_info        *type        = nullptr; // the C++ type converted
+    };
+
+    /**
+     * @brief The (static) conversion entry of T for a backend
+     */
+    template <typename Backend, typename T> const ConverterEntry<Backend> &converterFor();
+
+    template <typename... Ts> struct value_type_list {};
+
+    /**
+     * @brief Types every generator converts out of the box
+     */
+    using BuiltinValueTypes =
+        value_type_list<bool, char, unsigned char, short, unsigned short, int, unsigned int, long,
+                        long long, std::size_t, float, double, std::string, std::vector<int>,
+                        std::vector<unsigned int>, std::vector<long>, std::vector<std::size_t>,
+                        std::vector<float>, std::vector<double>, std::vector<bool>,
+                        std::vector<std::string>>;
+
+    /**
+     * @brief Call `add(type_name, entry)` for each built-in type convertible by
+     * `Backend`, with `type_name` the rosetta name of the type (getTypeName)
+     */
+    template <typename Backend, typename Add> void forEachBuiltinConverter(Add &&add);
+
+} // namespace rosetta
+
+#include "inline/converters.hxx"
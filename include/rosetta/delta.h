@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <rosetta/binary.h>
+#include <rosetta/observable.h>
+#include <rosetta/types.h>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace rosetta {
+
+    /**
+     * @brief Dirty bits of an object, one per member slot (the position of the
+     * member in TypeInfo::getMembersInOrder())
+     */
+    class DirtyBits {
+    public:
+        void set(std::size_t slot);
+        void reset(std::size_t slot);
+        bool test(std::size_t slot) const;
+        bool any() const;
+        void clear();
+
+        /**
+         * @brief Slots of the set bits, in increasing order
+         */
+        std::vector<std::size_t> slots() const;
+
+    private:
+        std::vector<std::uint64_t> words_;
+    };
+
+    /**
+     * @brief Encode the members of the given slots of `obj`: a header (magic
+     * "RSTD", format version, schema hash, see binary.h), the number of
+     * members, then each slot followed by the binary encoding of its member.
+     * Appends to the writer.
+     * @throws std::runtime_error if a member is not binary serializable
+     * (checked before anything is written)
+     */
+    void encodeDelta(const TypeInfo &type_info, const void *obj,
+                     const std::vector<std::size_t> &slots, BinaryWriter &writer);
+
+    /**
+     * @brief Decode the deltas written by encodeDelta into `obj`: one, or
+     * several appended to the same buffer (applied in order). The members
+     * written are reported to the member observers of the type (indexes,
+     * trackers) and to the property subscribers of the object, as if set
+     * through the reflection layer. An empty buffer has no effect.
+     *
+     * Applying is atomic: the value of each member is saved before it is
+     * decoded, and on error the members already written are set back to it
+     * (through their setters, hence reported again) before rethrowing.
+     * @throws std::runtime_error if the data was written for another layout of
+     * the type, or is truncated
+     */
+    void applyDelta(const TypeInfo &type_info, void *obj, const void *data, std::size_t size);
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    void applyDelta(T &object, const std::vector<std::uint8_t> &delta);
+
+    /**
+     * @brief Opt-in dirty tracking of objects of a registered class, to send
+     * only the members that changed (e.g. each frame, to script mirrors or to
+     * another process).
+     *
+     * Tracked objects start clean. A member becomes dirty when it is set
+     * through the reflection layer (setMemberValue, the binding properties,
+     * applyDelta) or marked with markDirty() after a direct write in C++.
+     * collectDelta() encodes the dirty members of an object and cleans it.
+     * Dirty bits are per top-level member: a change inside a nested object is
+     * marked on the member holding it.
+     *
+     * Like Index, the tracker refers to the objects: they must stay at the same
+     * address while tracked, and be untracked before being destroyed. It is not
+     * synchronized.
+     *
+     * @example
+     * ```cpp
+     * DirtyTracker<GameObject> tracker;
+     * tracker.track(player);
+     * player.setMemberValue("health", 50.0f); // dirty
+     * player.move({1, 0, 0});
+     * tracker.markDirty(player, "position");  // written directly
+     * for (const GameObject *object : tracker.dirtyObjects()) {
+     *     send(tracker.collectDelta(*object)); // health and position only
+     * }
+     * // on the other side
+     * applyDelta(mirror, received);
+     * ```
+     */
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    class DirtyTracker {
+    public:
+        DirtyTracker();
+        ~DirtyTracker();
+
+        // The tracker is registered by address with the TypeInfo
+        DirtyTracker(const DirtyTracker &)            = delete;
+        DirtyTracker &operator=(const DirtyTracker &) = delete;
+
+        std::size_t size() const { return objects_.size(); }
+        bool        isTracked(const T &object) const { return objects_.contains(&object); }
+
+        /**
+         * @brief Start tracking an object, clean (no effect if already tracked)
+         */
+        void track(const T &object);
+        void untrack(const T &object);
+        void clear(); // untrack all
+
+        /**
+         * @brief Mark a member of a tracked object as changed (no effect if the
+         * object is not tracked)
+         * @throws std::runtime_error if there is no such member
+         */
+        void markDirty(const T &object, std::string_view member);
+        void markAllDirty(const T &object);
+
+        bool isDirty(const T &object) const;
+        bool isDirty(const T &object, std::string_view member) const;
+
+        /**
+         * @brief Names of the dirty members of an object, in registration order
+         */
+        std::vector<std::string> dirtyMembers(const T &object) const;
+
+        /**
+         * @brief Tracked objects having dirty members
+         */
+        std::vector<const T *> dirtyObjects() const;
+
+        /**
+         * @brief Forget the changes of an object without encoding them
+         */
+        void clean(const T &object);
+
+        /**
+         * @brief Encode the dirty members of an object (see encodeDelta) and
+         * clean it. Returns an empty buffer if nothing changed.
+         * @throws std::runtime_error if a dirty member is not binary serializable
+         */
+        std::vector<std::uint8_t> collectDelta(const T &object);
+
+        /**
+         * @brief Same, appending to `buffer` (left as it was if it throws)
+         * @return false (nothing written) if nothing changed
+         */
+        bool collectDelta(const T &object, std::vector<std::uint8_t> &buffer);
+
+        const TypeInfo &getTypeInfo() const { return T::getStaticTypeInfo(); }
+
+    private:
+        std::size_t slotOf(std::string_view member) const;
+        void        memberChanged(void *object, const MemberInfo &member);
+
+        std::unordered_map<const MemberInfo *, std::size_t> slots_;
+        std::unordered_map<const T *, DirtyBits>            objects_; // tracked objects
+        std::size_t                                         observer_ = 0;
+    };
+
+} // namespace rosetta
+
+#include "inline/delta.hxx"
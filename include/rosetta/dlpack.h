@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <rosetta/binary.h>
+#include <rosetta/info.h>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+// DLPack (https://github.com/dmlc/dlpack), declared as in its dlpack.h (ABI
+// version 1) so that the real header can be included instead
+#ifndef DLPACK_DLPACK_H_
+#define DLPACK_DLPACK_H_
+
+#define DLPACK_VERSION 80
+#define DLPACK_ABI_VERSION 1
+
+extern "C" {
+
+typedef enum {
+    kDLCPU         = 1,
+    kDLCUDA        = 2,
+    kDLCUDAHost    = 3,
+    kDLOpenCL      = 4,
+    kDLVulkan      = 7,
+    kDLMetal       = 8,
+    kDLVPI         = 9,
+    kDLROCM        = 10,
+    kDLROCMHost    = 11,
+    kDLExtDev      = 12,
+    kDLCUDAManaged = 13,
+    kDLOneAPI      = 14,
+    kDLWebGPU      = 15,
+    kDLHexagon     = 16,
+} DLDeviceType;
+
+typedef struct {
+    DLDeviceType device_type;
+    int32_t      device_id;
+} DLDevice;
+
+typedef enum {
+    kDLInt          = 0U,
+    kDLUInt         = 1U,
+    kDLFloat        = 2U,
+    kDLOpaqueHandle = 3U,
+    kDLBfloat       = 4U,
+    kDLComplex      = 5U,
+    kDLBool         = 6U,
+} DLDataTypeCode;
+
+typedef struct {
+    uint8_t  code;
+    uint8_t  bits;
+    uint16_t lanes;
+} DLDataType;
+
+typedef struct {
+    void      *data;
+    DLDevice   device;
+    int32_t    ndim;
+    DLDataType dtype;
+    int64_t   *shape;
+    int64_t   *strides; // NULL for compact row-major tensors
+    uint64_t   byte_offset;
+} DLTensor;
+
+typedef struct DLManagedTensor {
+    DLTensor dl_tensor;
+    void    *manager_ctx;
+    void (*deleter)(struct DLManagedTensor *self);
+} DLManagedTensor;
+
+} // extern "C"
+
+#endif // DLPACK_DLPACK_H_
+
+namespace rosetta {
+
+    /**
+     * @brief Contiguous numbers stored in a member
+     */
+    struct DLPackBuffer {
+        void        *data   = nullptr;
+        std::int64_t length = 0;
+        DLDataType   dtype{};
+    };
+
+    /**
+     * @brief DLPack view of a C++ type, selected at compile time (see
+     * ArrowTraits). Supported: std::vector and std::array of arithmetic types
+     * (not bool, nor long double). Specializations provide
+     * `buffer(void *value) -> DLPackBuffer`.
+     */
+    template <typename T> struct DLPackTraits {
+        static constexpr bool supported = false;
+    };
+
+    template <typename T>
+    inline constexpr bool is_dlpack_exportable_v = DLPackTraits<std::remove_cv_t<T>>::supported;
+
+    /**
+     * @brief DLPack data type of an arithmetic type
+     */
+    template <typename E> constexpr DLDataType dlpackDataType();
+
+    /**
+     * @brief Export a numeric vector or array member of an object as a 1-D CPU
+     * tensor sharing the member storage (no copy), e.g. for NumPy, PyTorch or
+     * JAX. The tensor keeps `owner` alive until its consumer calls its deleter;
+     * the member must not be resized meanwhile.
+     * @throws std::runtime_error if there is no such member, or its type has no
+     * DLPack equivalent
+     */
+    DLManagedTensor *toDLPack(const TypeInfo &type_info, void *object, std::string_view member,
+                              std::shared_ptr<const void> owner = {});
+
+    /**
+     * @brief toDLPack() of an object that outlives the tensor
+     * @example
+     * ```cpp
+     * DLManagedTensor *tensor = toDLPack(mesh, "weights");
+     * // ... hand it to a consumer, which calls tensor->deleter(tensor)
+     * ```
+     */
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    DLManagedTensor *toDLPack(T &object, std::string_view member);
+
+    /**
+     * @brief toDLPack() tied to the lifetime of a shared object
+     */
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    DLManagedTensor *toDLPack(std::shared_ptr<T> object, std::string_view member);
+
+} // namespace rosetta
+
+#include "inline/dlpack.hxx"
@@ -3,7 +3,11 @@
  * LGPL v3 license
  */
 #pragma once
+#include <cstdint>
+#include <shared_mutex>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <typeindex>
 #include <unordered_map>
@@ -23,51 +27,86 @@ namespace rosetta {
 
     /**
      * @brief Information about an enum type
+     *
+     * Lookups are O(1) and allocation free:
+     * - by value, a dense table indexed by `value - min` when the values are
+     *   (nearly) contiguous, a sorted table otherwise;
+     * - by name, a perfect hash table (hash and displace), rebuilt when a value
+     *   is added, so a lookup hashes the name once and compares one string.
+     *
+     * Flag enums (setFlags) accept any combination of their values, and names
+     * such as "Read|Write".
      */
     class EnumInfo {
     public:
-        std::string                              name;
-        std::vector<EnumValueInfo>               values;
-        std::unordered_map<std::string, int64_t> name_to_value;
-        std::unordered_map<int64_t, std::string> value_to_name;
+        std::string                name;
+        std::vector<EnumValueInfo> values;
 
         explicit EnumInfo(const std::string &enum_name) : name(enum_name) {}
 
-        void addValue(const std::string &value_name, int64_t value) {
-            values.emplace_back(value_name, value);
-            name_to_value[value_name] = value;
-            value_to_name[value]      = value_name;
-        }
-
-        bool hasValue(const std::string &value_name) const {
-            return name_to_value.find(value_name) != name_to_value.end();
-        }
+        void addValue(const std::string &value_name, int64_t value);
+
+        /**
+         * @brief Mark the enum as a set of bit flags
+         */
+        void setFlags(bool flags);
+        bool isFlags() const { return flags_; }
+
+        bool hasValue(std::string_view value_name) const;
+        bool hasValue(int64_t value) const;
+
+        /**
+         * @brief The value of a name ("A|B" for flags)
+         * @throws std::runtime_error if a name is unknown
+         */
+        int64_t getValue(std::string_view value_name) const;
+
+        /**
+         * @brief The name of a declared value
+         * @throws std::runtime_error if the value is not declared
+         */
+        const std::string &getName(int64_t value) const;
+
+        /**
+         * @brief The name of a value, "A|B" for a combination of flags ("0" if no
+         * flag is set and 0 is not declared)
+         */
+        std::string format(int64_t value) const;
+
+        /**
+         * @brief Non-throwing lookups (nullptr if not found)
+         */
+        const EnumValueInfo *findValue(std::string_view value_name) const;
+        const EnumValueInfo *findName(int64_t value) const;
 
-        bool hasValue(int64_t value) const {
-            return value_to_name.find(value) != value_to_name.end();
-        }
-
-        int64_t getValue(const std::string &value_name) const {
-            auto it = name_to_value.find(value_name);
-            if (it != name_to_value.end()) {
-                return it->second;
-            }
-            throw std::runtime_error("Enum value '" + value_name + "' not found in enum '" + name +
-                                     "'");
-        }
-
-        std::string getName(int64_t value) const {
-            auto it = value_to_name.find(value);
-            if (it != value_to_name.end()) {
-                return it->second;
-            }
-            throw std::runtime_error("Enum value " + std::to_string(value) +
-                                     " not found in enum '" + name + "'");
-        }
+    private:
+        void   indexValue(size_t index);
+        void   rebuildValueTable();
+        void   indexName(size_t index);
+        void   rebuildNameTable();
+        bool   placeBucket(size_t bucket);
+        size_t nameSlot(uint32_t index, uint32_t seed) const;
+
+        bool    flags_    = false;
+        int64_t all_bits_ = 0; // union of the values (flags)
+
+        // By value: dense_[value - min_value_] or sorted_ (index in `values`, -1 if none)
+        int64_t                                  min_value_ = 0;
+        std::vector<int32_t>                     dense_;
+        std::vector<std::pair<int64_t, int32_t>> sorted_;
+
+        // By name: slot = hash(name, seeds_[bucket]) & slot_mask, with
+        // bucket = hash(name, 0) & bucket_mask
+        std::vector<uint64_t>              hashes_; // of the names, by index
+        std::vector<std::vector<uint32_t>> buckets_;
+        std::vector<uint32_t>              seeds_;
+        std::vector<int32_t>               slots_;
     };
 
     /**
-     * @brief Registry for enum types
+     * @brief Registry for enum types. Lookups can run concurrently with each
+     * other and with registrations; the returned EnumInfo must not be read while
+     * values are still being added to it.
      */
     class EnumRegistry {
     public:
@@ -78,6 +117,11 @@ namespace rosetta {
         template <typename EnumType>
         void addEnumValue(const std::string &value_name, EnumType value);
 
+        /**
+         * @brief Declare a registered enum as a set of bit flags
+         */
+        template <typename EnumType> void setFlags(bool flags = true);
+
         template <typename EnumType> const EnumInfo *getEnumInfo() const;
 
         const EnumInfo *getEnumInfo(const std::string &enum_name) const;
@@ -90,6 +134,7 @@ namespace rosetta {
         EnumRegistry() = default;
         std::unordered_map<std::type_index, EnumInfo>    enums_by_type;
         std::unordered_map<std::string, std::type_index> enums_by_name;
+        mutable std::shared_mutex                        mutex;
     };
 
     /**
@@ -107,6 +152,11 @@ namespace rosetta {
             return *this;
         }
 
+        EnumRegistrar &flags() {
+            EnumRegistry::instance().setFlags<EnumType>();
+            return *this;
+        }
+
     private:
         std::string enum_name_;
     };
@@ -138,6 +188,11 @@ namespace rosetta {
 
 #define ENUM_VALUE(ValueName) reg.value(#ValueName, EnumType_t::ValueName);
 
+/**
+ * @brief Declare the enum being registered as bit flags (see ROSETTA_ENUM_FLAGS)
+ */
+#define ENUM_FLAGS() reg.flags();
+
 #define END_ENUM_REGISTRATION() \
     }                           \
     }                           \
@@ -169,6 +224,43 @@ namespace rosetta {
     enum_registrar_instance;          \
     }
 
+/**
+ * @brief Bitwise operators for a flag enum class, to be used at namespace scope
+ * next to the enum
+ *
+ * Usage:
+ * enum class Access { None = 0, Read = 1, Write = 2, Exec = 4 };
+ * ROSETTA_ENUM_FLAGS(Access)
+ * BEGIN_ENUM_REGISTRATION(Access)
+ *     ENUM_FLAGS()
+ *     ENUM_VALUE(None)
+ *     ENUM_VALUE(Read)
+ *     ENUM_VALUE(Write)
+ *     ENUM_VALUE(Exec)
+ * END_ENUM_REGISTRATION()
+ */
+#define ROSETTA_ENUM_FLAGS(EnumType)                                              \
+    constexpr EnumType operator|(EnumType a, EnumType b) {                        \
+        using U = std::underlying_type_t<EnumType>;                               \
+        return static_cast<EnumType>(static_cast<U>(a) | static_cast<U>(b));      \
+    }                                                                             \
+    constexpr EnumType operator&(EnumType a, EnumType b) {                        \
+        using U = std::underlying_type_t<EnumType>;                               \
+        return static_cast<EnumType>(static_cast<U>(a) & static_cast<U>(b));      \
+    }                                                                             \
+    constexpr EnumType operator^(EnumType a, EnumType b) {                        \
+        using U = std::underlying_type_t<EnumType>;                               \
+        return static_cast<EnumType>(static_cast<U>(a) ^ static_cast<U>(b));      \
+    }                                                                             \
+    constexpr EnumType operator~(EnumType a) {                                    \
+        using U = std::underlying_type_t<EnumType>;                               \
+        return static_cast<EnumType>(~static_cast<U>(a));                         \
+    }                                                                             \
+    constexpr EnumType &operator|=(EnumType &a, EnumType b) { return a = a | b; } \
+    constexpr EnumType &operator&=(EnumType &a, EnumType b) { return a = a & b; } \
+    constexpr EnumType &operator^=(EnumType &a, EnumType b) { return a = a ^ b; } \
+    constexpr bool hasFlag(EnumType value, EnumType flag) { return (value & flag) == flag; }
+
 /**
  * @brief Helper macro for single value registration (internal use)
  */
@@ -21,6 +21,10 @@ namespace rosetta {
         static std::any callFunctionImpl(ReturnType (*func_ptr)(Args...),
                                          const std::vector<std::any> &args,
                                          std::index_sequence<I...>);
+
+        template <std::size_t... I>
+        static void mapFunctionImpl(ReturnType (*func_ptr)(Args...), const void *const *inputs,
+                                    void *output, std::size_t n, std::index_sequence<I...>);
     };
 
 } // namespace rosetta
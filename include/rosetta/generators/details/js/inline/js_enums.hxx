@@ -18,42 +18,13 @@ namespace rosetta {
 
         std::string type_name = enum_info->name;
 
-        // Register bidirectional converters
-        generator.register_type_converter(
-            type_name,
-            // C++ enum → JavaScript number
-            [](Napi::Env env, const std::any &value) -> Napi::Value {
-                try {
-                    EnumType enum_val    = std::any_cast<EnumType>(value);
-                    using UnderlyingType = std::underlying_type_t<EnumType>;
-                    int64_t int_val = static_cast<int64_t>(static_cast<UnderlyingType>(enum_val));
-                    return Napi::Number::New(env, static_cast<double>(int_val));
-                } catch (const std::bad_any_cast &) {
-                    return env.Undefined();
-                }
-            },
-            // JavaScript value → C++ enum
-            [enum_info](const Napi::Value &js_val) -> std::any {
-                int64_t int_val;
-
-                // Accept either number or string
-                if (js_val.IsNumber()) {
-                    int_val = static_cast<int64_t>(js_val.As<Napi::Number>().Int64Value());
-                } else if (js_val.IsString()) {
-                    std::string str_val = js_val.As<Napi::String>().Utf8Value();
-                    int_val             = enum_info->getValue(str_val);
-                } else {
-                    throw std::runtime_error("Expected number or string for enum value");
-                }
-
-                // Validate that value exists
-                if (!enum_info->hasValue(int_val)) {
-                    throw std::runtime_error("Invalid enum value: " + std::to_string(int_val));
-                }
-
-                using UnderlyingType = std::underlying_type_t<EnumType>;
-                return static_cast<EnumType>(static_cast<UnderlyingType>(int_val));
-            });
+        // Numbers or value names, checked against the enum tables (see js_converters.h)
+        const auto &entry = converterFor<JsBackend, EnumType>();
+        generator.register_type_converter(type_name, entry.to_script, entry.from_script);
+        if (type_name != getTypeName<EnumType>()) {
+            generator.register_type_converter(getTypeName<EnumType>(), entry.to_script,
+                                              entry.from_script);
+        }
 
         // Create JavaScript enum object
         auto enum_obj = Napi::Object::New(generator.env);
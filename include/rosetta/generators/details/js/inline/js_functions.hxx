@@ -1,9 +1,260 @@
 #pragma once
+#include "../js_converters.h"
 #include "../js_generator.h"
+#include <algorithm>
 #include <rosetta/function_registry.h>
 
 namespace rosetta {
 
+    namespace detail {
+
+        /**
+         * @brief Read a JS number (or BigInt) as the numeric type T. Integers
+         * are converted by N-API, as in js_converters.h (NaN and infinities
+         * give 0), so that no value is undefined behaviour.
+         * @throws Napi::TypeError if the value is not a number (e.g. an array
+         * hole, undefined or a string)
+         */
+        template <typename T> inline T numericFromJs(const Napi::Value &value) {
+            if (value.IsBigInt()) {
+                bool lossless = false;
+                if constexpr (std::is_signed_v<T>) {
+                    return static_cast<T>(value.As<Napi::BigInt>().Int64Value(&lossless));
+                } else {
+                    return static_cast<T>(value.As<Napi::BigInt>().Uint64Value(&lossless));
+                }
+            }
+            if (!value.IsNumber()) {
+                throw Napi::TypeError::New(value.Env(), "Expected a number or a BigInt");
+            }
+            const auto number = value.As<Napi::Number>();
+            if constexpr (std::is_floating_point_v<T>) {
+                return static_cast<T>(number.DoubleValue());
+            } else if constexpr (sizeof(T) > 4) {
+                return static_cast<T>(number.Int64Value());
+            } else if constexpr (std::is_signed_v<T>) {
+                return static_cast<T>(number.Int32Value());
+            } else {
+                return static_cast<T>(number.Uint32Value());
+            }
+        }
+
+        /**
+         * @brief Create a new TypedArray of `length` elements of the given type
+         * @param data Receives the address of the first element
+         */
+        inline Napi::Value newTypedArray(Napi::Env env, NumericType type, size_t length,
+                                         void **data) {
+            auto       buffer = Napi::ArrayBuffer::New(env, length * numericTypeSize(type));
+            napi_value result;
+            if (napi_create_typedarray(env, toTypedArrayType(type), length, buffer, 0, &result) !=
+                napi_ok) {
+                throw Napi::Error::New(env, "Failed to create typed array");
+            }
+            *data = buffer.Data();
+            return Napi::Value(env, result);
+        }
+
+        /**
+         * @brief Arguments of a vectorized call (fn.map / fn.mapAsync), resolved
+         * to raw contiguous buffers
+         */
+        struct VectorizedCall {
+            std::vector<const void *>          inputs;
+            std::vector<std::vector<uint8_t>>  scratch;    // coerced copies of the inputs
+            std::vector<Napi::ObjectReference> keep_alive; // only filled for async calls
+            Napi::ObjectReference              output_ref; // only filled for async calls
+            Napi::Value                        output;
+            void                              *output_data = nullptr;
+            size_t                             length      = 0;
+        };
+
+        /**
+         * @brief Resolve the arguments of fn.map(a, b, ..., out?).
+         * TypedArrays whose element type matches the parameter are used in place,
+         * other TypedArrays and plain arrays are coerced into a scratch buffer and
+         * numbers are broadcast. The optional trailing `out` must be a TypedArray
+         * of the return type; otherwise a new one is allocated.
+         */
+        inline VectorizedCall prepareVectorizedCall(const Napi::CallbackInfo &info,
+                                                    const FunctionInfo       &func_info,
+                                                    bool                      keep_alive) {
+            auto        env     = info.Env();
+            const auto &invoker = *func_info.vectorized;
+            size_t      arity   = invoker.parameter_types.size();
+
+            if (info.Length() != arity && info.Length() != arity + 1) {
+                throw Napi::TypeError::New(env, func_info.name + ".map expects " +
+                                                    std::to_string(arity) +
+                                                    " arrays (and an optional output), got " +
+                                                    std::to_string(info.Length()) + " arguments");
+            }
+
+            VectorizedCall call;
+            bool           has_length = false;
+            for (size_t i = 0; i < arity; ++i) {
+                if (info[i].IsNumber() || info[i].IsBigInt()) {
+                    continue;
+                }
+                size_t length = 0;
+                if (info[i].IsTypedArray()) {
+                    length = info[i].As<Napi::TypedArray>().ElementLength();
+                } else if (info[i].IsArray()) {
+                    length = info[i].As<Napi::Array>().Length();
+                } else {
+                    throw Napi::TypeError::New(env, "Argument " + std::to_string(i) +
+                                                        " must be a TypedArray, an array or a "
+                                                        "number");
+                }
+                if (has_length && length != call.length) {
+                    throw Napi::RangeError::New(env, "All arrays must have the same length");
+                }
+                call.length = length;
+                has_length  = true;
+            }
+            if (!has_length) {
+                throw Napi::TypeError::New(env, "At least one argument must be an array");
+            }
+
+            call.scratch.reserve(arity);
+            for (size_t i = 0; i < arity; ++i) {
+                NumericType type = invoker.parameter_types[i];
+
+                if (info[i].IsTypedArray()) {
+                    auto array = info[i].As<Napi::TypedArray>();
+                    if (array.TypedArrayType() == toTypedArrayType(type)) {
+                        call.inputs.push_back(typedArrayData(array)); // zero-copy
+                        if (keep_alive) {
+                            call.keep_alive.push_back(Napi::Persistent(array.As<Napi::Object>()));
+                        }
+                        continue;
+                    }
+                }
+
+                auto &buffer = call.scratch.emplace_back(call.length * numericTypeSize(type));
+                visitNumericType(type, [&](auto tag) {
+                    using T    = typename decltype(tag)::type;
+                    auto *data = reinterpret_cast<T *>(buffer.data());
+                    if (info[i].IsNumber() || info[i].IsBigInt()) {
+                        std::fill(data, data + call.length, numericFromJs<T>(info[i]));
+                    } else {
+                        auto object = info[i].As<Napi::Object>();
+                        for (uint32_t k = 0; k < call.length; ++k) {
+                            data[k] = numericFromJs<T>(object.Get(k));
+                        }
+                    }
+                });
+                call.inputs.push_back(buffer.data());
+            }
+
+            if (info.Length() == arity + 1 && !info[arity].IsUndefined()) {
+                if (!info[arity].IsTypedArray()) {
+                    throw Napi::TypeError::New(env, "Output must be a TypedArray");
+                }
+                auto out = info[arity].As<Napi::TypedArray>();
+                if (out.TypedArrayType() != toTypedArrayType(invoker.return_type) ||
+                    out.ElementLength() < call.length) {
+                    throw Napi::TypeError::New(env, "Output TypedArray has the wrong type or is "
+                                                    "too short for '" +
+                                                        func_info.return_type + "' results");
+                }
+                call.output      = out;
+                call.output_data = typedArrayData(out);
+            } else {
+                call.output =
+                    newTypedArray(env, invoker.return_type, call.length, &call.output_data);
+            }
+
+            if (keep_alive) {
+                call.output_ref = Napi::Persistent(call.output.As<Napi::Object>());
+            }
+            return call;
+        }
+
+        /**
+         * @brief Runs a vectorized kernel on the libuv thread pool and settles a
+         * Promise with the output TypedArray
+         */
+        class VectorizedMapWorker : public Napi::AsyncWorker {
+        public:
+            VectorizedMapWorker(Napi::Env env, const VectorizedInvoker &invoker,
+                                VectorizedCall call)
+                : Napi::AsyncWorker(env), invoker_(invoker), call_(std::move(call)),
+                  deferred_(Napi::Promise::Deferred::New(env)) {}
+
+            Napi::Promise GetPromise() const { return deferred_.Promise(); }
+
+        protected:
+            void Execute() override {
+                try {
+                    invoker_.kernel(call_.inputs.data(), call_.output_data, call_.length);
+                } catch (const std::exception &e) {
+                    SetError(e.what());
+                }
+            }
+
+            void OnOK() override { deferred_.Resolve(call_.output_ref.Value()); }
+
+            void OnError(const Napi::Error &e) override { deferred_.Reject(e.Value()); }
+
+        private:
+            const VectorizedInvoker &invoker_;
+            VectorizedCall           call_;
+            Napi::Promise::Deferred  deferred_;
+        };
+
+        // Bad arguments of an async call settle its promise, like kernel errors
+        inline Napi::Value rejectedPromise(Napi::Env env, Napi::Value error) {
+            auto deferred = Napi::Promise::Deferred::New(env);
+            deferred.Reject(error);
+            return deferred.Promise();
+        }
+
+        /**
+         * @brief Add fn.map() and fn.mapAsync() to a function whose signature is
+         * all-numeric (see FunctionInfo::vectorized)
+         */
+        inline void addVectorizedVariants(Napi::Function &fn, const FunctionInfo *func_info) {
+            auto env = fn.Env();
+
+            fn.Set("map", Napi::Function::New(
+                              env, [func_info](const Napi::CallbackInfo &info) -> Napi::Value {
+                                  try {
+                                      auto call = prepareVectorizedCall(info, *func_info, false);
+                                      func_info->vectorized->kernel(
+                                          call.inputs.data(), call.output_data, call.length);
+                                      return call.output;
+                                  } catch (const Napi::Error &e) {
+                                      e.ThrowAsJavaScriptException(); // keeps TypeError
+                                      return info.Env().Undefined();
+                                  } catch (const std::exception &e) {
+                                      Napi::Error::New(info.Env(), e.what())
+                                          .ThrowAsJavaScriptException();
+                                      return info.Env().Undefined();
+                                  }
+                              }));
+
+            fn.Set("mapAsync",
+                   Napi::Function::New(
+                       env, [func_info](const Napi::CallbackInfo &info) -> Napi::Value {
+                           try {
+                               auto  call   = prepareVectorizedCall(info, *func_info, true);
+                               auto *worker = new VectorizedMapWorker(
+                                   info.Env(), *func_info->vectorized, std::move(call));
+                               auto promise = worker->GetPromise();
+                               worker->Queue();
+                               return promise;
+                           } catch (const Napi::Error &e) {
+                               return rejectedPromise(info.Env(), e.Value());
+                           } catch (const std::exception &e) {
+                               auto error = Napi::Error::New(info.Env(), e.what());
+                               return rejectedPromise(info.Env(), error.Value());
+                           }
+                       }));
+        }
+
+    } // namespace detail
+
     inline void registerFunction(JsGenerator &generator, const std::string &func_name) {
         auto       &registry  = FunctionRegistry::instance();
         const auto *func_info = registry.getFunction(func_name);
@@ -12,38 +263,43 @@ namespace rosetta {
             throw std::runtime_error("Function not found: " + func_name);
         }
 
-        generator.exports.Set(
-            func_name,
-            Napi::Function::New(
-                generator.env, [func_info](const Napi::CallbackInfo &info) -> Napi::Value {
-                    try {
-                        if (info.Length() != func_info->parameter_types.size()) {
-                            std::string err = "Expected " +
-                                              std::to_string(func_info->parameter_types.size()) +
-                                              " arguments, got " + std::to_string(info.Length());
-                            Napi::TypeError::New(info.Env(), err).ThrowAsJavaScriptException();
-                            return info.Env().Undefined();
-                        }
+        auto fn = Napi::Function::New(
+            generator.env, [func_info](const Napi::CallbackInfo &info) -> Napi::Value {
+                try {
+                    if (info.Length() != func_info->parameter_types.size()) {
+                        std::string err = "Expected " +
+                                          std::to_string(func_info->parameter_types.size()) +
+                                          " arguments, got " + std::to_string(info.Length());
+                        Napi::TypeError::New(info.Env(), err).ThrowAsJavaScriptException();
+                        return info.Env().Undefined();
+                    }
 
-                        // Convert JS arguments to C++ std::any
-                        std::vector<std::any> args;
-                        for (size_t i = 0; i < info.Length(); ++i) {
-                            args.push_back(TypeConverterRegistry::instance().convert_to_cpp(
-                                info[i], func_info->parameter_types[i]));
-                        }
+                    // Convert JS arguments to C++ std::any
+                    std::vector<std::any> args;
+                    for (size_t i = 0; i < info.Length(); ++i) {
+                        args.push_back(TypeConverterRegistry::instance().convert_to_cpp(
+                            info[i], func_info->parameter_types[i]));
+                    }
 
-                        // Call the function
-                        auto result = func_info->invoker(args);
+                    // Call the function
+                    auto result = func_info->invoker(args);
 
-                        // Convert result back to JS
-                        return TypeConverterRegistry::instance().convert_to_js(
-                            info.Env(), result, func_info->return_type);
+                    // Convert result back to JS
+                    return TypeConverterRegistry::instance().convert_to_js(
+                        info.Env(), result, func_info->return_type);
 
-                    } catch (const std::exception &e) {
-                        Napi::Error::New(info.Env(), e.what()).ThrowAsJavaScriptException();
-                        return info.Env().Undefined();
-                    }
-                }));
+                } catch (const std::exception &e) {
+                    Napi::Error::New(info.Env(), e.what()).ThrowAsJavaScriptException();
+                    return info.Env().Undefined();
+                }
+            });
+
+        // All-numeric signatures also get fn.map(a, b, out?) and fn.mapAsync(...)
+        if (func_info->vectorized) {
+            detail::addVectorizedVariants(fn, func_info);
+        }
+
+        generator.exports.Set(func_name, fn);
     }
 
     inline void registerFunctions(JsGenerator                    &generator,
@@ -3,6 +3,7 @@
  * LGPL v3 license
  *
  */
+#include <rosetta/generators/details/js/js_converters.h>
 #include <rosetta/generators/details/js/js_functors.h>
 #include <rosetta/introspectable.h>
 #include <unordered_map>
@@ -19,6 +20,7 @@ namespace rosetta {
         static Napi::Object            Init(Napi::Env, Napi::Object, const std::string &);
 
         ObjectWrapper(const Napi::CallbackInfo &info);
+        ~ObjectWrapper();
 
         T *GetCppObject();
 
@@ -42,13 +44,15 @@ namespace rosetta {
         }
 
     private:
-        std::shared_ptr<T> cpp_obj;
+        std::shared_ptr<T>       cpp_obj;
+        std::vector<std::size_t> subscriptions; // of onPropertyChanged, ended with the wrapper
 
         void               SetupBindings();
         void               SetupProperty(const std::string &prop_name);
         void               SetupVirtualProperty(const std::string &prop_name);
         void               SetupMethod(const std::string &method_name);
         void               SetupIntrospection();
+        void               SetupPropertyChanged();
         static bool        IsSimpleGetterSetter(const std::string &, const TypeInfo &);
         static std::string Capitalize(const std::string &str);
     };
@@ -135,6 +139,14 @@ namespace rosetta {
         SetupBindings();
     }
 
+    template <typename T> inline ObjectWrapper<T>::~ObjectWrapper() {
+        if (cpp_obj) {
+            for (const std::size_t id : subscriptions) {
+                T::getStaticTypeInfo().unsubscribePropertyChanged(cpp_obj.get(), id);
+            }
+        }
+    }
+
     template <typename T> inline T *ObjectWrapper<T>::GetCppObject() {
         return cpp_obj.get();
     }
@@ -212,6 +224,14 @@ namespace rosetta {
 
         // Bind introspection
         SetupIntrospection();
+
+        // Change notifications of the observable members
+        for (const auto *member : type_info.getMembersInOrder()) {
+            if (member->observable) {
+                SetupPropertyChanged();
+                break;
+            }
+        }
     }
 
     template <typename T>
@@ -423,6 +443,58 @@ namespace rosetta {
                 }));
     }
 
+    // The callback receives [{ member, slot, oldValue, newValue }, ...]: one
+    // change, or those of the object in a batch. It must be called on the JS
+    // thread (members set from JS, or by C++ code running on it).
+    template <typename T> inline void ObjectWrapper<T>::SetupPropertyChanged() {
+        auto env = this->Env();
+        auto obj = this->Value();
+
+        obj.Set("onPropertyChanged",
+                Napi::Function::New(env, [this](const Napi::CallbackInfo &info) -> Napi::Value {
+                    if (info.Length() < 1 || !info[0].IsFunction()) {
+                        Napi::TypeError::New(info.Env(), "Expected a callback")
+                            .ThrowAsJavaScriptException();
+                        return info.Env().Undefined();
+                    }
+                    auto callback = std::make_shared<Napi::FunctionReference>(
+                        Napi::Persistent(info[0].As<Napi::Function>()));
+                    const std::size_t id = T::getStaticTypeInfo().subscribePropertyChanged(
+                        cpp_obj.get(), [callback](std::span<const PropertyChange> changes) {
+                            Napi::Env         env = callback->Env();
+                            Napi::HandleScope scope(env);
+                            const auto       &registry = TypeConverterRegistry::instance();
+                            auto              events   = Napi::Array::New(env, changes.size());
+                            for (std::size_t i = 0; i < changes.size(); ++i) {
+                                const PropertyChange &change    = changes[i];
+                                const std::string    &type_name = change.member->type_name;
+                                auto                  event     = Napi::Object::New(env);
+                                event.Set("member", change.member->name);
+                                event.Set("slot", Napi::Number::New(env, change.slot));
+                                event.Set("oldValue",
+                                          registry.convert_to_js(env, change.old_value, type_name));
+                                event.Set("newValue",
+                                          registry.convert_to_js(env, change.new_value, type_name));
+                                events.Set(static_cast<uint32_t>(i), event);
+                            }
+                            callback->Call({events});
+                        });
+                    subscriptions.push_back(id);
+                    return Napi::Number::New(info.Env(), static_cast<double>(id));
+                }));
+
+        obj.Set("offPropertyChanged",
+                Napi::Function::New(env, [this](const Napi::CallbackInfo &info) {
+                    if (info.Length() > 0 && info[0].IsNumber()) {
+                        const auto id = static_cast<std::size_t>(
+                            info[0].template As<Napi::Number>().Int64Value());
+                        T::getStaticTypeInfo().unsubscribePropertyChanged(cpp_obj.get(), id);
+                        std::erase(subscriptions, id);
+                    }
+                    return info.Env().Undefined();
+                }));
+    }
+
     template <typename T> inline void ObjectWrapper<T>::SetupIntrospection() {
         auto env = this->Env();
         auto obj = this->Value();
@@ -469,6 +541,20 @@ namespace rosetta {
                     return Napi::String::New(info.Env(), cpp_obj->toJSON());
                 }));
 
+        obj.Set("fromJSON", Napi::Function::New(env, [this](const Napi::CallbackInfo &info) {
+                    if (info.Length() < 1 || !info[0].IsString()) {
+                        Napi::TypeError::New(info.Env(), "Expected a JSON string")
+                            .ThrowAsJavaScriptException();
+                        return info.Env().Undefined();
+                    }
+                    try {
+                        cpp_obj->fromJSON(info[0].template As<Napi::String>().Utf8Value());
+                    } catch (const std::exception &e) {
+                        Napi::Error::New(info.Env(), e.what()).ThrowAsJavaScriptException();
+                    }
+                    return info.Env().Undefined();
+                }));
+
         obj.Set("getMemberValue", Napi::Function::New(env, [this](const Napi::CallbackInfo &info) {
                     if (info.Length() > 0 && info[0].IsString()) {
                         std::string name = info[0].template As<Napi::String>().Utf8Value();
@@ -596,22 +682,6 @@ namespace rosetta {
             return it->second(env, value);
         }
 
-        try {
-            if (type_name == "string") {
-                return Napi::String::New(env, std::any_cast<std::string>(value));
-            } else if (type_name == "int") {
-                return Napi::Number::New(env, std::any_cast<int>(value));
-            } else if (type_name == "double") {
-                return Napi::Number::New(env, std::any_cast<double>(value));
-            } else if (type_name == "float") {
-                return Napi::Number::New(env, std::any_cast<float>(value));
-            } else if (type_name == "bool") {
-                return Napi::Boolean::New(env, std::any_cast<bool>(value));
-            }
-        } catch (const std::bad_any_cast &) {
-            // Fall through
-        }
-
         return env.Undefined();
     }
 
@@ -622,81 +692,14 @@ namespace rosetta {
             return it->second(js_value);
         }
 
-        if (type_name == "string") {
-            return std::make_any<std::string>(js_value.IsString()
-                                                  ? js_value.As<Napi::String>().Utf8Value()
-                                                  : js_value.ToString().Utf8Value());
-        } else if (type_name == "int") {
-            return std::make_any<int>(js_value.As<Napi::Number>().Int32Value());
-        } else if (type_name == "double") {
-            return std::make_any<double>(js_value.As<Napi::Number>().DoubleValue());
-        } else if (type_name == "float") {
-            return std::make_any<float>(
-                static_cast<float>(js_value.As<Napi::Number>().DoubleValue()));
-        } else if (type_name == "bool") {
-            return std::make_any<bool>(js_value.As<Napi::Boolean>().Value());
-        }
-
         throw std::runtime_error("Unsupported type: " + type_name);
     }
 
     inline TypeConverterRegistry::TypeConverterRegistry() {
-        // Register vector converters
-        register_converter(
-            "vector<int>",
-            [](Napi::Env env, const std::any &value) -> Napi::Value {
-                auto vec = std::any_cast<std::vector<int>>(value);
-                auto arr = Napi::Array::New(env, vec.size());
-                for (size_t i = 0; i < vec.size(); ++i) {
-                    arr.Set(i, vec[i]);
-                }
-                return arr;
-            },
-            [](const Napi::Value &js_val) -> std::any {
-                auto             arr = js_val.As<Napi::Array>();
-                std::vector<int> vec;
-                for (uint32_t i = 0; i < arr.Length(); ++i) {
-                    vec.push_back(arr.Get(i).As<Napi::Number>().Int32Value());
-                }
-                return vec;
-            });
-
-        register_converter(
-            "vector<double>",
-            [](Napi::Env env, const std::any &value) -> Napi::Value {
-                auto vec = std::any_cast<std::vector<double>>(value);
-                auto arr = Napi::Array::New(env, vec.size());
-                for (size_t i = 0; i < vec.size(); ++i) {
-                    arr.Set(i, vec[i]);
-                }
-                return arr;
-            },
-            [](const Napi::Value &js_val) -> std::any {
-                auto                arr = js_val.As<Napi::Array>();
-                std::vector<double> vec;
-                for (uint32_t i = 0; i < arr.Length(); ++i) {
-                    vec.push_back(arr.Get(i).As<Napi::Number>().DoubleValue());
-                }
-                return vec;
-            });
-
-        register_converter(
-            "vector<string>",
-            [](Napi::Env env, const std::any &value) -> Napi::Value {
-                auto vec = std::any_cast<std::vector<std::string>>(value);
-                auto arr = Napi::Array::New(env, vec.size());
-                for (size_t i = 0; i < vec.size(); ++i) {
-                    arr.Set(i, vec[i]);
-                }
-                return arr;
-            },
-            [](const Napi::Value &js_val) -> std::any {
-                auto                     arr = js_val.As<Napi::Array>();
-                std::vector<std::string> vec;
-                for (uint32_t i = 0; i < arr.Length(); ++i) {
-                    vec.push_back(arr.Get(i).As<Napi::String>().Utf8Value());
-                }
-                return vec;
+        // Scalars, strings and vectors of them (see rosetta/converters.h)
+        forEachBuiltinConverter<JsBackend>(
+            [this](const std::string &type_name, const ConverterEntry<JsBackend> &entry) {
+                register_converter(type_name, entry.to_script, entry.from_script);
             });
     }
 
@@ -720,6 +723,28 @@ namespace rosetta {
         return *this;
     }
 
+    inline JsGenerator &JsGenerator::add_property_batch() {
+        if (exports.Has("beginPropertyBatch")) {
+            return *this;
+        }
+        const auto batch_function = [this](const char *name, void (*fn)()) {
+            exports.Set(name, Napi::Function::New(env, [fn](const Napi::CallbackInfo &info) {
+                            try {
+                                fn();
+                            } catch (const Napi::Error &) {
+                                throw;
+                            } catch (const std::exception &e) {
+                                throw Napi::Error::New(info.Env(), e.what());
+                            }
+                            return info.Env().Undefined();
+                        }));
+        };
+        batch_function("beginPropertyBatch", &beginPropertyBatch);
+        batch_function("endPropertyBatch", &endPropertyBatch);
+        batch_function("flushPropertyChanges", &flushPropertyChanges);
+        return *this;
+    }
+
     inline JsGenerator &JsGenerator::register_type_converter(const std::string &type_name,
                                                              CppToJsConverter   to_js,
                                                              JsToCppConverter   to_cpp) {
@@ -741,6 +766,12 @@ namespace rosetta {
         bound_classes.insert(final_name);
 
         ObjectWrapper<T>::Init(env, exports, final_name);
+        for (const auto *member : type_info.getMembersInOrder()) {
+            if (member->observable) {
+                add_property_batch();
+                break;
+            }
+        }
         return *this;
     }
 
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include "../js_generator.h"
+
+namespace rosetta {
+
+    namespace detail {
+
+        inline QueryValue jsIndexValue(const Napi::Value &value) {
+            if (value.IsBoolean()) {
+                return value.As<Napi::Boolean>().Value();
+            }
+            if (value.IsNumber()) {
+                return value.As<Napi::Number>().DoubleValue();
+            }
+            if (value.IsString()) {
+                return value.As<Napi::String>().Utf8Value();
+            }
+            throw Napi::TypeError::New(value.Env(), "Index keys are numbers, booleans or strings");
+        }
+
+        // A value, or an Array of values for several members
+        inline IndexKey jsIndexKey(const Napi::Value &values) {
+            IndexKey key;
+            if (values.IsArray()) {
+                const auto array = values.As<Napi::Array>();
+                for (uint32_t i = 0; i < array.Length(); ++i) {
+                    key.push_back(jsIndexValue(array.Get(i)));
+                }
+            } else {
+                key.push_back(jsIndexValue(values));
+            }
+            return key;
+        }
+
+        // C++ exceptions become JS errors
+        template <typename Fn> inline Napi::Value indexCall(const Napi::CallbackInfo &info, Fn fn) {
+            try {
+                return fn();
+            } catch (const Napi::Error &) {
+                throw;
+            } catch (const std::exception &e) {
+                throw Napi::Error::New(info.Env(), e.what());
+            }
+        }
+
+    } // namespace detail
+
+    template <typename T> Napi::FunctionReference JsIndexWrapper<T>::constructor;
+
+    template <typename T>
+    inline void JsIndexWrapper<T>::Init(Napi::Env env, Napi::Object exports,
+                                        const std::string &class_name) {
+        Napi::Function func = JsIndexWrapper::DefineClass(
+            env, class_name.c_str(),
+            {
+                JsIndexWrapper::InstanceAccessor("length", &JsIndexWrapper::Length, nullptr),
+                JsIndexWrapper::InstanceMethod("contains", &JsIndexWrapper::Contains),
+                JsIndexWrapper::InstanceMethod("add", &JsIndexWrapper::Add),
+                JsIndexWrapper::InstanceMethod("remove", &JsIndexWrapper::Remove),
+                JsIndexWrapper::InstanceMethod("update", &JsIndexWrapper::Update),
+                JsIndexWrapper::InstanceMethod("clear", &JsIndexWrapper::Clear),
+                JsIndexWrapper::InstanceMethod("lookup", &JsIndexWrapper::Lookup),
+                JsIndexWrapper::InstanceMethod("range", &JsIndexWrapper::Range),
+            });
+
+        constructor = Napi::Persistent(func);
+        constructor.SuppressDestruct();
+        exports.Set(class_name, func);
+    }
+
+    // new Index(kind, members)
+    template <typename T>
+    inline JsIndexWrapper<T>::JsIndexWrapper(const Napi::CallbackInfo &info)
+        : Napi::ObjectWrap<JsIndexWrapper<T>>(info) {
+        auto env = info.Env();
+        if (info.Length() < 2 || !info[0].IsString() || !info[1].IsArray()) {
+            throw Napi::TypeError::New(env, "Expected a kind (\"hash\" or \"ordered\") and an "
+                                            "Array of member names");
+        }
+        const auto               array = info[1].As<Napi::Array>();
+        std::vector<std::string> members;
+        for (uint32_t i = 0; i < array.Length(); ++i) {
+            members.push_back(array.Get(i).ToString().Utf8Value());
+        }
+        try {
+            index_ = std::make_unique<Index<T>>(
+                indexKindFromName(info[0].As<Napi::String>().Utf8Value()), members);
+        } catch (const std::exception &e) {
+            throw Napi::Error::New(env, e.what());
+        }
+    }
+
+    template <typename T>
+    inline T *JsIndexWrapper<T>::objectArg(const Napi::CallbackInfo &info) const {
+        if (info.Length() < 1 || !info[0].IsObject() ||
+            !info[0].As<Napi::Object>().InstanceOf(ObjectWrapper<T>::constructor.Value())) {
+            throw Napi::TypeError::New(info.Env(), "Expected a " +
+                                                       T::getStaticTypeInfo().class_name);
+        }
+        return Napi::ObjectWrap<ObjectWrapper<T>>::Unwrap(info[0].As<Napi::Object>())
+            ->GetCppObject();
+    }
+
+    template <typename T>
+    inline Napi::Array JsIndexWrapper<T>::objects(Napi::Env                env,
+                                                  const std::vector<T *> &objects) const {
+        Napi::Array result = Napi::Array::New(env, objects.size());
+        for (std::size_t i = 0; i < objects.size(); ++i) {
+            result.Set(static_cast<uint32_t>(i), owners_.at(objects[i]).Value());
+        }
+        return result;
+    }
+
+    template <typename T>
+    inline Napi::Value JsIndexWrapper<T>::Length(const Napi::CallbackInfo &info) {
+        return Napi::Number::New(info.Env(), static_cast<double>(index_->size()));
+    }
+
+    template <typename T>
+    inline Napi::Value JsIndexWrapper<T>::Contains(const Napi::CallbackInfo &info) {
+        return Napi::Boolean::New(info.Env(), index_->contains(*objectArg(info)));
+    }
+
+    template <typename T>
+    inline Napi::Value JsIndexWrapper<T>::Add(const Napi::CallbackInfo &info) {
+        return detail::indexCall(info, [&] {
+            T *object = objectArg(info);
+            index_->insert(*object);
+            if (!owners_.contains(object)) {
+                owners_.emplace(object, Napi::Persistent(info[0].As<Napi::Object>()));
+            }
+            return info.Env().Undefined();
+        });
+    }
+
+    template <typename T>
+    inline Napi::Value JsIndexWrapper<T>::Remove(const Napi::CallbackInfo &info) {
+        T *object = objectArg(info);
+        index_->erase(*object);
+        owners_.erase(object);
+        return info.Env().Undefined();
+    }
+
+    template <typename T>
+    inline Napi::Value JsIndexWrapper<T>::Update(const Napi::CallbackInfo &info) {
+        return detail::indexCall(info, [&] {
+            index_->update(*objectArg(info));
+            return info.Env().Undefined();
+        });
+    }
+
+    template <typename T>
+    inline Napi::Value JsIndexWrapper<T>::Clear(const Napi::CallbackInfo &info) {
+        index_->clear();
+        owners_.clear();
+        return info.Env().Undefined();
+    }
+
+    // lookup(...values): one value per member
+    template <typename T>
+    inline Napi::Value JsIndexWrapper<T>::Lookup(const Napi::CallbackInfo &info) {
+        return detail::indexCall(info, [&] {
+            IndexKey key;
+            for (std::size_t i = 0; i < info.Length(); ++i) {
+                key.push_back(detail::jsIndexValue(info[i]));
+            }
+            return objects(info.Env(), index_->lookup(key));
+        });
+    }
+
+    // range(lo, hi): bounds are values or Arrays of values
+    template <typename T>
+    inline Napi::Value JsIndexWrapper<T>::Range(const Napi::CallbackInfo &info) {
+        return detail::indexCall(info, [&] {
+            if (info.Length() < 2) {
+                throw Napi::TypeError::New(info.Env(), "Expected two bounds");
+            }
+            return objects(info.Env(), index_->range(detail::jsIndexKey(info[0]),
+                                                     detail::jsIndexKey(info[1])));
+        });
+    }
+
+    template <typename T>
+    inline void registerIndexType(JsGenerator &generator, const std::string &name) {
+        const std::string class_name =
+            name.empty() ? T::getStaticTypeInfo().class_name + "Index" : name;
+        JsIndexWrapper<T>::Init(generator.env, generator.exports, class_name);
+    }
+
+} // namespace rosetta
@@ -0,0 +1,424 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include "../js_converters.h"
+#include "../js_functions.h"
+#include "../js_generator.h"
+#include <cstring>
+#include <variant>
+
+namespace rosetta {
+
+    namespace detail {
+
+        // C++ exceptions become JS errors
+        template <typename Fn> inline Napi::Value tableCall(const Napi::CallbackInfo &info, Fn fn) {
+            try {
+                return fn();
+            } catch (const Napi::Error &) {
+                throw;
+            } catch (const std::exception &e) {
+                throw Napi::Error::New(info.Env(), e.what());
+            }
+        }
+
+        inline std::size_t tableRowArg(const Napi::CallbackInfo &info, std::size_t index) {
+            if (info.Length() <= index || !info[index].IsNumber()) {
+                throw Napi::TypeError::New(info.Env(), "Expected a row index");
+            }
+            const int64_t row = info[index].As<Napi::Number>().Int64Value();
+            if (row < 0) {
+                throw Napi::RangeError::New(info.Env(), "Negative row index");
+            }
+            return static_cast<std::size_t>(row);
+        }
+
+        inline std::string tableNameArg(const Napi::CallbackInfo &info, std::size_t index) {
+            if (info.Length() <= index || !info[index].IsString()) {
+                throw Napi::TypeError::New(info.Env(), "Expected a member name");
+            }
+            return info[index].As<Napi::String>().Utf8Value();
+        }
+
+        inline double tableNumberArg(const Napi::CallbackInfo &info, std::size_t index) {
+            if (info.Length() <= index || !info[index].IsNumber()) {
+                throw Napi::TypeError::New(info.Env(), "Expected a number");
+            }
+            return info[index].As<Napi::Number>().DoubleValue();
+        }
+
+        // Optional string argument (undefined or null when absent)
+        inline std::string tableTextArg(const Napi::CallbackInfo &info, std::size_t index) {
+            if (info.Length() <= index || info[index].IsUndefined() || info[index].IsNull()) {
+                return {};
+            }
+            if (!info[index].IsString()) {
+                throw Napi::TypeError::New(info.Env(), "Expected a query expression");
+            }
+            return info[index].As<Napi::String>().Utf8Value();
+        }
+
+        template <typename T>
+        inline Query<T> tableQuery(const std::string &where, const std::string &order_by = "") {
+            Query<T> query;
+            if (!where.empty()) {
+                query.where(where);
+            }
+            if (!order_by.empty()) {
+                query.orderBy(order_by);
+            }
+            return query;
+        }
+
+        inline Napi::Array tableRows(Napi::Env env, const std::vector<std::size_t> &rows) {
+            Napi::Array result = Napi::Array::New(env, rows.size());
+            for (std::size_t i = 0; i < rows.size(); ++i) {
+                result.Set(static_cast<uint32_t>(i), static_cast<double>(rows[i]));
+            }
+            return result;
+        }
+
+        template <typename T>
+        inline const std::string &tableMemberType(const Table<T> &table, const std::string &name) {
+            const MemberInfo *member = table.getTypeInfo().getMember(name);
+            if (!member) {
+                throw std::runtime_error("No member '" + name + "' in " +
+                                         table.getTypeInfo().class_name);
+            }
+            return member->type_name;
+        }
+
+    } // namespace detail
+
+    template <typename T> Napi::FunctionReference JsTableWrapper<T>::constructor;
+
+    template <typename T>
+    inline void JsTableWrapper<T>::Init(Napi::Env env, Napi::Object exports,
+                                        const std::string &class_name) {
+        Napi::Function func = JsTableWrapper::DefineClass(
+            env, class_name.c_str(),
+            {
+                JsTableWrapper::InstanceAccessor("length", &JsTableWrapper::Length, nullptr),
+                JsTableWrapper::InstanceMethod("push", &JsTableWrapper::Push),
+                JsTableWrapper::InstanceMethod("get", &JsTableWrapper::Get),
+                JsTableWrapper::InstanceMethod("set", &JsTableWrapper::Set),
+                JsTableWrapper::InstanceMethod("erase", &JsTableWrapper::Erase),
+                JsTableWrapper::InstanceMethod("clear", &JsTableWrapper::Clear),
+                JsTableWrapper::InstanceMethod("columnNames", &JsTableWrapper::ColumnNames),
+                JsTableWrapper::InstanceMethod("column", &JsTableWrapper::Column),
+                JsTableWrapper::InstanceMethod("setColumn", &JsTableWrapper::SetColumn),
+                JsTableWrapper::InstanceMethod("getValue", &JsTableWrapper::GetValue),
+                JsTableWrapper::InstanceMethod("setValue", &JsTableWrapper::SetValue),
+                JsTableWrapper::InstanceMethod("sum", &JsTableWrapper::Sum),
+                JsTableWrapper::InstanceMethod("minMax", &JsTableWrapper::MinMax),
+                JsTableWrapper::InstanceMethod("meanVariance", &JsTableWrapper::MeanVariance),
+                JsTableWrapper::InstanceMethod("dot", &JsTableWrapper::Dot),
+                JsTableWrapper::InstanceMethod("axpy", &JsTableWrapper::Axpy),
+                JsTableWrapper::InstanceMethod("clamp", &JsTableWrapper::Clamp),
+                JsTableWrapper::InstanceMethod("histogram", &JsTableWrapper::Histogram),
+                JsTableWrapper::InstanceMethod("select", &JsTableWrapper::Select),
+                JsTableWrapper::InstanceMethod("count", &JsTableWrapper::Count),
+                JsTableWrapper::InstanceMethod("groupBy", &JsTableWrapper::GroupBy),
+            });
+
+        constructor = Napi::Persistent(func);
+        constructor.SuppressDestruct();
+        exports.Set(class_name, func);
+    }
+
+    template <typename T>
+    inline JsTableWrapper<T>::JsTableWrapper(const Napi::CallbackInfo &info)
+        : Napi::ObjectWrap<JsTableWrapper<T>>(info) {}
+
+    template <typename T>
+    inline Napi::Value JsTableWrapper<T>::Length(const Napi::CallbackInfo &info) {
+        return Napi::Number::New(info.Env(), static_cast<double>(table_.size()));
+    }
+
+    template <typename T>
+    inline Napi::Value JsTableWrapper<T>::Push(const Napi::CallbackInfo &info) {
+        return detail::tableCall(info, [&] {
+            const auto &registry   = TypeConverterRegistry::instance();
+            const auto &class_name = table_.getTypeInfo().class_name;
+            const auto  value      = registry.convert_to_cpp(info[0], class_name);
+            table_.push_back(std::any_cast<const T &>(value));
+            return info.Env().Undefined();
+        });
+    }
+
+    template <typename T>
+    inline Napi::Value JsTableWrapper<T>::Get(const Napi::CallbackInfo &info) {
+        return detail::tableCall(info, [&] {
+            const std::size_t row = detail::tableRowArg(info, 0);
+            return TypeConverterRegistry::instance().convert_to_js(
+                info.Env(), std::any(table_.get(row)), table_.getTypeInfo().class_name);
+        });
+    }
+
+    template <typename T>
+    inline Napi::Value JsTableWrapper<T>::Set(const Napi::CallbackInfo &info) {
+        return detail::tableCall(info, [&] {
+            const std::size_t row      = detail::tableRowArg(info, 0);
+            const auto       &registry = TypeConverterRegistry::instance();
+            const auto value = registry.convert_to_cpp(info[1], table_.getTypeInfo().class_name);
+            table_.set(row, std::any_cast<const T &>(value));
+            return info.Env().Undefined();
+        });
+    }
+
+    template <typename T>
+    inline Napi::Value JsTableWrapper<T>::Erase(const Napi::CallbackInfo &info) {
+        return detail::tableCall(info, [&] {
+            table_.erase(detail::tableRowArg(info, 0));
+            return info.Env().Undefined();
+        });
+    }
+
+    template <typename T>
+    inline Napi::Value JsTableWrapper<T>::Clear(const Napi::CallbackInfo &info) {
+        table_.clear();
+        return info.Env().Undefined();
+    }
+
+    template <typename T>
+    inline Napi::Value JsTableWrapper<T>::ColumnNames(const Napi::CallbackInfo &info) {
+        const auto names = table_.columnNames();
+        auto       array = Napi::Array::New(info.Env(), names.size());
+        for (uint32_t i = 0; i < names.size(); ++i) {
+            array.Set(i, Napi::String::New(info.Env(), names[i]));
+        }
+        return array;
+    }
+
+    template <typename T>
+    inline Napi::Value JsTableWrapper<T>::Column(const Napi::CallbackInfo &info) {
+        return detail::tableCall(info, [&]() -> Napi::Value {
+            auto                 env    = info.Env();
+            const std::string    name   = detail::tableNameArg(info, 0);
+            const ColumnStorage &column = table_.columnStorage(name);
+
+            if (const auto type = column.numericType()) {
+                void *data  = nullptr;
+                auto  array = detail::newTypedArray(env, *type, column.size(), &data);
+                if (column.size() > 0) {
+                    std::memcpy(data, column.data(), column.size() * numericTypeSize(*type));
+                }
+                return array;
+            }
+
+            const auto &registry  = TypeConverterRegistry::instance();
+            const auto &type_name = detail::tableMemberType(table_, name);
+            auto        array     = Napi::Array::New(env, column.size());
+            for (std::size_t i = 0; i < column.size(); ++i) {
+                array.Set(static_cast<uint32_t>(i),
+                          registry.convert_to_js(env, column.get(i), type_name));
+            }
+            return array;
+        });
+    }
+
+    template <typename T>
+    inline Napi::Value JsTableWrapper<T>::SetColumn(const Napi::CallbackInfo &info) {
+        return detail::tableCall(info, [&] {
+            auto              env    = info.Env();
+            const std::string name   = detail::tableNameArg(info, 0);
+            ColumnStorage    &column = table_.columnStorage(name);
+            const auto        check_size = [&](std::size_t size) {
+                if (size != column.size()) {
+                    throw Napi::RangeError::New(env, "Column '" + name + "' has " +
+                                                         std::to_string(column.size()) +
+                                                         " rows, got " + std::to_string(size) +
+                                                         " values");
+                }
+            };
+            const auto type = column.numericType();
+
+            // Single memcpy from a TypedArray of the column type
+            if (type && info.Length() > 1 && info[1].IsTypedArray()) {
+                auto typed = info[1].As<Napi::TypedArray>();
+                if (typed.TypedArrayType() == detail::toTypedArrayType(*type)) {
+                    check_size(typed.ElementLength());
+                    if (column.size() > 0) {
+                        std::memcpy(column.data(), detail::typedArrayData(typed),
+                                    column.size() * numericTypeSize(*type));
+                    }
+                    return env.Undefined();
+                }
+            }
+
+            if (info.Length() < 2 || !(info[1].IsArray() || info[1].IsTypedArray())) {
+                throw Napi::TypeError::New(env, "Expected an Array or a TypedArray");
+            }
+            auto values = info[1].As<Napi::Object>();
+            check_size(values.Get("length").As<Napi::Number>().Uint32Value());
+            const auto &registry = TypeConverterRegistry::instance();
+            for (std::size_t i = 0; i < column.size(); ++i) {
+                const Napi::Value value = values.Get(static_cast<uint32_t>(i));
+                if (type) {
+                    visitNumericType(*type, [&](auto identity) {
+                        using E = typename decltype(identity)::type;
+                        static_cast<E *>(column.data())[i] = detail::numericFromJs<E>(value);
+                    });
+                } else {
+                    column.set(i, registry.convert_to_cpp(value,
+                                                          detail::tableMemberType(table_, name)));
+                }
+            }
+            return env.Undefined();
+        });
+    }
+
+    template <typename T>
+    inline Napi::Value JsTableWrapper<T>::GetValue(const Napi::CallbackInfo &info) {
+        return detail::tableCall(info, [&] {
+            const std::size_t row  = detail::tableRowArg(info, 0);
+            const std::string name = detail::tableNameArg(info, 1);
+            return TypeConverterRegistry::instance().convert_to_js(
+                info.Env(), table_[row].getMemberValue(name),
+                detail::tableMemberType(table_, name));
+        });
+    }
+
+    template <typename T>
+    inline Napi::Value JsTableWrapper<T>::SetValue(const Napi::CallbackInfo &info) {
+        return detail::tableCall(info, [&] {
+            const std::size_t row  = detail::tableRowArg(info, 0);
+            const std::string name = detail::tableNameArg(info, 1);
+            table_[row].setMemberValue(name, TypeConverterRegistry::instance().convert_to_cpp(
+                                                 info[2], detail::tableMemberType(table_, name)));
+            return info.Env().Undefined();
+        });
+    }
+
+    template <typename T>
+    inline Napi::Value JsTableWrapper<T>::Sum(const Napi::CallbackInfo &info) {
+        return detail::tableCall(info, [&] {
+            const double sum = kernels::sum(table_.columnStorage(detail::tableNameArg(info, 0)));
+            return Napi::Number::New(info.Env(), sum);
+        });
+    }
+
+    template <typename T>
+    inline Napi::Value JsTableWrapper<T>::MinMax(const Napi::CallbackInfo &info) {
+        return detail::tableCall(info, [&] {
+            const auto extrema =
+                kernels::minMax(table_.columnStorage(detail::tableNameArg(info, 0)));
+            Napi::Object result = Napi::Object::New(info.Env());
+            result.Set("min", extrema.min);
+            result.Set("max", extrema.max);
+            return result;
+        });
+    }
+
+    template <typename T>
+    inline Napi::Value JsTableWrapper<T>::MeanVariance(const Napi::CallbackInfo &info) {
+        return detail::tableCall(info, [&] {
+            const auto moments =
+                kernels::meanVariance(table_.columnStorage(detail::tableNameArg(info, 0)));
+            Napi::Object result = Napi::Object::New(info.Env());
+            result.Set("mean", moments.mean);
+            result.Set("variance", moments.variance);
+            return result;
+        });
+    }
+
+    template <typename T>
+    inline Napi::Value JsTableWrapper<T>::Dot(const Napi::CallbackInfo &info) {
+        return detail::tableCall(info, [&] {
+            const double dot = kernels::dot(table_.columnStorage(detail::tableNameArg(info, 0)),
+                                            table_.columnStorage(detail::tableNameArg(info, 1)));
+            return Napi::Number::New(info.Env(), dot);
+        });
+    }
+
+    // axpy(alpha, x, y): y += alpha * x
+    template <typename T>
+    inline Napi::Value JsTableWrapper<T>::Axpy(const Napi::CallbackInfo &info) {
+        return detail::tableCall(info, [&] {
+            kernels::axpy(detail::tableNumberArg(info, 0),
+                          table_.columnStorage(detail::tableNameArg(info, 1)),
+                          table_.columnStorage(detail::tableNameArg(info, 2)));
+            return info.Env().Undefined();
+        });
+    }
+
+    template <typename T>
+    inline Napi::Value JsTableWrapper<T>::Clamp(const Napi::CallbackInfo &info) {
+        return detail::tableCall(info, [&] {
+            kernels::clamp(table_.columnStorage(detail::tableNameArg(info, 0)),
+                           detail::tableNumberArg(info, 1), detail::tableNumberArg(info, 2));
+            return info.Env().Undefined();
+        });
+    }
+
+    template <typename T>
+    inline Napi::Value JsTableWrapper<T>::Histogram(const Napi::CallbackInfo &info) {
+        return detail::tableCall(info, [&] {
+            const double bins = detail::tableNumberArg(info, 3);
+            if (bins < 1) {
+                throw Napi::RangeError::New(info.Env(), "Expected at least one bin");
+            }
+            const ColumnStorage &column = table_.columnStorage(detail::tableNameArg(info, 0));
+            const auto counts = kernels::histogram(column, detail::tableNumberArg(info, 1),
+                                                   detail::tableNumberArg(info, 2),
+                                                   static_cast<std::size_t>(bins));
+            Napi::Array result = Napi::Array::New(info.Env(), counts.size());
+            for (std::size_t i = 0; i < counts.size(); ++i) {
+                result.Set(static_cast<uint32_t>(i), static_cast<double>(counts[i]));
+            }
+            return result;
+        });
+    }
+
+    // select(where, orderBy, limit): indices of the matching rows
+    template <typename T>
+    inline Napi::Value JsTableWrapper<T>::Select(const Napi::CallbackInfo &info) {
+        return detail::tableCall(info, [&] {
+            auto query = detail::tableQuery<T>(detail::tableTextArg(info, 0),
+                                               detail::tableTextArg(info, 1));
+            if (info.Length() > 2 && !info[2].IsUndefined() && !info[2].IsNull()) {
+                const double limit = detail::tableNumberArg(info, 2);
+                if (limit >= 0) {
+                    query.limit(static_cast<std::size_t>(limit));
+                }
+            }
+            return detail::tableRows(info.Env(), query.indices(table_));
+        });
+    }
+
+    template <typename T>
+    inline Napi::Value JsTableWrapper<T>::Count(const Napi::CallbackInfo &info) {
+        return detail::tableCall(info, [&] {
+            const auto count = detail::tableQuery<T>(detail::tableTextArg(info, 0)).count(table_);
+            return Napi::Number::New(info.Env(), static_cast<double>(count));
+        });
+    }
+
+    // groupBy(key, where): [{key, rows}] in increasing key order
+    template <typename T>
+    inline Napi::Value JsTableWrapper<T>::GroupBy(const Napi::CallbackInfo &info) {
+        return detail::tableCall(info, [&] {
+            auto       env    = info.Env();
+            const auto groups = detail::tableQuery<T>(detail::tableTextArg(info, 1))
+                                    .groupBy(table_, detail::tableTextArg(info, 0));
+            Napi::Array result = Napi::Array::New(env, groups.size());
+            for (std::size_t i = 0; i < groups.size(); ++i) {
+                Napi::Object group = Napi::Object::New(env);
+                std::visit([&](const auto &key) { group.Set("key", key); }, groups[i].key);
+                group.Set("rows", detail::tableRows(env, groups[i].rows));
+                result.Set(static_cast<uint32_t>(i), group);
+            }
+            return result;
+        });
+    }
+
+    template <typename T>
+    inline void registerTableType(JsGenerator &generator, const std::string &name) {
+        const std::string class_name =
+            name.empty() ? T::getStaticTypeInfo().class_name + "Table" : name;
+        JsTableWrapper<T>::Init(generator.env, generator.exports, class_name);
+    }
+
+} // namespace rosetta
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include "../js_converters.h"
+#include "../js_generator.h"
+#include "../js_indexes.h"
+
+namespace rosetta {
+
+    template <typename T> Napi::FunctionReference JsTrackerWrapper<T>::constructor;
+
+    template <typename T>
+    inline void JsTrackerWrapper<T>::Init(Napi::Env env, Napi::Object exports,
+                                          const std::string &class_name) {
+        Napi::Function func = JsTrackerWrapper::DefineClass(
+            env, class_name.c_str(),
+            {
+                JsTrackerWrapper::InstanceAccessor("length", &JsTrackerWrapper::Length, nullptr),
+                JsTrackerWrapper::InstanceMethod("contains", &JsTrackerWrapper::Contains),
+                JsTrackerWrapper::InstanceMethod("track", &JsTrackerWrapper::Track),
+                JsTrackerWrapper::InstanceMethod("untrack", &JsTrackerWrapper::Untrack),
+                JsTrackerWrapper::InstanceMethod("clear", &JsTrackerWrapper::Clear),
+                JsTrackerWrapper::InstanceMethod("markDirty", &JsTrackerWrapper::MarkDirty),
+                JsTrackerWrapper::InstanceMethod("isDirty", &JsTrackerWrapper::IsDirty),
+                JsTrackerWrapper::InstanceMethod("dirtyMembers", &JsTrackerWrapper::DirtyMembers),
+                JsTrackerWrapper::InstanceMethod("dirtyObjects", &JsTrackerWrapper::DirtyObjects),
+                JsTrackerWrapper::InstanceMethod("clean", &JsTrackerWrapper::Clean),
+                JsTrackerWrapper::InstanceMethod("collectDelta", &JsTrackerWrapper::CollectDelta),
+                JsTrackerWrapper::InstanceMethod("collectChanges",
+                                                 &JsTrackerWrapper::CollectChanges),
+                JsTrackerWrapper::StaticMethod("applyDelta", &JsTrackerWrapper::ApplyDelta),
+            });
+
+        constructor = Napi::Persistent(func);
+        constructor.SuppressDestruct();
+        exports.Set(class_name, func);
+    }
+
+    template <typename T>
+    inline JsTrackerWrapper<T>::JsTrackerWrapper(const Napi::CallbackInfo &info)
+        : Napi::ObjectWrap<JsTrackerWrapper<T>>(info),
+          tracker_(std::make_unique<DirtyTracker<T>>()) {}
+
+    template <typename T> inline T *JsTrackerWrapper<T>::objectArg(const Napi::CallbackInfo &info) {
+        if (info.Length() < 1 || !info[0].IsObject() ||
+            !info[0].As<Napi::Object>().InstanceOf(ObjectWrapper<T>::constructor.Value())) {
+            throw Napi::TypeError::New(info.Env(), "Expected a " +
+                                                       T::getStaticTypeInfo().class_name);
+        }
+        return Napi::ObjectWrap<ObjectWrapper<T>>::Unwrap(info[0].As<Napi::Object>())
+            ->GetCppObject();
+    }
+
+    template <typename T>
+    inline Napi::Value JsTrackerWrapper<T>::Length(const Napi::CallbackInfo &info) {
+        return Napi::Number::New(info.Env(), static_cast<double>(tracker_->size()));
+    }
+
+    template <typename T>
+    inline Napi::Value JsTrackerWrapper<T>::Contains(const Napi::CallbackInfo &info) {
+        return Napi::Boolean::New(info.Env(), tracker_->isTracked(*objectArg(info)));
+    }
+
+    template <typename T>
+    inline Napi::Value JsTrackerWrapper<T>::Track(const Napi::CallbackInfo &info) {
+        T *object = objectArg(info);
+        tracker_->track(*object);
+        if (!owners_.contains(object)) {
+            owners_.emplace(object, Napi::Persistent(info[0].As<Napi::Object>()));
+        }
+        return info.Env().Undefined();
+    }
+
+    template <typename T>
+    inline Napi::Value JsTrackerWrapper<T>::Untrack(const Napi::CallbackInfo &info) {
+        T *object = objectArg(info);
+        tracker_->untrack(*object);
+        owners_.erase(object);
+        return info.Env().Undefined();
+    }
+
+    template <typename T>
+    inline Napi::Value JsTrackerWrapper<T>::Clear(const Napi::CallbackInfo &info) {
+        tracker_->clear();
+        owners_.clear();
+        return info.Env().Undefined();
+    }
+
+    // markDirty(object, ...members): all the members without names
+    template <typename T>
+    inline Napi::Value JsTrackerWrapper<T>::MarkDirty(const Napi::CallbackInfo &info) {
+        return detail::indexCall(info, [&] {
+            T *object = objectArg(info);
+            if (info.Length() < 2) {
+                tracker_->markAllDirty(*object);
+            }
+            for (std::size_t i = 1; i < info.Length(); ++i) {
+                tracker_->markDirty(*object, info[i].ToString().Utf8Value());
+            }
+            return info.Env().Undefined();
+        });
+    }
+
+    // isDirty(object[, member])
+    template <typename T>
+    inline Napi::Value JsTrackerWrapper<T>::IsDirty(const Napi::CallbackInfo &info) {
+        return detail::indexCall(info, [&]() -> Napi::Value {
+            T *object = objectArg(info);
+            if (info.Length() > 1 && info[1].IsString()) {
+                return Napi::Boolean::New(
+                    info.Env(),
+                    tracker_->isDirty(*object, info[1].As<Napi::String>().Utf8Value()));
+            }
+            return Napi::Boolean::New(info.Env(), tracker_->isDirty(*object));
+        });
+    }
+
+    template <typename T>
+    inline Napi::Value JsTrackerWrapper<T>::DirtyMembers(const Napi::CallbackInfo &info) {
+        const auto  names  = tracker_->dirtyMembers(*objectArg(info));
+        Napi::Array result = Napi::Array::New(info.Env(), names.size());
+        for (std::size_t i = 0; i < names.size(); ++i) {
+            result.Set(static_cast<uint32_t>(i), Napi::String::New(info.Env(), names[i]));
+        }
+        return result;
+    }
+
+    template <typename T>
+    inline Napi::Value JsTrackerWrapper<T>::DirtyObjects(const Napi::CallbackInfo &info) {
+        const auto  objects = tracker_->dirtyObjects();
+        Napi::Array result  = Napi::Array::New(info.Env(), objects.size());
+        for (std::size_t i = 0; i < objects.size(); ++i) {
+            result.Set(static_cast<uint32_t>(i), owners_.at(objects[i]).Value());
+        }
+        return result;
+    }
+
+    template <typename T>
+    inline Napi::Value JsTrackerWrapper<T>::Clean(const Napi::CallbackInfo &info) {
+        tracker_->clean(*objectArg(info));
+        return info.Env().Undefined();
+    }
+
+    // Buffer of the changed members (empty if none)
+    template <typename T>
+    inline Napi::Value JsTrackerWrapper<T>::CollectDelta(const Napi::CallbackInfo &info) {
+        return detail::indexCall(info, [&]() -> Napi::Value {
+            const auto delta = tracker_->collectDelta(*objectArg(info));
+            return Napi::Buffer<uint8_t>::Copy(info.Env(), delta.data(), delta.size());
+        });
+    }
+
+    // { name: value } of the changed members (copies)
+    template <typename T>
+    inline Napi::Value JsTrackerWrapper<T>::CollectChanges(const Napi::CallbackInfo &info) {
+        return detail::indexCall(info, [&]() -> Napi::Value {
+            const T    *object    = objectArg(info);
+            const auto &registry  = TypeConverterRegistry::instance();
+            const auto &type_info = tracker_->getTypeInfo();
+            Napi::Object changes  = Napi::Object::New(info.Env());
+            for (const std::string &name : tracker_->dirtyMembers(*object)) {
+                const MemberInfo *member = type_info.getMember(name);
+                changes.Set(name, registry.convert_to_js(info.Env(), member->getter(object),
+                                                         member->type_name));
+            }
+            tracker_->clean(*object);
+            return changes;
+        });
+    }
+
+    // applyDelta(object, delta): delta is a Buffer or any TypedArray
+    template <typename T>
+    inline Napi::Value JsTrackerWrapper<T>::ApplyDelta(const Napi::CallbackInfo &info) {
+        return detail::indexCall(info, [&] {
+            T *object = objectArg(info);
+            if (info.Length() < 2 || !info[1].IsTypedArray()) {
+                throw Napi::TypeError::New(info.Env(), "Expected a Buffer or a TypedArray");
+            }
+            const auto delta = info[1].As<Napi::TypedArray>();
+            applyDelta(T::getStaticTypeInfo(), object, detail::typedArrayData(delta),
+                       delta.ByteLength());
+            return info.Env().Undefined();
+        });
+    }
+
+    template <typename T>
+    inline void registerTrackerType(JsGenerator &generator, const std::string &name) {
+        const std::string class_name =
+            name.empty() ? T::getStaticTypeInfo().class_name + "Tracker" : name;
+        JsTrackerWrapper<T>::Init(generator.env, generator.exports, class_name);
+    }
+
+} // namespace rosetta
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ *
+ * N-API specializations of the shared converter traits (see rosetta/converters.h)
+ */
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <napi.h>
+#include <rosetta/converters.h>
+
+namespace rosetta {
+
+    /**
+     * @brief Converter backend of the JsGenerator
+     */
+    struct JsBackend {
+        using Context    = Napi::Env;
+        using Value      = Napi::Value;
+        using Input      = const Napi::Value &;
+        using ToScript   = Napi::Value (*)(Napi::Env, const std::any &);
+        using FromScript = std::any (*)(const Napi::Value &);
+    };
+
+    namespace detail {
+
+        inline napi_typedarray_type toTypedArrayType(NumericType type) {
+            switch (type) {
+            case NumericType::Int8:
+                return napi_int8_array;
+            case NumericType::UInt8:
+                return napi_uint8_array;
+            case NumericType::Int16:
+                return napi_int16_array;
+            case NumericType::UInt16:
+                return napi_uint16_array;
+            case NumericType::Int32:
+                return napi_int32_array;
+            case NumericType::UInt32:
+                return napi_uint32_array;
+            case NumericType::Int64:
+                return napi_bigint64_array;
+            case NumericType::UInt64:
+                return napi_biguint64_array;
+            case NumericType::Float32:
+                return napi_float32_array;
+            default:
+                return napi_float64_array;
+            }
+        }
+
+        inline void *typedArrayData(const Napi::TypedArray &array) {
+            return static_cast<uint8_t *>(array.ArrayBuffer().Data()) + array.ByteOffset();
+        }
+
+    } // namespace detail
+
+    template <typename T> struct ScriptConverter<JsBackend, T, ValueKind::Bool> {
+        static Napi::Value to(Napi::Env env, bool value) { return Napi::Boolean::New(env, value); }
+        static T from(const Napi::Value &value) {
+            if (!value.IsBoolean()) {
+                throw Napi::TypeError::New(value.Env(), "Expected boolean");
+            }
+            return value.As<Napi::Boolean>().Value();
+        }
+    };
+
+    // Integers are numbers (exact up to 2^53)
+    template <typename T> struct ScriptConverter<JsBackend, T, ValueKind::Integer> {
+        static Napi::Value to(Napi::Env env, T value) {
+            if constexpr (sizeof(T) > 4) {
+                return Napi::Number::New(env, static_cast<double>(value));
+            } else {
+                return Napi::Number::New(env, static_cast<int32_t>(value));
+            }
+        }
+        static T from(const Napi::Value &value) {
+            if (!value.IsNumber()) {
+                throw Napi::TypeError::New(value.Env(), "Expected number");
+            }
+            if constexpr (sizeof(T) > 4) {
+                return static_cast<T>(value.As<Napi::Number>().Int64Value());
+            } else {
+                return static_cast<T>(value.As<Napi::Number>().Int32Value());
+            }
+        }
+    };
+
+    template <typename T> struct ScriptConverter<JsBackend, T, ValueKind::Unsigned> {
+        static Napi::Value to(Napi::Env env, T value) {
+            if constexpr (sizeof(T) > 4) {
+                return Napi::Number::New(env, static_cast<double>(value));
+            } else {
+                return Napi::Number::New(env, static_cast<uint32_t>(value));
+            }
+        }
+        static T from(const Napi::Value &value) {
+            if (!value.IsNumber()) {
+                throw Napi::TypeError::New(value.Env(), "Expected number");
+            }
+            if constexpr (sizeof(T) > 4) {
+                return static_cast<T>(value.As<Napi::Number>().Int64Value());
+            } else {
+                return static_cast<T>(value.As<Napi::Number>().Uint32Value());
+            }
+        }
+    };
+
+    template <typename T> struct ScriptConverter<JsBackend, T, ValueKind::Float> {
+        static Napi::Value to(Napi::Env env, T value) {
+            return Napi::Number::New(env, static_cast<double>(value));
+        }
+        static T from(const Napi::Value &value) {
+            if (!value.IsNumber()) {
+                throw Napi::TypeError::New(value.Env(), "Expected number");
+            }
+            return static_cast<T>(value.As<Napi::Number>().DoubleValue());
+        }
+    };
+
+    // Anything is accepted as a string (String(value) semantics)
+    template <typename T> struct ScriptConverter<JsBackend, T, ValueKind::String> {
+        static Napi::Value to(Napi::Env env, const T &value) {
+            return Napi::String::New(env, value);
+        }
+        static T from(const Napi::Value &value) {
+            return value.IsString() ? value.As<Napi::String>().Utf8Value()
+                                    : value.ToString().Utf8Value();
+        }
+    };
+
+    // Enums are numbers (combined with `|` for flags); value names are accepted too
+    template <typename T> struct ScriptConverter<JsBackend, T, ValueKind::Enum> {
+        using Underlying = std::underlying_type_t<T>;
+
+        static Napi::Value to(Napi::Env env, T value) {
+            return Napi::Number::New(env, static_cast<double>(static_cast<Underlying>(value)));
+        }
+        static T from(const Napi::Value &value) {
+            if (value.IsString()) {
+                const auto &info = detail::enumInfoFor<T>();
+                return static_cast<T>(static_cast<Underlying>(
+                    info.getValue(value.As<Napi::String>().Utf8Value())));
+            }
+            if (!value.IsNumber()) {
+                throw Napi::TypeError::New(value.Env(), "Expected number or enum value name");
+            }
+            return detail::checkedEnumValue<T>(value.As<Napi::Number>().Int64Value());
+        }
+    };
+
+    namespace detail {
+
+        template <typename T> inline T jsArrayToVector(const Napi::Value &value) {
+            if (!value.IsArray()) {
+                throw Napi::TypeError::New(value.Env(), "Expected array");
+            }
+            auto array = value.As<Napi::Array>();
+            T    vec;
+            vec.reserve(array.Length());
+            using Item = ScriptConverter<JsBackend, typename T::value_type>;
+            for (uint32_t i = 0; i < array.Length(); ++i) {
+                vec.push_back(Item::from(array.Get(i)));
+            }
+            return vec;
+        }
+
+    } // namespace detail
+
+    // Arrays out; Arrays or TypedArrays in (single memcpy for a matching TypedArray)
+    template <typename T> struct ScriptConverter<JsBackend, T, ValueKind::NumericVector> {
+        using Element = typename T::value_type;
+        using Scalar  = ScriptConverter<JsBackend, Element>;
+
+        static Napi::Value to(Napi::Env env, const T &vec) {
+            auto array = Napi::Array::New(env, vec.size());
+            for (size_t i = 0; i < vec.size(); ++i) {
+                array.Set(static_cast<uint32_t>(i), Scalar::to(env, vec[i]));
+            }
+            return array;
+        }
+        static T from(const Napi::Value &value) {
+            if (value.IsTypedArray()) {
+                auto typed = value.As<Napi::TypedArray>();
+                if (typed.TypedArrayType() ==
+                    detail::toTypedArrayType(numericTypeOf<Element>())) {
+                    T vec(typed.ElementLength());
+                    if (!vec.empty()) {
+                        std::memcpy(vec.data(), detail::typedArrayData(typed),
+                                    vec.size() * sizeof(Element));
+                    }
+                    return vec;
+                }
+            }
+            return detail::jsArrayToVector<T>(value);
+        }
+    };
+
+    template <typename T>
+        requires has_script_converter_v<JsBackend, typename T::value_type>
+    struct ScriptConverter<JsBackend, T, ValueKind::Vector> {
+        using Element = typename T::value_type;
+        using Item    = ScriptConverter<JsBackend, Element>;
+
+        static Napi::Value to(Napi::Env env, const T &vec) {
+            auto array = Napi::Array::New(env, vec.size());
+            for (size_t i = 0; i < vec.size(); ++i) {
+                array.Set(static_cast<uint32_t>(i), Item::to(env, vec[i]));
+            }
+            return array;
+        }
+        static T from(const Napi::Value &value) {
+            return detail::jsArrayToVector<T>(value);
+        }
+    };
+
+} // namespace rosetta
@@ -5,7 +5,19 @@
 namespace rosetta {
 
     /**
-     * @brief Register a single function by name
+     * @brief Register a single function by name.
+     * If all parameters and the return type are numeric (arithmetic, not bool),
+     * the JS function also gets vectorized variants running the C++ function in
+     * a tight loop, with a single N-API crossing:
+     * ```js
+     * const d = rosetta.distance.map(xs, ys)          // Float64Array
+     * rosetta.distance.map(xs, ys, out)               // writes into out
+     * const r = await rosetta.distance.mapAsync(xs, ys) // off the main thread
+     * ```
+     * TypedArrays of the matching element type are used without copy; plain
+     * arrays and other TypedArrays are converted, and numbers are broadcast.
+     * Elements that are not numbers (holes, undefined, strings) are a
+     * TypeError, thrown by map and rejecting the promise of mapAsync.
      */
     void registerFunction(JsGenerator &generator, const std::string &func_name);
 
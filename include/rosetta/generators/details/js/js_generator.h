@@ -30,6 +30,13 @@ namespace rosetta {
         template <typename T> JsGenerator &bind_class(const std::string &class_name = "");
 
         JsGenerator &add_utilities();
+
+        /**
+         * @brief Export beginPropertyBatch, endPropertyBatch and
+         * flushPropertyChanges (see rosetta::PropertyBatch), once. Done by
+         * bind_class for classes with observable members.
+         */
+        JsGenerator &add_property_batch();
         JsGenerator &register_type_converter(const std::string &, CppToJsConverter,
                                              JsToCppConverter);
 
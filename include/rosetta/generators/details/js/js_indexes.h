@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <memory>
+#include <napi.h>
+#include <rosetta/index.h>
+#include <string>
+#include <unordered_map>
+
+namespace rosetta {
+
+    class JsGenerator;
+
+    /**
+     * @brief JS class wrapping a rosetta::Index<T>. It holds references on the
+     * indexed JS objects, so that they stay alive while indexed.
+     */
+    template <typename T> class JsIndexWrapper : public Napi::ObjectWrap<JsIndexWrapper<T>> {
+    public:
+        static Napi::FunctionReference constructor;
+        static void Init(Napi::Env env, Napi::Object exports, const std::string &class_name);
+
+        explicit JsIndexWrapper(const Napi::CallbackInfo &info);
+
+    private:
+        Napi::Value Length(const Napi::CallbackInfo &info);
+        Napi::Value Contains(const Napi::CallbackInfo &info);
+        Napi::Value Add(const Napi::CallbackInfo &info);
+        Napi::Value Remove(const Napi::CallbackInfo &info);
+        Napi::Value Update(const Napi::CallbackInfo &info);
+        Napi::Value Clear(const Napi::CallbackInfo &info);
+        Napi::Value Lookup(const Napi::CallbackInfo &info);
+        Napi::Value Range(const Napi::CallbackInfo &info);
+
+        T          *objectArg(const Napi::CallbackInfo &info) const;
+        Napi::Array objects(Napi::Env env, const std::vector<T *> &objects) const;
+
+        std::unique_ptr<Index<T>>                            index_;
+        std::unordered_map<const T *, Napi::ObjectReference> owners_;
+    };
+
+    /**
+     * @brief Bind rosetta::Index<T> to JavaScript (T must be bound).
+     *
+     * Keys are updated when a key member is set from JS (or through
+     * setMemberValue in C++). Lookups return Arrays of the indexed objects.
+     *
+     * @example
+     * ```js
+     * const byName = new addon.GameObjectIndex("hash", ["name"]);
+     * objects.forEach(object => byName.add(object));
+     * const player = byName.lookup("Player")[0];
+     *
+     * const byHealth = new addon.GameObjectIndex("ordered", ["health", "name"]);
+     * const weak = byHealth.range(0, 20);                 // health in [0, 20]
+     * const some = byHealth.range([50, "a"], [50, "m"]);  // several members
+     * ```
+     * @param name JS class name (default: class name + "Index")
+     */
+    template <typename T>
+    void registerIndexType(JsGenerator &generator, const std::string &name = "");
+
+} // namespace rosetta
+
+#include "inline/js_indexes.hxx"
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <napi.h>
+#include <rosetta/kernels.h>
+#include <rosetta/query.h>
+#include <rosetta/table.h>
+#include <string>
+
+namespace rosetta {
+
+    class JsGenerator;
+
+    /**
+     * @brief JS class wrapping a rosetta::Table<T>
+     */
+    template <typename T> class JsTableWrapper : public Napi::ObjectWrap<JsTableWrapper<T>> {
+    public:
+        static Napi::FunctionReference constructor;
+        static void Init(Napi::Env env, Napi::Object exports, const std::string &class_name);
+
+        explicit JsTableWrapper(const Napi::CallbackInfo &info);
+
+        Table<T> &table() { return table_; }
+
+    private:
+        Napi::Value Length(const Napi::CallbackInfo &info);
+        Napi::Value Push(const Napi::CallbackInfo &info);
+        Napi::Value Get(const Napi::CallbackInfo &info);
+        Napi::Value Set(const Napi::CallbackInfo &info);
+        Napi::Value Erase(const Napi::CallbackInfo &info);
+        Napi::Value Clear(const Napi::CallbackInfo &info);
+        Napi::Value ColumnNames(const Napi::CallbackInfo &info);
+        Napi::Value Column(const Napi::CallbackInfo &info);
+        Napi::Value SetColumn(const Napi::CallbackInfo &info);
+        Napi::Value GetValue(const Napi::CallbackInfo &info);
+        Napi::Value SetValue(const Napi::CallbackInfo &info);
+
+        // Kernels over the numeric columns
+        Napi::Value Sum(const Napi::CallbackInfo &info);
+        Napi::Value MinMax(const Napi::CallbackInfo &info);
+        Napi::Value MeanVariance(const Napi::CallbackInfo &info);
+        Napi::Value Dot(const Napi::CallbackInfo &info);
+        Napi::Value Axpy(const Napi::CallbackInfo &info);
+        Napi::Value Clamp(const Napi::CallbackInfo &info);
+        Napi::Value Histogram(const Napi::CallbackInfo &info);
+
+        // Queries
+        Napi::Value Select(const Napi::CallbackInfo &info);
+        Napi::Value Count(const Napi::CallbackInfo &info);
+        Napi::Value GroupBy(const Napi::CallbackInfo &info);
+
+        Table<T> table_;
+    };
+
+    /**
+     * @brief Bind rosetta::Table<T> to JavaScript (T must be bound, and registered
+     * with registerIntrospectableObjectType).
+     *
+     * Rows are copied in and out as T (`push`, `get`, `set`), and single values
+     * are accessed with `getValue(row, name)` / `setValue(row, name, value)`.
+     * `column(name)` returns the numeric columns as TypedArrays of the column
+     * type (one memcpy; a view on the table memory would dangle once rows are
+     * added), and the others as Arrays. `setColumn(name, values)` writes a whole
+     * column back, with a single memcpy for a TypedArray of the column type.
+     *
+     * The vectorised kernels (see rosetta::kernels) run on numeric columns in a
+     * single call: `sum`, `minMax` ({min, max}), `meanVariance` ({mean,
+     * variance}), `dot`, `axpy`, `clamp` and `histogram`. Queries (see
+     * rosetta::Query) return row indices: `select(where, orderBy, limit)`,
+     * `count(where)` and `groupBy(key, where)` (an Array of {key, rows}).
+     *
+     * @example
+     * ```js
+     * const objects = new addon.GameObjectTable();
+     * objects.push(new addon.GameObject("Player", new addon.Vector3D(0, 0, 0)));
+     * const health = objects.column("health");          // Float32Array
+     * objects.setColumn("health", health.map(h => h * 2));
+     * objects.clamp("health", 0, 100);
+     * const { min, max } = objects.minMax("health");
+     * const weak = objects.select("health < 50", "name", 10);
+     * ```
+     * @param name JS class name (default: class name + "Table")
+     */
+    template <typename T>
+    void registerTableType(JsGenerator &generator, const std::string &name = "");
+
+} // namespace rosetta
+
+#include "inline/js_tables.hxx"
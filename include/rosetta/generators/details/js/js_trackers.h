@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <memory>
+#include <napi.h>
+#include <rosetta/delta.h>
+#include <string>
+#include <unordered_map>
+
+namespace rosetta {
+
+    class JsGenerator;
+
+    /**
+     * @brief JS class wrapping a rosetta::DirtyTracker<T>. It holds references
+     * on the tracked JS objects, so that they stay alive while tracked.
+     */
+    template <typename T> class JsTrackerWrapper : public Napi::ObjectWrap<JsTrackerWrapper<T>> {
+    public:
+        static Napi::FunctionReference constructor;
+        static void Init(Napi::Env env, Napi::Object exports, const std::string &class_name);
+
+        explicit JsTrackerWrapper(const Napi::CallbackInfo &info);
+
+    private:
+        Napi::Value Length(const Napi::CallbackInfo &info);
+        Napi::Value Contains(const Napi::CallbackInfo &info);
+        Napi::Value Track(const Napi::CallbackInfo &info);
+        Napi::Value Untrack(const Napi::CallbackInfo &info);
+        Napi::Value Clear(const Napi::CallbackInfo &info);
+        Napi::Value MarkDirty(const Napi::CallbackInfo &info);
+        Napi::Value IsDirty(const Napi::CallbackInfo &info);
+        Napi::Value DirtyMembers(const Napi::CallbackInfo &info);
+        Napi::Value DirtyObjects(const Napi::CallbackInfo &info);
+        Napi::Value Clean(const Napi::CallbackInfo &info);
+        Napi::Value CollectDelta(const Napi::CallbackInfo &info);
+        Napi::Value CollectChanges(const Napi::CallbackInfo &info);
+        static Napi::Value ApplyDelta(const Napi::CallbackInfo &info);
+
+        static T *objectArg(const Napi::CallbackInfo &info);
+
+        std::unique_ptr<DirtyTracker<T>>                     tracker_;
+        std::unordered_map<const T *, Napi::ObjectReference> owners_;
+    };
+
+    /**
+     * @brief Bind rosetta::DirtyTracker<T> to JavaScript (T must be bound).
+     *
+     * Members set from JS (or through setMemberValue in C++) mark tracked
+     * objects dirty. Changes are collected either as a binary delta (a Buffer,
+     * see collectDelta) or as an object of the changed members to update a JS
+     * mirror. Both clean the object.
+     *
+     * @example
+     * ```js
+     * const tracker = new addon.GameObjectTracker();
+     * tracker.track(player);
+     * player.health = 50;
+     * for (const object of tracker.dirtyObjects()) {
+     *     send(tracker.collectDelta(object));          // health only
+     * }
+     * addon.GameObjectTracker.applyDelta(remotePlayer, received);
+     *
+     * player.name = "Hero";
+     * Object.assign(mirror, tracker.collectChanges(player)); // { name: "Hero" }
+     * ```
+     * @param name JS class name (default: class name + "Tracker")
+     */
+    template <typename T>
+    void registerTrackerType(JsGenerator &generator, const std::string &name = "");
+
+} // namespace rosetta
+
+#include "inline/js_trackers.hxx"
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <exception>
+#include <stdexcept>
+
+namespace rosetta {
+
+    namespace detail {
+
+        // lua_resume changed signature with each Lua version
+        inline int luaResume(lua_State *co, lua_State *from, int nargs, int *nresults) {
+#if LUA_VERSION_NUM >= 504
+            return lua_resume(co, from, nargs, nresults);
+#elif LUA_VERSION_NUM >= 502
+            const int status = lua_resume(co, from, nargs);
+            *nresults        = lua_gettop(co);
+            return status;
+#else
+            (void)from;
+            const int status = lua_resume(co, nargs);
+            *nresults        = lua_gettop(co);
+            return status;
+#endif
+        }
+
+        inline constexpr const char *lua_async_scheduler_key = "rosetta.LuaAsyncScheduler";
+
+    } // namespace detail
+
+    inline LuaAsyncScheduler::LuaAsyncScheduler(WorkerPool &pool)
+        : pool(&pool), completions(std::make_shared<Completions>()) {}
+
+    inline LuaAsyncScheduler::~LuaAsyncScheduler() { shutdown(); }
+
+    inline LuaAsyncScheduler &LuaAsyncScheduler::of(lua_State *L) {
+        sol::state_view lua(L);
+        sol::table      registry = lua.registry();
+
+        sol::object scheduler = registry[detail::lua_async_scheduler_key];
+        if (!scheduler.is<std::shared_ptr<LuaAsyncScheduler>>()) {
+            registry[detail::lua_async_scheduler_key] = std::make_shared<LuaAsyncScheduler>();
+            scheduler = registry[detail::lua_async_scheduler_key];
+        }
+        return *scheduler.as<std::shared_ptr<LuaAsyncScheduler>>();
+    }
+
+    inline void LuaAsyncScheduler::set_pool(WorkerPool &pool) { this->pool = &pool; }
+
+    inline void LuaAsyncScheduler::submit(lua_State *L, std::function<std::any()> job,
+                                          ResultPusher push_result) {
+        // Reference the running coroutine, so that it stays alive while suspended
+        lua_pushthread(L);
+        sol::thread coroutine(L, -1);
+        lua_pop(L, 1);
+
+        const std::size_t id = next_id++;
+        suspended.insert(L);
+        waiting.emplace(id, Waiting{std::move(coroutine), std::move(push_result)});
+
+        pool->submit([completions = completions, id, job = std::move(job)] {
+            {
+                std::lock_guard lock(completions->mutex);
+                if (completions->cancelled) {
+                    return; // the object of the call may be gone
+                }
+                ++completions->running;
+            }
+            Completion completion{id};
+            try {
+                completion.value = job();
+                completion.ok    = true;
+            } catch (const std::exception &e) {
+                completion.error = e.what();
+            } catch (...) {
+                completion.error = "Unknown C++ exception";
+            }
+            std::lock_guard lock(completions->mutex);
+            completions->items.push_back(std::move(completion));
+            --completions->running;
+            completions->idle.notify_all();
+        });
+    }
+
+    inline void LuaAsyncScheduler::shutdown() {
+        std::unique_lock lock(completions->mutex);
+        completions->cancelled = true;
+        completions->idle.wait(lock, [this] { return completions->running == 0; });
+    }
+
+    inline std::size_t LuaAsyncScheduler::poll() {
+        std::vector<Completion> done;
+        {
+            std::lock_guard lock(completions->mutex);
+            done.swap(completions->items);
+        }
+
+        std::string first_error;
+        std::size_t resumed = 0;
+        for (auto &completion : done) {
+            auto it = waiting.find(completion.id);
+            if (it == waiting.end()) {
+                continue;
+            }
+            Waiting call = std::move(it->second);
+            waiting.erase(it);
+
+            lua_State *co = call.coroutine.thread_state();
+            suspended.erase(co);
+            if (completion.ok) {
+                // Converting the result may throw: the coroutine then gets the error
+                const int top = lua_gettop(co);
+                try {
+                    lua_pushboolean(co, 1);
+                    call.push_result(co, completion.value);
+                } catch (const std::exception &e) {
+                    lua_settop(co, top);
+                    completion.ok    = false;
+                    completion.error = e.what();
+                } catch (...) {
+                    lua_settop(co, top);
+                    completion.ok    = false;
+                    completion.error = "Unknown C++ exception";
+                }
+            }
+            if (!completion.ok) {
+                lua_pushboolean(co, 0);
+                lua_pushlstring(co, completion.error.data(), completion.error.size());
+            }
+
+            ++resumed;
+            int       nresults = 0;
+            const int status   = detail::luaResume(co, nullptr, 2, &nresults);
+            if (status == 0 || status == LUA_YIELD) {
+                lua_pop(co, nresults); // finished, or waiting for something else
+            } else {
+                if (first_error.empty()) {
+                    const char *message = lua_tostring(co, -1);
+                    first_error         = message ? message : "Unknown Lua error";
+                }
+                lua_pop(co, 1);
+            }
+        }
+
+        if (!first_error.empty()) {
+            throw std::runtime_error("Error in resumed Lua coroutine: " + first_error);
+        }
+        return resumed;
+    }
+
+    inline std::size_t LuaAsyncScheduler::pending() const { return waiting.size(); }
+
+    inline bool LuaAsyncScheduler::is_waiting(lua_State *co) const {
+        return suspended.count(co) != 0;
+    }
+
+} // namespace rosetta
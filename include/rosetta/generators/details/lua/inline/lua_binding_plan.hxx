@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <algorithm>
+#include <stdexcept>
+
+namespace rosetta {
+
+    template <typename T>
+    inline LuaBindingPlan& LuaBindingPlan::add_class(const std::string& class_name)
+    {
+        const auto& type_info = T::getStaticTypeInfo();
+        std::string final_class_name = class_name.empty() ? type_info.class_name : class_name;
+
+        if (std::find(classes.begin(), classes.end(), final_class_name) != classes.end()) {
+            throw std::runtime_error("Class '" + final_class_name + "' already in the plan");
+        }
+        classes.push_back(final_class_name);
+
+        // Converters are process wide: register them now rather than in each state
+        LuaGenerator::register_class_converters<T>(type_info.class_name);
+
+        auto binders = std::make_shared<const std::vector<LuaGenerator::UsertypeBinder<T>>>(
+            LuaGenerator::make_binders<T>());
+        steps.push_back([final_class_name, binders](sol::state_view lua) {
+            auto user_type = lua.new_usertype<T>(final_class_name);
+            for (const auto& binder : *binders) {
+                binder(user_type);
+            }
+        });
+
+        return *this;
+    }
+
+    template <typename... Classes> inline LuaBindingPlan& LuaBindingPlan::add_classes()
+    {
+        (add_class<Classes>(), ...);
+        return *this;
+    }
+
+    inline LuaBindingPlan& LuaBindingPlan::add_functions()
+    {
+        auto& registry = FunctionRegistry::instance();
+
+        std::vector<const FunctionInfo*> functions;
+        for (const auto& func_name : registry.getFunctionNames()) {
+            if (const auto* func_info = registry.getFunction(func_name)) {
+                functions.push_back(func_info);
+            }
+        }
+
+        steps.push_back([functions = std::move(functions)](sol::state_view lua) {
+            for (const auto* func_info : functions) {
+                lua.set_function(func_info->name, detail::makeLuaFunction(func_info));
+            }
+        });
+        return *this;
+    }
+
+    inline LuaBindingPlan& LuaBindingPlan::add_utilities()
+    {
+        utilities = true;
+        return *this;
+    }
+
+    inline void LuaBindingPlan::apply(sol::state_view lua) const
+    {
+        for (const auto& step : steps) {
+            step(lua);
+        }
+
+        if (utilities) {
+            lua["getAllClasses"] = [names = classes]() { return sol::as_table(names); };
+        }
+    }
+
+    inline const std::vector<std::string>& LuaBindingPlan::class_names() const { return classes; }
+
+} // namespace rosetta
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+
+namespace rosetta {
+
+    inline LuaFFIRegistry &LuaFFIRegistry::instance() {
+        static LuaFFIRegistry registry;
+        return registry;
+    }
+
+    template <typename T> inline void LuaFFIRegistry::register_scalar(const std::string &c_name) {
+        types[getTypeName<T>()] = CType{c_name, "", sizeof(T), alignof(T), {}};
+    }
+
+    template <typename T>
+    inline void LuaFFIRegistry::register_struct(const std::string &c_name,
+                                                const std::string &declaration) {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "Only trivially copyable types can be declared to the FFI");
+        types[getTypeName<T>()] = CType{c_name, declaration, sizeof(T), alignof(T), {}};
+    }
+
+    template <typename E> inline void LuaFFIRegistry::register_vector() {
+        const auto *element = find(getTypeName<E>());
+        if (!element || !element->declaration.empty()) {
+            throw std::runtime_error("No FFI scalar type for vector element: " +
+                                     getTypeName<E>());
+        }
+        arrays[getTypeName<std::vector<E>>()] =
+            ArrayType{element->name, [](void *ptr) -> std::pair<void *, std::size_t> {
+                          auto &vec = *static_cast<std::vector<E> *>(ptr);
+                          return {vec.data(), vec.size()};
+                      }};
+    }
+
+    inline const LuaFFIRegistry::CType *LuaFFIRegistry::find(const std::string &type_name) const {
+        auto it = types.find(type_name);
+        return it != types.end() ? &it->second : nullptr;
+    }
+
+    inline const LuaFFIRegistry::ArrayType *
+    LuaFFIRegistry::find_array(const std::string &type_name) const {
+        auto it = arrays.find(type_name);
+        return it != arrays.end() ? &it->second : nullptr;
+    }
+
+    template <typename T>
+    inline std::string LuaFFIRegistry::generate_cdef(const std::string &c_name) const {
+        struct Field {
+            std::size_t  offset;
+            std::size_t  size;
+            const CType *type;
+            std::string  name;
+        };
+
+        std::vector<Field> fields;
+        for (const auto *member : T::getStaticTypeInfo().getMembersInOrder()) {
+            if (!member->trivially_copyable || member->offset == MemberInfo::no_offset) {
+                continue;
+            }
+            const auto *type = find(member->type_name);
+            if (type && type->size == member->size) {
+                fields.push_back({member->offset, member->size, type, member->name});
+            }
+        }
+        if (fields.empty()) {
+            throw std::runtime_error("Class '" + c_name + "' has no member with an FFI type");
+        }
+        std::sort(fields.begin(), fields.end(),
+                  [](const Field &a, const Field &b) { return a.offset < b.offset; });
+
+        // Gaps (vtable pointer, opaque members, padding) are filled with bytes
+        std::ostringstream out;
+        out << "typedef struct " << c_name << " {\n";
+        std::size_t position = 0;
+        int         pad      = 0;
+        for (const auto &field : fields) {
+            if (field.offset < position) {
+                continue; // overlapping members (unions)
+            }
+            if (field.offset > position) {
+                out << "    uint8_t _pad" << pad++ << "[" << field.offset - position << "];\n";
+            }
+            out << "    " << field.type->name << " " << field.name << ";\n";
+            position = field.offset + field.size;
+        }
+        if (sizeof(T) > position) {
+            out << "    uint8_t _pad" << pad << "[" << sizeof(T) - position << "];\n";
+        }
+        out << "} " << c_name << ";\n";
+        return out.str();
+    }
+
+    template <typename T>
+    inline const LuaFFIRegistry::CType &LuaFFIRegistry::register_class(const std::string &c_name) {
+        CType type{c_name, generate_cdef<T>(c_name), sizeof(T), alignof(T), {}};
+        for (const auto *member : T::getStaticTypeInfo().getMembersInOrder()) {
+            const auto *member_type = find(member->type_name);
+            if (member_type && !member_type->declaration.empty() &&
+                std::find(type.dependencies.begin(), type.dependencies.end(),
+                          member->type_name) == type.dependencies.end()) {
+                type.dependencies.push_back(member->type_name);
+            }
+        }
+        auto &registered = types[getTypeName<T>()];
+        registered       = std::move(type);
+        return registered;
+    }
+
+    inline LuaFFIRegistry::LuaFFIRegistry() {
+        register_scalar<bool>("bool");
+        register_scalar<char>("char");
+        register_scalar<signed char>("int8_t");
+        register_scalar<unsigned char>("uint8_t");
+        register_scalar<short>("int16_t");
+        register_scalar<unsigned short>("uint16_t");
+        register_scalar<int>("int32_t");
+        register_scalar<unsigned int>("uint32_t");
+        register_scalar<long>(sizeof(long) == 8 ? "int64_t" : "int32_t");
+        register_scalar<unsigned long>(sizeof(long) == 8 ? "uint64_t" : "uint32_t");
+        register_scalar<long long>("int64_t");
+        register_scalar<unsigned long long>("uint64_t");
+        register_scalar<float>("float");
+        register_scalar<double>("double");
+
+        register_vector<int>();
+        register_vector<unsigned int>();
+        register_vector<std::size_t>();
+        register_vector<float>();
+        register_vector<double>();
+    }
+
+} // namespace rosetta
@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <stdexcept>
+#include <string>
+
+namespace rosetta {
+
+    namespace detail {
+
+        // Message handler of the protected calls: error message + Lua traceback
+        inline int luaTraceback(lua_State *L) {
+            const char *message = lua_tostring(L, 1);
+            if (message == nullptr) {
+                if (luaL_callmeta(L, 1, "__tostring") && lua_type(L, -1) == LUA_TSTRING) {
+                    return 1;
+                }
+                message = lua_pushfstring(L, "(error object is a %s value)", luaL_typename(L, 1));
+            }
+            luaL_traceback(L, L, message, 1);
+            return 1;
+        }
+
+    } // namespace detail
+
+    // ============================================================================
+    // LuaFunctionRef
+    // ============================================================================
+
+    inline LuaFunctionRef::LuaFunctionRef(lua_State *L, int index) { init(L, index); }
+
+    inline LuaFunctionRef::LuaFunctionRef(const sol::object &function) {
+        if (function.get_type() != sol::type::function) {
+            throw std::runtime_error("Expected Lua function");
+        }
+        lua_State *L = function.lua_state();
+        function.push();
+        init(L, -1);
+        lua_pop(L, 1);
+    }
+
+    inline LuaFunctionRef::~LuaFunctionRef() {
+        luaL_unref(L_, LUA_REGISTRYINDEX, function_ref);
+        luaL_unref(L_, LUA_REGISTRYINDEX, handler_ref);
+    }
+
+    inline void LuaFunctionRef::init(lua_State *L, int index) {
+        if (lua_type(L, index) != LUA_TFUNCTION) {
+            throw std::runtime_error("Expected Lua function");
+        }
+        index = lua_absindex(L, index);
+        L_    = sol::main_thread(L, L);
+
+        lua_pushvalue(L, index);
+        function_ref = luaL_ref(L, LUA_REGISTRYINDEX);
+        lua_pushcfunction(L, &detail::luaTraceback);
+        handler_ref = luaL_ref(L, LUA_REGISTRYINDEX);
+    }
+
+    inline lua_State *LuaFunctionRef::state() const { return L_; }
+
+    inline int LuaFunctionRef::push(lua_State *L) const {
+        lua_rawgeti(L, LUA_REGISTRYINDEX, handler_ref);
+        const int handler = lua_gettop(L);
+        lua_rawgeti(L, LUA_REGISTRYINDEX, function_ref);
+        return handler;
+    }
+
+    inline void LuaFunctionRef::raise(lua_State *L, int top) {
+        const char *message = lua_tostring(L, -1);
+        std::string error   = message ? message : "Unknown Lua error";
+        lua_settop(L, top);
+        throw std::runtime_error("Lua callback error: " + error);
+    }
+
+    template <typename Ret, typename... Args>
+    inline Ret LuaFunctionRef::call(Args &&...args) const {
+        lua_State *L   = L_;
+        const int  top = lua_gettop(L);
+        if (!lua_checkstack(L, static_cast<int>(sizeof...(Args)) + 2)) {
+            throw std::runtime_error("Lua stack overflow");
+        }
+
+        const int handler = push(L);
+        (detail::luaPushValue<std::decay_t<Args>>(L, args), ...);
+
+        constexpr int nresults = std::is_void_v<Ret> ? 0 : 1;
+        if (lua_pcall(L, static_cast<int>(sizeof...(Args)), nresults, handler) != 0) {
+            raise(L, top);
+        }
+
+        if constexpr (std::is_void_v<Ret>) {
+            lua_settop(L, top);
+        } else {
+            try {
+                Ret result = detail::luaToValue<std::decay_t<Ret>>(L, -1);
+                lua_settop(L, top);
+                return result;
+            } catch (...) {
+                lua_settop(L, top);
+                throw;
+            }
+        }
+    }
+
+    // ============================================================================
+    // LuaBatchCallback
+    // ============================================================================
+
+    template <typename Ret, typename... Args>
+    inline LuaBatchCallback<Ret, Args...>::LuaBatchCallback(const sol::object &function,
+                                                            std::size_t        batch_size)
+        : LuaBatchCallback(std::make_shared<LuaFunctionRef>(function), batch_size) {}
+
+    template <typename Ret, typename... Args>
+    inline LuaBatchCallback<Ret, Args...>::LuaBatchCallback(
+        std::shared_ptr<LuaFunctionRef> function, std::size_t batch_size)
+        : function_(std::move(function)), batch_size_(batch_size == 0 ? 1 : batch_size) {
+        std::apply([this](auto &...cols) { (cols.reserve(batch_size_), ...); }, columns_);
+    }
+
+    template <typename Ret, typename... Args>
+    inline void LuaBatchCallback<Ret, Args...>::push(Args... args) {
+        std::apply([&](auto &...cols) { (cols.push_back(std::forward<Args>(args)), ...); },
+                   columns_);
+        if (pending() >= batch_size_) {
+            flush();
+        }
+    }
+
+    template <typename Ret, typename... Args> inline void LuaBatchCallback<Ret, Args...>::flush() {
+        if (pending() == 0) {
+            return;
+        }
+        Results results = std::apply([this](auto &...cols) { return call(cols...); }, columns_);
+        std::apply([](auto &...cols) { (cols.clear(), ...); }, columns_);
+        if constexpr (!std::is_void_v<Ret>) {
+            results_.insert(results_.end(), std::make_move_iterator(results.begin()),
+                            std::make_move_iterator(results.end()));
+        }
+    }
+
+    // Runs inside the protected call: a Lua error unwinds it, so it must not own
+    // anything with a destructor. Stack: batch (light userdata), function.
+    template <typename Ret, typename... Args>
+    inline int LuaBatchCallback<Ret, Args...>::run(lua_State *L) {
+        auto *batch = static_cast<Batch *>(lua_touserdata(L, 1));
+        luaL_checkstack(L, static_cast<int>(sizeof...(Args)) + 1, nullptr);
+
+        constexpr int nresults = std::is_void_v<Ret> ? 0 : 1;
+        for (std::size_t i = 0; i < batch->size; ++i) {
+            lua_pushvalue(L, 2);
+            std::apply(
+                [L, i](auto *...cols) {
+                    (detail::luaPushValue<typename std::decay_t<decltype(*cols)>::value_type>(
+                         L, (*cols)[i]),
+                     ...);
+                },
+                batch->columns);
+            lua_call(L, static_cast<int>(sizeof...(Args)), nresults);
+            if constexpr (!std::is_void_v<Ret>) {
+                (*batch->results)[i] = detail::luaGetValue<std::decay_t<Ret>>(L, -1);
+                lua_pop(L, 1);
+            }
+        }
+        return 0;
+    }
+
+    template <typename Ret, typename... Args>
+    inline typename LuaBatchCallback<Ret, Args...>::Results
+    LuaBatchCallback<Ret, Args...>::call(const std::vector<std::decay_t<Args>> &...columns) {
+        const std::size_t sizes[] = {columns.size()...};
+        const std::size_t n       = sizes[0];
+        for (auto size : sizes) {
+            if (size != n) {
+                throw std::runtime_error("Batched callback columns must have the same size");
+            }
+        }
+
+        Results results(n);
+        if (n == 0) {
+            return results;
+        }
+        Batch batch{std::make_tuple(&columns...), &results, n};
+
+        lua_State *L   = function_->state();
+        const int  top = lua_gettop(L);
+        if (!lua_checkstack(L, 4)) {
+            throw std::runtime_error("Lua stack overflow");
+        }
+
+        // handler, runner, batch, function
+        const int handler = function_->push(L);
+        lua_pushcfunction(L, &LuaBatchCallback::run);
+        lua_insert(L, -2);
+        lua_pushlightuserdata(L, &batch);
+        lua_insert(L, -2);
+        if (lua_pcall(L, 2, 0, handler) != 0) {
+            LuaFunctionRef::raise(L, top);
+        }
+        lua_settop(L, top);
+        return results;
+    }
+
+    template <typename Ret, typename... Args>
+    inline typename LuaBatchCallback<Ret, Args...>::Results
+    LuaBatchCallback<Ret, Args...>::takeResults() {
+        Results results;
+        results.swap(results_);
+        return results;
+    }
+
+    template <typename Ret, typename... Args>
+    inline std::size_t LuaBatchCallback<Ret, Args...>::pending() const {
+        return std::get<0>(columns_).size();
+    }
+
+    template <typename Ret, typename... Args>
+    inline std::size_t LuaBatchCallback<Ret, Args...>::batchSize() const {
+        return batch_size_;
+    }
+
+    template <typename Ret, typename... Args>
+    inline std::function<void(Args...)> LuaBatchCallback<Ret, Args...>::asFunction() {
+        return [this](Args... args) { push(std::forward<Args>(args)...); };
+    }
+
+    // ============================================================================
+    // Converters
+    // ============================================================================
+
+    template <typename Ret, typename... Args>
+    inline void registerFunctorType(LuaGenerator & /*generator*/) {
+        using FuncType = std::function<Ret(Args...)>;
+
+        LuaGenerator::register_converter(
+            getTypeName<FuncType>(),
+            {// C++ to Lua: sol wraps the std::function as a callable
+             [](lua_State *L, const std::any &value) -> sol::object {
+                 return sol::make_object(L, std::any_cast<const FuncType &>(value));
+             },
+             // Lua to C++: the function is referenced once, not looked up per call
+             [](const sol::object &value) -> std::any {
+                 auto function = std::make_shared<LuaFunctionRef>(value);
+                 return FuncType([function](Args... args) -> Ret {
+                     return function->call<Ret>(std::forward<Args>(args)...);
+                 });
+             }});
+    }
+
+    inline void registerFunctorSupport(LuaGenerator &generator) {
+        // Unary functors
+        registerFunctorType<void, int>(generator);
+        registerFunctorType<void, double>(generator);
+        registerFunctorType<void, const std::string &>(generator);
+        registerFunctorType<int, int>(generator);
+        registerFunctorType<double, double>(generator);
+        registerFunctorType<std::string, const std::string &>(generator);
+
+        // Binary functors (for reduce)
+        registerFunctorType<int, int, int>(generator);
+        registerFunctorType<double, double, double>(generator);
+        registerFunctorType<std::string, const std::string &, const std::string &>(generator);
+
+        // Predicates
+        registerFunctorType<bool, int>(generator);
+        registerFunctorType<bool, double>(generator);
+        registerFunctorType<bool, const std::string &>(generator);
+
+        // Index-based functors (forEach with index)
+        registerFunctorType<void, int, size_t>(generator);
+        registerFunctorType<void, double, size_t>(generator);
+        registerFunctorType<void, const std::string &, size_t>(generator);
+    }
+
+} // namespace rosetta
@@ -3,8 +3,190 @@
  * LGPL v3 license
  * 
  */
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+
 namespace rosetta {
 
+    namespace detail {
+
+        template <typename... Ts> struct lua_type_list { };
+
+        // C++ types handled by the typed (sol3 native) member bindings
+        using LuaValueTypes = lua_type_list<bool, int, unsigned int, long, long long, std::size_t,
+            float, double, std::string>;
+
+        // ... and by the typed method bindings
+        using LuaReturnTypes = lua_type_list<void, bool, int, unsigned int, long, long long,
+            std::size_t, float, double, std::string>;
+        using LuaArgumentTypes = lua_type_list<bool, int, unsigned int, long, long long,
+            std::size_t, float, double, std::string, const std::string&>;
+        using LuaVectorArgumentTypes = lua_type_list<int, float, double>;
+
+        template <typename T> using LuaBinder = LuaGenerator::UsertypeBinder<T>;
+
+        template <typename T, typename M>
+        inline bool tryTypedMember(const MemberInfo& member, LuaBinder<T>& binder)
+        {
+            if (const auto* ptr = std::any_cast<M T::*>(&member.member_pointer)) {
+                binder = [member = &member, ptr = *ptr](sol::usertype<T>& user_type) {
+                    user_type[member->name] = sol::property(
+                        [ptr](const T& obj) { return obj.*ptr; },
+                        [member, ptr](T& obj, M value) {
+                            if (member->observable) {
+                                member->setter(&obj, std::any { std::move(value) });
+                                return;
+                            }
+                            obj.*ptr = std::move(value);
+                            T::getStaticTypeInfo().notifyMemberChanged(&obj, *member);
+                        });
+                };
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Bind a member as a typed sol3 property (no std::any) when its
+         * type is one of Ms. Writes notify the member observers like
+         * MemberInfo::setter (through it for observable members).
+         */
+        template <typename T, typename... Ms>
+        inline bool typedMember(
+            const MemberInfo& member, LuaBinder<T>& binder, lua_type_list<Ms...>)
+        {
+            return (tryTypedMember<T, Ms>(member, binder) || ...);
+        }
+
+        template <typename T, typename R, typename... A>
+        inline bool tryTypedMethod(const MethodInfo& method, LuaBinder<T>& binder)
+        {
+            if (const auto* ptr = std::any_cast<R (T::*)(A...)>(&method.method_pointer)) {
+                binder = [name = method.name, ptr = *ptr](
+                             sol::usertype<T>& user_type) { user_type[name] = ptr; };
+                return true;
+            }
+            if (const auto* ptr = std::any_cast<R (T::*)(A...) const>(&method.method_pointer)) {
+                binder = [name = method.name, ptr = *ptr](
+                             sol::usertype<T>& user_type) { user_type[name] = ptr; };
+                return true;
+            }
+            return false;
+        }
+
+        template <typename T, typename... Rs>
+        inline bool typedMethod0(
+            const MethodInfo& method, LuaBinder<T>& binder, lua_type_list<Rs...>)
+        {
+            return (tryTypedMethod<T, Rs>(method, binder) || ...);
+        }
+
+        template <typename T, typename R, typename... As>
+        inline bool typedMethod1For(
+            const MethodInfo& method, LuaBinder<T>& binder, lua_type_list<As...>)
+        {
+            return (tryTypedMethod<T, R, As>(method, binder) || ...);
+        }
+
+        template <typename T, typename... Rs, typename... As>
+        inline bool typedMethod1(const MethodInfo& method, LuaBinder<T>& binder,
+            lua_type_list<Rs...>, lua_type_list<As...> arguments)
+        {
+            return (typedMethod1For<T, Rs>(method, binder, arguments) || ...);
+        }
+
+        // Homogeneous numeric signatures, e.g. void move(double, double, double)
+        template <typename T, typename... As>
+        inline bool typedMethod2(
+            const MethodInfo& method, LuaBinder<T>& binder, lua_type_list<As...>)
+        {
+            return ((tryTypedMethod<T, void, As, As>(method, binder)
+                        || tryTypedMethod<T, As, As, As>(method, binder))
+                || ...);
+        }
+
+        template <typename T, typename... As>
+        inline bool typedMethod3(
+            const MethodInfo& method, LuaBinder<T>& binder, lua_type_list<As...>)
+        {
+            return ((tryTypedMethod<T, void, As, As, As>(method, binder)
+                        || tryTypedMethod<T, As, As, As, As>(method, binder))
+                || ...);
+        }
+
+        /**
+         * @brief Bind a method directly (`usertype[name] = &T::method`) when its
+         * signature is known at compile time: arity 0 or 1 with scalar or string
+         * types, arity 2 or 3 with homogeneous int/float/double parameters.
+         */
+        template <typename T>
+        inline bool typedMethod(const MethodInfo& method, LuaBinder<T>& binder)
+        {
+            switch (method.parameter_types.size()) {
+            case 0:
+                return typedMethod0<T>(method, binder, LuaReturnTypes {});
+            case 1:
+                return typedMethod1<T>(method, binder, LuaReturnTypes {}, LuaArgumentTypes {});
+            case 2:
+                return typedMethod2<T>(method, binder, LuaVectorArgumentTypes {});
+            case 3:
+                return typedMethod3<T>(method, binder, LuaVectorArgumentTypes {});
+            default:
+                return false;
+            }
+        }
+
+        inline constexpr const char* lua_property_subscriptions_key =
+            "rosetta.PropertySubscriptions";
+
+        // A subscription of onPropertyChanged, removed when collected
+        struct LuaPropertySubscription {
+            const TypeInfo* type_info;
+            const void* object;
+            std::size_t id;
+
+            ~LuaPropertySubscription() { type_info->unsubscribePropertyChanged(object, id); }
+        };
+
+        // Whether `self` holds its object by value (collected with it), rather
+        // than a pointer or a smart pointer to it
+        template <typename T>
+        inline bool luaOwnsObject(const sol::userdata& self)
+        {
+            lua_State* L = self.lua_state();
+            self.push(L);
+            bool owned = false;
+            if (lua_getmetatable(L, -1)) {
+                luaL_getmetatable(L, sol::usertype_traits<T>::metatable().c_str());
+                owned = lua_rawequal(L, -1, -2);
+                lua_pop(L, 2);
+            }
+            lua_pop(L, 1);
+            return owned;
+        }
+
+        // Keeps the subscriptions of the state until offPropertyChanged, or
+        // until the state is closed: { [id] = subscription } for objects owned
+        // by C++, and { [userdata] = { [id] = subscription } } with weak keys
+        // for objects owned by Lua, which also drops them with their object
+        inline sol::table luaPropertySubscriptions(sol::state_view lua, bool owned)
+        {
+            sol::table registry = lua.registry();
+            sol::object found = registry[lua_property_subscriptions_key];
+            if (found.get_type() != sol::type::table) {
+                sol::table by_object = lua.create_table();
+                by_object[sol::metatable_key] = lua.create_table_with("__mode", "k");
+                registry[lua_property_subscriptions_key] =
+                    lua.create_table_with("static", lua.create_table(), "owned", by_object);
+                found = registry[lua_property_subscriptions_key];
+            }
+            sol::table subscriptions = found;
+            return subscriptions[owned ? "owned" : "static"];
+        }
+
+    } // namespace detail
+
     template <typename T>
     inline LuaGenerator& LuaGenerator::bind_class(const std::string& class_name)
     {
@@ -21,20 +203,15 @@ namespace rosetta {
         }
         bound_classes.insert(final_class_name);
 
-        // Create Sol3 usertype
-        auto user_type = lua.new_usertype<T>(final_class_name);
-
-        // Bind constructors
-        bind_constructors<T>(user_type, type_info);
-
-        // Bind all members as properties
-        bind_members<T>(user_type, type_info);
+        // Members, arguments and return values of type T (fallback bindings)
+        register_class_converters<T>(type_info.class_name);
 
-        // Bind all methods
-        bind_methods<T>(user_type, type_info);
-
-        // Add introspection utilities
-        bind_introspection_utilities<T>(user_type);
+        // Create Sol3 usertype, then bind constructors, members, methods and
+        // introspection utilities
+        auto user_type = lua.new_usertype<T>(final_class_name);
+        for (const auto& binder : make_binders<T>()) {
+            binder(user_type);
+        }
 
         return *this;
     }
@@ -46,20 +223,60 @@ namespace rosetta {
     }
 
     template <typename T>
-    inline void LuaGenerator::bind_constructors(
-        sol::usertype<T>& user_type, const TypeInfo& type_info)
+    inline void LuaGenerator::register_class_converters(const std::string& class_name)
+    {
+        Converter converter;
+        converter.reference = [](lua_State* L, void* ptr) -> sol::object {
+            return sol::make_object(L, static_cast<T*>(ptr));
+        };
+        if constexpr (has_script_converter_v<LuaBackend, T>) {
+            const auto& entry = converterFor<LuaBackend, T>();
+            converter.to_lua = entry.to_script;
+            converter.from_lua = entry.from_script;
+        }
+        register_converter(getTypeName<T>(), converter);
+        if (!class_name.empty() && class_name != getTypeName<T>()) {
+            register_converter(class_name, converter);
+        }
+    }
+
+    template <typename T>
+    inline std::vector<LuaGenerator::UsertypeBinder<T>> LuaGenerator::make_binders()
+    {
+        static_assert(
+            std::is_base_of_v<Introspectable, T>, "Type must inherit from Introspectable");
+
+        const auto& type_info = T::getStaticTypeInfo();
+        std::vector<UsertypeBinder<T>> binders;
+        add_constructor_binders<T>(binders, type_info);
+        add_member_binders<T>(binders, type_info);
+        add_method_binders<T>(binders, type_info);
+        add_introspection_binders<T>(binders);
+        for (const auto* member : type_info.getMembersInOrder()) {
+            if (member->observable) {
+                add_property_changed_binders<T>(binders);
+                break;
+            }
+        }
+        return binders;
+    }
+
+    template <typename T>
+    inline void LuaGenerator::add_constructor_binders(
+        std::vector<UsertypeBinder<T>>& binders, const TypeInfo& type_info)
     {
         const auto& constructors = type_info.getConstructors();
 
         if (constructors.empty()) {
             // Default constructor only
-            user_type[sol::call_constructor] = sol::constructors<T()>();
+            binders.push_back([](sol::usertype<T>& user_type) {
+                user_type[sol::call_constructor] = sol::constructors<T()>();
+            });
             return;
         }
 
-        // Register all constructors generically
-        // Sol3 handles overload resolution automatically
-        user_type[sol::call_constructor] = [constructors](sol::variadic_args va) -> T* {
+        // Register all constructors generically, selected by argument count
+        auto construct = [&constructors](sol::variadic_args va) -> T* {
             size_t arg_count = va.size();
 
             // Find matching constructor
@@ -67,23 +284,10 @@ namespace rosetta {
                 if (ctor->parameter_types.size() == arg_count) {
                     // Convert Lua arguments to C++
                     std::vector<std::any> cpp_args;
+                    cpp_args.reserve(arg_count);
                     for (size_t i = 0; i < arg_count; ++i) {
-                        sol::object arg = va[i];
-                        std::any cpp_arg;
-
-                        const auto& param_type = ctor->parameter_types[i];
-                        if (param_type == "string") {
-                            cpp_arg = arg.as<std::string>();
-                        } else if (param_type == "int") {
-                            cpp_arg = arg.as<int>();
-                        } else if (param_type == "double") {
-                            cpp_arg = arg.as<double>();
-                        } else if (param_type == "float") {
-                            cpp_arg = arg.as<float>();
-                        } else if (param_type == "bool") {
-                            cpp_arg = arg.as<bool>();
-                        }
-                        cpp_args.push_back(cpp_arg);
+                        cpp_args.push_back(
+                            convert_lua_to_any(sol::object(va[i]), ctor->parameter_types[i]));
                     }
 
                     // Create object using factory
@@ -95,66 +299,41 @@ namespace rosetta {
             throw std::runtime_error(
                 "No matching constructor found for " + std::to_string(arg_count) + " arguments");
         };
+        binders.push_back([construct](sol::usertype<T>& user_type) {
+            user_type[sol::call_constructor] = construct;
+        });
     }
 
     template <typename T>
-    inline void LuaGenerator::bind_members(sol::usertype<T>& user_type, const TypeInfo& type_info)
+    inline void LuaGenerator::add_member_binders(
+        std::vector<UsertypeBinder<T>>& binders, const TypeInfo& type_info)
     {
-        for (const auto& member_name : type_info.getMemberNames()) {
-            const auto* member = type_info.getMember(member_name);
-            if (!member)
+        for (const auto* member : type_info.getMembersInOrder()) {
+            // Typed binding: sol3 reads and writes the field directly
+            UsertypeBinder<T> binder;
+            if (detail::typedMember<T>(*member, binder, detail::LuaValueTypes {})) {
+                binders.push_back(std::move(binder));
                 continue;
+            }
 
-            // Create property with getter and setter
-            user_type[member_name] = sol::property(
-                // Getter
-                [member_name](const T& obj) -> sol::object {
-                    auto value = obj.getMemberValue(member_name);
-                    const auto* mem = obj.getTypeInfo().getMember(member_name);
-
-                    // Convert based on type
-                    if (mem->type_name == "string") {
-                        return sol::make_object(
-                            obj.getTypeInfo().class_name, std::any_cast<std::string>(value));
-                    } else if (mem->type_name == "int") {
-                        return sol::make_object(
-                            obj.getTypeInfo().class_name, std::any_cast<int>(value));
-                    } else if (mem->type_name == "double") {
-                        return sol::make_object(
-                            obj.getTypeInfo().class_name, std::any_cast<double>(value));
-                    } else if (mem->type_name == "float") {
-                        return sol::make_object(
-                            obj.getTypeInfo().class_name, std::any_cast<float>(value));
-                    } else if (mem->type_name == "bool") {
-                        return sol::make_object(
-                            obj.getTypeInfo().class_name, std::any_cast<bool>(value));
-                    }
-                    return sol::lua_nil;
-                },
-                // Setter
-                [member_name](T& obj, sol::object lua_value) {
-                    const auto* mem = obj.getTypeInfo().getMember(member_name);
-                    std::any cpp_value;
-
-                    if (mem->type_name == "string") {
-                        cpp_value = lua_value.as<std::string>();
-                    } else if (mem->type_name == "int") {
-                        cpp_value = lua_value.as<int>();
-                    } else if (mem->type_name == "double") {
-                        cpp_value = lua_value.as<double>();
-                    } else if (mem->type_name == "float") {
-                        cpp_value = lua_value.as<float>();
-                    } else if (mem->type_name == "bool") {
-                        cpp_value = lua_value.as<bool>();
-                    }
-
-                    obj.setMemberValue(member_name, cpp_value);
-                });
+            // Type-erased fallback, with converters resolved by type name
+            binders.push_back([member](sol::usertype<T>& user_type) {
+                user_type[member->name] = sol::property(
+                    // Getter
+                    [member](sol::object self, sol::this_state s) -> sol::object {
+                        return get_member(s, &self.as<T&>(), *member, self);
+                    },
+                    // Setter
+                    [member](T& obj, sol::object lua_value) {
+                        member->setter(&obj, convert_lua_to_any(lua_value, member->type_name));
+                    });
+            });
         }
     }
 
     template <typename T>
-    inline void LuaGenerator::bind_methods(sol::usertype<T>& user_type, const TypeInfo& type_info)
+    inline void LuaGenerator::add_method_binders(
+        std::vector<UsertypeBinder<T>>& binders, const TypeInfo& type_info)
     {
         for (const auto& method_name : type_info.getMethodNames()) {
             const auto* method = type_info.getMethod(method_name);
@@ -165,148 +344,379 @@ namespace rosetta {
             if (is_getter_setter_method(method_name, type_info))
                 continue;
 
-            // Create Lua function wrapper
-            user_type[method_name] = [method_name](T& obj, sol::variadic_args va) -> sol::object {
-                const auto* method_info = obj.getTypeInfo().getMethod(method_name);
+            // Typed binding: sol3 calls the member function pointer directly
+            UsertypeBinder<T> binder;
+            if (!method->async && detail::typedMethod<T>(*method, binder)) {
+                binders.push_back(std::move(binder));
+                continue;
+            }
+
+            // Type-erased fallback
+            auto call = [method](T& obj, sol::variadic_args va) -> sol::object {
+                auto cpp_args = convert_arguments(*method, va);
+
+                // Call method and convert the result back to Lua
+                auto result = method->invoker(&obj, cpp_args);
+                return convert_any_to_lua(va.lua_state(), result, method->return_type);
+            };
+
+            if (method->async) {
+                add_async_method_binder<T>(binders, method, call);
+                continue;
+            }
+            binders.push_back([method_name, call](sol::usertype<T>& user_type) {
+                user_type[method_name] = call;
+            });
+        }
+    }
+
+    template <typename T, typename Call>
+    inline void LuaGenerator::add_async_method_binder(
+        std::vector<UsertypeBinder<T>>& binders, const MethodInfo* method, Call call)
+    {
+        // Queue the call on the pool of the state, then yield the coroutine. The
+        // job holds a raw pointer to the object: the scheduler cancels or waits
+        // for it before the state is closed (see LuaAsyncScheduler::shutdown)
+        auto start = [method](T& obj, sol::this_state s, sol::variadic_args va) {
+            LuaAsyncScheduler::of(s).submit(
+                s,
+                [method, target = &obj, args = convert_arguments(*method, va)] {
+                    return method->invoker(target, args);
+                },
+                [method](lua_State* L, const std::any& value) {
+                    convert_any_to_lua(L, value, method->return_type).push(L);
+                });
+        };
+
+        binders.push_back([method, start, call](sol::usertype<T>& user_type) {
+            // Resumed with (ok, result) by LuaAsyncScheduler::poll(). Outside of a
+            // coroutine, there is nothing to yield: run the method synchronously.
+            sol::state_view lua(user_type.lua_state());
+            sol::protected_function make = lua.load(R"(
+                local start, call = ...
+                return function(self, ...)
+                    local co, main = coroutine.running()
+                    if co == nil or main then return call(self, ...) end
+                    local ok, result = start(self, ...)
+                    if not ok then error(result, 2) end
+                    return result
+                end)");
+            sol::protected_function_result wrapper = make(sol::yielding(start), call);
+            if (!wrapper.valid()) {
+                sol::error err = wrapper;
+                throw std::runtime_error(
+                    "Cannot bind async method '" + method->name + "': " + err.what());
+            }
+            user_type[method->name] = wrapper.template get<sol::function>();
+        });
+    }
+
+    template <typename T>
+    inline void LuaGenerator::add_introspection_binders(std::vector<UsertypeBinder<T>>& binders)
+    {
+        binders.push_back([](sol::usertype<T>& user_type) {
+            user_type["getClassName"] = &T::getClassName;
+            user_type["getMemberNames"] = &T::getMemberNames;
+            user_type["getMethodNames"] = &T::getMethodNames;
+            user_type["hasMember"] = &T::hasMember;
+            user_type["hasMethod"] = &T::hasMethod;
+            user_type["toJSON"] = [](const T& obj) { return obj.toJSON(); };
+            user_type["fromJSON"] = [](T& obj, const std::string& json) { obj.fromJSON(json); };
+
+            // Dynamic member access
+            user_type["getMemberValue"] = [](sol::object self, const std::string& name,
+                                              sol::this_state s) -> sol::object {
+                T& obj = self.as<T&>();
+                const auto* member = obj.getTypeInfo().getMember(name);
+                if (!member) {
+                    throw std::runtime_error("Member not found: " + name);
+                }
+                return get_member(s, &obj, *member, self);
+            };
 
-                if (va.size() != method_info->parameter_types.size()) {
-                    throw std::runtime_error("Method '" + method_name + "' expects "
-                        + std::to_string(method_info->parameter_types.size()) + " arguments, got "
-                        + std::to_string(va.size()));
+            user_type["setMemberValue"] = [](T& obj, const std::string& name, sol::object value) {
+                const auto* member = obj.getTypeInfo().getMember(name);
+                if (!member) {
+                    throw std::runtime_error("Member not found: " + name);
+                }
+                member->setter(&obj, convert_lua_to_any(value, member->type_name));
+            };
+
+            user_type["callMethod"] = [](T& obj, const std::string& name, sol::table args,
+                                          sol::this_state s) -> sol::object {
+                const auto* method = obj.getTypeInfo().getMethod(name);
+                if (!method) {
+                    throw std::runtime_error("Method not found: " + name);
                 }
 
-                // Convert arguments
                 std::vector<std::any> cpp_args;
-                for (size_t i = 0; i < va.size(); ++i) {
-                    sol::object arg = va[i];
-                    const auto& param_type = method_info->parameter_types[i];
-
-                    if (param_type == "string") {
-                        cpp_args.push_back(arg.as<std::string>());
-                    } else if (param_type == "int") {
-                        cpp_args.push_back(arg.as<int>());
-                    } else if (param_type == "double") {
-                        cpp_args.push_back(arg.as<double>());
-                    } else if (param_type == "float") {
-                        cpp_args.push_back(arg.as<float>());
-                    } else if (param_type == "bool") {
-                        cpp_args.push_back(arg.as<bool>());
+                for (size_t i = 1; i <= args.size(); ++i) {
+                    // Convert based on expected parameter type
+                    if (i - 1 < method->parameter_types.size()) {
+                        sol::object arg = args[i];
+                        cpp_args.push_back(
+                            convert_lua_to_any(arg, method->parameter_types[i - 1]));
                     }
                 }
 
-                // Call method
-                auto result = obj.callMethod(method_name, cpp_args);
+                auto result = method->invoker(&obj, cpp_args);
+                return convert_any_to_lua(s, result, method->return_type);
+            };
+        });
+    }
 
-                // Convert result back to Lua
-                if (!result.has_value() || method_info->return_type == "void") {
-                    return sol::lua_nil;
+    template <typename T>
+    inline void LuaGenerator::add_property_changed_binders(std::vector<UsertypeBinder<T>>& binders)
+    {
+        // The callback receives { { member =, slot =, old =, new = }, ... }: one
+        // change, or those of the object in a batch
+        binders.push_back([](sol::usertype<T>& user_type) {
+            user_type["onPropertyChanged"] = [](sol::userdata self,
+                                                 sol::main_protected_function callback) {
+                const T& obj = self.as<const T&>();
+                const TypeInfo& type_info = T::getStaticTypeInfo();
+                const std::size_t id = type_info.subscribePropertyChanged(&obj,
+                    [callback](std::span<const PropertyChange> changes) {
+                        lua_State* L = callback.lua_state();
+                        sol::state_view lua(L);
+                        sol::table events = lua.create_table(static_cast<int>(changes.size()), 0);
+                        int idx = 1;
+                        for (const PropertyChange& change : changes) {
+                            const std::string& type_name = change.member->type_name;
+                            events[idx++] = lua.create_table_with("member", change.member->name,
+                                "slot", change.slot, "old",
+                                convert_any_to_lua(L, change.old_value, type_name), "new",
+                                convert_any_to_lua(L, change.new_value, type_name));
+                        }
+                        sol::protected_function_result result = callback(events);
+                        if (!result.valid()) {
+                            sol::error err = result;
+                            throw std::runtime_error(err.what());
+                        }
+                    });
+
+                std::unique_ptr<detail::LuaPropertySubscription> subscription(
+                    new detail::LuaPropertySubscription { &type_info, &obj, id });
+                sol::state_view lua(callback.lua_state());
+                if (detail::luaOwnsObject<T>(self)) {
+                    sol::table by_object = detail::luaPropertySubscriptions(lua, true);
+                    sol::object found = by_object.raw_get<sol::object>(self);
+                    if (found.get_type() != sol::type::table) {
+                        by_object.raw_set(self, lua.create_table());
+                        found = by_object.raw_get<sol::object>(self);
+                    }
+                    found.as<sol::table>().raw_set(id, std::move(subscription));
+                } else {
+                    sol::table by_id = detail::luaPropertySubscriptions(lua, false);
+                    by_id.raw_set(id, std::move(subscription));
                 }
-
-                auto& type_info = obj.getTypeInfo();
-                if (method_info->return_type == "string") {
-                    return sol::make_object(
-                        type_info.class_name, std::any_cast<std::string>(result));
-                } else if (method_info->return_type == "int") {
-                    return sol::make_object(type_info.class_name, std::any_cast<int>(result));
-                } else if (method_info->return_type == "double") {
-                    return sol::make_object(type_info.class_name, std::any_cast<double>(result));
-                } else if (method_info->return_type == "float") {
-                    return sol::make_object(type_info.class_name, std::any_cast<float>(result));
-                } else if (method_info->return_type == "bool") {
-                    return sol::make_object(type_info.class_name, std::any_cast<bool>(result));
+                return id;
+            };
+            user_type["offPropertyChanged"] = [](sol::userdata self, std::size_t id) {
+                const T& obj = self.as<const T&>();
+                T::getStaticTypeInfo().unsubscribePropertyChanged(&obj, id);
+                sol::state_view lua(self.lua_state());
+                if (detail::luaOwnsObject<T>(self)) {
+                    sol::object found = detail::luaPropertySubscriptions(lua, true)
+                                            .raw_get<sol::object>(self);
+                    if (found.get_type() == sol::type::table) {
+                        found.as<sol::table>().raw_set(id, sol::lua_nil);
+                    }
+                } else {
+                    detail::luaPropertySubscriptions(lua, false).raw_set(id, sol::lua_nil);
                 }
-
-                return sol::lua_nil;
             };
+
+            // Coalesce the changes until the outermost batch ends (e.g. per frame)
+            sol::state_view lua(user_type.lua_state());
+            lua["beginPropertyBatch"] = &beginPropertyBatch;
+            lua["endPropertyBatch"] = &endPropertyBatch;
+            lua["flushPropertyChanges"] = &flushPropertyChanges;
+        });
+    }
+
+    inline std::unordered_map<std::string, LuaGenerator::Converter>& LuaGenerator::converters()
+    {
+        static std::unordered_map<std::string, Converter> table = [] {
+            std::unordered_map<std::string, Converter> builtins;
+            forEachBuiltinConverter<LuaBackend>(
+                [&builtins](const std::string& type_name, const ConverterEntry<LuaBackend>& entry) {
+                    builtins[type_name] = Converter { entry.to_script, entry.from_script };
+                });
+            return builtins;
+        }();
+        return table;
+    }
+
+    inline std::shared_mutex& LuaGenerator::converters_mutex()
+    {
+        static std::shared_mutex mutex;
+        return mutex;
+    }
+
+    inline void LuaGenerator::register_converter(const std::string& type_name, Converter converter)
+    {
+        std::unique_lock lock(converters_mutex());
+        converters()[type_name] = std::move(converter);
+    }
+
+    inline const LuaGenerator::Converter* LuaGenerator::find_converter(
+        const std::string& type_name)
+    {
+        // Entries are never erased, so the returned pointer stays valid
+        std::shared_lock lock(converters_mutex());
+        auto& table = converters();
+        auto it = table.find(type_name);
+        return it != table.end() ? &it->second : nullptr;
+    }
+
+    inline sol::object LuaGenerator::convert_any_to_lua(
+        lua_State* L, const std::any& value, const std::string& type_name)
+    {
+        if (!value.has_value() || type_name == "void") {
+            return sol::lua_nil;
+        }
+        const auto* converter = find_converter(type_name);
+        if (!converter || !converter->to_lua) {
+            return sol::lua_nil;
+        }
+        return converter->to_lua(L, value);
+    }
+
+    inline std::any LuaGenerator::convert_lua_to_any(
+        const sol::object& lua_value, const std::string& type_name)
+    {
+        const auto* converter = find_converter(type_name);
+        if (!converter || !converter->from_lua) {
+            throw std::runtime_error("Unsupported type conversion for: " + type_name);
         }
+        return converter->from_lua(lua_value);
+    }
+
+    inline sol::object LuaGenerator::get_member(
+        lua_State* L, void* obj, const MemberInfo& member, const sol::object& parent)
+    {
+        const auto* converter = find_converter(member.type_name);
+        if (converter && converter->view && member.address && parent.valid()) {
+            return converter->view(L, member.address(obj), parent);
+        }
+        if (converter && converter->reference && member.address) {
+            return converter->reference(L, member.address(obj));
+        }
+        return convert_any_to_lua(L, member.getter(obj), member.type_name);
     }
 
     template <typename T>
-    inline void LuaGenerator::bind_introspection_utilities(sol::usertype<T>& user_type)
+    inline LuaGenerator& LuaGenerator::bind_ffi(const std::string& class_name)
     {
-        user_type["getClassName"] = &T::getClassName;
-        user_type["getMemberNames"] = &T::getMemberNames;
-        user_type["getMethodNames"] = &T::getMethodNames;
-        user_type["hasMember"] = &T::hasMember;
-        user_type["hasMethod"] = &T::hasMethod;
-        user_type["toJSON"] = &T::toJSON;
-
-        // Dynamic member access
-        user_type["getMemberValue"] = [](const T& obj, const std::string& name) -> sol::object {
-            auto value = obj.getMemberValue(name);
-            const auto* member = obj.getTypeInfo().getMember(name);
+        const auto& type_info = T::getStaticTypeInfo();
+        std::string final_class_name = class_name.empty() ? type_info.class_name : class_name;
+        if (bound_classes.find(final_class_name) == bound_classes.end()) {
+            throw std::runtime_error(
+                "Class '" + final_class_name + "' must be bound before bind_ffi");
+        }
 
-            if (member->type_name == "string") {
-                return sol::make_object(
-                    obj.getTypeInfo().class_name, std::any_cast<std::string>(value));
-            } else if (member->type_name == "int") {
-                return sol::make_object(obj.getTypeInfo().class_name, std::any_cast<int>(value));
-            } else if (member->type_name == "double") {
-                return sol::make_object(obj.getTypeInfo().class_name, std::any_cast<double>(value));
-            }
-            return sol::lua_nil;
-        };
+        sol::table ffi = require_ffi();
+        const auto& type = LuaFFIRegistry::instance().register_class<T>(final_class_name);
+        declare_ffi_type(ffi, type);
 
-        user_type["setMemberValue"] = [](T& obj, const std::string& name, sol::object value) {
+        sol::table cls = lua[final_class_name];
+        cls["ffiAddress"] = [](T& obj) -> void* { return &obj; };
+        cls["ffiArrayAddress"] = [](T& obj, const std::string& name)
+            -> std::tuple<void*, std::size_t, std::string> {
             const auto* member = obj.getTypeInfo().getMember(name);
             if (!member) {
                 throw std::runtime_error("Member not found: " + name);
             }
-
-            std::any cpp_value;
-            if (member->type_name == "string") {
-                cpp_value = value.as<std::string>();
-            } else if (member->type_name == "int") {
-                cpp_value = value.as<int>();
-            } else if (member->type_name == "double") {
-                cpp_value = value.as<double>();
+            const auto* array = LuaFFIRegistry::instance().find_array(member->type_name);
+            if (!array || !member->address) {
+                throw std::runtime_error("Member '" + name + "' is not an FFI array");
             }
-            obj.setMemberValue(name, cpp_value);
+            auto [data, size] = array->data(member->address(&obj));
+            return { data, size, array->element };
         };
 
-        user_type["callMethod"]
-            = [](T& obj, const std::string& name, sol::table args) -> sol::object {
-            const auto* method = obj.getTypeInfo().getMethod(name);
-            if (!method) {
-                throw std::runtime_error("Method not found: " + name);
-            }
+        // The casts are done on the Lua side, with the ctypes resolved once
+        sol::protected_function make = lua.load(R"(
+            local ffi, name = ...
+            local ptr_t, element_t = ffi.typeof(name .. "*"), {}
+            return function(self)
+                return ffi.cast(ptr_t, self:ffiAddress())
+            end, function(self, member)
+                local data, size, element = self:ffiArrayAddress(member)
+                element_t[element] = element_t[element] or ffi.typeof(element .. "*")
+                return ffi.cast(element_t[element], data), size
+            end)");
+        sol::protected_function_result accessors = make(ffi, final_class_name);
+        if (!accessors.valid()) {
+            sol::error err = accessors;
+            throw std::runtime_error("bind_ffi failed for " + final_class_name + ": " + err.what());
+        }
+        cls["ffi"] = accessors.get<sol::function>(0);
+        cls["ffiArray"] = accessors.get<sol::function>(1);
 
-            std::vector<std::any> cpp_args;
-            for (size_t i = 1; i <= args.size(); ++i) {
-                sol::object arg = args[i];
-                // Convert based on expected parameter type
-                if (i - 1 < method->parameter_types.size()) {
-                    const auto& param_type = method->parameter_types[i - 1];
-                    if (param_type == "string") {
-                        cpp_args.push_back(arg.as<std::string>());
-                    } else if (param_type == "int") {
-                        cpp_args.push_back(arg.as<int>());
-                    } else if (param_type == "double") {
-                        cpp_args.push_back(arg.as<double>());
-                    }
-                }
-            }
+        return *this;
+    }
 
-            auto result = obj.callMethod(name, cpp_args);
+    inline bool LuaGenerator::has_ffi() const
+    {
+        auto result = lua.safe_script("return require('ffi')", sol::script_pass_on_error);
+        return result.valid();
+    }
 
-            if (!result.has_value() || method->return_type == "void") {
-                return sol::lua_nil;
-            }
+    inline sol::table LuaGenerator::require_ffi() const
+    {
+        auto result = lua.safe_script("return require('ffi')", sol::script_pass_on_error);
+        if (!result.valid()) {
+            throw std::runtime_error("LuaJIT FFI is not available in this Lua state");
+        }
+        return result.get<sol::table>();
+    }
 
-            // Convert result
-            if (method->return_type == "string") {
-                return sol::make_object(
-                    obj.getTypeInfo().class_name, std::any_cast<std::string>(result));
-            } else if (method->return_type == "int") {
-                return sol::make_object(obj.getTypeInfo().class_name, std::any_cast<int>(result));
+    inline void LuaGenerator::declare_ffi_type(
+        sol::table& ffi, const LuaFFIRegistry::CType& type) const
+    {
+        if (type.declaration.empty()) {
+            return; // built-in C type
+        }
+        for (const auto& dependency : type.dependencies) {
+            if (const auto* dependency_type = LuaFFIRegistry::instance().find(dependency)) {
+                declare_ffi_type(ffi, *dependency_type);
             }
+        }
 
-            return sol::lua_nil;
-        };
+        // ffi.cdef fails on redefinitions, so only declare unknown types
+        sol::protected_function declare = lua.load(R"(
+            local ffi, name, declaration = ...
+            if not pcall(ffi.typeof, name) then ffi.cdef(declaration) end)");
+        sol::protected_function_result result = declare(ffi, type.name, type.declaration);
+        if (!result.valid()) {
+            sol::error err = result;
+            throw std::runtime_error("ffi.cdef failed for " + type.name + ": " + err.what());
+        }
+    }
+
+    inline std::vector<std::any> LuaGenerator::convert_arguments(
+        const MethodInfo& method, const sol::variadic_args& va)
+    {
+        if (va.size() != method.parameter_types.size()) {
+            throw std::runtime_error("Method '" + method.name + "' expects "
+                + std::to_string(method.parameter_types.size()) + " arguments, got "
+                + std::to_string(va.size()));
+        }
+
+        std::vector<std::any> cpp_args;
+        cpp_args.reserve(va.size());
+        for (size_t i = 0; i < va.size(); ++i) {
+            cpp_args.push_back(convert_lua_to_any(sol::object(va[i]), method.parameter_types[i]));
+        }
+        return cpp_args;
     }
 
+    inline std::size_t LuaGenerator::poll() { return LuaAsyncScheduler::of(lua).poll(); }
+
     inline bool LuaGenerator::is_getter_setter_method(
-        const std::string& method_name, const TypeInfo& type_info) const
+        const std::string& method_name, const TypeInfo& type_info)
     {
         if (method_name.starts_with("get") && method_name.length() > 3) {
             std::string potential_member = method_name.substr(3);
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <stdexcept>
+
+namespace rosetta {
+
+    namespace detail {
+
+        inline std::vector<std::string> luaIndexMembers(const sol::table& members)
+        {
+            std::vector<std::string> names;
+            for (std::size_t i = 1; i <= members.size(); ++i) {
+                names.push_back(members.get<std::string>(i));
+            }
+            return names;
+        }
+
+        inline QueryValue luaIndexValue(const sol::object& value)
+        {
+            switch (value.get_type()) {
+            case sol::type::boolean:
+                return value.as<bool>();
+            case sol::type::number:
+                return value.as<double>();
+            case sol::type::string:
+                return value.as<std::string>();
+            default:
+                throw std::runtime_error("Index keys are numbers, booleans or strings");
+            }
+        }
+
+        // A value, or an array of values for several members
+        inline IndexKey luaIndexKey(const sol::object& values)
+        {
+            IndexKey key;
+            if (values.get_type() == sol::type::table) {
+                const sol::table table = values.as<sol::table>();
+                for (std::size_t i = 1; i <= table.size(); ++i) {
+                    key.push_back(luaIndexValue(table.get<sol::object>(i)));
+                }
+            } else {
+                key.push_back(luaIndexValue(values));
+            }
+            return key;
+        }
+
+        template <typename T>
+        inline sol::table luaIndexObjects(
+            const LuaIndex<T>& index, const std::vector<T*>& objects, sol::this_state s)
+        {
+            sol::state_view lua(s);
+            sol::table result = lua.create_table(static_cast<int>(objects.size()), 0);
+            for (std::size_t i = 0; i < objects.size(); ++i) {
+                result[i + 1] = index.owners.at(objects[i]);
+            }
+            return result;
+        }
+
+    } // namespace detail
+
+    template <typename T>
+    inline LuaIndex<T>::LuaIndex(const std::string& kind, const sol::table& members)
+        : index(indexKindFromName(kind), detail::luaIndexMembers(members))
+    {
+    }
+
+    template <typename T> inline void registerIndexType(sol::state& lua, const std::string& name)
+    {
+        using IndexType = LuaIndex<T>;
+        const std::string class_name =
+            name.empty() ? T::getStaticTypeInfo().class_name + "Index" : name;
+
+        lua.new_usertype<IndexType>(class_name,
+            sol::constructors<IndexType(const std::string&, const sol::table&)>(),
+            sol::meta_function::length, [](const IndexType& index) { return index.index.size(); },
+            "size", [](const IndexType& index) { return index.index.size(); },
+            "contains",
+            [](const IndexType& index, const T& object) { return index.index.contains(object); },
+            "add",
+            [](IndexType& index, sol::object object) {
+                T& value = object.as<T&>();
+                index.index.insert(value);
+                index.owners.emplace(&value, object);
+            },
+            "remove",
+            [](IndexType& index, const T& object) {
+                index.index.erase(object);
+                index.owners.erase(&object);
+            },
+            "update", [](IndexType& index, const T& object) { index.index.update(object); },
+            "clear",
+            [](IndexType& index) {
+                index.index.clear();
+                index.owners.clear();
+            },
+            "lookup",
+            [](const IndexType& index, sol::variadic_args values, sol::this_state s) {
+                IndexKey key;
+                for (const auto& value : values) {
+                    key.push_back(detail::luaIndexValue(value.get<sol::object>()));
+                }
+                return detail::luaIndexObjects(index, index.index.lookup(key), s);
+            },
+            "range",
+            [](const IndexType& index, const sol::object& lo, const sol::object& hi,
+                sol::this_state s) {
+                return detail::luaIndexObjects(index,
+                    index.index.range(detail::luaIndexKey(lo), detail::luaIndexKey(hi)), s);
+            });
+    }
+
+} // namespace rosetta
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <algorithm>
+
+namespace rosetta {
+
+    inline void LuaScriptStats::registerIntrospection(TypeRegistrar<LuaScriptStats> reg) {
+        reg.member("name", &LuaScriptStats::name)
+            .member("total_us", &LuaScriptStats::total_us)
+            .member("last_frame_us", &LuaScriptStats::last_frame_us)
+            .member("max_frame_us", &LuaScriptStats::max_frame_us)
+            .member("resumes", &LuaScriptStats::resumes)
+            .member("preemptions", &LuaScriptStats::preemptions)
+            .member("instructions", &LuaScriptStats::instructions)
+            .member("finished", &LuaScriptStats::finished)
+            .member("error", &LuaScriptStats::error);
+    }
+
+    inline void LuaMethodStats::registerIntrospection(TypeRegistrar<LuaMethodStats> reg) {
+        reg.member("name", &LuaMethodStats::name)
+            .member("calls", &LuaMethodStats::calls)
+            .member("total_us", &LuaMethodStats::total_us);
+    }
+
+    inline void LuaFrameStats::registerIntrospection(TypeRegistrar<LuaFrameStats> reg) {
+        reg.member("frame", &LuaFrameStats::frame)
+            .member("budget_us", &LuaFrameStats::budget_us)
+            .member("used_us", &LuaFrameStats::used_us)
+            .member("resumed", &LuaFrameStats::resumed)
+            .member("skipped", &LuaFrameStats::skipped)
+            .member("preemptions", &LuaFrameStats::preemptions)
+            .member("scripts", &LuaFrameStats::scripts);
+    }
+
+    namespace detail {
+
+        inline double luaMicroseconds(LuaScheduler::Clock::duration d) {
+            return std::chrono::duration<double, std::micro>(d).count();
+        }
+
+        // Alive scripts are suspended by a yield; finished ones returned or failed
+        inline bool luaCoroutineDone(lua_State *co) { return lua_status(co) != LUA_YIELD; }
+
+    } // namespace detail
+
+    inline LuaScheduler::LuaScheduler(sol::state_view lua)
+        : L_(sol::main_thread(lua.lua_state(), lua.lua_state())) {}
+
+    inline LuaScheduler::~LuaScheduler() {
+        for (auto &script : scripts_) {
+            lua_sethook(script->co, nullptr, 0, 0);
+        }
+    }
+
+    inline LuaScheduler::ScriptId LuaScheduler::add(const std::string &name,
+                                                    const sol::function &function,
+                                                    const sol::object &entity) {
+        auto script        = std::make_unique<Script>();
+        script->id         = next_id_++;
+        script->thread     = sol::thread::create(L_);
+        script->co         = script->thread.thread_state();
+        script->stats.name = name;
+
+        function.push(script->co);
+        if (entity.valid() && entity.get_type() != sol::type::lua_nil) {
+            entity.push(script->co);
+            script->nargs = 1;
+        }
+        set_hook(script->co);
+
+        const ScriptId id = script->id;
+        scripts_.push_back(std::move(script));
+        return id;
+    }
+
+    inline void LuaScheduler::remove(ScriptId id) {
+        auto it = std::find_if(scripts_.begin(), scripts_.end(),
+                               [id](const auto &script) { return script->id == id; });
+        if (it == scripts_.end()) {
+            return;
+        }
+        const auto index = static_cast<std::size_t>(it - scripts_.begin());
+        lua_sethook((*it)->co, nullptr, 0, 0);
+        scripts_.erase(it);
+        if (cursor_ > index) {
+            --cursor_;
+        }
+    }
+
+    inline std::size_t LuaScheduler::update(std::chrono::microseconds budget) {
+        const auto start    = Clock::now();
+        const auto deadline = start + budget;
+
+        frame_.frame += 1;
+        frame_.budget_us   = static_cast<double>(budget.count());
+        frame_.resumed     = 0;
+        frame_.skipped     = 0;
+        frame_.preemptions = 0;
+        for (auto &script : scripts_) {
+            script->stats.last_frame_us = 0;
+        }
+
+        // Coroutines waiting for an async method are resumed by its scheduler
+        const LuaAsyncScheduler &async = LuaAsyncScheduler::of(L_);
+
+        auto runnable = [&async](Script &script) {
+            if (script.stats.finished) {
+                return false;
+            }
+            if (script.started && detail::luaCoroutineDone(script.co)) {
+                script.stats.finished = true; // completed while resumed by `async`
+                if (lua_status(script.co) != 0) {
+                    const char *message = lua_tostring(script.co, -1);
+                    script.stats.error  = message ? message : "Unknown Lua error";
+                }
+                return false;
+            }
+            return !async.is_waiting(script.co);
+        };
+
+        LuaScheduler *previous = active_;
+        active_                = this;
+
+        const std::size_t count   = scripts_.size();
+        std::size_t       visited = 0;
+        for (; visited < count; ++visited, ++cursor_) {
+            if (cursor_ >= scripts_.size()) {
+                cursor_ = 0;
+            }
+            Script &script = *scripts_[cursor_];
+            if (!runnable(script)) {
+                continue;
+            }
+            if (Clock::now() >= deadline) {
+                break;
+            }
+            if (resume(script, deadline)) {
+                frame_.preemptions += 1;
+            }
+            frame_.resumed += 1;
+        }
+
+        // Runnable scripts that did not fit in the budget
+        for (std::size_t i = visited; i < count; ++i) {
+            if (runnable(*scripts_[(cursor_ + i - visited) % count])) {
+                frame_.skipped += 1;
+            }
+        }
+
+        active_        = previous;
+        frame_.used_us = detail::luaMicroseconds(Clock::now() - start);
+        frame_.scripts = size();
+        return frame_.resumed;
+    }
+
+    inline bool LuaScheduler::resume(Script &script, Clock::time_point frame_deadline) {
+        lua_State *co    = script.co;
+        const auto start = Clock::now();
+
+        deadline_ = frame_deadline;
+        if (script_budget_.count() > 0) {
+            deadline_ = std::min(deadline_, start + script_budget_);
+        }
+        running_   = &script;
+        preempted_ = false;
+
+        const int nargs = script.started ? 0 : script.nargs;
+        script.started  = true;
+
+        int       nresults = 0;
+        const int status   = detail::luaResume(co, L_, nargs, &nresults);
+
+        running_ = nullptr;
+        calls_.clear(); // calls left open by a yield or an error
+
+        const double elapsed = detail::luaMicroseconds(Clock::now() - start);
+        auto        &stats   = script.stats;
+        stats.resumes += 1;
+        stats.total_us += elapsed;
+        stats.last_frame_us += elapsed;
+        stats.max_frame_us = std::max(stats.max_frame_us, stats.last_frame_us);
+
+        if (status == LUA_YIELD) {
+            lua_pop(co, nresults);
+            if (preempted_) {
+                stats.preemptions += 1;
+            }
+            return preempted_;
+        }
+
+        stats.finished = true;
+        if (status == 0) {
+            lua_pop(co, nresults);
+            return false;
+        }
+
+        const char *message = lua_tostring(co, -1);
+        luaL_traceback(co, co, message ? message : "Unknown Lua error", 0);
+        stats.error = lua_tostring(co, -1);
+        lua_pop(co, 2);
+        if (on_error_) {
+            on_error_(stats);
+        }
+        return false;
+    }
+
+    inline void LuaScheduler::hook(lua_State *L, lua_Debug *ar) {
+        LuaScheduler *self = active_;
+        if (self == nullptr || self->running_ == nullptr) {
+            return; // resumed by someone else (e.g. LuaAsyncScheduler::poll)
+        }
+
+        switch (ar->event) {
+        case LUA_HOOKCOUNT: {
+            Script &script = *self->running_;
+            script.stats.instructions += static_cast<std::size_t>(self->quantum_);
+            // Coroutines created by the script inherit the hook: only suspend the
+            // script itself
+            if (L != script.co || Clock::now() < self->deadline_) {
+                return;
+            }
+#if LUA_VERSION_NUM >= 503
+            if (lua_isyieldable(L)) {
+                self->preempted_ = true;
+                lua_yield(L, 0);
+            }
+#endif
+            return;
+        }
+        case LUA_HOOKCALL:
+            self->on_call(L, ar);
+            return;
+        case LUA_HOOKRET:
+            self->on_return(L, ar);
+            return;
+        default:
+            return;
+        }
+    }
+
+    inline void LuaScheduler::on_call(lua_State *L, lua_Debug *ar) {
+        lua_getinfo(L, "Sf", ar);
+        const bool  native = ar->what != nullptr && ar->what[0] == 'C';
+        const void *key    = lua_topointer(L, -1);
+        lua_pop(L, 1);
+        if (!native) {
+            return;
+        }
+
+        auto [it, inserted] = methods_.try_emplace(key);
+        if (inserted) {
+            lua_getinfo(L, "n", ar);
+            it->second.name = ar->name ? ar->name : "?";
+        }
+        it->second.calls += 1;
+        calls_.push_back({&it->second, Clock::now()});
+    }
+
+    inline void LuaScheduler::on_return(lua_State *L, lua_Debug *ar) {
+        lua_getinfo(L, "S", ar);
+        if (ar->what == nullptr || ar->what[0] != 'C' || calls_.empty()) {
+            return;
+        }
+        const Call call = calls_.back();
+        calls_.pop_back();
+        call.stats->total_us += detail::luaMicroseconds(Clock::now() - call.start);
+    }
+
+    inline void LuaScheduler::set_hook(lua_State *co) const {
+        const int mask = LUA_MASKCOUNT | (profiling_ ? LUA_MASKCALL | LUA_MASKRET : 0);
+        lua_sethook(co, &LuaScheduler::hook, mask, quantum_);
+    }
+
+    inline void LuaScheduler::set_script_budget(std::chrono::microseconds budget) {
+        script_budget_ = budget;
+    }
+
+    inline void LuaScheduler::set_instruction_quantum(int count) {
+        quantum_ = std::max(count, 1);
+        for (auto &script : scripts_) {
+            set_hook(script->co);
+        }
+    }
+
+    inline void LuaScheduler::set_method_profiling(bool enabled) {
+        profiling_ = enabled;
+        for (auto &script : scripts_) {
+            set_hook(script->co);
+        }
+    }
+
+    inline void LuaScheduler::set_error_handler(ErrorHandler handler) {
+        on_error_ = std::move(handler);
+    }
+
+    inline const LuaScriptStats *LuaScheduler::stats(ScriptId id) const {
+        for (const auto &script : scripts_) {
+            if (script->id == id) {
+                return &script->stats;
+            }
+        }
+        return nullptr;
+    }
+
+    inline std::vector<const LuaScriptStats *> LuaScheduler::scripts() const {
+        std::vector<const LuaScriptStats *> result;
+        result.reserve(scripts_.size());
+        for (const auto &script : scripts_) {
+            result.push_back(&script->stats);
+        }
+        return result;
+    }
+
+    inline std::vector<LuaMethodStats> LuaScheduler::method_stats() const {
+        std::vector<LuaMethodStats> result;
+        result.reserve(methods_.size());
+        for (const auto &[key, stats] : methods_) {
+            result.push_back(stats);
+        }
+        // Hottest first
+        std::sort(result.begin(), result.end(),
+                  [](const auto &a, const auto &b) { return a.total_us > b.total_us; });
+        return result;
+    }
+
+    inline const LuaFrameStats &LuaScheduler::frame_stats() const { return frame_; }
+
+    inline void LuaScheduler::reset_method_stats() { methods_.clear(); }
+
+    inline std::size_t LuaScheduler::size() const {
+        return static_cast<std::size_t>(
+            std::count_if(scripts_.begin(), scripts_.end(),
+                          [](const auto &script) { return !script->stats.finished; }));
+    }
+
+} // namespace rosetta
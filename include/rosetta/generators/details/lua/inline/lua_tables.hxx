@@ -0,0 +1,269 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <stdexcept>
+#include <variant>
+
+namespace rosetta {
+
+    namespace detail {
+
+        inline LuaColumnView& checkColumnView(lua_State* L)
+        {
+            auto& view = sol::stack::get<LuaColumnView&>(L, 1);
+            if (!view.column) {
+                luaL_error(L, "Invalid column view");
+            }
+            return view;
+        }
+
+        inline std::size_t checkColumnIndex(lua_State* L, const ColumnStorage& column)
+        {
+            const lua_Integer i = luaL_checkinteger(L, 2);
+            if (i < 1 || static_cast<std::size_t>(i) > column.size()) {
+                luaL_error(L, "Index %d out of range [1, %d]", static_cast<int>(i),
+                    static_cast<int>(column.size()));
+            }
+            return static_cast<std::size_t>(i - 1); // Lua is 1-indexed
+        }
+
+        // Called by sol3 for keys that are not methods of the view
+        inline int luaColumnViewIndex(lua_State* L)
+        {
+            auto& view = checkColumnView(L);
+            if (lua_type(L, 2) != LUA_TNUMBER) {
+                lua_pushnil(L);
+                return 1;
+            }
+            const std::size_t i = checkColumnIndex(L, *view.column);
+            if (const auto type = view.column->numericType()) {
+                visitNumericType(*type, [&](auto identity) {
+                    using E = typename decltype(identity)::type;
+                    luaPushValue<E>(L, static_cast<const E*>(view.column->data())[i]);
+                });
+                return 1;
+            }
+            bool failed = false;
+            try {
+                LuaGenerator::convert_any_to_lua(L, view.column->get(i), view.type_name).push(L);
+            } catch (const std::exception& e) {
+                lua_pushstring(L, e.what());
+                failed = true;
+            }
+            return failed ? lua_error(L) : 1; // no Lua error across C++ frames
+        }
+
+        inline int luaColumnViewNewIndex(lua_State* L)
+        {
+            auto& view = checkColumnView(L);
+            const std::size_t i = checkColumnIndex(L, *view.column);
+            if (const auto type = view.column->numericType()) {
+                visitNumericType(*type, [&](auto identity) {
+                    using E = typename decltype(identity)::type;
+                    static_cast<E*>(view.column->data())[i] = luaGetValue<E>(L, 3);
+                });
+                return 0;
+            }
+            bool failed = false;
+            try {
+                view.column->set(i,
+                    LuaGenerator::convert_lua_to_any(sol::stack_object(L, 3), view.type_name));
+            } catch (const std::exception& e) {
+                lua_pushstring(L, e.what());
+                failed = true;
+            }
+            return failed ? lua_error(L) : 0;
+        }
+
+        inline sol::table columnViewToTable(const LuaColumnView& view, sol::this_state s)
+        {
+            lua_State* L = s;
+            const ColumnStorage& column = *view.column;
+            lua_createtable(L, static_cast<int>(column.size()), 0);
+            for (std::size_t i = 0; i < column.size(); ++i) {
+                if (const auto type = column.numericType()) {
+                    visitNumericType(*type, [&](auto identity) {
+                        using E = typename decltype(identity)::type;
+                        luaPushValue<E>(L, static_cast<const E*>(column.data())[i]);
+                    });
+                } else {
+                    LuaGenerator::convert_any_to_lua(L, column.get(i), view.type_name).push(L);
+                }
+                lua_rawseti(L, -2, static_cast<lua_Integer>(i + 1));
+            }
+            sol::table table(L, -1);
+            lua_pop(L, 1);
+            return table;
+        }
+
+        inline void columnViewAssign(LuaColumnView& view, const sol::table& values)
+        {
+            ColumnStorage& column = *view.column;
+            if (values.size() != column.size()) {
+                throw std::runtime_error("Column has " + std::to_string(column.size())
+                    + " rows, got " + std::to_string(values.size()) + " values");
+            }
+            for (std::size_t i = 0; i < column.size(); ++i) {
+                const auto value = values.raw_get<sol::object>(i + 1);
+                if (const auto type = column.numericType()) {
+                    visitNumericType(*type, [&](auto identity) {
+                        using E = typename decltype(identity)::type;
+                        static_cast<E*>(column.data())[i] = value.as<E>();
+                    });
+                } else {
+                    column.set(i, LuaGenerator::convert_lua_to_any(value, view.type_name));
+                }
+            }
+        }
+
+        inline void registerColumnView(sol::state& lua)
+        {
+            if (lua["TableColumn"].valid()) {
+                return;
+            }
+            lua.new_usertype<LuaColumnView>("TableColumn", sol::no_constructor,
+                sol::meta_function::index, &luaColumnViewIndex,
+                sol::meta_function::new_index, &luaColumnViewNewIndex,
+                sol::meta_function::length,
+                [](const LuaColumnView& v) { return v.column->size(); },
+                "size", [](const LuaColumnView& v) { return v.column->size(); },
+                "toTable", &columnViewToTable,
+                "assign", &columnViewAssign);
+        }
+
+        template <typename T>
+        inline const std::string& tableMemberType(const Table<T>& table, const std::string& name)
+        {
+            const MemberInfo* member = table.getTypeInfo().getMember(name);
+            if (!member) {
+                throw std::runtime_error("No member '" + name + "' in "
+                    + table.getTypeInfo().class_name);
+            }
+            return member->type_name;
+        }
+
+        template <typename T>
+        inline Query<T> tableQuery(const sol::optional<std::string>& where,
+            const sol::optional<std::string>& order_by, const sol::optional<lua_Integer>& limit)
+        {
+            Query<T> query;
+            if (where && !where->empty()) {
+                query.where(*where);
+            }
+            if (order_by && !order_by->empty()) {
+                query.orderBy(*order_by);
+            }
+            if (limit && *limit >= 0) {
+                query.limit(static_cast<std::size_t>(*limit));
+            }
+            return query;
+        }
+
+        // 1-indexed rows
+        inline sol::table luaRows(lua_State* L, const std::vector<std::size_t>& rows)
+        {
+            lua_createtable(L, static_cast<int>(rows.size()), 0);
+            for (std::size_t i = 0; i < rows.size(); ++i) {
+                lua_pushinteger(L, static_cast<lua_Integer>(rows[i] + 1));
+                lua_rawseti(L, -2, static_cast<lua_Integer>(i + 1));
+            }
+            sol::table table(L, -1);
+            lua_pop(L, 1);
+            return table;
+        }
+
+    } // namespace detail
+
+    template <typename T> inline void registerTableType(sol::state& lua, const std::string& name)
+    {
+        using TableType = Table<T>;
+        detail::registerColumnView(lua);
+        const std::string class_name =
+            name.empty() ? T::getStaticTypeInfo().class_name + "Table" : name;
+
+        // Rows are 1-indexed (0 wraps around and is rejected by the table)
+        auto type = lua.new_usertype<TableType>(class_name, sol::constructors<TableType()>(),
+            sol::meta_function::length, &TableType::size,
+            "size", &TableType::size,
+            "push", [](TableType& table, const T& value) { table.push_back(value); },
+            "get", [](const TableType& table, std::size_t row) { return table.get(row - 1); },
+            "set",
+            [](TableType& table, std::size_t row, const T& value) { table.set(row - 1, value); },
+            "erase", [](TableType& table, std::size_t row) { table.erase(row - 1); },
+            "clear", &TableType::clear,
+            "reserve", &TableType::reserve,
+            "columnNames",
+            [](const TableType& table) { return sol::as_table(table.columnNames()); },
+            "column",
+            [](sol::object self, const std::string& member) {
+                auto& table = self.as<TableType&>();
+                return LuaColumnView { &table.columnStorage(member),
+                    detail::tableMemberType(table, member), self };
+            },
+            "getValue",
+            [](const TableType& table, std::size_t row, const std::string& member,
+                sol::this_state s) {
+                return LuaGenerator::convert_any_to_lua(s, table[row - 1].getMemberValue(member),
+                    detail::tableMemberType(table, member));
+            },
+            "setValue",
+            [](TableType& table, std::size_t row, const std::string& member,
+                const sol::object& value) {
+                const auto& type_name = detail::tableMemberType(table, member);
+                table[row - 1].setMemberValue(member,
+                    LuaGenerator::convert_lua_to_any(value, type_name));
+            });
+
+        // Kernels over the numeric columns
+        type["sum"] = [](const TableType& table, const std::string& column) {
+            return kernels::sum(table.columnStorage(column));
+        };
+        type["minMax"] = [](const TableType& table, const std::string& column) {
+            const auto extrema = kernels::minMax(table.columnStorage(column));
+            return std::make_tuple(extrema.min, extrema.max);
+        };
+        type["meanVariance"] = [](const TableType& table, const std::string& column) {
+            const auto moments = kernels::meanVariance(table.columnStorage(column));
+            return std::make_tuple(moments.mean, moments.variance);
+        };
+        type["dot"] = [](const TableType& table, const std::string& x, const std::string& y) {
+            return kernels::dot(table.columnStorage(x), table.columnStorage(y));
+        };
+        type["axpy"] = [](TableType& table, double alpha, const std::string& x,
+                           const std::string& y) {
+            kernels::axpy(alpha, table.columnStorage(x), table.columnStorage(y));
+        };
+        type["clamp"] = [](TableType& table, const std::string& column, double lo, double hi) {
+            kernels::clamp(table.columnStorage(column), lo, hi);
+        };
+        type["histogram"] = [](const TableType& table, const std::string& column, double lo,
+                                double hi, std::size_t bins) {
+            return sol::as_table(kernels::histogram(table.columnStorage(column), lo, hi, bins));
+        };
+
+        // Queries, compiled and run in one call
+        type["select"] = [](const TableType& table, const sol::optional<std::string>& where,
+                             const sol::optional<std::string>& order_by,
+                             const sol::optional<lua_Integer>& limit, sol::this_state s) {
+            return detail::luaRows(
+                s, detail::tableQuery<T>(where, order_by, limit).indices(table));
+        };
+        type["count"] = [](const TableType& table, const sol::optional<std::string>& where) {
+            return detail::tableQuery<T>(where, sol::nullopt, sol::nullopt).count(table);
+        };
+        type["groupBy"] = [](const TableType& table, const std::string& key,
+                              const sol::optional<std::string>& where, sol::this_state s) {
+            sol::state_view lua(s);
+            sol::table groups = lua.create_table();
+            for (const auto& group :
+                detail::tableQuery<T>(where, sol::nullopt, sol::nullopt).groupBy(table, key)) {
+                const sol::object value = std::visit(
+                    [&](const auto& v) { return sol::make_object(lua, v); }, group.key);
+                groups[value] = detail::luaRows(s, group.rows);
+            }
+            return groups;
+        };
+    }
+
+} // namespace rosetta
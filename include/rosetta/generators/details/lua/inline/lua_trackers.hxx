@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+
+namespace rosetta {
+
+    namespace detail {
+
+        // { name = value } of the dirty members (copies), cleaning the object
+        template <typename T>
+        inline sol::table luaTrackerChanges(
+            LuaDirtyTracker<T>& tracker, const T& object, sol::this_state s)
+        {
+            sol::state_view lua(s);
+            sol::table changes = lua.create_table();
+            const auto& type_info = tracker.tracker.getTypeInfo();
+            for (const std::string& name : tracker.tracker.dirtyMembers(object)) {
+                const MemberInfo* member = type_info.getMember(name);
+                changes[name] = LuaGenerator::convert_any_to_lua(
+                    s, member->getter(&object), member->type_name);
+            }
+            tracker.tracker.clean(object);
+            return changes;
+        }
+
+    } // namespace detail
+
+    template <typename T> inline void registerTrackerType(sol::state& lua, const std::string& name)
+    {
+        using TrackerType = LuaDirtyTracker<T>;
+        const std::string class_name =
+            name.empty() ? T::getStaticTypeInfo().class_name + "Tracker" : name;
+
+        lua.new_usertype<TrackerType>(class_name, sol::constructors<TrackerType()>(),
+            sol::meta_function::length,
+            [](const TrackerType& tracker) { return tracker.tracker.size(); },
+            "size", [](const TrackerType& tracker) { return tracker.tracker.size(); },
+            "contains",
+            [](const TrackerType& tracker, const T& object) {
+                return tracker.tracker.isTracked(object);
+            },
+            "track",
+            [](TrackerType& tracker, sol::object object) {
+                const T& value = object.as<const T&>();
+                tracker.tracker.track(value);
+                tracker.owners.emplace(&value, object);
+            },
+            "untrack",
+            [](TrackerType& tracker, const T& object) {
+                tracker.tracker.untrack(object);
+                tracker.owners.erase(&object);
+            },
+            "clear",
+            [](TrackerType& tracker) {
+                tracker.tracker.clear();
+                tracker.owners.clear();
+            },
+            "markDirty",
+            [](TrackerType& tracker, const T& object, sol::variadic_args members) {
+                if (members.size() == 0) {
+                    tracker.tracker.markAllDirty(object);
+                }
+                for (const auto& member : members) {
+                    tracker.tracker.markDirty(object, member.get<std::string>());
+                }
+            },
+            "isDirty",
+            [](const TrackerType& tracker, const T& object, sol::optional<std::string> member) {
+                return member ? tracker.tracker.isDirty(object, *member)
+                              : tracker.tracker.isDirty(object);
+            },
+            "dirtyMembers",
+            [](const TrackerType& tracker, const T& object) {
+                return sol::as_table(tracker.tracker.dirtyMembers(object));
+            },
+            "dirtyObjects",
+            [](const TrackerType& tracker, sol::this_state s) {
+                sol::state_view lua(s);
+                const auto objects = tracker.tracker.dirtyObjects();
+                sol::table result = lua.create_table(static_cast<int>(objects.size()), 0);
+                for (std::size_t i = 0; i < objects.size(); ++i) {
+                    result[i + 1] = tracker.owners.at(objects[i]);
+                }
+                return result;
+            },
+            "clean", [](TrackerType& tracker, const T& object) { tracker.tracker.clean(object); },
+            "collectDelta",
+            [](TrackerType& tracker, const T& object) {
+                const auto delta = tracker.tracker.collectDelta(object);
+                return std::string(delta.begin(), delta.end());
+            },
+            "collectChanges", &detail::luaTrackerChanges<T>,
+            "applyDelta",
+            [](T& object, const std::string& delta) {
+                applyDelta(T::getStaticTypeInfo(), &object, delta.data(), delta.size());
+            });
+    }
+
+} // namespace rosetta
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <any>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <rosetta/worker_pool.h>
+#include <sol/sol.hpp>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace rosetta {
+
+    /**
+     * @brief Runs async methods (see `async_method`) of a Lua state on a
+     * WorkerPool, and resumes the calling coroutines when they complete.
+     *
+     * Called from a coroutine, an async method converts its arguments, queues
+     * the call on the pool and yields. The host calls poll() regularly (e.g.
+     * once per frame, on the thread owning the Lua state): finished calls have
+     * their result converted and their coroutine resumed, so scripts see a
+     * plain return value (or a Lua error if the method threw). Called outside
+     * of a coroutine, an async method simply runs synchronously.
+     *
+     * A coroutine waiting for a result must not be resumed by the script itself.
+     * The object the method is called on is kept alive by the suspended
+     * coroutine, and must not be touched by other scripts until the call
+     * returns.
+     *
+     * Destroying the scheduler (closing its state) cancels the calls that did
+     * not start and waits for the running ones. As closing a state may collect
+     * the objects of the running calls before the scheduler, call shutdown()
+     * before lua_close() while calls are in flight.
+     *
+     * @example
+     * ```lua
+     * coroutine.wrap(function()
+     *     local path = world:findPath(a, b) -- runs on a worker thread
+     *     agent:follow(path)
+     * end)()
+     * ```
+     * ```cpp
+     * while (running) {
+     *     rosetta::LuaAsyncScheduler::of(lua).poll();
+     *     // ... rest of the frame
+     * }
+     * ```
+     */
+    class LuaAsyncScheduler {
+    public:
+        explicit LuaAsyncScheduler(WorkerPool &pool = WorkerPool::shared());
+        ~LuaAsyncScheduler();
+
+        LuaAsyncScheduler(const LuaAsyncScheduler &)            = delete;
+        LuaAsyncScheduler &operator=(const LuaAsyncScheduler &) = delete;
+
+        /**
+         * @brief The scheduler of a Lua state, created on first use (and destroyed
+         * with the state)
+         */
+        static LuaAsyncScheduler &of(lua_State *L);
+
+        /**
+         * @brief Use another pool for the calls submitted from now on
+         */
+        void set_pool(WorkerPool &pool);
+
+        /**
+         * @brief Pushes the result of a job (in poll(), on the Lua thread)
+         */
+        using ResultPusher = std::function<void(lua_State *, const std::any &)>;
+
+        /**
+         * @brief Run `job` on the pool, then resume the running coroutine of `L`
+         * with `(true, result)` or `(false, error message)`. The caller must yield
+         * right after this call.
+         */
+        void submit(lua_State *L, std::function<std::any()> job, ResultPusher push_result);
+
+        /**
+         * @brief Resume the coroutines whose call completed. If the result of a
+         * call cannot be converted to Lua, its coroutine gets `(false, error message)`
+         * @return The number of resumed coroutines
+         * @throws std::runtime_error with the first error raised by a resumed
+         * coroutine (after all of them were resumed)
+         */
+        std::size_t poll();
+
+        /**
+         * @brief Cancel the calls that did not start on the pool, and wait for
+         * the running ones. The coroutines of cancelled calls are never
+         * resumed, and calls submitted afterwards are cancelled too.
+         */
+        void shutdown();
+
+        /**
+         * @brief Number of calls submitted and not yet resumed
+         */
+        std::size_t pending() const;
+
+        /**
+         * @brief Whether the coroutine `co` is suspended in an async call (it must
+         * then only be resumed by poll())
+         */
+        bool is_waiting(lua_State *co) const;
+
+    private:
+        // Lua side of a call (only touched on the Lua thread)
+        struct Waiting {
+            sol::thread  coroutine; // keeps the coroutine alive while suspended
+            ResultPusher push_result;
+        };
+
+        // Worker side of a call
+        struct Completion {
+            std::size_t id = 0;
+            bool        ok = false;
+            std::any    value;
+            std::string error;
+        };
+
+        // Shared with the queued jobs, which may outlive the scheduler
+        struct Completions {
+            std::mutex              mutex;
+            std::condition_variable idle;
+            std::vector<Completion> items;
+            std::size_t             running   = 0;
+            bool                    cancelled = false;
+        };
+
+        WorkerPool                              *pool;
+        std::shared_ptr<Completions>             completions;
+        std::unordered_map<std::size_t, Waiting> waiting;
+        std::unordered_set<lua_State *>          suspended;
+        std::size_t                              next_id = 0;
+    };
+
+} // namespace rosetta
+
+#include "inline/lua_async.hxx"
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include "lua_functions.h"
+#include "lua_generator.h"
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace rosetta {
+
+    /**
+     * @brief Bindings computed once and applied to many Lua states.
+     *
+     * LuaGenerator analyzes the TypeInfo of a class (typed or type-erased
+     * bindings, getter/setter detection, converter registration...) each time a
+     * class is bound. A plan does this work once; apply() then only creates the
+     * usertypes and functions in the given state. This is meant for servers
+     * running one Lua VM per worker thread or per request.
+     *
+     * Build the plan on one thread, then share it as a
+     * `std::shared_ptr<const LuaBindingPlan>`: apply() is const and can run
+     * concurrently on different states (the registries it reads are safe for
+     * concurrent readers).
+     *
+     * @example
+     * ```cpp
+     * auto plan = std::make_shared<rosetta::LuaBindingPlan>();
+     * plan->add_classes<Person, Vehicle>().add_functions().add_utilities();
+     * std::shared_ptr<const rosetta::LuaBindingPlan> shared = plan;
+     *
+     * // On each worker thread
+     * sol::state lua;
+     * shared->apply(lua);
+     * ```
+     */
+    class LuaBindingPlan {
+    public:
+        /**
+         * @brief Add an introspectable class
+         * @param class_name Optional custom class name (uses introspection name if empty)
+         */
+        template <typename T> LuaBindingPlan& add_class(const std::string& class_name = "");
+
+        template <typename... Classes> LuaBindingPlan& add_classes();
+
+        /**
+         * @brief Add the functions currently in the FunctionRegistry
+         */
+        LuaBindingPlan& add_functions();
+
+        /**
+         * @brief Add the module-level utilities of LuaGenerator (getAllClasses)
+         */
+        LuaBindingPlan& add_utilities();
+
+        /**
+         * @brief Create all the bindings in a Lua state
+         */
+        void apply(sol::state_view lua) const;
+
+        const std::vector<std::string>& class_names() const;
+
+    private:
+        std::vector<std::string>                          classes;
+        std::vector<std::function<void(sol::state_view)>> steps;
+        bool                                              utilities = false;
+    };
+
+} // namespace rosetta
+
+#include "inline/lua_binding_plan.hxx"
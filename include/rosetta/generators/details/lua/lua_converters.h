@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ *
+ * sol3 specializations of the shared converter traits (see rosetta/converters.h)
+ */
+#pragma once
+#include "lua_stack.h"
+#include <rosetta/converters.h>
+#include <sol/sol.hpp>
+#include <stdexcept>
+
+namespace rosetta {
+
+    /**
+     * @brief Converter backend of the LuaGenerator
+     */
+    struct LuaBackend {
+        using Context = lua_State*;
+        using Value = sol::object;
+        using Input = const sol::object&;
+        using ToScript = sol::object (*)(lua_State*, const std::any&);
+        using FromScript = std::any (*)(const sol::object&);
+    };
+
+    namespace detail {
+
+        // Pops the value pushed by the caller, also when the conversion throws
+        template <typename T> inline T luaObjectTo(const sol::object& value)
+        {
+            lua_State* L = value.lua_state();
+            if (L == nullptr) {
+                throw std::runtime_error("Expected a value, got nil");
+            }
+            value.push(L);
+            try {
+                T result = luaToValue<T>(L, -1);
+                lua_pop(L, 1);
+                return result;
+            } catch (...) {
+                lua_pop(L, 1);
+                throw;
+            }
+        }
+
+        template <typename T> inline sol::object luaObjectFrom(lua_State* L, const T& value)
+        {
+            luaPushValue<T>(L, value);
+            sol::object result(L, -1);
+            lua_pop(L, 1);
+            return result;
+        }
+
+    } // namespace detail
+
+    // Scalars and strings: raw stack access, C++ exception on type mismatch
+    template <typename T> struct ScriptConverter<LuaBackend, T, ValueKind::Bool> {
+        static sol::object to(lua_State* L, bool value) { return detail::luaObjectFrom(L, value); }
+        static T from(const sol::object& value) { return detail::luaObjectTo<T>(value); }
+    };
+
+    template <typename T> struct ScriptConverter<LuaBackend, T, ValueKind::Integer> {
+        static sol::object to(lua_State* L, T value) { return detail::luaObjectFrom(L, value); }
+        static T from(const sol::object& value) { return detail::luaObjectTo<T>(value); }
+    };
+
+    template <typename T> struct ScriptConverter<LuaBackend, T, ValueKind::Unsigned> {
+        static sol::object to(lua_State* L, T value) { return detail::luaObjectFrom(L, value); }
+        static T from(const sol::object& value) { return detail::luaObjectTo<T>(value); }
+    };
+
+    template <typename T> struct ScriptConverter<LuaBackend, T, ValueKind::Float> {
+        static sol::object to(lua_State* L, T value) { return detail::luaObjectFrom(L, value); }
+        static T from(const sol::object& value) { return detail::luaObjectTo<T>(value); }
+    };
+
+    template <typename T> struct ScriptConverter<LuaBackend, T, ValueKind::String> {
+        static sol::object to(lua_State* L, const T& value)
+        {
+            return detail::luaObjectFrom(L, value);
+        }
+        static T from(const sol::object& value) { return detail::luaObjectTo<T>(value); }
+    };
+
+    // Enums are integers (combined with `|` for flags); value names are accepted too
+    template <typename T> struct ScriptConverter<LuaBackend, T, ValueKind::Enum> {
+        using Underlying = std::underlying_type_t<T>;
+
+        static sol::object to(lua_State* L, T value)
+        {
+            return detail::luaObjectFrom(L, static_cast<Underlying>(value));
+        }
+        static T from(const sol::object& value)
+        {
+            if (value.get_type() == sol::type::string) {
+                const auto& info = detail::enumInfoFor<T>();
+                const auto name = value.as<std::string>();
+                return static_cast<T>(static_cast<Underlying>(info.getValue(name)));
+            }
+            return detail::checkedEnumValue<T>(detail::luaObjectTo<int64_t>(value));
+        }
+    };
+
+    // Tables (preallocated, raw access), or a vector usertype
+    template <typename T> struct ScriptConverter<LuaBackend, T, ValueKind::NumericVector> {
+        using Element = typename T::value_type;
+
+        static sol::object to(lua_State* L, const T& vec)
+        {
+            lua_createtable(L, static_cast<int>(vec.size()), 0);
+            lua_Integer i = 1; // Lua is 1-indexed
+            for (const Element& value : vec) {
+                detail::luaPushValue<Element>(L, value);
+                lua_rawseti(L, -2, i++);
+            }
+            sol::object table(L, -1);
+            lua_pop(L, 1);
+            return table;
+        }
+        static T from(const sol::object& value)
+        {
+            if (value.get_type() != sol::type::table) {
+                if (value.is<T>()) {
+                    return value.as<T>();
+                }
+                throw std::runtime_error("Expected a table");
+            }
+            lua_State* L = value.lua_state();
+            value.push(L);
+            const int table_index = lua_gettop(L);
+            const auto size = static_cast<lua_Integer>(lua_rawlen(L, table_index));
+            T vec;
+            vec.reserve(static_cast<size_t>(size));
+            try {
+                for (lua_Integer i = 1; i <= size; ++i) {
+                    lua_rawgeti(L, table_index, i);
+                    vec.push_back(detail::luaToValue<Element>(L, -1));
+                    lua_pop(L, 1);
+                }
+            } catch (...) {
+                lua_settop(L, table_index - 1);
+                throw;
+            }
+            lua_pop(L, 1);
+            return vec;
+        }
+    };
+
+    template <typename T>
+        requires has_script_converter_v<LuaBackend, typename T::value_type>
+    struct ScriptConverter<LuaBackend, T, ValueKind::Vector> {
+        using Element = typename T::value_type;
+        using Item = ScriptConverter<LuaBackend, Element>;
+
+        static sol::object to(lua_State* L, const T& vec)
+        {
+            sol::table table = sol::table::create(L, static_cast<int>(vec.size()), 0);
+            for (size_t i = 0; i < vec.size(); ++i) {
+                table.raw_set(i + 1, Item::to(L, vec[i]));
+            }
+            return table;
+        }
+        static T from(const sol::object& value)
+        {
+            if (value.get_type() != sol::type::table) {
+                throw std::runtime_error("Expected a table");
+            }
+            auto table = value.as<sol::table>();
+            const size_t size = table.size();
+            T vec;
+            vec.reserve(size);
+            for (size_t i = 1; i <= size; ++i) {
+                vec.push_back(Item::from(table.raw_get<sol::object>(i)));
+            }
+            return vec;
+        }
+    };
+
+    // Bound classes: copied in and out (members are exposed by reference, see
+    // LuaGenerator::register_class_converters)
+    template <typename T>
+        requires std::is_copy_constructible_v<T>
+    struct ScriptConverter<LuaBackend, T, ValueKind::Object> {
+        static sol::object to(lua_State* L, const T& value) { return sol::make_object(L, value); }
+        static T from(const sol::object& value)
+        {
+            if (!value.is<const T&>()) {
+                throw std::runtime_error("Expected " + getTypeName<T>());
+            }
+            return value.as<const T&>();
+        }
+    };
+
+} // namespace rosetta
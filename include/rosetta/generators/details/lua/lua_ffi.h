@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <functional>
+#include <rosetta/introspectable.h>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace rosetta {
+
+    /**
+     * @brief C declarations of C++ types for the LuaJIT FFI, keyed by type name.
+     *
+     * Scalars are built in. Plain structs used as members (e.g. a Vector3D
+     * registered with REGISTER_TYPE) are declared with register_struct, and
+     * introspectable classes get a declaration generated from their members
+     * (see LuaGenerator::bind_ffi).
+     *
+     * Under LuaJIT, member access through an `ffi.cast` pointer compiles down to
+     * plain loads and stores in traces, instead of a call into C++ per access.
+     */
+    class LuaFFIRegistry {
+    public:
+        struct CType {
+            std::string name;        // C type name used in declarations
+            std::string declaration; // C declaration to give to ffi.cdef (empty for scalars)
+            std::size_t size      = 0;
+            std::size_t alignment = 0;
+            std::vector<std::string> dependencies; // C types to declare first
+        };
+
+        /**
+         * @brief Contiguous storage of a C++ container (std::vector of scalars)
+         */
+        struct ArrayType {
+            std::string                                             element; // C element type
+            std::function<std::pair<void *, std::size_t>(void *)> data;    // pointer and count
+        };
+
+        static LuaFFIRegistry &instance();
+
+        /**
+         * @brief Declare a trivially copyable C++ type as a C type
+         * @param declaration e.g. "typedef struct { float x, y, z; } Vector3D;"
+         * (the layout must match the C++ one, which is checked only by size)
+         */
+        template <typename T>
+        void register_struct(const std::string &c_name, const std::string &declaration);
+
+        /**
+         * @brief Expose the storage of std::vector<E> to the FFI (E must be a scalar
+         * with a C type)
+         */
+        template <typename E> void register_vector();
+
+        const CType     *find(const std::string &type_name) const;
+        const ArrayType *find_array(const std::string &type_name) const;
+
+        /**
+         * @brief Generate the C declaration of an introspectable class.
+         *
+         * Members are placed at their C++ offsets. Members without a C type
+         * (strings, containers, ...) and the vtable pointer become opaque
+         * padding, and the struct has the size of the C++ class, so that
+         * arrays of objects can be indexed too.
+         *
+         * @throws std::runtime_error if no member has a C type
+         */
+        template <typename T> std::string generate_cdef(const std::string &c_name) const;
+
+        /**
+         * @brief generate_cdef, then register the class under its type name
+         */
+        template <typename T> const CType &register_class(const std::string &c_name);
+
+    private:
+        LuaFFIRegistry();
+
+        template <typename T> void register_scalar(const std::string &c_name);
+
+        std::unordered_map<std::string, CType>     types;
+        std::unordered_map<std::string, ArrayType> arrays;
+    };
+
+} // namespace rosetta
+
+#include "inline/lua_ffi.hxx"
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ *
+ * Lua Functor/Lambda Support
+ * Allows Lua functions to be used as C++ std::function (and the other way around)
+ *
+ * Also provides:
+ * - LuaFunctionRef: registry reference to a Lua function, called with a cached
+ *   traceback handler and typed argument pushing
+ * - LuaBatchCallback: calls a Lua function over many inputs in a single pcall
+ */
+#pragma once
+#include "lua_generator.h"
+#include "lua_stack.h"
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <sol/sol.hpp>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+namespace rosetta {
+
+    /**
+     * @brief Reference to a Lua function, callable from C++.
+     *
+     * The function and a traceback message handler are stored in the registry
+     * of the main thread once, so a call only does two `lua_rawgeti`, pushes
+     * its arguments with their static types and runs one `lua_pcall`. A Lua
+     * error is rethrown as std::runtime_error with the Lua traceback.
+     *
+     * Must only be used (and destroyed) on the thread owning the Lua state,
+     * and must not outlive it.
+     */
+    class LuaFunctionRef {
+    public:
+        /**
+         * @brief Reference the function at `index` on the stack of `L`
+         * @throws std::runtime_error if the value is not a function
+         */
+        LuaFunctionRef(lua_State *L, int index);
+        explicit LuaFunctionRef(const sol::object &function);
+        ~LuaFunctionRef();
+
+        LuaFunctionRef(const LuaFunctionRef &)            = delete;
+        LuaFunctionRef &operator=(const LuaFunctionRef &) = delete;
+
+        /**
+         * @brief Call the function with `args`
+         * @throws std::runtime_error on Lua error, or if the result is not a Ret
+         */
+        template <typename Ret, typename... Args> Ret call(Args &&...args) const;
+
+        /**
+         * @brief Push the handler then the function, and return the stack index
+         * of the handler (to be given to lua_pcall)
+         */
+        int push(lua_State *L) const;
+
+        /**
+         * @brief Pop the error message at the top of the stack, restore the stack
+         * to `top` and throw it
+         */
+        [[noreturn]] static void raise(lua_State *L, int top);
+
+        lua_State *state() const;
+
+    private:
+        void init(lua_State *L, int index);
+
+        lua_State *L_           = nullptr; // main thread (coroutines may be collected)
+        int        function_ref = LUA_NOREF;
+        int        handler_ref  = LUA_NOREF;
+    };
+
+    /**
+     * @brief Calls a Lua function over batches of inputs, with one `lua_pcall`
+     * per batch instead of one per invocation (for event systems firing many
+     * callbacks per frame).
+     *
+     * The Lua function keeps its scalar signature: it is called once per input,
+     * but all calls of a batch run inside the same protected call, with the
+     * message handler pushed once.
+     *
+     * @example
+     * ```cpp
+     * rosetta::LuaBatchCallback<void, int, double> onHit(lua["onHit"]);
+     * for (auto &hit : hits) {
+     *     onHit.push(hit.entity, hit.damage); // flushes every batchSize() pushes
+     * }
+     * onHit.flush();
+     * ```
+     */
+    template <typename Ret, typename... Args> class LuaBatchCallback {
+        static_assert(sizeof...(Args) > 0, "Batched callbacks need at least one argument");
+
+    public:
+        using Columns = std::tuple<std::vector<std::decay_t<Args>>...>;
+        using Results = std::vector<std::conditional_t<std::is_void_v<Ret>, std::monostate, Ret>>;
+
+        explicit LuaBatchCallback(const sol::object &function, std::size_t batch_size = 1024);
+        explicit LuaBatchCallback(std::shared_ptr<LuaFunctionRef> function,
+                                  std::size_t                     batch_size = 1024);
+
+        /**
+         * @brief Queue one invocation (flushes when the batch is full)
+         */
+        void push(Args... args);
+
+        /**
+         * @brief Call Lua for the pending invocations (no-op if none)
+         */
+        void flush();
+
+        /**
+         * @brief Call the Lua function for each row of `columns` (all of the same
+         * size), in a single protected call
+         * @throws std::runtime_error on the first Lua error (the remaining rows
+         * are not processed)
+         */
+        Results call(const std::vector<std::decay_t<Args>> &...columns);
+
+        /**
+         * @brief Results of all the flushed invocations, in push order
+         */
+        Results takeResults();
+
+        std::size_t pending() const;
+        std::size_t batchSize() const;
+
+        /**
+         * @brief std::function queuing invocations (e.g. for a C++ forEach)
+         * The LuaBatchCallback must outlive the returned function.
+         */
+        std::function<void(Args...)> asFunction();
+
+    private:
+        // Everything the batch runner needs, passed as a light userdata
+        struct Batch {
+            std::tuple<const std::vector<std::decay_t<Args>> *...> columns;
+            Results                                               *results;
+            std::size_t                                            size;
+        };
+        static int run(lua_State *L);
+
+        std::shared_ptr<LuaFunctionRef> function_;
+        std::size_t                     batch_size_;
+        Columns                         columns_;
+        Results                         results_;
+    };
+
+    /**
+     * @brief Register functor converters with the generator
+     */
+    inline void registerFunctorSupport(LuaGenerator &generator);
+
+    /**
+     * @brief Register specific functor type converter (bidirectional)
+     * @tparam Ret Return type
+     * @tparam Args Argument types
+     */
+    template <typename Ret, typename... Args> void registerFunctorType(LuaGenerator &generator);
+
+} // namespace rosetta
+
+#include "inline/lua_functors.hxx"
@@ -3,9 +3,16 @@
  * LGPL v3 license
  */
 #pragma once
+#include <functional>
+#include <rosetta/generators/details/lua/lua_async.h>
+#include <rosetta/generators/details/lua/lua_converters.h>
+#include <rosetta/generators/details/lua/lua_ffi.h>
 #include <rosetta/introspectable.h>
+#include <shared_mutex>
 #include <sol/sol.hpp>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace rosetta {
 
@@ -50,29 +57,138 @@ namespace rosetta {
          */
         LuaGenerator& add_utilities();
 
+        /**
+         * @brief Declare an already bound class to the LuaJIT FFI (see LuaFFIRegistry).
+         *
+         * Members with a C type (scalars, plain structs declared with
+         * LuaFFIRegistry::register_struct, other FFI classes) become fields of a C
+         * struct laid out like the C++ class, and the class gets two methods:
+         * - `obj:ffi()` returns a `T*` cdata pointing to the C++ object
+         * - `obj:ffiArray(name)` returns a pointer to the data of a vector member
+         *   and its size (0-based indexing, as in C)
+         *
+         * The pointers do not keep the object alive, and the one of `ffiArray` is
+         * invalidated when the vector is resized. Needs LuaJIT, with the `package`
+         * and `ffi` libraries opened.
+         *
+         * @example
+         * ```lua
+         * local p = obj:ffi()
+         * for i = 1, 1000000 do p.health = p.health - 0.1 end -- no C++ call in the loop
+         * ```
+         * @throws std::runtime_error if the FFI is not available or T is not bound
+         */
+        template <typename T> LuaGenerator& bind_ffi(const std::string& class_name = "");
+
+        /**
+         * @brief True if the Lua state is LuaJIT with the ffi library available
+         */
+        bool has_ffi() const;
+
+        /**
+         * @brief Resume the coroutines waiting for an async method (registered with
+         * `rosetta::async_method`) that completed. Call it regularly, e.g. once per
+         * frame, from the thread owning the Lua state (see LuaAsyncScheduler).
+         * @return The number of resumed coroutines
+         */
+        std::size_t poll();
+
+        /**
+         * @brief One state independent binding step of a class (constructor,
+         * member, method...), applied to a freshly created usertype
+         */
+        template <typename T> using UsertypeBinder = std::function<void(sol::usertype<T>&)>;
+
+        /**
+         * @brief Build the binding steps of T from its TypeInfo. This is where the
+         * member and method signatures are analyzed, so the result can be built
+         * once and applied to any number of Lua states (see LuaBindingPlan).
+         */
+        template <typename T> static std::vector<UsertypeBinder<T>> make_binders();
+
+        /**
+         * @brief Register the converters of T under its type name and class_name
+         * (done by bind_class)
+         */
+        template <typename T> static void register_class_converters(const std::string& class_name);
+
+        /**
+         * @brief Type-erased converter, used by the fallback bindings (members and
+         * methods whose C++ types are not handled by the typed sol3 bindings,
+         * constructors, dynamic access, free functions).
+         */
+        struct Converter {
+            std::function<sol::object(lua_State*, const std::any&)> to_lua;
+            std::function<std::any(const sol::object&)> from_lua;
+            std::function<sol::object(lua_State*, void*)> reference; // optional, no copy
+            // optional, no copy and keeps `parent` (the owner of the value) alive
+            std::function<sol::object(lua_State*, void*, const sol::object& parent)> view;
+        };
+
+        /**
+         * @brief Register a converter for a rosetta type name. Scalars, strings and
+         * their vectors are built in (see LuaBackend), and bind_class<T>() registers
+         * T (members of type T are then exposed by reference).
+         */
+        static void register_converter(const std::string& type_name, Converter converter);
+        static const Converter* find_converter(const std::string& type_name);
+
+        // Type conversion helpers
+        static sol::object convert_any_to_lua(
+            lua_State* L, const std::any& value, const std::string& type_name);
+        static std::any convert_lua_to_any(
+            const sol::object& lua_value, const std::string& type_name);
+
+        // Read a member of `obj`, by reference when its type allows it (or as a
+        // view when `parent`, the Lua object holding `obj`, is given)
+        static sol::object get_member(lua_State* L, void* obj, const MemberInfo& member,
+            const sol::object& parent = sol::lua_nil);
+
     private:
         sol::state& lua;
         std::unordered_set<std::string> bound_classes;
 
         template <typename T>
-        void bind_constructors(sol::usertype<T>& user_type, const TypeInfo& type_info);
+        static void add_constructor_binders(
+            std::vector<UsertypeBinder<T>>& binders, const TypeInfo& type_info);
+
+        template <typename T>
+        static void add_member_binders(
+            std::vector<UsertypeBinder<T>>& binders, const TypeInfo& type_info);
+
+        template <typename T>
+        static void add_method_binders(
+            std::vector<UsertypeBinder<T>>& binders, const TypeInfo& type_info);
 
         template <typename T>
-        void bind_members(sol::usertype<T>& user_type, const TypeInfo& type_info);
+        static void add_introspection_binders(std::vector<UsertypeBinder<T>>& binders);
 
+        // onPropertyChanged / offPropertyChanged, and the global batch
+        // functions. A subscription ends with offPropertyChanged, when its
+        // object is collected (if owned by Lua, and not captured by the
+        // callback) or when the state is closed.
         template <typename T>
-        void bind_methods(sol::usertype<T>& user_type, const TypeInfo& type_info);
+        static void add_property_changed_binders(std::vector<UsertypeBinder<T>>& binders);
+
+        template <typename T, typename Call>
+        static void add_async_method_binder(
+            std::vector<UsertypeBinder<T>>& binders, const MethodInfo* method, Call call);
 
-        template <typename T> void bind_introspection_utilities(sol::usertype<T>& user_type);
+        // Convert the Lua arguments of a method call (checking their count)
+        static std::vector<std::any> convert_arguments(
+            const MethodInfo& method, const sol::variadic_args& va);
 
         // Helper to check if method is a getter/setter
-        bool is_getter_setter_method(
-            const std::string& method_name, const TypeInfo& type_info) const;
+        static bool is_getter_setter_method(
+            const std::string& method_name, const TypeInfo& type_info);
 
-        // Type conversion helpers
-        sol::object convert_any_to_lua(const std::any& value, const std::string& type_name) const;
-        std::any convert_lua_to_any(
-            const sol::object& lua_value, const std::string& type_name) const;
+        // Shared by all generators (and threads), hence the lock
+        static std::unordered_map<std::string, Converter>& converters();
+        static std::shared_mutex& converters_mutex();
+
+        // LuaJIT FFI helpers
+        sol::table require_ffi() const;
+        void declare_ffi_type(sol::table& ffi, const LuaFFIRegistry::CType& type) const;
     };
 
 } // namespace rosetta
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <rosetta/index.h>
+#include <sol/sol.hpp>
+#include <string>
+#include <unordered_map>
+
+namespace rosetta {
+
+    /**
+     * @brief Index<T> holding references on the Lua objects it refers to, so
+     * that they stay alive (and at the same address) while indexed
+     */
+    template <typename T> class LuaIndex {
+    public:
+        LuaIndex(const std::string& kind, const sol::table& members);
+
+        Index<T>                                     index;
+        std::unordered_map<const T*, sol::reference> owners;
+    };
+
+    /**
+     * @brief Bind rosetta::Index<T> to Lua (T must be bound with bind_class).
+     *
+     * Keys are updated when a key member is set from Lua (or through
+     * setMemberValue in C++). Lookups return arrays of the indexed objects.
+     *
+     * @example
+     * ```lua
+     * local by_name = GameObjectIndex.new("hash", { "name" })
+     * for _, object in ipairs(objects) do by_name:add(object) end
+     * local player = by_name:lookup("Player")[1]
+     *
+     * local by_health = GameObjectIndex.new("ordered", { "health", "name" })
+     * local weak = by_health:range(0, 20)                -- health in [0, 20]
+     * local some = by_health:range({ 50, "a" }, { 50, "m" }) -- several members
+     * ```
+     * @param name Lua class name (default: class name + "Index")
+     */
+    template <typename T> void registerIndexType(sol::state& lua, const std::string& name = "");
+
+} // namespace rosetta
+
+#include "inline/lua_indexes.hxx"
@@ -0,0 +1,214 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <rosetta/generators/details/lua/lua_async.h>
+#include <rosetta/introspectable.h>
+#include <sol/sol.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace rosetta {
+
+    /**
+     * @brief CPU accounting of one script of a LuaScheduler
+     */
+    class LuaScriptStats : public Introspectable {
+        INTROSPECTABLE(LuaScriptStats)
+    public:
+        std::string name;
+        double      total_us      = 0; // time spent in the script since it was added
+        double      last_frame_us = 0; // ... during the last update()
+        double      max_frame_us  = 0; // worst update() so far
+        std::size_t resumes       = 0;
+        std::size_t preemptions   = 0; // slices interrupted by the budget
+        std::size_t instructions  = 0; // approximation (count hook quanta)
+        bool        finished      = false;
+        std::string error; // set if the script raised an error (with traceback)
+    };
+
+    /**
+     * @brief Calls of a C++ function bound to Lua (methods, free functions),
+     * counted while method profiling is enabled
+     */
+    class LuaMethodStats : public Introspectable {
+        INTROSPECTABLE(LuaMethodStats)
+    public:
+        std::string name;
+        std::size_t calls    = 0;
+        double      total_us = 0;
+    };
+
+    /**
+     * @brief Summary of the last LuaScheduler::update()
+     */
+    class LuaFrameStats : public Introspectable {
+        INTROSPECTABLE(LuaFrameStats)
+    public:
+        std::size_t frame       = 0;
+        double      budget_us   = 0;
+        double      used_us     = 0;
+        std::size_t resumed     = 0; // scripts resumed during the frame
+        std::size_t skipped     = 0; // runnable scripts left for the next frame
+        std::size_t preemptions = 0;
+        std::size_t scripts     = 0; // scripts not finished yet
+    };
+
+    /**
+     * @brief Runs one coroutine per scripted entity, within a per-frame time
+     * budget.
+     *
+     * Each update() resumes the scripts in round robin order (starting where
+     * the previous frame stopped) until the budget is spent. A count hook checks
+     * the clock every set_instruction_quantum() VM instructions and suspends the
+     * running script once its slice is over, so a script stuck in a long loop
+     * only delays itself: it continues at the next frame. Scripts yield
+     * (`coroutine.yield()`) to wait for the next frame.
+     *
+     * Preemption needs Lua 5.3+ (a hook can only yield there). With older
+     * versions the budget is still enforced between scripts, but a running
+     * script is only interrupted by its own yield.
+     *
+     * All the statistics are Introspectable (toJSON(), or bound to Lua with
+     * LuaGenerator::bind_class) so that tools can inspect them.
+     *
+     * Must be used on the thread owning the Lua state, and destroyed before it.
+     * Scripts must not be added or removed from within update().
+     *
+     * @example
+     * ```cpp
+     * rosetta::LuaScheduler scheduler(lua);
+     * for (auto &entity : entities) {
+     *     scheduler.add(entity.name, lua["npcBrain"], sol::make_object(lua, &entity));
+     * }
+     * while (running) {
+     *     scheduler.update(std::chrono::microseconds(2000));
+     * }
+     * for (const auto *stats : scheduler.scripts()) {
+     *     std::cout << stats->toJSON() << std::endl;
+     * }
+     * ```
+     * ```lua
+     * function npcBrain(npc)
+     *     while npc:isAlive() do
+     *         npc:think()
+     *         coroutine.yield() -- next frame
+     *     end
+     * end
+     * ```
+     */
+    class LuaScheduler {
+    public:
+        using ScriptId     = std::size_t;
+        using Clock        = std::chrono::steady_clock;
+        using ErrorHandler = std::function<void(const LuaScriptStats &)>;
+
+        explicit LuaScheduler(sol::state_view lua);
+        ~LuaScheduler();
+
+        LuaScheduler(const LuaScheduler &)            = delete;
+        LuaScheduler &operator=(const LuaScheduler &) = delete;
+
+        /**
+         * @brief Run `function` in a new coroutine, first resumed (with `entity`
+         * as argument, unless nil) at the next update()
+         */
+        ScriptId add(const std::string &name, const sol::function &function,
+                     const sol::object &entity = sol::lua_nil);
+
+        /**
+         * @brief Stop a script (its coroutine is collected with the Lua state)
+         */
+        void remove(ScriptId id);
+
+        /**
+         * @brief Resume the scripts for at most `budget`
+         * @return The number of scripts resumed
+         */
+        std::size_t update(std::chrono::microseconds budget);
+
+        /**
+         * @brief Limit the time a single script can take per frame (0: only the
+         * frame budget applies)
+         */
+        void set_script_budget(std::chrono::microseconds budget);
+
+        /**
+         * @brief Number of VM instructions between two clock checks (default 1000)
+         */
+        void set_instruction_quantum(int count);
+
+        /**
+         * @brief Count the calls and time of the C++ functions called by the
+         * scripts (adds a call/return hook, off by default)
+         */
+        void set_method_profiling(bool enabled);
+
+        /**
+         * @brief Called when a script raises an error (the script is stopped, the
+         * other scripts keep running)
+         */
+        void set_error_handler(ErrorHandler handler);
+
+        const LuaScriptStats               *stats(ScriptId id) const;
+        std::vector<const LuaScriptStats *> scripts() const;
+        std::vector<LuaMethodStats>         method_stats() const;
+        const LuaFrameStats                &frame_stats() const;
+        void                                reset_method_stats();
+
+        /**
+         * @brief Number of scripts not finished yet
+         */
+        std::size_t size() const;
+
+    private:
+        struct Script {
+            ScriptId       id = 0;
+            sol::thread    thread; // keeps the coroutine alive
+            lua_State     *co      = nullptr;
+            int            nargs   = 0; // pushed for the first resume
+            bool           started = false;
+            LuaScriptStats stats;
+        };
+
+        // Bound function running in a script (method profiling)
+        struct Call {
+            LuaMethodStats   *stats;
+            Clock::time_point start;
+        };
+
+        static void hook(lua_State *L, lua_Debug *ar);
+        void        set_hook(lua_State *co) const;
+        bool        resume(Script &script, Clock::time_point frame_deadline);
+        void        on_call(lua_State *L, lua_Debug *ar);
+        void        on_return(lua_State *L, lua_Debug *ar);
+
+        lua_State                                      *L_;
+        std::vector<std::unique_ptr<Script>>            scripts_;
+        std::size_t                                     cursor_  = 0;
+        ScriptId                                        next_id_ = 0;
+        std::chrono::microseconds                       script_budget_{0};
+        int                                             quantum_   = 1000;
+        bool                                            profiling_ = false;
+        ErrorHandler                                    on_error_;
+        LuaFrameStats                                   frame_;
+        std::unordered_map<const void *, LuaMethodStats> methods_; // by Lua closure
+
+        // State of the running slice, read by the hook
+        Script           *running_ = nullptr;
+        Clock::time_point deadline_;
+        bool              preempted_ = false;
+        std::vector<Call> calls_;
+
+        inline static thread_local LuaScheduler *active_ = nullptr;
+    };
+
+} // namespace rosetta
+
+#include "inline/lua_scheduler.hxx"
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <sol/sol.hpp>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace rosetta {
+
+    namespace detail {
+
+        // Raw stack access for scalars and strings (no sol::object / sol::proxy in between)
+        template <typename T> inline void luaPushValue(lua_State* L, const T& value)
+        {
+            if constexpr (std::is_same_v<T, bool>) {
+                lua_pushboolean(L, value ? 1 : 0);
+            } else if constexpr (std::is_integral_v<T>) {
+                lua_pushinteger(L, static_cast<lua_Integer>(value));
+            } else if constexpr (std::is_floating_point_v<T>) {
+                lua_pushnumber(L, static_cast<lua_Number>(value));
+            } else if constexpr (std::is_same_v<T, std::string>) {
+                lua_pushlstring(L, value.data(), value.size());
+            } else {
+                sol::stack::push(L, value);
+            }
+        }
+
+        // Raises a Lua error on type mismatch: only call it from a function run by Lua
+        template <typename T> inline T luaGetValue(lua_State* L, int index)
+        {
+            if constexpr (std::is_same_v<T, bool>) {
+                return lua_toboolean(L, index) != 0;
+            } else if constexpr (std::is_integral_v<T>) {
+                return static_cast<T>(luaL_checkinteger(L, index));
+            } else if constexpr (std::is_floating_point_v<T>) {
+                return static_cast<T>(luaL_checknumber(L, index));
+            } else if constexpr (std::is_same_v<T, std::string>) {
+                size_t length = 0;
+                const char* str = luaL_checklstring(L, index, &length);
+                return std::string(str, length);
+            } else {
+                return sol::stack::get<T>(L, index);
+            }
+        }
+
+        // Same as luaGetValue, but throws a C++ exception on type mismatch (to be
+        // used outside of any Lua protected call, e.g. on the result of lua_pcall)
+        template <typename T> inline T luaToValue(lua_State* L, int index)
+        {
+            if constexpr (std::is_same_v<T, bool>) {
+                return lua_toboolean(L, index) != 0;
+            } else if constexpr (std::is_arithmetic_v<T>) {
+                if (lua_type(L, index) != LUA_TNUMBER) {
+                    throw std::runtime_error(std::string("Expected a number, got ")
+                        + lua_typename(L, lua_type(L, index)));
+                }
+                if constexpr (std::is_integral_v<T>) {
+                    return static_cast<T>(lua_tointeger(L, index));
+                } else {
+                    return static_cast<T>(lua_tonumber(L, index));
+                }
+            } else if constexpr (std::is_same_v<T, std::string>) {
+                if (lua_type(L, index) != LUA_TSTRING && lua_type(L, index) != LUA_TNUMBER) {
+                    throw std::runtime_error(std::string("Expected a string, got ")
+                        + lua_typename(L, lua_type(L, index)));
+                }
+                size_t length = 0;
+                const char* str = lua_tolstring(L, index, &length);
+                return std::string(str, length);
+            } else {
+                auto value = sol::stack::check_get<T>(L, index);
+                if (!value) {
+                    throw std::runtime_error("Unexpected Lua value type");
+                }
+                return *value;
+            }
+        }
+
+    } // namespace detail
+
+} // namespace rosetta
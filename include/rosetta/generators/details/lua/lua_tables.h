@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <rosetta/generators/details/lua/lua_generator.h>
+#include <rosetta/generators/details/lua/lua_stack.h>
+#include <rosetta/kernels.h>
+#include <rosetta/query.h>
+#include <rosetta/table.h>
+#include <sol/sol.hpp>
+#include <string>
+
+namespace rosetta {
+
+    /**
+     * @brief Lua view of a column of a Table: 1-indexed element access without
+     * copying the column (`view[i]`, `#view`, `view:toTable()`,
+     * `view:assign(table)`). The view holds a reference on the table, and indices
+     * are checked against the current number of rows, so it stays valid when
+     * rows are added or removed.
+     */
+    struct LuaColumnView {
+        ColumnStorage* column = nullptr;
+        std::string type_name; // rosetta type name of the elements
+        sol::reference parent; // keeps the table alive
+    };
+
+    /**
+     * @brief Bind rosetta::Table<T> to Lua (T must be bound with bind_class).
+     *
+     * Rows are 1-indexed, copied in and out as T (`push`, `get`, `set`), and
+     * single values are accessed with `getValue(row, name)` /
+     * `setValue(row, name, value)`. `column(name)` returns a LuaColumnView;
+     * numeric columns are read and written with raw stack access.
+     *
+     * The vectorised kernels (see rosetta::kernels) run on numeric columns in a
+     * single call: `sum`, `minMax` and `meanVariance` (two results), `dot`,
+     * `axpy`, `clamp` and `histogram`. Queries (see rosetta::Query) return
+     * 1-indexed rows: `select(where, orderBy, limit)`, `count(where)` and
+     * `groupBy(key, where)` (a table of value -> rows).
+     *
+     * @example
+     * ```lua
+     * local objects = GameObjectTable.new()
+     * objects:push(GameObject.new("Player", Vector3D.new(0, 0, 0)))
+     * local health = objects:column("health")
+     * local total = 0
+     * for i = 1, #health do total = total + health[i] end
+     * local low, high = objects:minMax("health") -- same, in one call
+     * local weak = objects:select("health < 50", "name", 10)
+     * ```
+     * @param name Lua class name (default: class name + "Table")
+     */
+    template <typename T> void registerTableType(sol::state& lua, const std::string& name = "");
+
+} // namespace rosetta
+
+#include "inline/lua_tables.hxx"
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <rosetta/delta.h>
+#include <rosetta/generators/details/lua/lua_generator.h>
+#include <sol/sol.hpp>
+#include <string>
+#include <unordered_map>
+
+namespace rosetta {
+
+    /**
+     * @brief DirtyTracker<T> holding references on the Lua objects it tracks,
+     * so that they stay alive (and at the same address) while tracked
+     */
+    template <typename T> class LuaDirtyTracker {
+    public:
+        DirtyTracker<T>                              tracker;
+        std::unordered_map<const T*, sol::reference> owners;
+    };
+
+    /**
+     * @brief Bind rosetta::DirtyTracker<T> to Lua (T must be bound with
+     * bind_class).
+     *
+     * Members set from Lua (or through setMemberValue in C++) mark tracked
+     * objects dirty. Changes are collected either as a binary delta (a Lua
+     * string, see collectDelta) or as a table of the changed members to update
+     * a Lua mirror. Both clean the object.
+     *
+     * @example
+     * ```lua
+     * local tracker = GameObjectTracker.new()
+     * tracker:track(player)
+     * player.health = 50
+     * for _, object in ipairs(tracker:dirtyObjects()) do
+     *     send(tracker:collectDelta(object))       -- health only
+     * end
+     * GameObjectTracker.applyDelta(remote_player, received)
+     *
+     * player.name = "Hero"
+     * local changes = tracker:collectChanges(player) -- { name = "Hero" }
+     * ```
+     * @param name Lua class name (default: class name + "Tracker")
+     */
+    template <typename T> void registerTrackerType(sol::state& lua, const std::string& name = "");
+
+} // namespace rosetta
+
+#include "inline/lua_trackers.hxx"
@@ -3,6 +3,7 @@
  * LGPL v3 license
  */
 #pragma once
+#include "lua_stack.h"
 #include <rosetta/generators/lua.h>
 #include <rosetta/type_registry.h>
 #include <sol/sol.hpp>
@@ -15,13 +16,129 @@ namespace rosetta {
     // Lua-specific type conversion helpers
     // ============================================================================
 
+    /**
+     * @brief Helper to convert Lua table to std::vector
+     * @tparam T Element type
+     * @param lua_table The Lua table (array part, 1-indexed)
+     * @return std::vector<T>
+     *
+     * The vector is allocated once and the elements are read with lua_rawgeti.
+     */
+    template <typename T> inline std::vector<T> tableToVector(const sol::table& lua_table)
+    {
+        lua_State* L = lua_table.lua_state();
+        lua_table.push();
+        const int table_index = lua_gettop(L);
+
+        const auto size = static_cast<lua_Integer>(lua_rawlen(L, table_index));
+        std::vector<T> vec;
+        vec.reserve(static_cast<size_t>(size));
+        for (lua_Integer i = 1; i <= size; ++i) { // Lua is 1-indexed
+            lua_rawgeti(L, table_index, i);
+            vec.push_back(detail::luaGetValue<T>(L, -1));
+            lua_pop(L, 1);
+        }
+
+        lua_pop(L, 1);
+        return vec;
+    }
+
+    /**
+     * @brief Helper to convert std::vector to Lua table
+     * @tparam T Element type
+     * @param L The Lua state
+     * @param vec The vector to convert
+     * @return sol::table
+     *
+     * The table is preallocated with lua_createtable and filled with lua_rawseti.
+     */
+    template <typename T> inline sol::table vectorToTable(lua_State* L, const std::vector<T>& vec)
+    {
+        lua_createtable(L, static_cast<int>(vec.size()), 0);
+        lua_Integer i = 1; // Lua is 1-indexed
+        for (const T& value : vec) {
+            detail::luaPushValue<T>(L, value);
+            lua_rawseti(L, -2, i++);
+        }
+
+        sol::table table(L, -1);
+        lua_pop(L, 1);
+        return table;
+    }
+
+    template <typename T>
+    inline sol::table vectorToTable(sol::state& lua, const std::vector<T>& vec)
+    {
+        return vectorToTable(lua.lua_state(), vec);
+    }
+
+    // ============================================================================
+    // Views
+    // ============================================================================
+
+    /**
+     * @brief Non-owning Lua view of a std::vector stored in another object
+     * (typically a member of a bound class). Element access does not copy the
+     * vector, and the parent object is referenced so that it outlives the view.
+     */
+    template <typename T> struct LuaVectorView {
+        std::vector<T>* data = nullptr;
+        sol::reference parent; // keeps the owner of `data` alive
+    };
+
+    namespace detail {
+
+        template <typename T> inline LuaVectorView<T>& checkVectorView(lua_State* L)
+        {
+            auto& view = sol::stack::get<LuaVectorView<T>&>(L, 1);
+            if (!view.data) {
+                luaL_error(L, "Invalid vector view");
+            }
+            return view;
+        }
+
+        template <typename T> inline size_t checkViewIndex(lua_State* L, const std::vector<T>& v)
+        {
+            const lua_Integer i = luaL_checkinteger(L, 2);
+            if (i < 1 || static_cast<size_t>(i) > v.size()) {
+                luaL_error(L, "Index %d out of range [1, %d]", static_cast<int>(i),
+                    static_cast<int>(v.size()));
+            }
+            return static_cast<size_t>(i - 1); // Lua is 1-indexed
+        }
+
+        // Called by sol3 for keys that are not methods of the view
+        template <typename T> inline int luaVectorViewIndex(lua_State* L)
+        {
+            auto& view = checkVectorView<T>(L);
+            if (lua_type(L, 2) != LUA_TNUMBER) {
+                lua_pushnil(L);
+                return 1;
+            }
+            const T value = (*view.data)[checkViewIndex(L, *view.data)];
+            luaPushValue<T>(L, value);
+            return 1;
+        }
+
+        template <typename T> inline int luaVectorViewNewIndex(lua_State* L)
+        {
+            auto& view = checkVectorView<T>(L);
+            const size_t i = checkViewIndex(L, *view.data);
+            (*view.data)[i] = luaGetValue<T>(L, 3);
+            return 0;
+        }
+
+    } // namespace detail
+
     /**
      * @brief Register vector type converter for Lua using automatic type name
      * @tparam T Element type of the vector
      * @param lua The Lua state
      *
      * Sol3 automatically handles std::vector for most basic types,
-     * but explicit registration provides better control.
+     * but explicit registration provides better control. Members of type
+     * std::vector<T> of bound classes are then exposed as LuaVectorView<T>
+     * (no copy, `view:toTable()` / `view:assign(table)` for bulk transfers).
      */
     template <typename T> inline void registerVectorType(sol::state& lua)
     {
@@ -52,6 +169,43 @@ namespace rosetta {
             // Methods
             "push_back", &std::vector<T>::push_back, "size", &std::vector<T>::size, "clear",
             &std::vector<T>::clear, "empty", &std::vector<T>::empty);
+
+        // View over a vector owned by another object
+        lua.new_usertype<LuaVectorView<T>>(type_name + "_view", sol::no_constructor,
+            sol::meta_function::index, &detail::luaVectorViewIndex<T>,
+            sol::meta_function::new_index, &detail::luaVectorViewNewIndex<T>,
+            sol::meta_function::length, [](const LuaVectorView<T>& v) { return v.data->size(); },
+            "size", [](const LuaVectorView<T>& v) { return v.data->size(); },
+            "toTable",
+            [](const LuaVectorView<T>& v, sol::this_state s) {
+                return vectorToTable<T>(s, *v.data);
+            },
+            "assign",
+            [](LuaVectorView<T>& v, const sol::table& t) { *v.data = tableToVector<T>(t); },
+            "resize", [](LuaVectorView<T>& v, size_t size) { v.data->resize(size); },
+            "push_back", [](LuaVectorView<T>& v, const T& value) { v.data->push_back(value); });
+
+        // Members of this vector type are exposed by reference (no table copy)
+        LuaGenerator::register_converter(getTypeName<std::vector<T>>(),
+            { [](lua_State* L, const std::any& value) -> sol::object {
+                 return sol::make_object(L, std::any_cast<const std::vector<T>&>(value));
+             },
+                [](const sol::object& value) -> std::any {
+                    if (value.get_type() == sol::type::table) {
+                        return tableToVector<T>(value.as<sol::table>());
+                    }
+                    if (value.is<LuaVectorView<T>>()) {
+                        return *value.as<LuaVectorView<T>&>().data;
+                    }
+                    return value.as<std::vector<T>>();
+                },
+                [](lua_State* L, void* ptr) -> sol::object {
+                    return sol::make_object(L, static_cast<std::vector<T>*>(ptr));
+                },
+                [](lua_State* L, void* ptr, const sol::object& parent) -> sol::object {
+                    return sol::make_object(
+                        L, LuaVectorView<T> { static_cast<std::vector<T>*>(ptr), parent });
+                } });
     }
 
     /**
@@ -108,38 +262,6 @@ namespace rosetta {
         registerVectorType<std::string>(lua);
     }
 
-    /**
-     * @brief Helper to convert Lua table to std::vector
-     * @tparam T Element type
-     * @param lua_table The Lua table
-     * @return std::vector<T>
-     */
-    template <typename T> inline std::vector<T> tableToVector(const sol::table& lua_table)
-    {
-        std::vector<T> vec;
-        for (size_t i = 1; i <= lua_table.size(); ++i) { // Lua is 1-indexed
-            vec.push_back(lua_table[i]);
-        }
-        return vec;
-    }
-
-    /**
-     * @brief Helper to convert std::vector to Lua table
-     * @tparam T Element type
-     * @param lua The Lua state
-     * @param vec The vector to convert
-     * @return sol::table
-     */
-    template <typename T>
-    inline sol::table vectorToTable(sol::state& lua, const std::vector<T>& vec)
-    {
-        sol::table table = lua.create_table();
-        for (size_t i = 0; i < vec.size(); ++i) {
-            table[i + 1] = vec[i]; // Lua is 1-indexed
-        }
-        return table;
-    }
-
 } // namespace rosetta
 
 // ============================================================================
@@ -150,7 +272,8 @@ namespace rosetta {
 BASIC USAGE:
 -----------
 
-    #include <rosetta/generators/lua.h>
+    #include "lua_stack.h"
+#include <rosetta/generators/lua.h>
     #include <rosetta/generators/lua_vector_helpers.h>
 
     using Vertices = std::vector<double>;
@@ -242,6 +365,19 @@ For custom types like Point3D:
     -- local mesh = Mesh.new(points)
 
 
+VECTOR MEMBERS (VIEWS):
+----------------------
+
+Once registerVectorType<double>(lua) was called, a std::vector<double> member
+of a bound class is exposed as a view on the C++ storage (no copy):
+
+    -- Lua usage:
+    -- local v = mesh.vertices  -- view, keeps `mesh` alive
+    -- v[1] = 2.5               -- writes into the C++ vector
+    -- local t = v:toTable()    -- bulk copy to a Lua table
+    -- v:assign(t)              -- bulk copy back (resizes the vector)
+
+
 HELPER FUNCTIONS:
 ----------------
 
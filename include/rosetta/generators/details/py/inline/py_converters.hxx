@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <cstring>
+
+namespace rosetta {
+
+    namespace detail {
+
+        /**
+         * @brief Check that a buffer format character (struct module syntax)
+         * describes the same kind of number as T. The item size is checked
+         * separately, since e.g. int64 may be reported as 'l' or 'q'.
+         */
+        template <typename T> inline bool bufferFormatMatches(const char *format) {
+            if (!format) {
+                return false;
+            }
+            if (*format == '@' || *format == '=') {
+                ++format;
+            }
+            const char code = *format;
+            if (code == '\0' || format[1] != '\0') {
+                return false;
+            }
+            if constexpr (std::is_floating_point_v<T>) {
+                return code == 'f' || code == 'd';
+            } else if constexpr (std::is_signed_v<T>) {
+                return std::strchr("bhilqn", code) != nullptr ||
+                       (sizeof(T) == 1 && code == 'c');
+            } else {
+                return std::strchr("BHILQN", code) != nullptr || (sizeof(T) == 1 && code == 'c');
+            }
+        }
+
+        /**
+         * @brief Fast path for numeric vectors: copy a contiguous 1D buffer
+         * (array.array, numpy array, memoryview, ...) with a single memcpy.
+         * @return false if the object does not expose a compatible buffer
+         */
+        template <typename T> inline bool copyFromBuffer(const py::handle &h, std::vector<T> &out) {
+            if (!PyObject_CheckBuffer(h.ptr())) {
+                return false;
+            }
+
+            Py_buffer view;
+            if (PyObject_GetBuffer(h.ptr(), &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0) {
+                PyErr_Clear();
+                return false;
+            }
+
+            const bool compatible = view.ndim <= 1 && view.itemsize == sizeof(T) &&
+                                    bufferFormatMatches<T>(view.format);
+            if (compatible) {
+                out.resize(static_cast<size_t>(view.len) / sizeof(T));
+                if (!out.empty()) {
+                    std::memcpy(out.data(), view.buf, out.size() * sizeof(T));
+                }
+            }
+
+            PyBuffer_Release(&view);
+            return compatible;
+        }
+
+        // pybind11 casters (scalars, strings, bound classes...)
+        template <typename T> struct PyCastConverter {
+            static py::object to(const T &value) { return py::cast(value); }
+            static T          from(const py::handle &h) { return h.cast<T>(); }
+        };
+
+    } // namespace detail
+
+    template <typename T>
+    struct ScriptConverter<PyBackend, T, ValueKind::Bool> : detail::PyCastConverter<T> {};
+    template <typename T>
+    struct ScriptConverter<PyBackend, T, ValueKind::Integer> : detail::PyCastConverter<T> {};
+    template <typename T>
+    struct ScriptConverter<PyBackend, T, ValueKind::Unsigned> : detail::PyCastConverter<T> {};
+    template <typename T>
+    struct ScriptConverter<PyBackend, T, ValueKind::Float> : detail::PyCastConverter<T> {};
+    template <typename T>
+    struct ScriptConverter<PyBackend, T, ValueKind::String> : detail::PyCastConverter<T> {};
+
+    // Enum members out; members, integers (IntEnum, IntFlag...) or value names in
+    template <typename T> struct ScriptConverter<PyBackend, T, ValueKind::Enum> {
+        static py::object to(const T &value) { return py::cast(value); }
+        static T          from(const py::handle &h) {
+            using UnderlyingType = std::underlying_type_t<T>;
+            if (py::isinstance<py::str>(h)) {
+                const auto &info = detail::enumInfoFor<T>();
+                return static_cast<T>(
+                    static_cast<UnderlyingType>(info.getValue(h.cast<std::string>())));
+            }
+            if (PyLong_Check(h.ptr())) {
+                try {
+                    return detail::checkedEnumValue<T>(h.cast<int64_t>());
+                } catch (const std::runtime_error &e) {
+                    throw py::value_error(e.what());
+                }
+            }
+            return h.cast<T>();
+        }
+    };
+
+    // Lists out; buffers (single memcpy) or sequences in
+    template <typename T> struct ScriptConverter<PyBackend, T, ValueKind::NumericVector> {
+        static py::object to(const T &vec) { return py::cast(vec); }
+        static T          from(const py::handle &h) {
+            if constexpr (std::is_same_v<T, std::vector<typename T::value_type>>) {
+                T vec;
+                if (detail::copyFromBuffer(h, vec)) {
+                    return vec;
+                }
+            }
+            return h.cast<T>();
+        }
+    };
+
+    template <typename T>
+        requires has_script_converter_v<PyBackend, typename T::value_type>
+    struct ScriptConverter<PyBackend, T, ValueKind::Vector> : detail::PyCastConverter<T> {};
+
+    template <typename T>
+        requires std::is_copy_constructible_v<T>
+    struct ScriptConverter<PyBackend, T, ValueKind::Object> : detail::PyCastConverter<T> {};
+
+    // ------------------------------------------------
+
+    inline PyTypeConverterRegistry &PyTypeConverterRegistry::instance() {
+        static PyTypeConverterRegistry registry;
+        return registry;
+    }
+
+    inline void PyTypeConverterRegistry::register_converter(const std::string &type_name,
+                                                            CppToPyConverter   to_python,
+                                                            PyToCppConverter   from_python,
+                                                            CppToPyReference   reference) {
+        // Assign in place so that Converter pointers handed out by find() stay valid
+        auto &converter       = converters[type_name];
+        converter.to_python   = std::move(to_python);
+        converter.from_python = std::move(from_python);
+        converter.reference   = std::move(reference);
+    }
+
+    template <typename T>
+    inline void PyTypeConverterRegistry::register_type(CppToPyConverter to_python,
+                                                       PyToCppConverter from_python,
+                                                       CppToPyReference reference) {
+        const std::string type_name = getTypeName<T>();
+        register_converter(type_name, std::move(to_python), std::move(from_python),
+                           std::move(reference));
+        by_type[std::type_index(typeid(T))] = &converters.at(type_name);
+    }
+
+    template <typename VectorType> inline void PyTypeConverterRegistry::register_vector() {
+        if constexpr (has_script_converter_v<PyBackend, VectorType>) {
+            const auto &entry = converterFor<PyBackend, VectorType>();
+            register_type<VectorType>(entry.to_script, entry.from_script);
+        } else {
+            // Element type only known to pybind11 (e.g. a py::class_ of a plain struct)
+            register_type<VectorType>(
+                [](const std::any &value) -> py::object {
+                    return py::cast(std::any_cast<const VectorType &>(value));
+                },
+                [](const py::handle &h) -> std::any { return h.cast<VectorType>(); });
+        }
+    }
+
+    template <typename ArrayType> inline void PyTypeConverterRegistry::register_array() {
+        register_type<ArrayType>(
+            [](const std::any &value) -> py::object {
+                return py::cast(std::any_cast<const ArrayType &>(value));
+            },
+            [](const py::handle &h) -> std::any { return h.cast<ArrayType>(); });
+    }
+
+    template <typename EnumType> inline void PyTypeConverterRegistry::register_enum() {
+        static_assert(std::is_enum_v<EnumType>, "Type must be an enum");
+
+        const auto *enum_info = EnumRegistry::instance().getEnumInfo<EnumType>();
+        if (!enum_info) {
+            throw std::runtime_error("Enum not registered");
+        }
+
+        const auto &entry = converterFor<PyBackend, EnumType>();
+        register_type<EnumType>(entry.to_script, entry.from_script);
+        if (enum_info->name != getTypeName<EnumType>()) {
+            register_converter(enum_info->name, entry.to_script, entry.from_script);
+        }
+    }
+
+    template <typename T> inline void PyTypeConverterRegistry::register_class(const std::string &alias) {
+        CppToPyConverter to_python;
+        PyToCppConverter from_python;
+        if constexpr (has_script_converter_v<PyBackend, T>) {
+            to_python   = converterFor<PyBackend, T>().to_script;
+            from_python = converterFor<PyBackend, T>().from_script;
+        }
+        auto reference = [](void *ptr, py::handle parent) -> py::object {
+            return py::cast(static_cast<T *>(ptr), py::return_value_policy::reference_internal,
+                            parent);
+        };
+
+        register_type<T>(to_python, from_python, reference);
+        if (!alias.empty() && alias != getTypeName<T>()) {
+            register_converter(alias, to_python, from_python, reference);
+        }
+
+        // Containers of bound classes come for free (list of copies)
+        if constexpr (has_script_converter_v<PyBackend, std::vector<T>>) {
+            register_vector<std::vector<T>>();
+        }
+    }
+
+    inline bool PyTypeConverterRegistry::has_converter(const std::string &type_name) const {
+        return converters.find(type_name) != converters.end();
+    }
+
+    inline const PyTypeConverterRegistry::Converter *
+    PyTypeConverterRegistry::find(const std::string &type_name) const {
+        auto it = converters.find(type_name);
+        return it != converters.end() ? &it->second : nullptr;
+    }
+
+    inline const PyTypeConverterRegistry::Converter *
+    PyTypeConverterRegistry::find(std::type_index type) const {
+        auto it = by_type.find(type);
+        return it != by_type.end() ? it->second : nullptr;
+    }
+
+    inline const PyTypeConverterRegistry::Converter *
+    PyTypeConverterRegistry::find(const MemberInfo &member) const {
+        const Converter *converter = find(member.type);
+        return converter ? converter : find(member.type_name);
+    }
+
+    inline py::object PyTypeConverterRegistry::convert_to_python(const std::any   &value,
+                                                                 const std::string &type_name) const {
+        if (!value.has_value() || type_name == "void") {
+            return py::none();
+        }
+
+        const auto *converter = find(type_name);
+        if (!converter) {
+            throw py::type_error("No Python converter registered for type: " + type_name);
+        }
+
+        try {
+            return converter->to_python(value);
+        } catch (const std::bad_any_cast &e) {
+            throw py::type_error("Failed to convert type '" + type_name + "' to Python: " +
+                                 e.what());
+        }
+    }
+
+    inline std::any PyTypeConverterRegistry::convert_to_cpp(const py::handle  &py_value,
+                                                            const std::string &type_name) const {
+        const auto *converter = find(type_name);
+        if (!converter) {
+            throw py::type_error("Unsupported type conversion for: " + type_name);
+        }
+
+        try {
+            return converter->from_python(py_value);
+        } catch (const py::cast_error &e) {
+            throw py::type_error("Failed to convert Python object to '" + type_name +
+                                 "': " + e.what());
+        }
+    }
+
+    inline PyTypeConverterRegistry::PyTypeConverterRegistry() {
+        // Scalars, strings and vectors of them (buffer protocol fast path for
+        // numeric element types)
+        forEachBuiltinConverter<PyBackend>(
+            [this](const std::string &type_name, const ConverterEntry<PyBackend> &entry) {
+                register_converter(type_name, entry.to_script, entry.from_script);
+                by_type[std::type_index(*entry.type)] = &converters.at(type_name);
+            });
+
+        // Fixed size arrays
+        register_array<std::array<int, 2>>();
+        register_array<std::array<int, 3>>();
+        register_array<std::array<int, 4>>();
+        register_array<std::array<float, 2>>();
+        register_array<std::array<float, 3>>();
+        register_array<std::array<float, 4>>();
+        register_array<std::array<double, 2>>();
+        register_array<std::array<double, 3>>();
+        register_array<std::array<double, 4>>();
+        register_array<std::array<double, 6>>();
+        register_array<std::array<double, 9>>();
+        register_array<std::array<double, 16>>();
+    }
+
+} // namespace rosetta
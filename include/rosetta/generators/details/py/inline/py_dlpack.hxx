@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+
+namespace rosetta {
+
+    namespace detail {
+
+        /**
+         * @brief A member of a Python-owned object, exported on demand through
+         * DLPack
+         */
+        struct PyMemberTensor {
+            py::object        owner;
+            void             *object; // owned by `owner`
+            const TypeInfo   *type_info;
+            const MemberInfo *member;
+        };
+
+        // Unconsumed tensors are deleted with their capsule (consumers rename it)
+        inline void releaseDLPackCapsule(PyObject *capsule) {
+            if (!PyCapsule_IsValid(capsule, "dltensor")) {
+                return;
+            }
+            auto *tensor =
+                static_cast<DLManagedTensor *>(PyCapsule_GetPointer(capsule, "dltensor"));
+            if (tensor->deleter) {
+                tensor->deleter(tensor);
+            }
+        }
+
+        inline py::capsule dlpackCapsule(const PyMemberTensor &view) {
+            // The owner is released by the consumer, possibly without the GIL
+            std::shared_ptr<const void> owner(new py::object(view.owner),
+                                              [](const py::object *object) {
+                                                  py::gil_scoped_acquire gil;
+                                                  delete object;
+                                              });
+            DLManagedTensor *tensor =
+                toDLPack(*view.type_info, view.object, view.member->name, std::move(owner));
+            PyObject *capsule = PyCapsule_New(tensor, "dltensor", &releaseDLPackCapsule);
+            if (!capsule) {
+                tensor->deleter(tensor);
+                throw py::error_already_set();
+            }
+            return py::reinterpret_steal<py::capsule>(capsule);
+        }
+
+        inline void ensureMemberTensorType(py::handle scope) {
+            if (py::detail::get_type_info(typeid(PyMemberTensor))) {
+                return;
+            }
+            py::class_<PyMemberTensor>(scope, "_MemberTensor", py::module_local())
+                .def(
+                    "__dlpack__",
+                    [](const PyMemberTensor &view, const py::object &stream,
+                       const py::object &max_version, const py::object &dl_device,
+                       const py::object &copy) {
+                        if (!dl_device.is_none() &&
+                            !dl_device.equal(py::make_tuple(static_cast<int>(kDLCPU), 0))) {
+                            throw py::buffer_error("Members are only exported on the CPU");
+                        }
+                        if (!copy.is_none() && copy.cast<bool>()) {
+                            throw py::buffer_error("Members are exported without copy");
+                        }
+                        return dlpackCapsule(view);
+                    },
+                    py::kw_only(), py::arg("stream") = py::none(),
+                    py::arg("max_version") = py::none(), py::arg("dl_device") = py::none(),
+                    py::arg("copy") = py::none())
+                .def("__dlpack_device__",
+                     [](const PyMemberTensor &) {
+                         return py::make_tuple(static_cast<int>(kDLCPU), 0);
+                     })
+                .def_property_readonly(
+                    "name", [](const PyMemberTensor &view) { return view.member->name; });
+        }
+
+    } // namespace detail
+
+    inline bool hasDLPackMembers(const TypeInfo &type_info) {
+        for (const MemberInfo *member : type_info.getMembersInOrder()) {
+            if (member->dlpack_buffer) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename T> inline void bindDLPack(py::class_<T> &py_class) {
+        detail::ensureMemberTensorType(py_class);
+
+        py_class.def(
+            "member_tensor",
+            [](py::object self, const std::string &name) {
+                const TypeInfo   &type_info = T::getStaticTypeInfo();
+                const MemberInfo *member    = type_info.getMember(name);
+                if (!member) {
+                    throw py::value_error("Member not found: " + name);
+                }
+                if (!member->dlpack_buffer) {
+                    throw py::type_error("Member '" + name + "' of type " + member->type_name +
+                                         " is not a numeric vector or array");
+                }
+                T &object = self.cast<T &>();
+                return detail::PyMemberTensor{self, &object, &type_info, member};
+            },
+            py::arg("name"), "DLPack view of a numeric vector or array member (no copy)");
+    }
+
+} // namespace rosetta
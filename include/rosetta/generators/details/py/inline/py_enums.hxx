@@ -14,8 +14,11 @@ namespace rosetta {
             throw std::runtime_error("Enum not registered");
         }
 
-        // pybind11 has built-in enum support
-        py::enum_<EnumType> py_enum(generator.module, enum_info->name.c_str());
+        // pybind11 has built-in enum support. Flags combine with | & ^ ~ (as ints)
+        py::enum_<EnumType> py_enum =
+            enum_info->isFlags()
+                ? py::enum_<EnumType>(generator.module, enum_info->name.c_str(), py::arithmetic())
+                : py::enum_<EnumType>(generator.module, enum_info->name.c_str());
 
         // Add all values
         for (const auto &value_info : enum_info->values) {
@@ -27,6 +30,9 @@ namespace rosetta {
 
         // Export values to module scope (optional, but convenient)
         py_enum.export_values();
+
+        // Accept enum members, integers and value names wherever EnumType is expected
+        PyTypeConverterRegistry::instance().register_enum<EnumType>();
     }
 
     template <typename... EnumTypes> inline void registerEnumTypes(PyGenerator &generator) {
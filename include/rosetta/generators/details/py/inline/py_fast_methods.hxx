@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <cstddef>
+#include <structmember.h>
+
+namespace rosetta {
+
+#if ROSETTA_PY_HAS_VECTORCALL
+
+    namespace detail {
+
+        struct PyFastMethodObject {
+            PyObject_HEAD
+            vectorcallfunc    vectorcall;
+            PyFastMethodData *data;
+        };
+
+        template <typename T> inline void *fastMethodSelf(PyObject *self) {
+            return static_cast<void *>(&py::handle(self).cast<T &>());
+        }
+
+        inline const PyTypeConverterRegistry::Converter *
+        resolveConverter(const PyTypeConverterRegistry::Converter *&slot,
+                         const std::string                         &type_name) {
+            if (!slot) {
+                slot = PyTypeConverterRegistry::instance().find(type_name);
+                if (!slot) {
+                    throw py::type_error("No Python converter registered for type: " + type_name);
+                }
+            }
+            return slot;
+        }
+
+        inline PyObject *fastMethodCall(PyObject *callable, PyObject *const *args, size_t nargsf,
+                                        PyObject *kwnames) {
+            auto      &data  = *reinterpret_cast<PyFastMethodObject *>(callable)->data;
+            Py_ssize_t nargs = PyVectorcall_NARGS(nargsf);
+
+            if (kwnames && PyTuple_GET_SIZE(kwnames) > 0) {
+                PyErr_Format(PyExc_TypeError, "%s() takes no keyword arguments",
+                             data.name.c_str());
+                return nullptr;
+            }
+
+            const auto &parameter_types = data.method->parameter_types;
+            if (nargs < 1) {
+                PyErr_Format(PyExc_TypeError, "unbound method %s.%s() needs an argument",
+                             data.class_name.c_str(), data.name.c_str());
+                return nullptr;
+            }
+            if (static_cast<size_t>(nargs - 1) != parameter_types.size()) {
+                PyErr_Format(PyExc_TypeError, "%s() takes %zu arguments (%zd given)",
+                             data.name.c_str(), parameter_types.size(), nargs - 1);
+                return nullptr;
+            }
+
+            // Re-entrant calls (e.g. a method calling back into Python) get their own storage
+            std::vector<std::any>  local_arguments;
+            const bool             reuse     = !data.arguments_in_use;
+            std::vector<std::any> &arguments = reuse ? data.arguments : local_arguments;
+            struct Release {
+                PyFastMethodData *data;
+                ~Release() {
+                    if (data) {
+                        data->arguments.clear();
+                        data->arguments_in_use = false;
+                    }
+                }
+            } release{reuse ? &data : nullptr};
+            data.arguments_in_use = true;
+
+            try {
+                void *obj = nullptr;
+                try {
+                    obj = data.self(args[0]);
+                } catch (const py::cast_error &) {
+                    PyErr_Format(PyExc_TypeError, "descriptor '%s' requires a '%s' object",
+                                 data.name.c_str(), data.class_name.c_str());
+                    return nullptr;
+                }
+
+                arguments.clear();
+                for (size_t i = 0; i < parameter_types.size(); ++i) {
+                    const auto *converter =
+                        resolveConverter(data.parameter_converters[i], parameter_types[i]);
+                    arguments.push_back(converter->from_python(args[i + 1]));
+                }
+
+                std::any result = data.method->invoker(obj, arguments);
+
+                if (!result.has_value() || data.method->return_type == "void") {
+                    Py_RETURN_NONE;
+                }
+                const auto *converter =
+                    resolveConverter(data.return_converter, data.method->return_type);
+                return converter->to_python(result).release().ptr();
+            } catch (py::error_already_set &e) {
+                e.restore();
+            } catch (const py::builtin_exception &e) {
+                e.set_error();
+            } catch (const std::exception &e) {
+                PyErr_Format(PyExc_RuntimeError, "Failed to call method '%s': %s",
+                             data.name.c_str(), e.what());
+            }
+            return nullptr;
+        }
+
+        inline PyObject *fastMethodGet(PyObject *self, PyObject *obj, PyObject *) {
+            if (!obj) {
+                Py_INCREF(self);
+                return self;
+            }
+            return PyMethod_New(self, obj);
+        }
+
+        inline void fastMethodDealloc(PyObject *self) {
+            PyTypeObject *type = Py_TYPE(self);
+            delete reinterpret_cast<PyFastMethodObject *>(self)->data;
+            type->tp_free(self);
+            Py_DECREF(type);
+        }
+
+        inline PyObject *fastMethodName(PyObject *self, void *) {
+            return PyUnicode_FromString(
+                reinterpret_cast<PyFastMethodObject *>(self)->data->name.c_str());
+        }
+
+        inline PyObject *fastMethodQualName(PyObject *self, void *) {
+            const auto *data = reinterpret_cast<PyFastMethodObject *>(self)->data;
+            return PyUnicode_FromString((data->class_name + "." + data->name).c_str());
+        }
+
+        inline PyObject *fastMethodRepr(PyObject *self) {
+            const auto *data = reinterpret_cast<PyFastMethodObject *>(self)->data;
+            return PyUnicode_FromFormat("<method '%s' of '%s' objects>", data->name.c_str(),
+                                        data->class_name.c_str());
+        }
+
+        /**
+         * @brief The (process wide) Python type of fast method descriptors
+         */
+        inline PyTypeObject *fastMethodType() {
+            static PyTypeObject *type = [] {
+                static PyMemberDef members[] = {
+                    {"__vectorcalloffset__", T_PYSSIZET,
+                     offsetof(PyFastMethodObject, vectorcall), READONLY, nullptr},
+                    {nullptr, 0, 0, 0, nullptr}};
+                static PyGetSetDef getset[] = {
+                    {"__name__", fastMethodName, nullptr, nullptr, nullptr},
+                    {"__qualname__", fastMethodQualName, nullptr, nullptr, nullptr},
+                    {nullptr, nullptr, nullptr, nullptr, nullptr}};
+                static PyType_Slot slots[] = {
+                    {Py_tp_call, reinterpret_cast<void *>(PyVectorcall_Call)},
+                    {Py_tp_descr_get, reinterpret_cast<void *>(fastMethodGet)},
+                    {Py_tp_dealloc, reinterpret_cast<void *>(fastMethodDealloc)},
+                    {Py_tp_repr, reinterpret_cast<void *>(fastMethodRepr)},
+                    {Py_tp_members, members},
+                    {Py_tp_getset, getset},
+                    {0, nullptr}};
+                static PyType_Spec spec = {"rosetta.FastMethod",
+                                           static_cast<int>(sizeof(PyFastMethodObject)), 0,
+                                           Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_VECTORCALL |
+                                               Py_TPFLAGS_METHOD_DESCRIPTOR,
+                                           slots};
+                auto *created = reinterpret_cast<PyTypeObject *>(PyType_FromSpec(&spec));
+                if (!created) {
+                    throw py::error_already_set();
+                }
+                return created;
+            }();
+            return type;
+        }
+
+    } // namespace detail
+
+    template <typename T>
+    inline py::object makeFastMethod(const std::string &class_name, const MethodInfo *method) {
+        auto data        = std::make_unique<PyFastMethodData>();
+        data->name       = method->name;
+        data->class_name = class_name;
+        data->method     = method;
+        data->self       = &detail::fastMethodSelf<T>;
+        data->parameter_converters.resize(method->parameter_types.size(), nullptr);
+        data->arguments.reserve(method->parameter_types.size());
+
+        PyTypeObject *type = detail::fastMethodType();
+        PyObject     *obj  = type->tp_alloc(type, 0);
+        if (!obj) {
+            throw py::error_already_set();
+        }
+        auto *fast_method       = reinterpret_cast<detail::PyFastMethodObject *>(obj);
+        fast_method->vectorcall = detail::fastMethodCall;
+        fast_method->data       = data.release();
+        return py::reinterpret_steal<py::object>(obj);
+    }
+
+#endif
+
+} // namespace rosetta
@@ -3,10 +3,15 @@
  * LGPL v3 license
  *
  */
+#include <atomic>
+#include <exception>
 #include <functional>
 #include <memory>
 #include <pybind11/functional.h>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
+#include <tuple>
+#include <variant>
 #include <rosetta/generators/details/py/py_generator.h>
 
 namespace py = pybind11;
@@ -70,6 +75,23 @@ namespace rosetta {
             }
         }
 
+        const py::object& callable() const { return callable_; }
+
+        // The last reference may be released from a non Python thread, or
+        // after the interpreter is finalized (static storage): it is then leaked
+        ~PyCallableWrapper()
+        {
+            if (!Py_IsInitialized()) {
+                callable_.release();
+                return;
+            }
+            py::gil_scoped_acquire gil;
+            callable_ = py::object();
+        }
+
+        PyCallableWrapper(const PyCallableWrapper&) = delete;
+        PyCallableWrapper& operator=(const PyCallableWrapper&) = delete;
+
     private:
         py::object callable_;
     };
@@ -98,6 +120,302 @@ namespace rosetta {
         return cpp_func;
     }
 
+    // ============================================================================
+    // Batched callbacks
+    // ============================================================================
+
+    namespace detail {
+
+        inline bool numpyAvailable()
+        {
+            static const bool available = [] {
+                try {
+                    py::module_::import("numpy");
+                    return true;
+                } catch (const py::error_already_set&) {
+                    return false;
+                }
+            }();
+            return available;
+        }
+
+        // Numeric columns become NumPy arrays (one memcpy), others become lists
+        template <typename T> inline py::object columnToPython(const std::vector<T>& column)
+        {
+            if constexpr (is_numeric_v<T>) {
+                if (numpyAvailable()) {
+                    return py::array_t<T>(static_cast<py::ssize_t>(column.size()), column.data());
+                }
+            }
+            return py::cast(column);
+        }
+
+        template <typename T>
+        inline void resultsFromPython(const py::handle& result, std::size_t n, std::vector<T>& out)
+        {
+            const std::size_t offset = out.size();
+            if constexpr (is_numeric_v<T>) {
+                std::vector<T> block;
+                if (copyFromBuffer(result, block)) {
+                    if (block.size() != n) {
+                        throw std::runtime_error("Batched callback returned "
+                            + std::to_string(block.size()) + " results, expected "
+                            + std::to_string(n));
+                    }
+                    out.insert(out.end(), block.begin(), block.end());
+                    return;
+                }
+            }
+            for (auto item : result) {
+                out.push_back(item.cast<T>());
+            }
+            if (out.size() - offset != n) {
+                throw std::runtime_error("Batched callback returned "
+                    + std::to_string(out.size() - offset) + " results, expected "
+                    + std::to_string(n));
+            }
+        }
+
+    } // namespace detail
+
+    /**
+     * @brief Invoke a Python callable once per batch of N invocations instead of
+     * once per invocation.
+     *
+     * Invocations are queued with push() (or through the std::function returned
+     * by asFunction()). When batch_size invocations are pending, or on flush(),
+     * the GIL is acquired once and the callable is called with one column per
+     * argument: NumPy arrays for numeric arguments (lists when NumPy is not
+     * available, or for other types). For a non-void Ret the callable must
+     * return a sequence (or buffer) of N results, collected in push order and
+     * retrieved with takeResults().
+     *
+     * Not thread safe: use PyCallbackQueue to call back from worker threads.
+     *
+     * @code{.py}
+     * proc.for_each_batched(lambda xs: print(xs.sum()))    # xs: numpy.ndarray
+     * proc.transform_batched(lambda xs, ys: xs * ys + 1)  # returns N results
+     * @endcode
+     */
+    template <typename Ret, typename... Args> class PyBatchCallback {
+        static_assert(sizeof...(Args) > 0, "Batched callbacks need at least one argument");
+
+    public:
+        using Columns = std::tuple<std::vector<std::decay_t<Args>>...>;
+        using Results
+            = std::vector<std::conditional_t<std::is_void_v<Ret>, std::monostate, Ret>>;
+
+        explicit PyBatchCallback(py::object callable, std::size_t batch_size = 1024)
+            : callable_(std::make_shared<PyCallableWrapper>(std::move(callable)))
+            , batch_size_(batch_size == 0 ? 1 : batch_size)
+        {
+            std::apply([this](auto&... cols) { (cols.reserve(batch_size_), ...); }, columns_);
+        }
+
+        /**
+         * @brief Queue one invocation (flushes when the batch is full)
+         */
+        void push(Args... args)
+        {
+            std::apply(
+                [&](auto&... cols) { (cols.push_back(std::forward<Args>(args)), ...); }, columns_);
+            if (pending() >= batch_size_) {
+                flush();
+            }
+        }
+
+        /**
+         * @brief Call Python for the pending invocations (no-op if none)
+         */
+        void flush()
+        {
+            if (pending() == 0) {
+                return;
+            }
+            Results results = std::apply([this](auto&... cols) { return call(cols...); }, columns_);
+            std::apply([](auto&... cols) { (cols.clear(), ...); }, columns_);
+            if constexpr (!std::is_void_v<Ret>) {
+                results_.insert(results_.end(), std::make_move_iterator(results.begin()),
+                    std::make_move_iterator(results.end()));
+            }
+        }
+
+        /**
+         * @brief Call Python once with whole columns (all of the same size)
+         */
+        Results call(const std::vector<std::decay_t<Args>>&... columns)
+        {
+            const std::size_t sizes[] = { columns.size()... };
+            const std::size_t n = sizes[0];
+            for (auto size : sizes) {
+                if (size != n) {
+                    throw std::runtime_error("Batched callback columns must have the same size");
+                }
+            }
+
+            Results results;
+            results.reserve(n);
+
+            py::gil_scoped_acquire gil;
+            try {
+                py::object result = callable_->callable()(detail::columnToPython(columns)...);
+                if constexpr (!std::is_void_v<Ret>) {
+                    detail::resultsFromPython(result, n, results);
+                }
+            } catch (const py::error_already_set& e) {
+                throw std::runtime_error(std::string("Python callback error: ") + e.what());
+            }
+            if constexpr (std::is_void_v<Ret>) {
+                results.resize(n);
+            }
+            return results;
+        }
+
+        /**
+         * @brief Results of all the flushed invocations, in push order
+         */
+        Results takeResults()
+        {
+            Results results;
+            results.swap(results_);
+            return results;
+        }
+
+        std::size_t pending() const { return std::get<0>(columns_).size(); }
+        std::size_t batchSize() const { return batch_size_; }
+
+        /**
+         * @brief std::function queuing invocations (e.g. for a C++ forEach)
+         * The PyBatchCallback must outlive the returned function.
+         */
+        std::function<void(Args...)> asFunction()
+        {
+            return [this](Args... args) { push(std::forward<Args>(args)...); };
+        }
+
+    private:
+        std::shared_ptr<PyCallableWrapper> callable_;
+        std::size_t                        batch_size_;
+        Columns                            columns_;
+        Results                            results_;
+    };
+
+    // ============================================================================
+    // Callbacks from worker threads
+    // ============================================================================
+
+    /**
+     * @brief Multi-producer queue of tasks executed on the Python thread.
+     *
+     * post() is lock-free and does not need the GIL, so it can be called from
+     * any C++ worker thread. The thread owning the Python interpreter runs the
+     * queued tasks with drain(), acquiring the GIL once for all of them.
+     *
+     * @code{.cpp}
+     * PyCallbackQueue queue;
+     * auto on_progress = queue.wrap<double>(py_callback);  // with the GIL
+     * std::thread worker([&] { on_progress(0.5); });      // from any thread
+     * ...
+     * queue.drain();                                       // Python thread
+     * @endcode
+     */
+    class PyCallbackQueue {
+    public:
+        PyCallbackQueue() = default;
+        PyCallbackQueue(const PyCallbackQueue&) = delete;
+        PyCallbackQueue& operator=(const PyCallbackQueue&) = delete;
+
+        ~PyCallbackQueue()
+        {
+            Node* node = head_.exchange(nullptr, std::memory_order_acquire);
+            while (node) {
+                std::unique_ptr<Node> owned(node);
+                node = node->next;
+            }
+        }
+
+        /**
+         * @brief Queue a task (any thread, lock-free, no GIL needed)
+         */
+        void post(std::function<void()> task)
+        {
+            auto* node = new Node { std::move(task), head_.load(std::memory_order_relaxed) };
+            while (!head_.compare_exchange_weak(
+                node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+            }
+        }
+
+        /**
+         * @brief Wrap a Python callable into a std::function that can be called
+         * from any thread: each call is queued and runs on the next drain().
+         * Must be called with the GIL held.
+         */
+        template <typename... Args> std::function<void(Args...)> wrap(py::object callable)
+        {
+            auto wrapper = std::make_shared<PyCallableWrapper>(std::move(callable));
+            return [this, wrapper](Args... args) {
+                post([wrapper, values = std::make_tuple(std::decay_t<Args>(args)...)]() {
+                    std::apply(
+                        [&](const auto&... v) { wrapper->call<void>(v...); }, values);
+                });
+            };
+        }
+
+        /**
+         * @brief Run all the queued tasks (FIFO) on the calling thread, with the
+         * GIL acquired once. Rethrows the first task exception after all the
+         * tasks have run.
+         * @return Number of tasks executed
+         */
+        std::size_t drain()
+        {
+            Node* list = head_.exchange(nullptr, std::memory_order_acquire);
+            if (!list) {
+                return 0;
+            }
+
+            // The stack is LIFO: reverse it to run tasks in posting order
+            Node* fifo = nullptr;
+            while (list) {
+                Node* next = list->next;
+                list->next = fifo;
+                fifo = list;
+                list = next;
+            }
+
+            std::size_t        count = 0;
+            std::exception_ptr error;
+            {
+                py::gil_scoped_acquire gil;
+                while (fifo) {
+                    std::unique_ptr<Node> node(fifo);
+                    fifo = fifo->next;
+                    try {
+                        node->task();
+                    } catch (...) {
+                        if (!error) {
+                            error = std::current_exception();
+                        }
+                    }
+                    ++count;
+                }
+            }
+            if (error) {
+                std::rethrow_exception(error);
+            }
+            return count;
+        }
+
+        bool empty() const { return head_.load(std::memory_order_acquire) == nullptr; }
+
+    private:
+        struct Node {
+            std::function<void()> task;
+            Node*                 next;
+        };
+        std::atomic<Node*> head_ { nullptr };
+    };
+
     // ============================================================================
     // Type registration
     // ============================================================================
@@ -110,14 +428,16 @@ namespace rosetta {
     template <typename Ret, typename... Args>
     inline void registerFunctorType(PyGenerator& generator)
     {
-        // Note: pybind11 has automatic support for std::function via pybind11/functional.h
-        // This registration is for explicit control and consistency with the JS/Lua systems
-
-        // The conversion is handled automatically by pybind11's built-in converters
-        // when pybind11/functional.h is included
-
-        // This function exists for API consistency but doesn't need explicit registration
-        // in Python since pybind11 handles it automatically
+        // Members, arguments and return values declared as std::function go
+        // through the converter registry like any other type
+        using FunctionType = std::function<Ret(Args...)>;
+        PyTypeConverterRegistry::instance().register_type<FunctionType>(
+            [](const std::any& value) -> py::object {
+                return functorToPython(std::any_cast<const FunctionType&>(value));
+            },
+            [](const py::handle& h) -> std::any {
+                return pythonToFunctor<Ret, Args...>(py::reinterpret_borrow<py::object>(h));
+            });
     }
 
     /**
@@ -125,26 +445,28 @@ namespace rosetta {
      */
     inline void registerFunctorSupport(PyGenerator& generator)
     {
-        // With pybind11, functor support is built-in via pybind11/functional.h
-        // Common functor types are automatically handled:
-
         // Unary functors
-        // - void(int), void(double), void(const std::string&)
-        // - int(int), double(double), std::string(const std::string&)
+        registerFunctorType<void, int>(generator);
+        registerFunctorType<void, double>(generator);
+        registerFunctorType<void, const std::string&>(generator);
+        registerFunctorType<int, int>(generator);
+        registerFunctorType<double, double>(generator);
+        registerFunctorType<std::string, const std::string&>(generator);
 
         // Binary functors (for reduce)
-        // - int(int, int), double(double, double)
-        // - std::string(const std::string&, const std::string&)
+        registerFunctorType<int, int, int>(generator);
+        registerFunctorType<double, double, double>(generator);
+        registerFunctorType<std::string, const std::string&, const std::string&>(generator);
 
         // Predicates
-        // - bool(int), bool(double), bool(const std::string&)
+        registerFunctorType<bool, int>(generator);
+        registerFunctorType<bool, double>(generator);
+        registerFunctorType<bool, const std::string&>(generator);
 
         // Index-based functors (forEach with index)
-        // - void(int, size_t), void(double, size_t)
-        // - void(const std::string&, size_t)
-
-        // No explicit registration needed - pybind11 handles this automatically
-        // This function exists for API consistency with JS and Lua generators
+        registerFunctorType<void, int, size_t>(generator);
+        registerFunctorType<void, double, size_t>(generator);
+        registerFunctorType<void, const std::string&, size_t>(generator);
     }
 
 } // namespace rosetta
@@ -350,7 +672,10 @@ PERFORMANCE NOTES:
 1. GIL Overhead:
    - Python GIL acquired for each callback
    - Use C++ lambdas when possible for performance
-   - Batch operations to minimize GIL acquisitions
+   - Use PyBatchCallback to call Python once per batch of invocations
+     (one GIL acquisition, NumPy columns, vectorized Python code)
+   - Use PyCallbackQueue to call back from C++ worker threads: they post
+     lock-free, the Python thread runs everything with drain()
 
 2. Type Conversion:
    - Conversion overhead for arguments/returns
@@ -431,7 +756,8 @@ LIMITATIONS:
 
 1. Python GIL:
    - Must acquire GIL for Python callbacks
-   - Can't use Python callbacks in C++ threads
+   - Python callbacks from C++ threads serialize on the GIL
+     (prefer PyCallbackQueue::wrap + drain)
    - Use py::call_guard<py::gil_scoped_release>() for long operations
 
 2. Lifetime:
@@ -26,6 +26,10 @@ namespace rosetta {
         // Create pybind11 class
         auto py_class = py::class_<T>(module, final_class_name.c_str());
 
+        // Make T (and std::vector<T>) usable as member, argument and return type.
+        // Done before binding members so that self-referencing types resolve.
+        PyTypeConverterRegistry::instance().register_class<T>(type_info.class_name);
+
         // Bind constructors (we may want to customize this)
         bind_constructors<T>(py_class, type_info);
 
@@ -38,6 +42,22 @@ namespace rosetta {
         // Add introspection utilities to Python
         bind_introspection_utilities<T>(py_class);
 
+        // Pickle support (multiprocessing, copy) when all members are serializable
+        if (isBinarySerializable(type_info)) {
+            bindPickle<T>(py_class);
+        }
+
+        // Zero-copy export of the numeric vector and array members
+        if (hasDLPackMembers(type_info)) {
+            bindDLPack<T>(py_class);
+        }
+
+        // Change notifications of the observable members
+        if (hasObservableMembers(type_info)) {
+            bindPropertyChanged<T>(py_class);
+            bindPropertyBatch(module);
+        }
+
         return py_class;
     }
 
@@ -87,29 +107,30 @@ namespace rosetta {
             if (!member)
                 continue;
 
-            // Create Python property using introspection getter/setter
+            // Create Python property using introspection getter/setter. Members
+            // whose type is a bound class are returned by reference (no copy).
             py_class.def_property(
                 member_name.c_str(),
                 // Getter
-                [this, member_name](const T& obj) -> py::object {
+                [member](py::object self) -> py::object {
                     try {
-                        auto value = obj.getMemberValue(member_name);
-                        return convert_any_to_python(
-                            value, obj.getTypeInfo().getMember(member_name)->type_name);
+                        return get_member(self, &self.cast<T &>(), *member);
+                    } catch (const py::error_already_set &) {
+                        throw;
                     } catch (const std::exception& e) {
                         throw py::value_error(
-                            "Failed to get member '" + member_name + "': " + e.what());
+                            "Failed to get member '" + member->name + "': " + e.what());
                     }
                 },
                 // Setter
-                [this, member_name](T& obj, py::object py_value) {
+                [member](T& obj, py::handle py_value) {
                     try {
-                        const auto* member_info = obj.getTypeInfo().getMember(member_name);
-                        auto cpp_value = convert_python_to_any(py_value, member_info->type_name);
-                        obj.setMemberValue(member_name, cpp_value);
+                        member->setter(&obj,
+                            PyTypeConverterRegistry::instance().convert_to_cpp(
+                                py_value, member->type_name));
                     } catch (const std::exception& e) {
                         throw py::value_error(
-                            "Failed to set member '" + member_name + "': " + e.what());
+                            "Failed to set member '" + member->name + "': " + e.what());
                     }
                 },
                 ("Access to " + member_name + " member").c_str());
@@ -119,6 +140,8 @@ namespace rosetta {
     template <typename T>
     inline void PyGenerator::bind_methods(py::class_<T>& py_class, const TypeInfo& type_info)
     {
+        const auto class_name = py_class.attr("__name__").template cast<std::string>();
+
         for (const auto& method_name : type_info.getMethodNames()) {
             const auto* method = type_info.getMethod(method_name);
             if (!method)
@@ -128,6 +151,14 @@ namespace rosetta {
             if (is_getter_setter_method(method_name))
                 continue;
 
+#if ROSETTA_PY_HAS_VECTORCALL
+            // Vectorcall descriptor: no argument tuple, no overload resolution
+            if (fast_methods) {
+                py_class.attr(method_name.c_str()) = makeFastMethod<T>(class_name, method);
+                continue;
+            }
+#endif
+
             // Create Python method using introspection
             py_class.def(
                 method_name.c_str(),
@@ -153,9 +184,11 @@ namespace rosetta {
 
                         // Convert result back to Python
                         return convert_any_to_python(result, method_info->return_type);
+                    } catch (const py::error_already_set&) {
+                        throw;
                     } catch (const std::exception& e) {
-                        // throw py::runtime_error("Failed to call method '" +
-                        //                         method_name + "': " + e.what());
+                        throw std::runtime_error(
+                            "Failed to call method '" + method_name + "': " + e.what());
                     }
                 },
                 ("Call " + method_name + " method").c_str());
@@ -171,15 +204,21 @@ namespace rosetta {
         py_class.def("get_method_names", &T::getMethodNames, "Get all method names");
         py_class.def("has_member", &T::hasMember, "Check if member exists");
         py_class.def("has_method", &T::hasMethod, "Check if method exists");
-        py_class.def("to_json", &T::toJSON, "Export object to JSON string");
+        py_class.def(
+            "to_json", [](const T& obj) { return obj.toJSON(); }, "Export object to JSON string");
+        py_class.def(
+            "from_json", [](T& obj, const std::string& json) { obj.fromJSON(json); },
+            "Read members from a JSON string");
 
         // Dynamic member/method access
         py_class.def(
             "get_member_value",
-            [this](const T& obj, const std::string& name) -> py::object {
-                auto value = obj.getMemberValue(name);
+            [](py::object self, const std::string& name) -> py::object {
+                T& obj = self.cast<T&>();
                 const auto* member = obj.getTypeInfo().getMember(name);
-                return convert_any_to_python(value, member ? member->type_name : "unknown");
+                if (!member)
+                    throw py::value_error("Member not found: " + name);
+                return get_member(self, &obj, *member);
             },
             "Get member value by name");
 
@@ -222,60 +261,45 @@ namespace rosetta {
             || method_name.starts_with("is");
     }
 
+    inline PyGenerator& PyGenerator::use_fast_methods(bool enable)
+    {
+        fast_methods = enable && ROSETTA_PY_HAS_VECTORCALL;
+        return *this;
+    }
+
+    inline PyGenerator& PyGenerator::register_type_converter(const std::string& type_name,
+        CppToPyConverter to_python, PyToCppConverter from_python, CppToPyReference reference)
+    {
+        PyTypeConverterRegistry::instance().register_converter(
+            type_name, std::move(to_python), std::move(from_python), std::move(reference));
+        return *this;
+    }
+
+    inline py::object PyGenerator::get_member(
+        py::handle self, void* obj, const MemberInfo& member)
+    {
+        const auto* converter = PyTypeConverterRegistry::instance().find(member);
+        if (!converter) {
+            throw py::type_error("No Python converter registered for type: " + member.type_name);
+        }
+        if (converter->reference && member.address) {
+            return converter->reference(member.address(obj), self);
+        }
+        return converter->to_python(member.getter(obj));
+    }
+
     // Convert std::any to Python object based on type name
     inline py::object PyGenerator::convert_any_to_python(
         const std::any& value, const std::string& type_name) const
     {
-        if (value.has_value() == false || type_name == "void") {
-            return py::none();
-        }
-
-        try {
-            if (type_name == "string") {
-                return py::cast(std::any_cast<std::string>(value));
-            } else if (type_name == "int") {
-                return py::cast(std::any_cast<int>(value));
-            } else if (type_name == "double") {
-                return py::cast(std::any_cast<double>(value));
-            } else if (type_name == "float") {
-                return py::cast(std::any_cast<float>(value));
-            } else if (type_name == "bool") {
-                return py::cast(std::any_cast<bool>(value));
-            } else {
-                // For custom types, try generic casting
-                // we may need to extend this for our custom types
-                return py::cast(value);
-            }
-        } catch (const std::bad_any_cast& e) {
-            throw py::type_error(
-                "Failed to convert type '" + type_name + "' to Python: " + e.what());
-        }
+        return PyTypeConverterRegistry::instance().convert_to_python(value, type_name);
     }
 
     // Convert Python object to std::any based on expected type
     inline std::any PyGenerator::convert_python_to_any(
-        py::object py_value, const std::string& type_name) const
+        py::handle py_value, const std::string& type_name) const
     {
-        try {
-            if (type_name == "string") {
-                return std::make_any<std::string>(py_value.cast<std::string>());
-            } else if (type_name == "int") {
-                return std::make_any<int>(py_value.cast<int>());
-            } else if (type_name == "double") {
-                return std::make_any<double>(py_value.cast<double>());
-            } else if (type_name == "float") {
-                return std::make_any<float>(py_value.cast<float>());
-            } else if (type_name == "bool") {
-                return std::make_any<bool>(py_value.cast<bool>());
-            } else {
-                // For custom types, this is more complex and would require
-                // additional type information or registration
-                throw py::type_error("Unsupported type conversion for: " + type_name);
-            }
-        } catch (const py::cast_error& e) {
-            throw py::type_error(
-                "Failed to convert Python object to '" + type_name + "': " + e.what());
-        }
+        return PyTypeConverterRegistry::instance().convert_to_cpp(py_value, type_name);
     }
 
 }
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+
+namespace rosetta {
+
+    namespace detail {
+
+        inline QueryValue pyIndexValue(const py::handle& value)
+        {
+            if (py::isinstance<py::bool_>(value)) {
+                return value.cast<bool>();
+            }
+            if (py::isinstance<py::int_>(value) || py::isinstance<py::float_>(value)) {
+                return value.cast<double>();
+            }
+            if (py::isinstance<py::str>(value)) {
+                return value.cast<std::string>();
+            }
+            throw py::type_error("Index keys are numbers, bool or strings");
+        }
+
+        // A value, or a tuple/list of values for several members
+        inline IndexKey pyIndexKey(const py::handle& values)
+        {
+            IndexKey key;
+            if (py::isinstance<py::tuple>(values) || py::isinstance<py::list>(values)) {
+                for (const auto& value : values) {
+                    key.push_back(pyIndexValue(value));
+                }
+            } else {
+                key.push_back(pyIndexValue(values));
+            }
+            return key;
+        }
+
+        template <typename T>
+        inline py::list pyIndexObjects(const PyIndex<T>& index, const std::vector<T*>& objects)
+        {
+            py::list result(objects.size());
+            for (std::size_t i = 0; i < objects.size(); ++i) {
+                result[i] = index.owners.at(objects[i]);
+            }
+            return result;
+        }
+
+        template <typename T> inline void pyIndexAdd(PyIndex<T>& index, const py::object& object)
+        {
+            T& value = object.cast<T&>();
+            index.index.insert(value);
+            index.owners.emplace(&value, object);
+        }
+
+    } // namespace detail
+
+    template <typename T>
+    inline py::class_<PyIndex<T>> registerIndexType(PyGenerator& generator, const std::string& name)
+    {
+        using IndexType = PyIndex<T>;
+        const std::string class_name =
+            name.empty() ? T::getStaticTypeInfo().class_name + "Index" : name;
+
+        py::class_<IndexType> py_class(generator.module, class_name.c_str());
+        py_class
+            .def(py::init<const std::string&, const std::vector<std::string>&>(), py::arg("kind"),
+                py::arg("members"), "Index of kind \"hash\" or \"ordered\" on key members")
+            .def("__len__", [](const IndexType& index) { return index.index.size(); })
+            .def(
+                "__contains__",
+                [](const IndexType& index, const T& object) {
+                    return index.index.contains(object);
+                },
+                py::arg("object"))
+            .def_property_readonly(
+                "members", [](const IndexType& index) { return index.index.members(); })
+            .def("add", &detail::pyIndexAdd<T>, py::arg("object"), "Index an object")
+            .def(
+                "extend",
+                [](IndexType& index, const py::iterable& objects) {
+                    for (const auto& object : objects) {
+                        detail::pyIndexAdd(index, py::reinterpret_borrow<py::object>(object));
+                    }
+                },
+                py::arg("objects"), "Index all the objects of an iterable")
+            .def(
+                "remove",
+                [](IndexType& index, const T& object) {
+                    index.index.erase(object);
+                    index.owners.erase(&object);
+                },
+                py::arg("object"), "Remove an object from the index")
+            .def(
+                "update",
+                [](IndexType& index, const T& object) { index.index.update(object); },
+                py::arg("object"), "Re-key an object after a change made outside of Python")
+            .def(
+                "clear",
+                [](IndexType& index) {
+                    index.index.clear();
+                    index.owners.clear();
+                })
+            .def(
+                "lookup",
+                [](const IndexType& index, const py::args& values) {
+                    return detail::pyIndexObjects(
+                        index, index.index.lookup(detail::pyIndexKey(values)));
+                },
+                "Objects whose key equals the values (one per member)")
+            .def(
+                "range",
+                [](const IndexType& index, const py::object& lo, const py::object& hi) {
+                    return detail::pyIndexObjects(index,
+                        index.index.range(detail::pyIndexKey(lo), detail::pyIndexKey(hi)));
+                },
+                py::arg("lo"), py::arg("hi"),
+                "Objects whose key is in [lo, hi] in key order (ordered indexes)");
+        return py_class;
+    }
+
+} // namespace rosetta
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <memory>
+
+namespace rosetta {
+
+    namespace detail {
+
+        /**
+         * @brief Python callback of a subscription, and the weak reference
+         * ending it when its object is collected
+         */
+        struct PyPropertySubscriber {
+            py::object callback;
+            py::object finalizer;
+        };
+
+        // Subscriptions may be dropped by any thread, or after the interpreter
+        // is finalized (static TypeInfo): the Python objects are then leaked
+        inline std::shared_ptr<PyPropertySubscriber> makePropertySubscriber(py::object callback) {
+            return std::shared_ptr<PyPropertySubscriber>(
+                new PyPropertySubscriber{std::move(callback), {}},
+                [](PyPropertySubscriber *subscriber) {
+                    if (!Py_IsInitialized()) {
+                        subscriber->callback.release();
+                        subscriber->finalizer.release();
+                    } else {
+                        py::gil_scoped_acquire gil;
+                        subscriber->callback  = py::object();
+                        subscriber->finalizer = py::object();
+                    }
+                    delete subscriber;
+                });
+        }
+
+        inline PropertyChangeHandler pyPropertyChangeHandler(
+            std::shared_ptr<PyPropertySubscriber> subscriber) {
+            return [subscriber](std::span<const PropertyChange> changes) {
+                py::gil_scoped_acquire gil;
+                const auto &registry = PyTypeConverterRegistry::instance();
+                py::list    events;
+                for (const PropertyChange &change : changes) {
+                    const std::string &type_name = change.member->type_name;
+                    events.append(py::make_tuple(
+                        change.member->name, change.slot,
+                        registry.convert_to_python(change.old_value, type_name),
+                        registry.convert_to_python(change.new_value, type_name)));
+                }
+                subscriber->callback(events);
+            };
+        }
+
+        struct PyPropertyBatch {
+            bool open = false;
+        };
+
+    } // namespace detail
+
+    inline bool hasObservableMembers(const TypeInfo &type_info) {
+        for (const MemberInfo *member : type_info.getMembersInOrder()) {
+            if (member->observable) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename T> inline void bindPropertyChanged(py::class_<T> &py_class) {
+        py_class
+            .def(
+                "on_property_changed",
+                [](py::object self, py::function callback) {
+                    const TypeInfo &type_info = T::getStaticTypeInfo();
+                    const void     *address   = &self.cast<const T &>();
+                    auto subscriber = detail::makePropertySubscriber(std::move(callback));
+                    const std::size_t id = type_info.subscribePropertyChanged(
+                        address, detail::pyPropertyChangeHandler(subscriber));
+
+                    // An object owned by Python cannot outlive its wrapper
+                    if (reinterpret_cast<py::detail::instance *>(self.ptr())->owned) {
+                        subscriber->finalizer = py::weakref(
+                            self, py::cpp_function([&type_info, address, id](py::handle) {
+                                type_info.unsubscribePropertyChanged(address, id);
+                            }));
+                    }
+                    return id;
+                },
+                py::arg("callback"),
+                "Call callback([(name, slot, old, new), ...]) when observable members change")
+            .def(
+                "off_property_changed",
+                [](const T &object, std::size_t id) {
+                    T::getStaticTypeInfo().unsubscribePropertyChanged(&object, id);
+                },
+                py::arg("id"), "Remove a subscription of on_property_changed");
+    }
+
+    inline void bindPropertyBatch(py::module_ &module) {
+        if (py::hasattr(module, "PropertyBatch")) {
+            return;
+        }
+        py::class_<detail::PyPropertyBatch>(module, "PropertyBatch", py::module_local())
+            .def(py::init<>())
+            .def("__enter__",
+                 [](py::object self) {
+                     auto &batch = self.cast<detail::PyPropertyBatch &>();
+                     if (!batch.open) {
+                         beginPropertyBatch();
+                         batch.open = true;
+                     }
+                     return self;
+                 })
+            .def(
+                "__exit__",
+                [](detail::PyPropertyBatch &batch, const py::args &) {
+                    if (batch.open) {
+                        batch.open = false;
+                        endPropertyBatch();
+                    }
+                    return false;
+                },
+                "Deliver the coalesced changes (when the outermost batch ends)")
+            .def_static("flush", &flushPropertyChanges, "Deliver the queued changes now")
+            .def_static("is_open", &propertyBatchOpen, "Is a batch open on this thread?");
+    }
+
+} // namespace rosetta
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+
+namespace rosetta {
+
+    namespace detail {
+
+        /**
+         * @brief Read-only view on the memory of a C++ object, exposed through the
+         * buffer protocol. Holds a reference on the Python owner of the memory.
+         */
+        struct PyOutOfBandBuffer {
+            py::object  owner;
+            const void *data;
+            std::size_t size;
+        };
+
+        inline void ensureOutOfBandBufferType(py::handle scope) {
+            if (py::detail::get_type_info(typeid(PyOutOfBandBuffer))) {
+                return;
+            }
+            py::class_<PyOutOfBandBuffer>(scope, "_OutOfBandBuffer", py::module_local(),
+                                          py::buffer_protocol())
+                .def_buffer([](PyOutOfBandBuffer &buffer) -> py::buffer_info {
+                    return py::buffer_info(const_cast<void *>(buffer.data), 1,
+                                           py::format_descriptor<std::uint8_t>::format(), 1,
+                                           {static_cast<py::ssize_t>(buffer.size)}, {1}, true);
+                });
+        }
+
+        /**
+         * @brief (bytes, *out_of_band_buffers)
+         */
+        template <typename T> inline py::tuple pickleState(py::object self, int protocol) {
+            const T &obj = self.cast<const T &>();
+
+            std::vector<std::uint8_t>   bytes;
+            py::list                    buffers;
+            BinaryWriter::OutOfBandSink sink;
+            if (protocol >= 5) {
+                py::object pickle_buffer = py::module_::import("pickle").attr("PickleBuffer");
+                sink = [&](const void *data, std::size_t size) {
+                    if (size < pickle_out_of_band_threshold) {
+                        return false;
+                    }
+                    buffers.append(pickle_buffer(PyOutOfBandBuffer{self, data, size}));
+                    return true;
+                };
+            }
+
+            BinaryWriter writer(bytes, sink);
+            encodeObject(T::getStaticTypeInfo(), &obj, writer);
+
+            py::tuple state(1 + buffers.size());
+            state[0] = py::bytes(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+            for (std::size_t i = 0; i < buffers.size(); ++i) {
+                state[i + 1] = buffers[i];
+            }
+            return state;
+        }
+
+        template <typename T> inline T *unpickleState(const py::tuple &state) {
+            if (state.size() == 0) {
+                throw std::runtime_error("Invalid pickle state");
+            }
+
+            char      *data = nullptr;
+            py::ssize_t size = 0;
+            if (PyBytes_AsStringAndSize(state[0].ptr(), &data, &size) != 0) {
+                throw py::error_already_set();
+            }
+
+            // Out-of-band buffers (bytes, bytearray, PickleBuffer, memoryview...)
+            std::vector<py::buffer_info> views;
+            std::size_t                  next = 1;
+            BinaryReader reader(data, static_cast<std::size_t>(size), [&](std::size_t bytes) {
+                if (next >= state.size()) {
+                    throw std::runtime_error("Missing out-of-band pickle buffer");
+                }
+                auto view = state[next++].cast<py::buffer>().request();
+                if (static_cast<std::size_t>(view.size * view.itemsize) != bytes) {
+                    throw std::runtime_error("Out-of-band pickle buffer has a wrong size");
+                }
+                views.push_back(std::move(view));
+                return static_cast<const void *>(views.back().ptr);
+            });
+
+            auto obj = std::make_unique<T>();
+            decodeObject(T::getStaticTypeInfo(), obj.get(), reader);
+            return obj.release();
+        }
+
+    } // namespace detail
+
+    template <typename T> inline void bindPickle(py::class_<T> &py_class) {
+        detail::ensureOutOfBandBufferType(py_class);
+
+        py_class.def(py::pickle(
+            [](py::object self) { return detail::pickleState<T>(self, 4); },
+            [](const py::tuple &state) { return detail::unpickleState<T>(state); }));
+
+        // Same as object.__reduce_ex__, but the state depends on the protocol
+        py_class.def("__reduce_ex__", [](py::object self, int protocol) {
+            py::object newobj = py::module_::import("copyreg").attr("__newobj__");
+            return py::make_tuple(newobj, py::make_tuple(py::type::of(self)),
+                                  detail::pickleState<T>(self, protocol));
+        });
+    }
+
+} // namespace rosetta
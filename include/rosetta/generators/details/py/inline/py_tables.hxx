@@ -0,0 +1,374 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <algorithm>
+#include <memory>
+#include <pybind11/numpy.h>
+#include <stdexcept>
+#include <unordered_map>
+#include <variant>
+
+namespace rosetta {
+
+    namespace detail {
+
+        inline const std::string& tableMemberType(
+            const TypeInfo& type_info, const std::string& name)
+        {
+            const MemberInfo* member = type_info.getMember(name);
+            if (!member) {
+                throw py::key_error("No member '" + name + "' in " + type_info.class_name);
+            }
+            return member->type_name;
+        }
+
+        // Number of live NumPy views and Arrow exports of each table (GIL held)
+        inline std::unordered_map<const void*, std::size_t>& tableExports()
+        {
+            static auto* exports = new std::unordered_map<const void*, std::size_t>();
+            return *exports;
+        }
+
+        // Keeps the Python table alive and counted as exported while NumPy or
+        // Arrow consumers share its columns
+        template <typename T> inline std::shared_ptr<const void> tableExportOwner(py::object self)
+        {
+            const void* table = &self.cast<const Table<T>&>();
+            ++tableExports()[table];
+            return std::shared_ptr<const void>(
+                new py::object(std::move(self)), [table](const py::object* owner) {
+                    py::gil_scoped_acquire gil;
+                    auto& exports = tableExports();
+                    if (const auto found = exports.find(table);
+                        found != exports.end() && --found->second == 0) {
+                        exports.erase(found);
+                    }
+                    delete owner;
+                });
+        }
+
+        // Rows can not be added or removed while the column storage is shared
+        inline void checkTableResizable(const void* table)
+        {
+            if (tableExports().count(table) != 0) {
+                throw py::buffer_error("Table rows can not be added or removed while NumPy "
+                                       "views or Arrow exports of its columns exist");
+            }
+        }
+
+        // NumPy view of numeric columns (kept alive by `self`), lists otherwise
+        template <typename T>
+        inline py::object tableColumnToPython(py::object self, const std::string& name)
+        {
+            auto& table = self.cast<Table<T>&>();
+            ColumnStorage& column = table.columnStorage(name);
+            if (const auto type = column.numericType(); type && numpyAvailable()) {
+                // The capsule releases the export when NumPy drops its base
+                auto* owner = new std::shared_ptr<const void>(tableExportOwner<T>(self));
+                const py::capsule base(owner, [](void* released) {
+                    delete static_cast<std::shared_ptr<const void>*>(released);
+                });
+                return visitNumericType(*type, [&](auto identity) -> py::object {
+                    using E = typename decltype(identity)::type;
+                    return py::array_t<E>({ static_cast<py::ssize_t>(column.size()) },
+                        { static_cast<py::ssize_t>(sizeof(E)) }, static_cast<E*>(column.data()),
+                        base);
+                });
+            }
+
+            const auto& registry = PyTypeConverterRegistry::instance();
+            const auto& type_name = tableMemberType(table.getTypeInfo(), name);
+            py::list values(column.size());
+            for (std::size_t i = 0; i < column.size(); ++i) {
+                values[i] = registry.convert_to_python(column.get(i), type_name);
+            }
+            return values;
+        }
+
+        // Buffers of the column type are copied with a single memcpy
+        template <typename T>
+        inline void tableColumnFromPython(Table<T>& table, const std::string& name,
+            const py::handle& values)
+        {
+            ColumnStorage& column = table.columnStorage(name);
+            const auto check_size = [&](std::size_t size) {
+                if (size != column.size()) {
+                    throw py::value_error("Column '" + name + "' has " +
+                        std::to_string(column.size()) + " rows, got " + std::to_string(size) +
+                        " values");
+                }
+            };
+
+            if (const auto type = column.numericType()) {
+                const bool copied = visitNumericType(*type, [&](auto identity) {
+                    using E = typename decltype(identity)::type;
+                    std::vector<E> block;
+                    if (!copyFromBuffer(values, block)) {
+                        return false;
+                    }
+                    check_size(block.size());
+                    std::copy(block.begin(), block.end(), static_cast<E*>(column.data()));
+                    return true;
+                });
+                if (copied) {
+                    return;
+                }
+            }
+
+            const auto& registry = PyTypeConverterRegistry::instance();
+            const auto& type_name = tableMemberType(table.getTypeInfo(), name);
+            check_size(py::len(values));
+            std::size_t i = 0;
+            for (auto item : values) {
+                column.set(i++, registry.convert_to_cpp(item, type_name));
+            }
+        }
+
+        template <typename T>
+        inline Query<T> tableQuery(
+            const std::string& where, const std::string& order_by, long long limit)
+        {
+            Query<T> query;
+            if (!where.empty()) {
+                query.where(where);
+            }
+            if (!order_by.empty()) {
+                query.orderBy(order_by);
+            }
+            if (limit >= 0) {
+                query.limit(static_cast<std::size_t>(limit));
+            }
+            return query;
+        }
+
+        // PyCapsules of the Arrow PyCapsule interface: an unconsumed structure is
+        // released with its capsule
+        template <typename S> inline const char* arrowCapsuleName();
+        template <> inline const char* arrowCapsuleName<ArrowSchema>() { return "arrow_schema"; }
+        template <> inline const char* arrowCapsuleName<ArrowArray>() { return "arrow_array"; }
+        template <> inline const char* arrowCapsuleName<ArrowArrayStream>()
+        {
+            return "arrow_array_stream";
+        }
+
+        template <typename S> inline void releaseArrowCapsule(PyObject* capsule)
+        {
+            auto* owned = static_cast<S*>(PyCapsule_GetPointer(capsule, arrowCapsuleName<S>()));
+            if (owned && owned->release) {
+                owned->release(owned);
+            }
+            delete owned;
+        }
+
+        template <typename S> inline py::capsule arrowCapsule(std::unique_ptr<S> owned)
+        {
+            PyObject* capsule =
+                PyCapsule_New(owned.get(), arrowCapsuleName<S>(), &releaseArrowCapsule<S>);
+            if (!capsule) {
+                throw py::error_already_set();
+            }
+            owned.release();
+            return py::reinterpret_steal<py::capsule>(capsule);
+        }
+
+        template <typename S> inline S* arrowFromCapsule(const py::handle& capsule)
+        {
+            auto* owned =
+                static_cast<S*>(PyCapsule_GetPointer(capsule.ptr(), arrowCapsuleName<S>()));
+            if (!owned) {
+                throw py::error_already_set();
+            }
+            return owned;
+        }
+
+        template <typename T> inline Table<T> tableFromArrow(const py::object& source)
+        {
+            Table<T> table;
+            if (py::hasattr(source, "__arrow_c_stream__")) {
+                py::object capsule = source.attr("__arrow_c_stream__")();
+                appendFromArrowStream(table, arrowFromCapsule<ArrowArrayStream>(capsule));
+            } else if (py::hasattr(source, "__arrow_c_array__")) {
+                const auto capsules = source.attr("__arrow_c_array__")().cast<py::tuple>();
+                appendFromArrow(table, arrowFromCapsule<ArrowSchema>(capsules[0]),
+                    arrowFromCapsule<ArrowArray>(capsules[1]));
+            } else {
+                throw py::type_error("Expected an Arrow object (with __arrow_c_stream__ or "
+                                     "__arrow_c_array__)");
+            }
+            return table;
+        }
+
+    } // namespace detail
+
+    template <typename T>
+    inline py::class_<Table<T>> registerTableType(PyGenerator& generator, const std::string& name)
+    {
+        using TableType = Table<T>;
+        const std::string class_name =
+            name.empty() ? T::getStaticTypeInfo().class_name + "Table" : name;
+
+        py::class_<TableType> py_class(generator.module, class_name.c_str());
+        py_class.def(py::init<>())
+            .def("__len__", &TableType::size)
+            .def("__getitem__", &TableType::get, py::arg("row"), "Copy of a row")
+            .def("__setitem__", &TableType::set, py::arg("row"), py::arg("value"))
+            .def(
+                "append",
+                [](TableType& table, const T& value) {
+                    detail::checkTableResizable(&table);
+                    table.push_back(value);
+                },
+                py::arg("value"), "Append a copy of an object")
+            .def(
+                "erase",
+                [](TableType& table, std::size_t row) {
+                    detail::checkTableResizable(&table);
+                    table.erase(row);
+                },
+                py::arg("row"), "Remove a row")
+            .def("clear",
+                [](TableType& table) {
+                    detail::checkTableResizable(&table);
+                    table.clear();
+                })
+            .def(
+                "reserve",
+                [](TableType& table, std::size_t rows) {
+                    detail::checkTableResizable(&table);
+                    table.reserve(rows);
+                },
+                py::arg("rows"))
+            .def("column_names", &TableType::columnNames)
+            .def("column", &detail::tableColumnToPython<T>, py::arg("name"),
+                "Values of a member (NumPy view for numbers)")
+            .def("set_column", &detail::tableColumnFromPython<T>, py::arg("name"),
+                py::arg("values"), "Overwrite all the values of a member")
+            .def(
+                "get",
+                [](const TableType& table, std::size_t row, const std::string& member) {
+                    return PyTypeConverterRegistry::instance().convert_to_python(
+                        table[row].getMemberValue(member),
+                        detail::tableMemberType(table.getTypeInfo(), member));
+                },
+                py::arg("row"), py::arg("name"), "Value of a member of a row")
+            .def(
+                "set",
+                [](TableType& table, std::size_t row, const std::string& member,
+                    const py::handle& value) {
+                    table[row].setMemberValue(member,
+                        PyTypeConverterRegistry::instance().convert_to_cpp(value,
+                            detail::tableMemberType(table.getTypeInfo(), member)));
+                },
+                py::arg("row"), py::arg("name"), py::arg("value"), "Set a member of a row");
+
+        // Kernels over the numeric columns
+        py_class
+            .def(
+                "sum",
+                [](const TableType& table, const std::string& column) {
+                    return kernels::sum(table.columnStorage(column));
+                },
+                py::arg("name"), "Sum of a column")
+            .def(
+                "min_max",
+                [](const TableType& table, const std::string& column) {
+                    const auto extrema = kernels::minMax(table.columnStorage(column));
+                    return py::make_tuple(extrema.min, extrema.max);
+                },
+                py::arg("name"), "(min, max) of a column")
+            .def(
+                "mean_variance",
+                [](const TableType& table, const std::string& column) {
+                    const auto moments = kernels::meanVariance(table.columnStorage(column));
+                    return py::make_tuple(moments.mean, moments.variance);
+                },
+                py::arg("name"), "(mean, population variance) of a column")
+            .def(
+                "dot",
+                [](const TableType& table, const std::string& x, const std::string& y) {
+                    return kernels::dot(table.columnStorage(x), table.columnStorage(y));
+                },
+                py::arg("x"), py::arg("y"), "Dot product of two columns")
+            .def(
+                "axpy",
+                [](TableType& table, double alpha, const std::string& x, const std::string& y) {
+                    kernels::axpy(alpha, table.columnStorage(x), table.columnStorage(y));
+                },
+                py::arg("alpha"), py::arg("x"), py::arg("y"), "y += alpha * x, for two columns")
+            .def(
+                "clamp",
+                [](TableType& table, const std::string& column, double lo, double hi) {
+                    kernels::clamp(table.columnStorage(column), lo, hi);
+                },
+                py::arg("name"), py::arg("lo"), py::arg("hi"), "Clamp a column in place")
+            .def(
+                "histogram",
+                [](const TableType& table, const std::string& column, double lo, double hi,
+                    std::size_t bins) {
+                    return kernels::histogram(table.columnStorage(column), lo, hi, bins);
+                },
+                py::arg("name"), py::arg("lo"), py::arg("hi"), py::arg("bins"),
+                "Counts of a column in equal bins over [lo, hi]");
+
+        // Queries, compiled and run in one call
+        py_class
+            .def(
+                "select",
+                [](const TableType& table, const std::string& where, const std::string& order_by,
+                    long long limit) {
+                    return detail::tableQuery<T>(where, order_by, limit).indices(table);
+                },
+                py::arg("where") = "", py::arg("order_by") = "", py::arg("limit") = -1,
+                "Rows matching a condition, e.g. select(\"health < 50\", \"name desc\", 10)")
+            .def(
+                "count",
+                [](const TableType& table, const std::string& where) {
+                    return detail::tableQuery<T>(where, "", -1).count(table);
+                },
+                py::arg("where") = "", "Number of rows matching a condition")
+            .def(
+                "group_by",
+                [](const TableType& table, const std::string& key, const std::string& where) {
+                    py::dict groups;
+                    for (const auto& group :
+                        detail::tableQuery<T>(where, "", -1).groupBy(table, key)) {
+                        const py::object value = std::visit(
+                            [](const auto& v) -> py::object { return py::cast(v); }, group.key);
+                        groups[value] = py::cast(group.rows);
+                    }
+                    return groups;
+                },
+                py::arg("key"), py::arg("where") = "",
+                "Rows matching a condition grouped by the value of key: {value: [rows]}");
+
+        // Arrow PyCapsule interface (pyarrow, polars, DuckDB...). The requested
+        // schema is ignored: columns keep their own type.
+        py_class
+            .def(
+                "__arrow_c_array__",
+                [](py::object self, const py::object&) {
+                    auto schema = std::make_unique<ArrowSchema>();
+                    auto array = std::make_unique<ArrowArray>();
+                    toArrow(self.cast<const TableType&>(), schema.get(), array.get(),
+                        detail::tableExportOwner<T>(self));
+                    return py::make_tuple(detail::arrowCapsule(std::move(schema)),
+                        detail::arrowCapsule(std::move(array)));
+                },
+                py::arg("requested_schema") = py::none(),
+                "Arrow struct array of the columns (numeric columns are shared)")
+            .def(
+                "__arrow_c_stream__",
+                [](py::object self, const py::object&) {
+                    auto stream = std::make_unique<ArrowArrayStream>();
+                    toArrowStream(self.cast<const TableType&>(), stream.get(),
+                        detail::tableExportOwner<T>(self));
+                    return detail::arrowCapsule(std::move(stream));
+                },
+                py::arg("requested_schema") = py::none(), "Arrow stream of a single batch")
+            .def_static("from_arrow", &detail::tableFromArrow<T>, py::arg("source"),
+                "Table copied from an Arrow table, record batch or struct array");
+        return py_class;
+    }
+
+} // namespace rosetta
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+
+namespace rosetta {
+
+    namespace detail {
+
+        template <typename T>
+        inline void pyTrackerAdd(PyDirtyTracker<T>& tracker, const py::object& object)
+        {
+            const T& value = object.cast<const T&>();
+            tracker.tracker.track(value);
+            tracker.owners.emplace(&value, object);
+        }
+
+        // {name: value} of the dirty members (copies), cleaning the object
+        template <typename T>
+        inline py::dict pyTrackerChanges(PyDirtyTracker<T>& tracker, const T& object)
+        {
+            const auto& registry = PyTypeConverterRegistry::instance();
+            const auto& type_info = tracker.tracker.getTypeInfo();
+            py::dict changes;
+            for (const std::string& name : tracker.tracker.dirtyMembers(object)) {
+                const MemberInfo* member = type_info.getMember(name);
+                changes[py::str(name)] =
+                    registry.convert_to_python(member->getter(&object), member->type_name);
+            }
+            tracker.tracker.clean(object);
+            return changes;
+        }
+
+    } // namespace detail
+
+    template <typename T>
+    inline py::class_<PyDirtyTracker<T>> registerTrackerType(
+        PyGenerator& generator, const std::string& name)
+    {
+        using TrackerType = PyDirtyTracker<T>;
+        const std::string class_name =
+            name.empty() ? T::getStaticTypeInfo().class_name + "Tracker" : name;
+
+        py::class_<TrackerType> py_class(generator.module, class_name.c_str());
+        py_class.def(py::init<>())
+            .def("__len__", [](const TrackerType& tracker) { return tracker.tracker.size(); })
+            .def(
+                "__contains__",
+                [](const TrackerType& tracker, const T& object) {
+                    return tracker.tracker.isTracked(object);
+                },
+                py::arg("object"))
+            .def("track", &detail::pyTrackerAdd<T>, py::arg("object"),
+                "Track the changes of an object (clean)")
+            .def(
+                "untrack",
+                [](TrackerType& tracker, const T& object) {
+                    tracker.tracker.untrack(object);
+                    tracker.owners.erase(&object);
+                },
+                py::arg("object"))
+            .def(
+                "clear",
+                [](TrackerType& tracker) {
+                    tracker.tracker.clear();
+                    tracker.owners.clear();
+                },
+                "Untrack all the objects")
+            .def(
+                "mark_dirty",
+                [](TrackerType& tracker, const T& object, const py::args& members) {
+                    if (members.empty()) {
+                        tracker.tracker.markAllDirty(object);
+                    }
+                    for (const auto& member : members) {
+                        tracker.tracker.markDirty(object, member.cast<std::string>());
+                    }
+                },
+                py::arg("object"),
+                "Mark members as changed after a write made outside of the reflection layer "
+                "(all of them without names)")
+            .def(
+                "is_dirty",
+                [](const TrackerType& tracker, const T& object, const py::object& member) {
+                    return member.is_none()
+                        ? tracker.tracker.isDirty(object)
+                        : tracker.tracker.isDirty(object, member.cast<std::string>());
+                },
+                py::arg("object"), py::arg("member") = py::none())
+            .def(
+                "dirty_members",
+                [](const TrackerType& tracker, const T& object) {
+                    return tracker.tracker.dirtyMembers(object);
+                },
+                py::arg("object"))
+            .def(
+                "dirty_objects",
+                [](const TrackerType& tracker) {
+                    py::list objects;
+                    for (const T* object : tracker.tracker.dirtyObjects()) {
+                        objects.append(tracker.owners.at(object));
+                    }
+                    return objects;
+                },
+                "Tracked objects having changes")
+            .def(
+                "clean",
+                [](TrackerType& tracker, const T& object) { tracker.tracker.clean(object); },
+                py::arg("object"), "Forget the changes of an object")
+            .def(
+                "collect_delta",
+                [](TrackerType& tracker, const T& object) {
+                    const auto delta = tracker.tracker.collectDelta(object);
+                    return py::bytes(reinterpret_cast<const char*>(delta.data()), delta.size());
+                },
+                py::arg("object"), "Binary delta of the changed members (empty if none)")
+            .def("collect_changes", &detail::pyTrackerChanges<T>, py::arg("object"),
+                "Dict of the changed members and their values")
+            .def_static(
+                "apply_delta",
+                [](T& object, const py::buffer& delta) {
+                    const py::buffer_info view = delta.request();
+                    applyDelta(T::getStaticTypeInfo(), &object, view.ptr,
+                        static_cast<std::size_t>(view.size * view.itemsize));
+                },
+                py::arg("object"), py::arg("delta"), "Apply a delta from collect_delta");
+        return py_class;
+    }
+
+} // namespace rosetta
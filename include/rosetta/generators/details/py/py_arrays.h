@@ -0,0 +1,31 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <array>
+#include <rosetta/generators/details/py/py_generator.h>
+
+namespace rosetta {
+
+    /**
+     * @brief Register a std::array<T, N> type converter for Python.
+     * Arrays are returned as lists and accept any sequence of length N.
+     * @tparam T Element type
+     * @tparam N Number of elements
+     * @param generator The Python generator
+     */
+    template <typename T, std::size_t N> inline void registerArrayType(PyGenerator &generator) {
+        PyTypeConverterRegistry::instance().register_array<std::array<T, N>>();
+    }
+
+    /**
+     * @brief Register common array types (2, 3, 4 elements of int/float/double,
+     * and 6, 9, 16 doubles). These are registered by default, this function only
+     * exists for API consistency with JavaScript.
+     */
+    inline void registerCommonArrayTypes(PyGenerator &generator) {
+        PyTypeConverterRegistry::instance(); // registers the defaults
+    }
+
+} // namespace rosetta
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <any>
+#include <array>
+#include <functional>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <rosetta/converters.h>
+#include <rosetta/enum_registry.h>
+#include <rosetta/introspectable.h>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace py = pybind11;
+
+namespace rosetta {
+
+    /**
+     * @brief Convert a C++ value (held in a std::any) to a Python object
+     */
+    using CppToPyConverter = std::function<py::object(const std::any &)>;
+
+    /**
+     * @brief Convert a Python object to a C++ value held in a std::any
+     */
+    using PyToCppConverter = std::function<std::any(const py::handle &)>;
+
+    /**
+     * @brief Wrap a C++ value living inside `parent` without copying it. The
+     * returned Python object keeps `parent` alive (reference_internal).
+     */
+    using CppToPyReference = std::function<py::object(void *, py::handle)>;
+
+    /**
+     * @brief Converter backend of the PyGenerator (see rosetta/converters.h)
+     */
+    struct PyBackend {
+        using Value      = py::object;
+        using Input      = const py::handle &;
+        using ToScript   = py::object (*)(const std::any &);
+        using FromScript = std::any (*)(const py::handle &);
+    };
+
+    /**
+     * @brief Python type converters registry - singleton pattern
+     *
+     * Converters are keyed by the rosetta type name of the C++ type (the same
+     * name that is stored in MemberInfo::type_name, MethodInfo::return_type and
+     * so on), so registering a type once makes it usable for members, method
+     * arguments, return values, constructors and free functions. Converters of
+     * a known C++ type (register_type and the built-in ones) are also indexed
+     * by its std::type_index, which members are looked up by (MemberInfo::type)
+     * without hashing their type name.
+     *
+     * Built-in scalars, common std::vector and std::array types are registered
+     * by default, with the conversions shared with the other generators
+     * (ScriptConverter<PyBackend, T>). Enums are added by registerEnumType<E>() and introspectable
+     * classes by PyGenerator::bind_class<T>().
+     */
+    class PyTypeConverterRegistry {
+    public:
+        struct Converter {
+            CppToPyConverter to_python;
+            PyToCppConverter from_python;
+            CppToPyReference reference; // optional
+        };
+
+        static PyTypeConverterRegistry &instance();
+
+        void register_converter(const std::string &, CppToPyConverter, PyToCppConverter,
+                                CppToPyReference = nullptr);
+
+        /**
+         * @brief Register a converter for the C++ type T (keyed by getTypeName<T>())
+         */
+        template <typename T>
+        void register_type(CppToPyConverter, PyToCppConverter, CppToPyReference = nullptr);
+
+        /**
+         * @brief Register the default converter of std::vector<T> (or of an alias of it)
+         */
+        template <typename VectorType> void register_vector();
+
+        /**
+         * @brief Register the default converter of std::array<T, N>
+         */
+        template <typename ArrayType> void register_array();
+
+        /**
+         * @brief Register the converter of an enum registered in the EnumRegistry.
+         * Python values may be given as enum members, integers or value names.
+         */
+        template <typename EnumType> void register_enum();
+
+        /**
+         * @brief Register the converter of a class bound with py::class_<T>.
+         * Members of this type are exposed by reference (no copy).
+         */
+        template <typename T> void register_class(const std::string &alias = "");
+
+        bool             has_converter(const std::string &) const;
+        const Converter *find(const std::string &) const;
+        const Converter *find(std::type_index) const;
+
+        /**
+         * @brief Converter of a member: by its C++ type, else by its type name
+         * (converters registered by name only)
+         */
+        const Converter *find(const MemberInfo &) const;
+
+        py::object convert_to_python(const std::any &, const std::string &) const;
+        std::any   convert_to_cpp(const py::handle &, const std::string &) const;
+
+    private:
+        PyTypeConverterRegistry();
+        std::unordered_map<std::string, Converter>             converters;
+        std::unordered_map<std::type_index, const Converter *> by_type; // into converters
+    };
+
+} // namespace rosetta
+
+#include "inline/py_converters.hxx"
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <pybind11/pybind11.h>
+#include <rosetta/dlpack.h>
+#include <rosetta/introspectable.h>
+
+namespace py = pybind11;
+
+namespace rosetta {
+
+    /**
+     * @brief Does the class have numeric vector or array members (see toDLPack)?
+     */
+    bool hasDLPackMembers(const TypeInfo &type_info);
+
+    /**
+     * @brief Add `member_tensor(name)` to a bound introspectable class. It
+     * returns a view of a numeric vector or array member implementing the
+     * DLPack protocol (`__dlpack__`, `__dlpack_device__`), so that NumPy,
+     * PyTorch or JAX share the member storage without copying it. The view and
+     * the tensors made from it keep the object alive; the member must not be
+     * resized while they are in use.
+     *
+     * Called by PyGenerator::bind_class<T>() when T has such members.
+     *
+     * @example
+     * ```python
+     * weights = numpy.from_dlpack(mesh.member_tensor("weights"))
+     * weights *= 2  # writes to mesh.weights
+     * ```
+     */
+    template <typename T> void bindDLPack(py::class_<T> &py_class);
+
+} // namespace rosetta
+
+#include "inline/py_dlpack.hxx"
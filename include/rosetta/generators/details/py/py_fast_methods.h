@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <pybind11/pybind11.h>
+#include <rosetta/generators/details/py/py_converters.h>
+#include <rosetta/info.h>
+
+namespace py = pybind11;
+
+/**
+ * @brief Set to 1 when the CPython headers allow heap types implementing the
+ * vectorcall protocol (Python >= 3.9), i.e. when fast methods are available.
+ */
+#if PY_VERSION_HEX >= 0x03090000
+#define ROSETTA_PY_HAS_VECTORCALL 1
+#else
+#define ROSETTA_PY_HAS_VECTORCALL 0
+#endif
+
+namespace rosetta {
+
+#if ROSETTA_PY_HAS_VECTORCALL
+
+    /**
+     * @brief Pre-resolved state of a fast method (one per bound method)
+     */
+    struct PyFastMethodData {
+        std::string       name;
+        std::string       class_name;
+        const MethodInfo *method = nullptr;
+
+        // Get the C++ instance (as expected by MethodInfo::invoker) from `self`
+        void *(*self)(PyObject *) = nullptr;
+
+        // Resolved on first use, since converters may be registered after binding
+        std::vector<const PyTypeConverterRegistry::Converter *> parameter_converters;
+        const PyTypeConverterRegistry::Converter               *return_converter = nullptr;
+
+        // Argument storage reused from one call to the next (unless re-entered)
+        std::vector<std::any> arguments;
+        bool                  arguments_in_use = false;
+    };
+
+    /**
+     * @brief Create a Python method descriptor calling `method` through the
+     * CPython vectorcall protocol.
+     *
+     * Compared to a pybind11 method taking py::args, a call does not allocate an
+     * argument tuple, skips overload resolution and uses converters resolved
+     * once per method. The descriptor is flagged as a method descriptor, so
+     * `obj.method(...)` does not even create a bound method object.
+     *
+     * @tparam T The class owning the method
+     */
+    template <typename T>
+    py::object makeFastMethod(const std::string &class_name, const MethodInfo *method);
+
+#endif
+
+} // namespace rosetta
+
+#include "inline/py_fast_methods.hxx"
@@ -13,59 +13,17 @@ namespace rosetta {
     /**
      * @brief Helper function to convert Python object to std::any
      */
-    inline std::any convert_python_to_any(py::object py_value, const std::string &type_name) {
-        if (type_name == "string") {
-            return std::make_any<std::string>(py_value.cast<std::string>());
-        } else if (type_name == "int") {
-            return std::make_any<int>(py_value.cast<int>());
-        } else if (type_name == "double") {
-            return std::make_any<double>(py_value.cast<double>());
-        } else if (type_name == "float") {
-            return std::make_any<float>(py_value.cast<float>());
-        } else if (type_name == "bool") {
-            return std::make_any<bool>(py_value.cast<bool>());
-        } else if (type_name == "vector<int>") {
-            return std::make_any<std::vector<int>>(py_value.cast<std::vector<int>>());
-        } else if (type_name == "vector<double>") {
-            return std::make_any<std::vector<double>>(py_value.cast<std::vector<double>>());
-        } else if (type_name == "vector<string>") {
-            return std::make_any<std::vector<std::string>>(
-                py_value.cast<std::vector<std::string>>());
-        }
-
-        throw py::type_error("Unsupported type conversion for: " + type_name);
+    inline std::any convert_python_to_any(py::handle py_value, const std::string &type_name) {
+        return PyTypeConverterRegistry::instance().convert_to_cpp(py_value, type_name);
     }
 
     /**
      * @brief Helper function to convert std::any to Python object
      */
     inline py::object convert_any_to_python(const std::any &value, const std::string &type_name) {
-        if (!value.has_value() || type_name == "void") {
-            return py::none();
-        }
-
-        if (type_name == "string") {
-            return py::cast(std::any_cast<std::string>(value));
-        } else if (type_name == "int") {
-            return py::cast(std::any_cast<int>(value));
-        } else if (type_name == "double") {
-            return py::cast(std::any_cast<double>(value));
-        } else if (type_name == "float") {
-            return py::cast(std::any_cast<float>(value));
-        } else if (type_name == "bool") {
-            return py::cast(std::any_cast<bool>(value));
-        } else if (type_name == "vector<int>") {
-            return py::cast(std::any_cast<std::vector<int>>(value));
-        } else if (type_name == "vector<double>") {
-            return py::cast(std::any_cast<std::vector<double>>(value));
-        } else if (type_name == "vector<string>") {
-            return py::cast(std::any_cast<std::vector<std::string>>(value));
-        }
-
-        return py::none();
+        return PyTypeConverterRegistry::instance().convert_to_python(value, type_name);
     }
 
-
     /**
      * @brief Bind a single function by name
      */
@@ -4,6 +4,11 @@
  *
  * Python Functor/Lambda Support
  * Allows C++ lambdas to be passed to Python and Python callables to be used in C++
+ *
+ * Also provides (see inline/py_functors.hxx):
+ * - PyBatchCallback: calls a Python callable once per batch of invocations
+ * - PyCallbackQueue: lock-free queue running callbacks posted by worker threads
+ *   on the Python thread
  */
 #pragma once
 
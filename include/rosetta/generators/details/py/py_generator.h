@@ -7,6 +7,11 @@
 #include <pybind11/functional.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <rosetta/generators/details/py/py_converters.h>
+#include <rosetta/generators/details/py/py_dlpack.h>
+#include <rosetta/generators/details/py/py_fast_methods.h>
+#include <rosetta/generators/details/py/py_observable.h>
+#include <rosetta/generators/details/py/py_pickle.h>
 #include <rosetta/introspectable.h>
 #include <typeinfo>
 #include <unordered_set>
@@ -55,8 +60,23 @@ namespace rosetta {
          */
         template <typename... Classes> void bind_classes();
 
+        /**
+         * @brief Enable or disable vectorcall based methods (enabled by default
+         * when supported, see makeFastMethod). Applies to the classes bound after
+         * this call; when disabled, methods are regular pybind11 functions.
+         */
+        PyGenerator &use_fast_methods(bool enable);
+
+        /**
+         * @brief Register custom converters for a C++ type, identified by its
+         * rosetta type name (see PyTypeConverterRegistry)
+         */
+        PyGenerator &register_type_converter(const std::string &, CppToPyConverter,
+                                             PyToCppConverter, CppToPyReference = nullptr);
+
     private:
         std::unordered_set<std::string> bound_classes;
+        bool                            fast_methods = ROSETTA_PY_HAS_VECTORCALL;
 
         template <typename T>
         void bind_constructors(py::class_<T> &py_class, const rosetta::TypeInfo &type_info);
@@ -72,11 +92,14 @@ namespace rosetta {
         // Helper function to check if a method is a getter/setter
         bool is_getter_setter_method(const std::string &) const;
 
+        // Read a member of `obj` (owned by `self`), by reference when its type allows it
+        static py::object get_member(py::handle self, void *obj, const MemberInfo &member);
+
         // Convert std::any to Python object based on type name
         py::object convert_any_to_python(const std::any &, const std::string &) const;
 
         // Convert Python object to std::any based on expected type
-        std::any convert_python_to_any(py::object, const std::string &) const;
+        std::any convert_python_to_any(py::handle, const std::string &) const;
     };
 
 } // namespace rosetta
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <rosetta/generators/details/py/py_generator.h>
+#include <rosetta/index.h>
+#include <unordered_map>
+
+namespace rosetta {
+
+    /**
+     * @brief Index<T> holding the Python objects it refers to, so that they stay
+     * alive (and at the same address) while indexed
+     */
+    template <typename T> class PyIndex {
+    public:
+        PyIndex(const std::string& kind, const std::vector<std::string>& members)
+            : index(indexKindFromName(kind), members)
+        {
+        }
+
+        Index<T>                                 index;
+        std::unordered_map<const T*, py::object> owners;
+    };
+
+    /**
+     * @brief Bind rosetta::Index<T> to Python (T must be bound with bind_class).
+     *
+     * Keys are updated when a key member is set from Python (or through
+     * setMemberValue in C++). Lookups return the indexed objects themselves.
+     *
+     * @example
+     * ```python
+     * by_name = GameObjectIndex("hash", ["name"])
+     * by_name.extend(scene.objects)
+     * player = by_name.lookup("Player")[0]
+     *
+     * by_health = GameObjectIndex("ordered", ["health", "name"])
+     * by_health.extend(scene.objects)
+     * weak = by_health.range(0, 20)              # health in [0, 20]
+     * some = by_health.range((50, "a"), (50, "m")) # keys compare as tuples
+     * ```
+     * @param name Python class name (default: class name + "Index")
+     */
+    template <typename T>
+    py::class_<PyIndex<T>> registerIndexType(PyGenerator& generator, const std::string& name = "");
+
+} // namespace rosetta
+
+#include "inline/py_indexes.hxx"
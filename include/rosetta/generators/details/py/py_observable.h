@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <pybind11/pybind11.h>
+#include <rosetta/generators/details/py/py_converters.h>
+#include <rosetta/introspectable.h>
+#include <rosetta/observable.h>
+
+namespace py = pybind11;
+
+namespace rosetta {
+
+    /**
+     * @brief Does the class have observable members (see
+     * TypeRegistrar::member_observable)?
+     */
+    bool hasObservableMembers(const TypeInfo &type_info);
+
+    /**
+     * @brief Add `on_property_changed(callback)` and `off_property_changed(id)`
+     * to a bound introspectable class. The callback receives a list of
+     * `(name, slot, old_value, new_value)` tuples: one change as it is made, or
+     * all the changes of the object at the end of a `PropertyBatch` (see
+     * bindPropertyBatch). It is called with the GIL, on the thread setting the
+     * member.
+     *
+     * Subscriptions of an object created from Python end when it is
+     * collected; those of a C++ object (e.g. a member of another object) must
+     * be removed before it is destroyed.
+     *
+     * Called by PyGenerator::bind_class<T>() when T has observable members.
+     */
+    template <typename T> void bindPropertyChanged(py::class_<T> &py_class);
+
+    /**
+     * @brief Add the `PropertyBatch` context manager to a module (once): the
+     * changes made in the `with` block are coalesced and delivered when it
+     * ends (see rosetta::PropertyBatch). `PropertyBatch.flush()` delivers
+     * them before.
+     *
+     * @example
+     * ```python
+     * player.on_property_changed(lambda changes: ui.refresh(changes))
+     * with PropertyBatch():
+     *     player.health = 50
+     *     player.health = 40
+     *     player.name = "Hero"
+     * # one call: [("health", 1, 100.0, 40.0), ("name", 0, "Player", "Hero")]
+     * ```
+     */
+    void bindPropertyBatch(py::module_ &module);
+
+} // namespace rosetta
+
+#include "inline/py_observable.hxx"
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <pybind11/pybind11.h>
+#include <rosetta/binary.h>
+#include <rosetta/introspectable.h>
+
+namespace py = pybind11;
+
+namespace rosetta {
+
+    /**
+     * @brief Numeric vectors of at least this many bytes are sent as out-of-band
+     * buffers with pickle protocol 5
+     */
+    inline constexpr std::size_t pickle_out_of_band_threshold = 4096;
+
+    /**
+     * @brief Add pickle support to a bound introspectable class.
+     *
+     * The state is the binary encoding of the members (see encodeObject), so
+     * objects can be sent to multiprocessing workers, ProcessPoolExecutor, or
+     * copied with the copy module. With pickle protocol 5, large numeric vectors
+     * are exported as pickle.PickleBuffer referencing the object memory, and can
+     * be transferred out of band without being copied into the pickle stream.
+     *
+     * Called by PyGenerator::bind_class<T>() when all the members of T are
+     * binary serializable.
+     */
+    template <typename T> void bindPickle(py::class_<T> &py_class);
+
+} // namespace rosetta
+
+#include "inline/py_pickle.hxx"
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <rosetta/arrow.h>
+#include <rosetta/generators/details/py/py_converters.h>
+#include <rosetta/generators/details/py/py_functors.h>
+#include <rosetta/generators/details/py/py_generator.h>
+#include <rosetta/kernels.h>
+#include <rosetta/query.h>
+#include <rosetta/table.h>
+
+namespace rosetta {
+
+    /**
+     * @brief Bind rosetta::Table<T> to Python (T must be bound with bind_class).
+     *
+     * Rows are copied in and out as T (`append`, `table[i]`), and single values
+     * are accessed with `get(row, name)` / `set(row, name, value)`. `column(name)`
+     * returns the numeric columns as NumPy arrays viewing the table storage (no
+     * copy, writes go to the table). While such a view is alive, `append`,
+     * `erase`, `clear` and `reserve` raise BufferError, as `bytearray` does
+     * (`.copy()` the view to keep the values). Other columns, or all of them
+     * when NumPy is not installed, are returned as lists.
+     *
+     * The vectorised kernels (see rosetta::kernels) run on numeric columns in a
+     * single call: `sum`, `min_max`, `mean_variance`, `dot`, `axpy`, `clamp`
+     * and `histogram`. Queries (see rosetta::Query) return row positions:
+     * `select(where, order_by, limit)`, `count(where)` and `group_by(key, where)`.
+     *
+     * Tables implement the Arrow PyCapsule interface (`__arrow_c_array__`,
+     * `__arrow_c_stream__`, see rosetta::toArrow), so that pyarrow, polars or
+     * DuckDB read them without copying the numeric columns. As for NumPy views,
+     * rows can not be added or removed until the Arrow data is released.
+     * `from_arrow(data)` builds a table from any Arrow object exposing these
+     * methods.
+     *
+     * @example
+     * ```python
+     * objects = GameObjectTable()
+     * objects.append(GameObject("Player", Vector3D(0, 0, 0)))
+     * total = objects.column("health").sum()
+     * objects.column("health")[:] = 100   # in place
+     * objects.set_column("health", values) # any buffer or sequence
+     * low, high = objects.min_max("health")
+     * objects.clamp("health", 0, 100)
+     * rows = objects.select("health < 50", order_by="name", limit=10)
+     * frame = polars.DataFrame(objects)
+     * copy = GameObjectTable.from_arrow(pyarrow.table(frame))
+     * ```
+     * @param name Python class name (default: class name + "Table")
+     */
+    template <typename T>
+    py::class_<Table<T>> registerTableType(PyGenerator& generator, const std::string& name = "");
+
+} // namespace rosetta
+
+#include "inline/py_tables.hxx"
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <rosetta/delta.h>
+#include <rosetta/generators/details/py/py_generator.h>
+#include <unordered_map>
+
+namespace rosetta {
+
+    /**
+     * @brief DirtyTracker<T> holding the Python objects it tracks, so that they
+     * stay alive (and at the same address) while tracked
+     */
+    template <typename T> class PyDirtyTracker {
+    public:
+        DirtyTracker<T>                          tracker;
+        std::unordered_map<const T*, py::object> owners;
+    };
+
+    /**
+     * @brief Bind rosetta::DirtyTracker<T> to Python (T must be bound with
+     * bind_class).
+     *
+     * Members set from Python (or through setMemberValue in C++) mark tracked
+     * objects dirty. Changes are collected either as a delta (bytes, see
+     * collectDelta) for another process, or as a dict of the changed members
+     * to update a Python mirror. Both clean the object.
+     *
+     * @example
+     * ```python
+     * tracker = GameObjectTracker()
+     * tracker.track(player)
+     * player.health = 50
+     * for obj in tracker.dirty_objects():
+     *     send(tracker.collect_delta(obj))   # bytes, health only
+     * GameObjectTracker.apply_delta(remote_player, received)
+     *
+     * player.name = "Hero"
+     * mirror.update(tracker.collect_changes(player))  # {"name": "Hero"}
+     * ```
+     * @param name Python class name (default: class name + "Tracker")
+     */
+    template <typename T>
+    py::class_<PyDirtyTracker<T>> registerTrackerType(
+        PyGenerator& generator, const std::string& name = "");
+
+} // namespace rosetta
+
+#include "inline/py_trackers.hxx"
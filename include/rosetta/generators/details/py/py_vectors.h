@@ -18,45 +18,45 @@ namespace rosetta {
      * @brief Register vector type converter for Python using automatic type name
      * @tparam T Element type of the vector
      * @param generator The Python generator to register with
+     *
+     * Python lists are accepted as input, and numeric vectors are also filled
+     * directly (single memcpy) from any contiguous buffer of the same element
+     * type (array.array, numpy arrays, memoryview, ...).
      */
     template <typename T> inline void registerVectorType(PyGenerator& generator)
     {
-        // This is actually handled automatically by pybind11 for most types
-        // pybind11 has built-in support for std::vector<T>
-        // This function is here for API consistency with JS and Lua
-
-        // The type will be automatically converted by pybind11's built-in converters
-        // No explicit registration needed unless you want custom behavior
+        PyTypeConverterRegistry::instance().register_vector<std::vector<T>>();
     }
 
     /**
      * @brief Register type alias for Python
      * @tparam AliasType The type alias
      * @tparam ElementType The element type of the underlying vector
-     * @param generator The Python generator (not used, here for consistency)
+     * @param generator The Python generator
      *
-     * Note: pybind11 automatically handles type aliases that resolve to
-     * std::vector<T> for basic types. This function exists for API consistency.
+     * The converter is registered under the name of the alias (see
+     * REGISTER_TYPE_ALIAS_MANGLED), so that members and arguments declared
+     * with the alias are converted.
      */
     template <typename AliasType, typename ElementType>
     inline void registerTypeAlias(PyGenerator& generator)
     {
-        // pybind11 automatically handles std::vector conversions
-        // Type aliases like "using Vertices = std::vector<double>"
-        // work automatically without explicit registration
+        static_assert(std::is_same_v<AliasType, std::vector<ElementType>>,
+            "AliasType must be an alias of std::vector<ElementType>");
+        PyTypeConverterRegistry::instance().register_vector<AliasType>();
     }
 
     /**
-     * @brief Register all common vector types (no-op for Python)
+     * @brief Register all common vector types
      * @param generator The Python generator
      *
-     * pybind11 has built-in support for std::vector of most basic types,
-     * so explicit registration is not needed.
+     * The common vectors (int, unsigned int, long, size_t, float, double, bool
+     * and string elements) are registered by default, so this is only needed for
+     * API consistency with JavaScript and Lua.
      */
     inline void registerCommonVectorTypes(PyGenerator& generator)
     {
-        // No-op: pybind11 handles this automatically
-        // This function exists for API consistency with JavaScript and Lua
+        PyTypeConverterRegistry::instance(); // registers the defaults
     }
 
     /**
@@ -101,11 +101,12 @@ namespace rosetta {
 // ============================================================================
 /*
 
-Python bindings are simpler than JavaScript because pybind11 automatically
-handles std::vector conversions for most basic types.
+Python bindings are simpler than JavaScript because the common std::vector
+types are registered by default in the PyTypeConverterRegistry (and the
+converters of a bound class T and of std::vector<T> are added by bind_class).
 
-BASIC USAGE (No explicit registration needed):
-----------------------------------------------
+BASIC USAGE:
+------------
 
     #include <rosetta/generators/py.h>
 
@@ -117,12 +118,15 @@ BASIC USAGE (No explicit registration needed):
 
     PYBIND11_MODULE(surface, m) {
         rosetta::PyGenerator generator(m);
+        rosetta::registerTypeAlias<Vertices, double>(generator);
+        rosetta::registerTypeAlias<Triangles, size_t>(generator);
         generator.bind_class<Surface>();
     }
 
     // Python automatically handles:
     # s = surface.Surface([1.0, 2.0, 3.0], [0, 1, 2])
     # print(s.vertices())  # [1.0, 2.0, 3.0]
+    # s = surface.Surface(array.array('d', [1, 2, 3]), [0, 1, 2])  # memcpy
 
 
 CUSTOM TYPES (Need explicit registration):
@@ -142,8 +146,9 @@ If you have a custom type like Point3D:
             .def_readwrite("y", &Point3D::y)
             .def_readwrite("z", &Point3D::z);
 
-        // pybind11 automatically handles std::vector<Point3D>
-        // after Point3D is registered!
+        // Make Point3D and std::vector<Point3D> convertible (done
+        // automatically by bind_class for introspectable classes)
+        rosetta::PyTypeConverterRegistry::instance().register_class<Point3D>();
 
         rosetta::PyGenerator generator(m);
         generator.bind_class<Mesh>();
@@ -175,8 +180,7 @@ JavaScript:
     rosetta::registerTypeAlias<Vertices, double>(generator);
 
 Python:
-    // Works automatically via pybind11
-    rosetta::PyGenerator generator(m);
-    generator.bind_class<Surface>();
+    // Same call (the common vector types need no registration)
+    rosetta::registerTypeAlias<Vertices, double>(generator);
 
 */
\ No newline at end of file
@@ -8,7 +8,10 @@
 #include "details/js/js_functions.h"
 #include "details/js/js_functors.h"
 #include "details/js/js_generator.h"
+#include "details/js/js_indexes.h"
 #include "details/js/js_pointers.h"
+#include "details/js/js_tables.h"
+#include "details/js/js_trackers.h"
 #include "details/js/js_vectors.h"
 // #include "details/js/js_enums.h"
 
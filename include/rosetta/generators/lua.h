@@ -3,7 +3,15 @@
  * LGPL v3 license
  */
 #pragma once
+#include "details/lua/lua_async.h"
+#include "details/lua/lua_binding_plan.h"
+#include "details/lua/lua_ffi.h"
 #include "details/lua/lua_functions.h"
+#include "details/lua/lua_functors.h"
 #include "details/lua/lua_generator.h"
+#include "details/lua/lua_indexes.h"
 #include "details/lua/lua_pointers.h"
+#include "details/lua/lua_scheduler.h"
+#include "details/lua/lua_tables.h"
+#include "details/lua/lua_trackers.h"
 #include "details/lua/lua_vectors.h"
\ No newline at end of file
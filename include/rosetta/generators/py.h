@@ -4,9 +4,14 @@
  */
 #pragma once
 #include "details/py/py_generator.h"
+#include "details/py/py_arrays.h"
+#include "details/py/py_converters.h"
 #include "details/py/py_functions.h"
 #include "details/py/py_functors.h"
+#include "details/py/py_indexes.h"
 #include "details/py/py_pointers.h"
+#include "details/py/py_tables.h"
+#include "details/py/py_trackers.h"
 #include "details/py/py_vectors.h"
 //#include "details/py/py_enums.h"
 
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <ranges>
+#include <rosetta/query.h>
+#include <rosetta/types.h>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace rosetta {
+
+    /**
+     * @brief Values of the key members of an object, in the order of the index
+     * members (numbers are doubles)
+     */
+    using IndexKey = std::vector<QueryValue>;
+
+    /**
+     * @brief Key of an index from C++ values, e.g. `indexKey("Player", 3)`
+     */
+    template <typename... V> IndexKey indexKey(const V &...values);
+
+    enum class IndexKind {
+        Hash,   // point lookups
+        Ordered // point and range lookups, keys in increasing order
+    };
+
+    /**
+     * @brief "hash" or "ordered" (e.g. for the bindings)
+     * @throws std::runtime_error for other names
+     */
+    IndexKind indexKindFromName(std::string_view name);
+
+    namespace detail {
+
+        // Keys compare member by member, with NaN equal to itself and after all
+        // the numbers (as in Query::orderBy), so that NaN keys keep a strict
+        // weak order
+        struct IndexKeyHash {
+            std::size_t operator()(const IndexKey &key) const;
+        };
+        struct IndexKeyEqual {
+            bool operator()(const IndexKey &a, const IndexKey &b) const;
+        };
+        struct IndexKeyLess {
+            bool operator()(const IndexKey &a, const IndexKey &b) const;
+        };
+
+        template <typename V> QueryValue indexValue(const V &value);
+
+    } // namespace detail
+
+    /**
+     * @brief Secondary index of objects of a registered class, keyed by one or
+     * more of its members.
+     *
+     * The index refers to the objects (it does not own them): they must stay at
+     * the same address while indexed, and be erased before being destroyed. The
+     * key members are resolved once through the TypeInfo and read at their
+     * offset. Keys are updated incrementally when a key member is set through
+     * the reflection layer (setMemberValue, the binding properties); call
+     * update() after writing a key member directly in C++.
+     *
+     * Like the standard containers, an index is not synchronized: objects must
+     * not be modified from several threads while indexed.
+     *
+     * @example
+     * ```cpp
+     * Index<GameObject> by_name(IndexKind::Hash, {"name"});
+     * by_name.insert(objects); // any range of GameObject or GameObject*
+     * for (GameObject *object : by_name.lookup("Player")) { ... }
+     *
+     * Index<GameObject> by_health(IndexKind::Ordered, {"health"});
+     * by_health.insert(objects);
+     * auto weak = by_health.range(0, 20); // health in [0, 20]
+     * player.setMemberValue("health", 10.0f); // re-indexed
+     * ```
+     */
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    class Index {
+    public:
+        /**
+         * @throws QueryError if a member does not exist or is not a number, bool
+         * or std::string
+         */
+        Index(IndexKind kind, const std::vector<std::string> &members);
+        ~Index();
+
+        // The index is registered by address with the TypeInfo
+        Index(const Index &)            = delete;
+        Index &operator=(const Index &) = delete;
+
+        IndexKind                       kind() const { return kind_; }
+        const std::vector<std::string> &members() const { return members_; }
+        std::size_t                     size() const { return keys_.size(); }
+        bool                            empty() const { return keys_.empty(); }
+        bool                            contains(const T &object) const;
+
+        /**
+         * @brief Add an object (no effect if it is already indexed)
+         */
+        void insert(T &object);
+
+        /**
+         * @brief Add all the objects of a range of T or of pointers to T
+         */
+        template <std::ranges::input_range R>
+            requires(!std::is_same_v<std::remove_cvref_t<R>, T>)
+        void insert(R &&objects);
+
+        /**
+         * @brief Remove an object (no effect if it is not indexed)
+         */
+        void erase(const T &object);
+        void clear();
+
+        /**
+         * @brief Re-key an object after its key members were written directly
+         */
+        void update(const T &object);
+
+        /**
+         * @brief Objects whose key equals `key`
+         * @throws std::runtime_error if the key has not one value per member
+         */
+        std::vector<T *> lookup(const IndexKey &key) const;
+        template <typename... V>
+            requires(sizeof...(V) > 0 && !(std::is_same_v<V, IndexKey> || ...))
+        std::vector<T *> lookup(const V &...values) const {
+            return lookup(indexKey(values...));
+        }
+
+        /**
+         * @brief Objects whose key is in [lo, hi], in increasing key order. Keys
+         * compare member by member, and a shorter bound compares as a prefix
+         * (e.g. {"Player"} matches all the levels of an index on name, level).
+         * NaN sorts after all the numbers, so that it is only in ranges whose
+         * upper bound is NaN.
+         * @throws std::runtime_error if the index is not ordered
+         */
+        std::vector<T *> range(const IndexKey &lo, const IndexKey &hi) const;
+        template <typename V>
+            requires(!std::is_same_v<V, IndexKey>)
+        std::vector<T *> range(const V &lo, const V &hi) const {
+            return range(indexKey(lo), indexKey(hi));
+        }
+
+        /**
+         * @brief Current key of an indexed object
+         * @throws std::runtime_error if the object is not indexed
+         */
+        const IndexKey &keyOf(const T &object) const;
+
+        const TypeInfo &getTypeInfo() const { return T::getStaticTypeInfo(); }
+
+    private:
+        using HashMap =
+            std::unordered_multimap<IndexKey, T *, detail::IndexKeyHash, detail::IndexKeyEqual>;
+        using OrderedMap = std::multimap<IndexKey, T *, detail::IndexKeyLess>;
+
+        // Indexed object: its key (hash) or its position (ordered, O(1) removal)
+        struct Entry {
+            IndexKey                      key;
+            typename OrderedMap::iterator position;
+        };
+
+        IndexKey        computeKey(const T &object) const;
+        const IndexKey &entryKey(const Entry &entry) const;
+        void            add(T &object, IndexKey key);
+        void            remove(const T &object, const Entry &entry);
+        void            checkKey(const IndexKey &key) const;
+        void            memberChanged(void *object, const MemberInfo &member);
+
+        IndexKind                            kind_;
+        std::vector<std::string>             members_;
+        std::vector<const MemberInfo *>      slots_; // members read by the key
+        std::vector<detail::QueryNode>       readers_;
+        HashMap                              hash_;
+        OrderedMap                           ordered_;
+        std::unordered_map<const T *, Entry> keys_; // indexed objects
+        std::size_t                          observer_ = 0;
+    };
+
+} // namespace rosetta
+
+#include "inline/index.hxx"
@@ -5,17 +5,36 @@
  */
 #pragma once
 #include <any>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <shared_mutex>
+#include <span>
 #include <string>
+#include <string_view>
+#include <typeindex>
+#include <type_traits>
 #include <typeinfo>
+#include <unordered_map>
 #include <vector>
 
+struct ArrowSchema;
+struct ArrowArray;
+
 namespace rosetta {
 
     using Arg  = std::any;
     using Args = std::vector<Arg>;
 
+    class BinaryWriter;
+    class BinaryReader;
+    class JsonWriter;
+    class JsonReader;
+    class ColumnStorage;
+    struct DLPackBuffer;
+
     /**
      * @brief Holds information about a constructor.
      */
@@ -38,6 +57,47 @@ namespace rosetta {
         std::string                              type_name;
         std::function<Arg(const void *)>         getter;
         std::function<void(void *, const Arg &)> setter;
+        std::function<void *(void *)>            address; // storage of the member in an instance
+        std::type_index                          type = typeid(void); // C++ type of the member
+        std::any    member_pointer; // the `MemberType Class::*` pointer, for typed bindings
+        std::size_t slot = 0;       // position in TypeInfo::getMembersInOrder()
+
+        // Set through the reflection layer, the member sends its old and new
+        // values to the property subscribers of the object (see
+        // TypeRegistrar::member_observable)
+        bool observable = false;
+
+        // Layout of the member in an instance (e.g. for LuaJIT FFI declarations)
+        static constexpr std::size_t no_offset          = static_cast<std::size_t>(-1);
+        std::size_t                  offset             = no_offset;
+        std::size_t                  size               = 0;
+        bool                         trivially_copyable = false;
+
+        // Binary codec of the member (empty if its type is not binary serializable)
+        std::function<void(const void *, BinaryWriter &)> encode;
+        std::function<void(void *, BinaryReader &)>       decode;
+        // The encoding is the `size` bytes at `offset` (copied in runs with the
+        // adjacent raw members)
+        bool binary_raw = false;
+
+        // JSON codec of the member (empty if its type is not JSON serializable)
+        std::function<void(const void *, JsonWriter &)> write_json;
+        std::function<void(void *, JsonReader &)>       read_json;
+
+        // Arrow codec of the member values at the given addresses (empty if its
+        // type has no Arrow equivalent, see ArrowTraits)
+        void (*to_arrow)(const void *const *values, std::size_t count, std::string_view name,
+                         ArrowSchema &schema, ArrowArray &array) = nullptr;
+        void (*from_arrow)(const ArrowSchema &schema, const ArrowArray &array, std::int64_t first,
+                           std::size_t count, void *const *values) = nullptr;
+
+        // Numbers stored contiguously in the member value (empty if its type is
+        // not a numeric vector or array, see DLPackTraits)
+        DLPackBuffer (*dlpack_buffer)(void *value) = nullptr;
+
+        // Creates an empty column of values of the member (empty if its type is
+        // not copyable, see Table)
+        std::function<std::unique_ptr<ColumnStorage>()> make_column;
 
         MemberInfo(const std::string &n, const std::string &t, std::function<Arg(const void *)> g,
                    std::function<void(void *, const Arg &)> s);
@@ -52,12 +112,60 @@ namespace rosetta {
         std::string                              return_type;
         std::vector<std::string>                 parameter_types;
         std::function<Arg(void *, const Args &)> invoker;
+        std::any method_pointer; // the `ReturnType (Class::*)(Args...) [const]` pointer
+        bool     async = false;  // long running: bindings may run it on a worker thread
 
         MethodInfo(const std::string &n, const std::string &ret_type,
                    const std::vector<std::string>          &param_types,
                    std::function<Arg(void *, const Args &)> inv);
     };
 
+    /**
+     * @brief Called after a member of `object` was set through the reflection
+     * layer (MemberInfo::setter: setMemberValue, the binding properties)
+     */
+    using MemberObserver = std::function<void(void *object, const MemberInfo &member)>;
+
+    /**
+     * @brief A change of an observable member of an object
+     */
+    struct PropertyChange {
+        const MemberInfo *member = nullptr;
+        std::size_t       slot   = 0; // MemberInfo::slot
+        Arg               old_value;
+        Arg               new_value;
+    };
+
+    /**
+     * @brief Receives the changes of the observable members of an object: each
+     * change as it is made, or those of a batch at once (see PropertyBatch)
+     */
+    using PropertyChangeHandler = std::function<void(std::span<const PropertyChange> changes)>;
+
+    namespace detail {
+
+        // Classes with a TypeInfo (INTROSPECTABLE)
+        template <typename T>
+        concept IntrospectableClass = std::is_class_v<T> && requires { T::getStaticTypeInfo(); };
+
+        struct MemberObserverList {
+            std::shared_mutex                                   mutex;
+            std::vector<std::pair<std::size_t, MemberObserver>> observers;
+            std::atomic<std::size_t>                            count   = 0;
+            std::size_t                                         next_id = 0;
+        };
+
+        struct PropertySubscriberList {
+            using Handlers = std::vector<std::pair<std::size_t, PropertyChangeHandler>>;
+
+            std::shared_mutex                          mutex;
+            std::unordered_map<const void *, Handlers> objects;
+            std::atomic<std::size_t>                   count   = 0; // handlers of all objects
+            std::size_t                                next_id = 0;
+        };
+
+    } // namespace detail
+
     /**
      * @brief Holds information about a class type, including its members and
      * methods. Uses unique_ptr to manage MemberInfo and MethodInfo instances. Copy
@@ -72,6 +180,7 @@ namespace rosetta {
         std::unordered_map<std::string, std::unique_ptr<MemberInfo>> members;
         std::unordered_map<std::string, std::unique_ptr<MethodInfo>> methods;
         std::vector<std::unique_ptr<ConstructorInfo>>                constructors;
+        std::vector<const MemberInfo *> member_order; // members in registration order
 
         explicit TypeInfo(const std::string &name) : class_name(name) {}
 
@@ -91,8 +200,57 @@ namespace rosetta {
         const MethodInfo *getMethod(const std::string &name) const;
         const std::vector<std::unique_ptr<ConstructorInfo>> &getConstructors() const;
 
-        std::vector<std::string> getMemberNames() const;
+        const std::vector<const MemberInfo *> &getMembersInOrder() const;
+
+        std::vector<std::string> getMemberNames() const; // in registration order
         std::vector<std::string> getMethodNames() const;
+
+        /**
+         * @brief Observe the members set through the reflection layer, for all
+         * the instances (e.g. to maintain an Index). Observers must not add or
+         * remove observers.
+         * @return id for removeMemberObserver()
+         */
+        std::size_t addMemberObserver(MemberObserver observer);
+        void        removeMemberObserver(std::size_t id);
+
+        /**
+         * @brief Call the observers (a single atomic load when there are none)
+         */
+        void notifyMemberChanged(void *object, const MemberInfo &member) const;
+
+        /**
+         * @brief Subscribe to the changes of the observable members of one
+         * object. The object must stay at the same address while subscribed.
+         * Handlers may subscribe and unsubscribe.
+         *
+         * Subscriptions are keyed by address: unsubscribe (e.g.
+         * unsubscribePropertyChanged(object)) before the object is destroyed,
+         * otherwise the handlers leak and a new object allocated at the same
+         * address receives them. PropertySubscription does it on destruction.
+         * @return id for unsubscribePropertyChanged()
+         */
+        std::size_t subscribePropertyChanged(const void *object,
+                                             PropertyChangeHandler handler) const;
+        void        unsubscribePropertyChanged(const void *object, std::size_t id) const;
+        void        unsubscribePropertyChanged(const void *object) const; // all its handlers
+
+        /**
+         * @brief Does the object have subscribers? (a single atomic load when
+         * no instance has)
+         */
+        bool hasPropertySubscribers(const void *object) const;
+
+        /**
+         * @brief Copy of the handlers of an object, to call them unlocked
+         */
+        std::vector<PropertyChangeHandler> propertyChangeHandlers(const void *object) const;
+
+    private:
+        std::unique_ptr<detail::MemberObserverList> observers_ =
+            std::make_unique<detail::MemberObserverList>();
+        std::unique_ptr<detail::PropertySubscriberList> subscribers_ =
+            std::make_unique<detail::PropertySubscriberList>();
     };
 
 } // namespace rosetta
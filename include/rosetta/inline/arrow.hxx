@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace rosetta {
+
+    namespace detail {
+
+        // Child of a table export sharing the storage of a numeric column
+        inline void shareArrowColumn(const ColumnStorage &column, NumericType type,
+                                     std::string_view name, std::shared_ptr<const void> owner,
+                                     ArrowSchema &schema, ArrowArray &array) {
+            visitNumericType(type, [&](auto identity) {
+                using E = typename decltype(identity)::type;
+                initArrowSchema(schema, arrowNumberFormat<E>(), name, 0);
+            });
+            auto &data      = initArrowArray(array, column.size(), 2, 0);
+            data.buffers[1] = column.data();
+            data.keep_alive = std::move(owner);
+        }
+
+        inline void checkArrowStruct(const ArrowSchema *schema, const ArrowArray *array) {
+            if (!schema || !array || !schema->release || !array->release) {
+                throw std::runtime_error("Released or missing Arrow schema or array");
+            }
+            if (std::string_view(schema->format) != "+s") {
+                throw std::runtime_error("Expected an Arrow struct array, got format '" +
+                                         std::string(schema->format) + "'");
+            }
+        }
+
+        // A single batch: the schema and the array exported up front
+        struct ArrowTableStream {
+            ArrowSchema schema{};
+            ArrowArray  array{};
+            std::string error;
+
+            ~ArrowTableStream() {
+                if (array.release) {
+                    array.release(&array);
+                }
+                if (schema.release) {
+                    schema.release(&schema);
+                }
+            }
+        };
+
+        inline int arrowStreamGetSchema(ArrowArrayStream *stream, ArrowSchema *out) {
+            auto *data = static_cast<ArrowTableStream *>(stream->private_data);
+            try {
+                copyArrowSchema(data->schema, *out);
+                return 0;
+            } catch (const std::exception &e) {
+                data->error = e.what();
+                return ENOMEM;
+            }
+        }
+
+        inline int arrowStreamGetNext(ArrowArrayStream *stream, ArrowArray *out) {
+            auto *data = static_cast<ArrowTableStream *>(stream->private_data);
+            *out       = data->array; // moved, or released at the end of the stream
+            data->array.release = nullptr;
+            return 0;
+        }
+
+        inline const char *arrowStreamGetLastError(ArrowArrayStream *stream) {
+            auto *data = static_cast<ArrowTableStream *>(stream->private_data);
+            return data->error.empty() ? nullptr : data->error.c_str();
+        }
+
+        inline void arrowStreamRelease(ArrowArrayStream *stream) {
+            delete static_cast<ArrowTableStream *>(stream->private_data);
+            stream->release = nullptr;
+        }
+
+    } // namespace detail
+
+    template <typename T>
+    inline void toArrow(const Table<T> &table, ArrowSchema *schema, ArrowArray *array,
+                        std::shared_ptr<const void> owner) {
+        std::vector<std::string> names;
+        for (const std::string &name : table.columnNames()) {
+            if (table.getTypeInfo().getMember(name)->to_arrow) {
+                names.push_back(name);
+            }
+        }
+        auto &schema_data = detail::initArrowSchema(*schema, "+s", "", names.size());
+        auto &data        = detail::initArrowArray(*array, table.size(), 1, names.size());
+        std::vector<const void *> cells(table.size());
+        for (std::size_t k = 0; k < names.size(); ++k) {
+            const ColumnStorage &column = table.columnStorage(names[k]);
+            const MemberInfo    *member = table.getTypeInfo().getMember(names[k]);
+            if (const auto type = column.numericType(); type && owner) {
+                detail::shareArrowColumn(column, *type, member->name, owner,
+                                         *schema_data.children[k], *data.children[k]);
+                continue;
+            }
+            const auto *base = static_cast<const unsigned char *>(column.data());
+            for (std::size_t row = 0; row < cells.size(); ++row) {
+                cells[row] = base + row * member->size;
+            }
+            member->to_arrow(cells.data(), cells.size(), member->name, *schema_data.children[k],
+                             *data.children[k]);
+        }
+    }
+
+    template <detail::ArrowObjectRange R>
+    inline void toArrow(R &&objects, ArrowSchema *schema, ArrowArray *array) {
+        using T = detail::arrow_object_t<R>;
+        std::vector<const void *> addresses;
+        if constexpr (std::ranges::sized_range<R>) {
+            addresses.reserve(static_cast<std::size_t>(std::ranges::size(objects)));
+        }
+        for (auto &&item : objects) {
+            if constexpr (detail::is_query_indirect_v<std::remove_cvref_t<decltype(item)>>) {
+                addresses.push_back(static_cast<const T *>(std::addressof(*item)));
+            } else {
+                addresses.push_back(static_cast<const T *>(std::addressof(item)));
+            }
+        }
+        exportObjectsArrow(T::getStaticTypeInfo(), addresses.data(), addresses.size(), "",
+                           *schema, *array);
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline std::vector<T> fromArrow(const ArrowSchema *schema, const ArrowArray *array) {
+        detail::checkArrowStruct(schema, array);
+        std::vector<T>      objects(static_cast<std::size_t>(array->length));
+        std::vector<void *> addresses;
+        addresses.reserve(objects.size());
+        for (T &object : objects) {
+            addresses.push_back(&object);
+        }
+        importObjectsArrow(T::getStaticTypeInfo(), *schema, *array, 0, objects.size(),
+                           addresses.data());
+        return objects;
+    }
+
+    template <typename T>
+    inline void appendFromArrow(Table<T> &table, const ArrowSchema *schema,
+                                const ArrowArray *array) {
+        detail::checkArrowStruct(schema, array);
+        const std::size_t first = table.size();
+        const auto        count = static_cast<std::size_t>(array->length);
+        table.reserve(first + count);
+        const T defaults{};
+        for (std::size_t i = 0; i < count; ++i) {
+            table.push_back(defaults);
+        }
+        std::vector<void *> cells(count);
+        try {
+            detail::checkArrowChildren(*schema, *array, schema->n_children);
+            for (std::int64_t k = 0; k < schema->n_children; ++k) {
+                const ArrowSchema &child  = *schema->children[k];
+                const std::string  name   = child.name ? child.name : "";
+                const MemberInfo  *member = table.getTypeInfo().getMember(name);
+                if (!member || !member->from_arrow || !table.hasColumn(name)) {
+                    continue;
+                }
+                auto *base = static_cast<unsigned char *>(table.columnStorage(name).data());
+                for (std::size_t i = 0; i < count; ++i) {
+                    const auto row = array->offset + static_cast<std::int64_t>(i);
+                    cells[i]       = nullptr;
+                    if (detail::arrowIsValid(*array, row)) {
+                        cells[i] = base + (first + i) * member->size;
+                    }
+                }
+                member->from_arrow(child, *array->children[k], array->offset, count,
+                                   cells.data());
+            }
+        } catch (...) {
+            while (table.size() > first) { // the table is left unchanged
+                table.erase(table.size() - 1);
+            }
+            throw;
+        }
+    }
+
+    template <typename T>
+    inline void toArrowStream(const Table<T> &table, ArrowArrayStream *stream,
+                              std::shared_ptr<const void> owner) {
+        auto data = std::make_unique<detail::ArrowTableStream>();
+        toArrow(table, &data->schema, &data->array, std::move(owner));
+        stream->get_schema     = &detail::arrowStreamGetSchema;
+        stream->get_next       = &detail::arrowStreamGetNext;
+        stream->get_last_error = &detail::arrowStreamGetLastError;
+        stream->release        = &detail::arrowStreamRelease;
+        stream->private_data   = data.release();
+    }
+
+    template <typename T>
+    inline void appendFromArrowStream(Table<T> &table, ArrowArrayStream *stream) {
+        const auto check = [&](int code) {
+            if (code != 0) {
+                const char *error = stream->get_last_error(stream);
+                throw std::runtime_error("Arrow stream error: " +
+                                         std::string(error ? error : std::strerror(code)));
+            }
+        };
+        // Released on every exit, as the stream and its schema are consumed here
+        const auto release = [](auto *owned) {
+            if (owned->release) {
+                owned->release(owned);
+            }
+        };
+        std::unique_ptr<ArrowArrayStream, decltype(release)> stream_guard(stream, release);
+        ArrowSchema                                          schema{};
+        check(stream->get_schema(stream, &schema));
+        std::unique_ptr<ArrowSchema, decltype(release)> schema_guard(&schema, release);
+        while (true) {
+            ArrowArray array{};
+            check(stream->get_next(stream, &array));
+            if (!array.release) {
+                break;
+            }
+            std::unique_ptr<ArrowArray, decltype(release)> array_guard(&array, release);
+            appendFromArrow(table, &schema, &array);
+        }
+    }
+
+} // namespace rosetta
@@ -0,0 +1,500 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <array>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace rosetta {
+
+    namespace detail {
+
+        inline void releaseArrowSchema(ArrowSchema *schema) {
+            auto *data = static_cast<ArrowSchemaData *>(schema->private_data);
+            for (auto &child : data->children) {
+                if (child->release) { // not moved by the consumer
+                    child->release(child.get());
+                }
+            }
+            delete data;
+            schema->release = nullptr;
+        }
+
+        inline void releaseArrowArray(ArrowArray *array) {
+            auto *data = static_cast<ArrowArrayData *>(array->private_data);
+            for (auto &child : data->children) {
+                if (child->release) {
+                    child->release(child.get());
+                }
+            }
+            delete data;
+            array->release = nullptr;
+        }
+
+        inline ArrowSchemaData &initArrowSchema(ArrowSchema &schema, std::string format,
+                                                std::string_view name, std::size_t children) {
+            auto *data   = new ArrowSchemaData;
+            data->format = std::move(format);
+            data->name   = std::string(name);
+            for (std::size_t i = 0; i < children; ++i) {
+                data->children.push_back(std::make_unique<ArrowSchema>());
+                data->child_pointers.push_back(data->children.back().get());
+            }
+            schema              = ArrowSchema{};
+            schema.format       = data->format.c_str();
+            schema.name         = data->name.c_str();
+            schema.n_children   = static_cast<int64_t>(children);
+            schema.children     = data->child_pointers.data();
+            schema.release      = &releaseArrowSchema;
+            schema.private_data = data;
+            return *data;
+        }
+
+        inline ArrowArrayData &initArrowArray(ArrowArray &array, std::size_t length,
+                                              std::size_t buffers, std::size_t children) {
+            auto *data = new ArrowArrayData;
+            data->owned.resize(buffers);
+            data->buffers.resize(buffers, nullptr);
+            for (std::size_t i = 0; i < children; ++i) {
+                data->children.push_back(std::make_unique<ArrowArray>());
+                data->child_pointers.push_back(data->children.back().get());
+            }
+            array              = ArrowArray{};
+            array.length       = static_cast<int64_t>(length);
+            array.n_buffers    = static_cast<int64_t>(buffers);
+            array.n_children   = static_cast<int64_t>(children);
+            array.buffers      = data->buffers.data();
+            array.children     = data->child_pointers.data();
+            array.release      = &releaseArrowArray;
+            array.private_data = data;
+            return *data;
+        }
+
+        inline void *allocateArrowBuffer(ArrowArrayData &data, std::size_t index,
+                                         std::size_t bytes) {
+            auto &buffer = data.owned[index];
+            buffer.assign(bytes, 0);
+            data.buffers[index] = buffer.data();
+            return buffer.data();
+        }
+
+        inline bool arrowIsValid(const ArrowArray &array, std::int64_t index) {
+            if (array.null_count == 0 || array.n_buffers == 0 || !array.buffers[0]) {
+                return true;
+            }
+            const auto *bitmap = static_cast<const std::uint8_t *>(array.buffers[0]);
+            return (bitmap[index / 8] >> (index % 8)) & 1;
+        }
+
+        inline void copyArrowSchema(const ArrowSchema &source, ArrowSchema &copy) {
+            const auto children = static_cast<std::size_t>(source.n_children);
+            auto      &data = initArrowSchema(copy, source.format, source.name ? source.name : "",
+                                              children);
+            copy.flags      = source.flags;
+            for (std::size_t i = 0; i < children; ++i) {
+                copyArrowSchema(*source.children[i], *data.children[i]);
+            }
+        }
+
+        [[noreturn]] inline void arrowFormatError(const ArrowSchema &schema, const char *expected) {
+            const std::string name = schema.name ? schema.name : "";
+            throw std::runtime_error("Arrow column '" + name + "' of format '" + schema.format +
+                                     "' is not " + expected);
+        }
+
+        inline void checkArrowChildren(const ArrowSchema &schema, const ArrowArray &array,
+                                       std::int64_t children) {
+            if (schema.n_children != children || array.n_children != children) {
+                throw std::runtime_error("Malformed Arrow column '" +
+                                         std::string(schema.name ? schema.name : "") + "'");
+            }
+        }
+
+        template <typename E> constexpr const char *arrowNumberFormat() {
+            if constexpr (std::is_floating_point_v<E>) {
+                static_assert(sizeof(E) == 4 || sizeof(E) == 8, "No Arrow float of this size");
+                return sizeof(E) == 4 ? "f" : "g";
+            } else {
+                constexpr std::array<const char *, 4> signed_formats{"c", "s", "i", "l"};
+                constexpr std::array<const char *, 4> unsigned_formats{"C", "S", "I", "L"};
+                constexpr std::size_t index = sizeof(E) == 1   ? 0
+                                              : sizeof(E) == 2 ? 1
+                                              : sizeof(E) == 4 ? 2
+                                                               : 3;
+                return std::is_signed_v<E> ? signed_formats[index] : unsigned_formats[index];
+            }
+        }
+
+        /**
+         * @brief visitor(std::type_identity<E>) with the C++ type of a numeric
+         * Arrow format (bool included)
+         * @throws std::runtime_error if the format is not numeric
+         */
+        template <typename Visitor>
+        inline decltype(auto) visitArrowNumber(const ArrowSchema &schema, Visitor &&visitor) {
+            const std::string_view format = schema.format;
+            if (format.size() == 1) {
+                switch (format[0]) {
+                case 'b':
+                    return visitor(std::type_identity<bool>{});
+                case 'c':
+                    return visitor(std::type_identity<std::int8_t>{});
+                case 'C':
+                    return visitor(std::type_identity<std::uint8_t>{});
+                case 's':
+                    return visitor(std::type_identity<std::int16_t>{});
+                case 'S':
+                    return visitor(std::type_identity<std::uint16_t>{});
+                case 'i':
+                    return visitor(std::type_identity<std::int32_t>{});
+                case 'I':
+                    return visitor(std::type_identity<std::uint32_t>{});
+                case 'l':
+                    return visitor(std::type_identity<std::int64_t>{});
+                case 'L':
+                    return visitor(std::type_identity<std::uint64_t>{});
+                case 'f':
+                    return visitor(std::type_identity<float>{});
+                case 'g':
+                    return visitor(std::type_identity<double>{});
+                }
+            }
+            arrowFormatError(schema, "a number");
+        }
+
+        // Numbers and bools, bit-packed for bool
+        template <typename E>
+        inline E readArrowNumber(const ArrowArray &array, std::int64_t index) {
+            if constexpr (std::is_same_v<E, bool>) {
+                const auto *bits = static_cast<const std::uint8_t *>(array.buffers[1]);
+                return (bits[index / 8] >> (index % 8)) & 1;
+            } else {
+                return static_cast<const E *>(array.buffers[1])[index];
+            }
+        }
+
+        template <typename V>
+        inline void importArrowNumbers(const ArrowSchema &schema, const ArrowArray &array,
+                                       std::int64_t first, std::size_t count, void *const *values) {
+            const std::int64_t base = array.offset + first;
+            visitArrowNumber(schema, [&](auto identity) {
+                using E = typename decltype(identity)::type;
+                for (std::size_t i = 0; i < count; ++i) {
+                    const auto index = base + static_cast<std::int64_t>(i);
+                    if (values[i] && arrowIsValid(array, index)) {
+                        *static_cast<V *>(values[i]) =
+                            static_cast<V>(readArrowNumber<E>(array, index));
+                    }
+                }
+            });
+        }
+
+        // Offsets of variable size elements (strings, lists): int32 when they fit
+        template <typename Offset, typename Size>
+        inline void writeArrowOffsets(ArrowArrayData &data, std::size_t count, Size &&size_of) {
+            auto *offsets = static_cast<Offset *>(
+                allocateArrowBuffer(data, 1, (count + 1) * sizeof(Offset)));
+            for (std::size_t i = 0; i < count; ++i) {
+                offsets[i + 1] = offsets[i] + static_cast<Offset>(size_of(i));
+            }
+        }
+
+        // Range [begin, end) of the element `index` of a variable size column
+        inline std::pair<std::int64_t, std::int64_t> arrowElementRange(const ArrowArray &array,
+                                                                       bool large,
+                                                                       std::int64_t index) {
+            if (large) {
+                const auto *offsets = static_cast<const std::int64_t *>(array.buffers[1]);
+                return {offsets[index], offsets[index + 1]};
+            }
+            const auto *offsets = static_cast<const std::int32_t *>(array.buffers[1]);
+            return {offsets[index], offsets[index + 1]};
+        }
+
+        // Lists (variable or fixed size) of E stored in containers C
+        template <typename C, typename E> struct ArrowListTraits {
+            static void exportChild(const void *const *values, std::size_t count,
+                                    ArrowSchemaData &schema, ArrowArrayData &array) {
+                std::vector<const void *> items;
+                for (std::size_t i = 0; i < count; ++i) {
+                    for (const E &item : *static_cast<const C *>(values[i])) {
+                        items.push_back(&item);
+                    }
+                }
+                ArrowTraits<E>::exportValues(items.data(), items.size(), "item",
+                                             *schema.children[0], *array.children[0]);
+            }
+
+            static void importItems(const ArrowSchema &schema, const ArrowArray &array,
+                                    std::int64_t begin, C &container) {
+                std::vector<void *> items;
+                for (E &item : container) {
+                    items.push_back(&item);
+                }
+                ArrowTraits<E>::importValues(*schema.children[0], *array.children[0], begin,
+                                             items.size(), items.data());
+            }
+        };
+
+    } // namespace detail
+
+    // ------------------------------------------------
+
+    template <typename T>
+        requires((std::is_arithmetic_v<T> && !std::is_same_v<T, bool> &&
+                  !std::is_same_v<T, long double>) ||
+                 std::is_enum_v<T>)
+    struct ArrowTraits<T> {
+        static constexpr bool supported = true;
+        using Number = typename std::conditional_t<std::is_enum_v<T>, std::underlying_type<T>,
+                                                   std::type_identity<T>>::type;
+
+        static void exportValues(const void *const *values, std::size_t count,
+                                 std::string_view name, ArrowSchema &schema, ArrowArray &array) {
+            detail::initArrowSchema(schema, detail::arrowNumberFormat<Number>(), name, 0);
+            auto &data = detail::initArrowArray(array, count, 2, 0);
+            auto *out  = static_cast<T *>(detail::allocateArrowBuffer(data, 1, count * sizeof(T)));
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = *static_cast<const T *>(values[i]);
+            }
+        }
+
+        static void importValues(const ArrowSchema &schema, const ArrowArray &array,
+                                 std::int64_t first, std::size_t count, void *const *values) {
+            if constexpr (std::is_enum_v<T>) {
+                std::vector<Number> numbers(count);
+                std::vector<void *> addresses(count, nullptr);
+                for (std::size_t i = 0; i < count; ++i) {
+                    if (values[i]) {
+                        numbers[i]   = static_cast<Number>(*static_cast<const T *>(values[i]));
+                        addresses[i] = &numbers[i];
+                    }
+                }
+                detail::importArrowNumbers<Number>(schema, array, first, count, addresses.data());
+                for (std::size_t i = 0; i < count; ++i) {
+                    if (values[i]) {
+                        *static_cast<T *>(values[i]) = static_cast<T>(numbers[i]);
+                    }
+                }
+            } else {
+                detail::importArrowNumbers<T>(schema, array, first, count, values);
+            }
+        }
+    };
+
+    template <> struct ArrowTraits<bool> {
+        static constexpr bool supported = true;
+
+        static void exportValues(const void *const *values, std::size_t count,
+                                 std::string_view name, ArrowSchema &schema, ArrowArray &array) {
+            detail::initArrowSchema(schema, "b", name, 0);
+            auto &data = detail::initArrowArray(array, count, 2, 0);
+            auto *bits = static_cast<std::uint8_t *>(
+                detail::allocateArrowBuffer(data, 1, (count + 7) / 8));
+            for (std::size_t i = 0; i < count; ++i) {
+                if (*static_cast<const bool *>(values[i])) {
+                    bits[i / 8] |= static_cast<std::uint8_t>(1u << (i % 8));
+                }
+            }
+        }
+
+        static void importValues(const ArrowSchema &schema, const ArrowArray &array,
+                                 std::int64_t first, std::size_t count, void *const *values) {
+            detail::importArrowNumbers<bool>(schema, array, first, count, values);
+        }
+    };
+
+    template <> struct ArrowTraits<std::string> {
+        static constexpr bool supported = true;
+
+        static void exportValues(const void *const *values, std::size_t count,
+                                 std::string_view name, ArrowSchema &schema, ArrowArray &array) {
+            const auto text = [&](std::size_t i) -> const std::string & {
+                return *static_cast<const std::string *>(values[i]);
+            };
+            std::size_t total = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                total += text(i).size();
+            }
+            const bool large = total > static_cast<std::size_t>(
+                                           std::numeric_limits<std::int32_t>::max());
+            detail::initArrowSchema(schema, large ? "U" : "u", name, 0);
+            auto      &data     = detail::initArrowArray(array, count, 3, 0);
+            const auto size_of  = [&](std::size_t i) { return text(i).size(); };
+            if (large) {
+                detail::writeArrowOffsets<std::int64_t>(data, count, size_of);
+            } else {
+                detail::writeArrowOffsets<std::int32_t>(data, count, size_of);
+            }
+            auto *chars = static_cast<char *>(detail::allocateArrowBuffer(data, 2, total));
+            for (std::size_t i = 0; i < count; ++i) {
+                chars = std::copy(text(i).begin(), text(i).end(), chars);
+            }
+        }
+
+        static void importValues(const ArrowSchema &schema, const ArrowArray &array,
+                                 std::int64_t first, std::size_t count, void *const *values) {
+            const std::string_view format = schema.format;
+            if (format != "u" && format != "U") {
+                detail::arrowFormatError(schema, "a string");
+            }
+            const auto *chars = static_cast<const char *>(array.buffers[2]);
+            const auto  base  = array.offset + first;
+            for (std::size_t i = 0; i < count; ++i) {
+                const auto index = base + static_cast<std::int64_t>(i);
+                if (values[i] && detail::arrowIsValid(array, index)) {
+                    const bool large        = format == "U";
+                    const auto [begin, end] = detail::arrowElementRange(array, large, index);
+                    static_cast<std::string *>(values[i])->assign(chars + begin, chars + end);
+                }
+            }
+        }
+    };
+
+    // std::vector<bool> has no addressable elements
+    template <typename E>
+        requires(ArrowTraits<E>::supported && !std::is_same_v<E, bool>)
+    struct ArrowTraits<std::vector<E>> {
+        static constexpr bool supported = true;
+        using List                      = detail::ArrowListTraits<std::vector<E>, E>;
+
+        static void exportValues(const void *const *values, std::size_t count,
+                                 std::string_view name, ArrowSchema &schema, ArrowArray &array) {
+            const auto items = [&](std::size_t i) {
+                return static_cast<const std::vector<E> *>(values[i])->size();
+            };
+            std::size_t total = 0;
+            for (std::size_t i = 0; i < count; ++i) {
+                total += items(i);
+            }
+            const bool large = total > static_cast<std::size_t>(
+                                           std::numeric_limits<std::int32_t>::max());
+            auto &schema_data = detail::initArrowSchema(schema, large ? "+L" : "+l", name, 1);
+            auto &data        = detail::initArrowArray(array, count, 2, 1);
+            if (large) {
+                detail::writeArrowOffsets<std::int64_t>(data, count, items);
+            } else {
+                detail::writeArrowOffsets<std::int32_t>(data, count, items);
+            }
+            List::exportChild(values, count, schema_data, data);
+        }
+
+        static void importValues(const ArrowSchema &schema, const ArrowArray &array,
+                                 std::int64_t first, std::size_t count, void *const *values) {
+            const std::string_view format = schema.format;
+            if (format != "+l" && format != "+L") {
+                detail::arrowFormatError(schema, "a list");
+            }
+            detail::checkArrowChildren(schema, array, 1);
+            const auto base = array.offset + first;
+            for (std::size_t i = 0; i < count; ++i) {
+                const auto index = base + static_cast<std::int64_t>(i);
+                if (!values[i] || !detail::arrowIsValid(array, index)) {
+                    continue;
+                }
+                const auto [begin, end] = detail::arrowElementRange(array, format == "+L", index);
+                auto &vector            = *static_cast<std::vector<E> *>(values[i]);
+                vector.resize(static_cast<std::size_t>(end - begin));
+                List::importItems(schema, array, begin, vector);
+            }
+        }
+    };
+
+    template <typename E, std::size_t N>
+        requires ArrowTraits<E>::supported
+    struct ArrowTraits<std::array<E, N>> {
+        static constexpr bool supported = true;
+        using List                      = detail::ArrowListTraits<std::array<E, N>, E>;
+
+        static void exportValues(const void *const *values, std::size_t count,
+                                 std::string_view name, ArrowSchema &schema, ArrowArray &array) {
+            auto &schema_data =
+                detail::initArrowSchema(schema, "+w:" + std::to_string(N), name, 1);
+            auto &data = detail::initArrowArray(array, count, 1, 1);
+            List::exportChild(values, count, schema_data, data);
+        }
+
+        static void importValues(const ArrowSchema &schema, const ArrowArray &array,
+                                 std::int64_t first, std::size_t count, void *const *values) {
+            if (std::string_view(schema.format) != "+w:" + std::to_string(N)) {
+                detail::arrowFormatError(schema, ("a list of " + std::to_string(N)).c_str());
+            }
+            detail::checkArrowChildren(schema, array, 1);
+            const auto base = array.offset + first;
+            for (std::size_t i = 0; i < count; ++i) {
+                const auto index = base + static_cast<std::int64_t>(i);
+                if (values[i] && detail::arrowIsValid(array, index)) {
+                    List::importItems(schema, array, index * static_cast<std::int64_t>(N),
+                                      *static_cast<std::array<E, N> *>(values[i]));
+                }
+            }
+        }
+    };
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    struct ArrowTraits<T> {
+        static constexpr bool supported = true;
+
+        static void exportValues(const void *const *values, std::size_t count,
+                                 std::string_view name, ArrowSchema &schema, ArrowArray &array) {
+            exportObjectsArrow(T::getStaticTypeInfo(), values, count, name, schema, array);
+        }
+
+        static void importValues(const ArrowSchema &schema, const ArrowArray &array,
+                                 std::int64_t first, std::size_t count, void *const *values) {
+            importObjectsArrow(T::getStaticTypeInfo(), schema, array, first, count, values);
+        }
+    };
+
+    // ------------------------------------------------
+
+    inline void exportObjectsArrow(const TypeInfo &type_info, const void *const *objects,
+                                   std::size_t count, std::string_view name, ArrowSchema &schema,
+                                   ArrowArray &array) {
+        std::vector<const MemberInfo *> members;
+        for (const MemberInfo *member : type_info.getMembersInOrder()) {
+            if (member->to_arrow) {
+                members.push_back(member);
+            }
+        }
+        auto &schema_data = detail::initArrowSchema(schema, "+s", name, members.size());
+        auto &data        = detail::initArrowArray(array, count, 1, members.size());
+        std::vector<const void *> values(count);
+        for (std::size_t k = 0; k < members.size(); ++k) {
+            for (std::size_t i = 0; i < count; ++i) {
+                values[i] = members[k]->address(const_cast<void *>(objects[i]));
+            }
+            members[k]->to_arrow(values.data(), count, members[k]->name,
+                                 *schema_data.children[k], *data.children[k]);
+        }
+    }
+
+    inline void importObjectsArrow(const TypeInfo &type_info, const ArrowSchema &schema,
+                                   const ArrowArray &array, std::int64_t first, std::size_t count,
+                                   void *const *objects) {
+        if (std::string_view(schema.format) != "+s") {
+            detail::arrowFormatError(schema, ("a struct of " + type_info.class_name).c_str());
+        }
+        detail::checkArrowChildren(schema, array, schema.n_children);
+        const auto          base = array.offset + first;
+        std::vector<void *> values(count);
+        for (std::int64_t k = 0; k < schema.n_children; ++k) {
+            const ArrowSchema &child  = *schema.children[k];
+            const MemberInfo  *member = type_info.getMember(child.name ? child.name : "");
+            if (!member || !member->from_arrow) {
+                continue;
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                const bool valid = objects[i] &&
+                                   detail::arrowIsValid(array, base + static_cast<std::int64_t>(i));
+                values[i] = valid ? member->address(objects[i]) : nullptr;
+            }
+            member->from_arrow(child, *array.children[k], base, count, values.data());
+        }
+    }
+
+} // namespace rosetta
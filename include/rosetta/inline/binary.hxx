@@ -0,0 +1,467 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace rosetta {
+
+    namespace detail {
+
+        // Element types written as one contiguous block (same as is_numeric_v)
+        template <typename T>
+        inline constexpr bool is_block_element_v =
+            std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+        // Trivially copyable classes opted in with BinaryRaw are written as raw
+        // bytes
+        template <typename T>
+        inline constexpr bool is_raw_class_v = std::is_class_v<T> &&
+                                               std::is_trivially_copyable_v<T> &&
+                                               !IntrospectableClass<T> && BinaryRaw<T>::value;
+
+        // Types whose encoding is their object representation
+        template <typename T>
+        inline constexpr bool is_binary_raw_v =
+            is_raw_class_v<T> || (std::endian::native == std::endian::little &&
+                                  std::is_arithmetic_v<T> && !std::is_same_v<T, bool>);
+
+        // Storage flag preceding each contiguous block
+        inline constexpr std::uint8_t block_inline      = 0;
+        inline constexpr std::uint8_t block_out_of_band = 1;
+
+        template <typename T> inline void storeLittleEndian(std::uint8_t *out, T value) {
+            std::memcpy(out, &value, sizeof(T));
+            if constexpr (std::endian::native == std::endian::big) {
+                std::reverse(out, out + sizeof(T));
+            }
+        }
+
+        template <typename T> inline T loadLittleEndian(const std::uint8_t *in) {
+            T value;
+            if constexpr (std::endian::native == std::endian::big) {
+                std::uint8_t tmp[sizeof(T)];
+                std::reverse_copy(in, in + sizeof(T), tmp);
+                std::memcpy(&value, tmp, sizeof(T));
+            } else {
+                std::memcpy(&value, in, sizeof(T));
+            }
+            return value;
+        }
+
+    } // namespace detail
+
+    // ------------------------------------------------
+
+    inline BinaryWriter::BinaryWriter(std::vector<std::uint8_t> &buffer, OutOfBandSink sink)
+        : buffer_(buffer), sink_(std::move(sink)) {}
+
+    template <typename T> inline void BinaryWriter::write(T value) {
+        if constexpr (std::is_enum_v<T>) {
+            write(static_cast<std::underlying_type_t<T>>(value));
+        } else if constexpr (std::is_same_v<T, bool>) {
+            buffer_.push_back(value ? 1 : 0);
+        } else {
+            static_assert(std::is_arithmetic_v<T>, "Only arithmetic values can be written");
+            const auto offset = buffer_.size();
+            buffer_.resize(offset + sizeof(T));
+            detail::storeLittleEndian(buffer_.data() + offset, value);
+        }
+    }
+
+    inline void BinaryWriter::writeBytes(const void *data, std::size_t bytes) {
+        const auto *begin = static_cast<const std::uint8_t *>(data);
+        buffer_.insert(buffer_.end(), begin, begin + bytes);
+    }
+
+    inline void BinaryWriter::writeString(const std::string &value) {
+        write<std::uint64_t>(value.size());
+        writeBytes(value.data(), value.size());
+    }
+
+    template <typename T> inline void BinaryWriter::writeArray(const T *data, std::size_t count) {
+        static_assert(detail::is_block_element_v<T>,
+                      "Only numeric arrays can be written as a block");
+        const std::size_t bytes = count * sizeof(T);
+
+        if constexpr (std::endian::native == std::endian::little) {
+            if (sink_ && bytes > 0 && sink_(data, bytes)) {
+                write(detail::block_out_of_band);
+                return;
+            }
+            write(detail::block_inline);
+            writeBytes(data, bytes);
+        } else {
+            write(detail::block_inline);
+            for (std::size_t i = 0; i < count; ++i) {
+                write(data[i]);
+            }
+        }
+    }
+
+    inline std::vector<std::uint8_t> &BinaryWriter::buffer() { return buffer_; }
+
+    // ------------------------------------------------
+
+    inline BinaryReader::BinaryReader(const void *data, std::size_t size, OutOfBandSource source)
+        : data_(static_cast<const std::uint8_t *>(data)), size_(size), source_(std::move(source)) {
+    }
+
+    template <typename T> inline T BinaryReader::read() {
+        if constexpr (std::is_enum_v<T>) {
+            return static_cast<T>(read<std::underlying_type_t<T>>());
+        } else if constexpr (std::is_same_v<T, bool>) {
+            return read<std::uint8_t>() != 0;
+        } else {
+            static_assert(std::is_arithmetic_v<T>, "Only arithmetic values can be read");
+            if (remaining() < sizeof(T)) {
+                throw std::runtime_error("Binary data truncated");
+            }
+            T value = detail::loadLittleEndian<T>(data_ + pos_);
+            pos_ += sizeof(T);
+            return value;
+        }
+    }
+
+    inline void BinaryReader::readBytes(void *out, std::size_t bytes) {
+        if (remaining() < bytes) {
+            throw std::runtime_error("Binary data truncated");
+        }
+        if (bytes > 0) {
+            std::memcpy(out, data_ + pos_, bytes);
+        }
+        pos_ += bytes;
+    }
+
+    inline std::string BinaryReader::readString() {
+        const auto size = read<std::uint64_t>();
+        if (size > remaining()) {
+            throw std::runtime_error("Binary data truncated");
+        }
+        std::string value(size, '\0');
+        readBytes(value.data(), size);
+        return value;
+    }
+
+    template <typename T> inline void BinaryReader::readArray(T *out, std::size_t count) {
+        static_assert(detail::is_block_element_v<T>,
+                      "Only numeric arrays can be read as a block");
+        const std::size_t bytes = count * sizeof(T);
+
+        const auto storage = read<std::uint8_t>();
+        if (storage == detail::block_out_of_band) {
+            if (!source_) {
+                throw std::runtime_error("Missing out-of-band buffer");
+            }
+            const void *data = source_(bytes);
+            if (bytes > 0) {
+                std::memcpy(out, data, bytes);
+            }
+        } else if constexpr (std::endian::native == std::endian::little) {
+            readBytes(out, bytes);
+        } else {
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = read<T>();
+            }
+        }
+    }
+
+    template <typename T>
+    inline void BinaryReader::readArray(std::vector<T> &out, std::uint64_t count) {
+        static_assert(detail::is_block_element_v<T>,
+                      "Only numeric arrays can be read as a block");
+        if (count > std::numeric_limits<std::size_t>::max() / sizeof(T)) {
+            throw std::runtime_error("Binary data truncated");
+        }
+        const std::size_t bytes = count * sizeof(T);
+
+        const auto storage = read<std::uint8_t>();
+        if (storage == detail::block_out_of_band) {
+            if (!source_) {
+                throw std::runtime_error("Missing out-of-band buffer");
+            }
+            const void *data = source_(bytes);
+            out.resize(count);
+            if (bytes > 0) {
+                std::memcpy(out.data(), data, bytes);
+            }
+            return;
+        }
+        if (remaining() < bytes) {
+            throw std::runtime_error("Binary data truncated");
+        }
+        out.resize(count);
+        if constexpr (std::endian::native == std::endian::little) {
+            readBytes(out.data(), bytes);
+        } else {
+            for (auto &item : out) {
+                item = read<T>();
+            }
+        }
+    }
+
+    inline std::size_t BinaryReader::remaining() const { return size_ - pos_; }
+
+    inline bool BinaryReader::atEnd() const { return pos_ == size_; }
+
+    // ------------------------------------------------
+
+    template <typename T>
+        requires std::is_arithmetic_v<T>
+    struct BinaryTraits<T> {
+        static constexpr bool supported = true;
+        static void           encode(BinaryWriter &writer, const T &value) { writer.write(value); }
+        static void           decode(BinaryReader &reader, T &value) { value = reader.read<T>(); }
+    };
+
+    // Underlying value; decoded values must be declared (or, for flags, made of
+    // declared bits) when the enum is registered
+    template <typename T>
+        requires std::is_enum_v<T>
+    struct BinaryTraits<T> {
+        static constexpr bool supported = true;
+        static void           encode(BinaryWriter &writer, const T &value) { writer.write(value); }
+        static void           decode(BinaryReader &reader, T &value) {
+            using Underlying = std::underlying_type_t<T>;
+            value            = reader.read<T>();
+            const auto *info = EnumRegistry::instance().getEnumInfo<T>();
+            const auto  raw  = static_cast<std::int64_t>(static_cast<Underlying>(value));
+            if (info && !info->hasValue(raw)) {
+                throw std::runtime_error("Invalid value " + std::to_string(raw) + " for enum '" +
+                                         info->name + "'");
+            }
+        }
+    };
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    struct BinaryTraits<T> {
+        static constexpr bool supported = true;
+        static void           encode(BinaryWriter &writer, const T &value) {
+            encodeObject(T::getStaticTypeInfo(), &value, writer);
+        }
+        static void decode(BinaryReader &reader, T &value) {
+            decodeObject(T::getStaticTypeInfo(), &value, reader);
+        }
+    };
+
+    template <typename T>
+        requires detail::is_raw_class_v<T>
+    struct BinaryTraits<T> {
+        static constexpr bool supported = true;
+        static void           encode(BinaryWriter &writer, const T &value) {
+            writer.writeBytes(&value, sizeof(T));
+        }
+        static void decode(BinaryReader &reader, T &value) { reader.readBytes(&value, sizeof(T)); }
+    };
+
+    template <> struct BinaryTraits<std::string> {
+        static constexpr bool supported = true;
+        static void encode(BinaryWriter &writer, const std::string &value) {
+            writer.writeString(value);
+        }
+        static void decode(BinaryReader &reader, std::string &value) {
+            value = reader.readString();
+        }
+    };
+
+    template <typename T>
+        requires BinaryTraits<T>::supported
+    struct BinaryTraits<std::vector<T>> {
+        static constexpr bool supported = true;
+
+        static void encode(BinaryWriter &writer, const std::vector<T> &value) {
+            writer.write<std::uint64_t>(value.size());
+            if constexpr (detail::is_block_element_v<T>) {
+                writer.writeArray(value.data(), value.size());
+            } else if constexpr (detail::is_raw_class_v<T>) {
+                writer.writeBytes(value.data(), value.size() * sizeof(T));
+            } else {
+                for (const auto &item : value) {
+                    BinaryTraits<T>::encode(writer, item);
+                }
+            }
+        }
+
+        static void decode(BinaryReader &reader, std::vector<T> &value) {
+            const auto size = reader.read<std::uint64_t>();
+            if constexpr (detail::is_block_element_v<T>) {
+                reader.readArray(value, size);
+            } else if constexpr (detail::is_raw_class_v<T>) {
+                if (size > reader.remaining() / sizeof(T)) {
+                    throw std::runtime_error("Binary data truncated");
+                }
+                value.resize(size);
+                reader.readBytes(value.data(), value.size() * sizeof(T));
+            } else {
+                value.clear();
+                value.reserve(std::min<std::uint64_t>(size, reader.remaining()));
+                for (std::uint64_t i = 0; i < size; ++i) {
+                    T item{};
+                    BinaryTraits<T>::decode(reader, item);
+                    value.push_back(std::move(item));
+                }
+            }
+        }
+    };
+
+    template <typename T, std::size_t N>
+        requires BinaryTraits<T>::supported
+    struct BinaryTraits<std::array<T, N>> {
+        static constexpr bool supported = true;
+
+        static void encode(BinaryWriter &writer, const std::array<T, N> &value) {
+            if constexpr (detail::is_binary_raw_v<T>) {
+                writer.writeBytes(value.data(), N * sizeof(T));
+            } else {
+                for (const auto &item : value) {
+                    BinaryTraits<T>::encode(writer, item);
+                }
+            }
+        }
+
+        static void decode(BinaryReader &reader, std::array<T, N> &value) {
+            if constexpr (detail::is_binary_raw_v<T>) {
+                reader.readBytes(value.data(), N * sizeof(T));
+            } else {
+                for (auto &item : value) {
+                    BinaryTraits<T>::decode(reader, item);
+                }
+            }
+        }
+    };
+
+    // ------------------------------------------------
+
+    namespace detail {
+
+        [[noreturn]] inline void throwNotSerializable(const TypeInfo   &type_info,
+                                                      const MemberInfo &member) {
+            throw std::runtime_error("Member '" + type_info.class_name + "::" + member.name +
+                                     "' of type '" + member.type_name +
+                                     "' is not binary serializable");
+        }
+
+        // Number of members from `first` forming a contiguous run of raw members
+        inline std::size_t rawRunLength(const std::vector<const MemberInfo *> &members,
+                                        std::size_t first, std::size_t &bytes) {
+            const MemberInfo *member = members[first];
+            if (!member->binary_raw || member->offset == MemberInfo::no_offset) {
+                return 0;
+            }
+            std::size_t count = 1;
+            bytes             = member->size;
+            while (first + count < members.size()) {
+                const MemberInfo *next = members[first + count];
+                if (!next->binary_raw || next->offset != member->offset + bytes) {
+                    break;
+                }
+                bytes += next->size;
+                ++count;
+            }
+            return count;
+        }
+
+        inline constexpr std::uint8_t binary_magic[4] = {'R', 'S', 'T', 'B'};
+
+    } // namespace detail
+
+    inline std::uint64_t binarySchemaHash(const TypeInfo &type_info) {
+        std::uint64_t hash = 14695981039346656037ull; // FNV-1a
+        auto          add  = [&hash](const std::string &text) {
+            for (const char c : text) {
+                hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+            }
+            hash = (hash ^ 0xff) * 1099511628211ull; // separator
+        };
+        add(type_info.class_name);
+        for (const auto *member : type_info.getMembersInOrder()) {
+            add(member->name);
+            add(member->type_name);
+        }
+        return hash;
+    }
+
+    inline void writeBinaryHeader(const TypeInfo &type_info, BinaryWriter &writer) {
+        writer.writeBytes(detail::binary_magic, sizeof(detail::binary_magic));
+        writer.write(binary_format_version);
+        writer.write(binarySchemaHash(type_info));
+    }
+
+    inline void readBinaryHeader(const TypeInfo &type_info, BinaryReader &reader) {
+        std::uint8_t magic[sizeof(detail::binary_magic)];
+        if (reader.remaining() < sizeof(magic)) {
+            throw std::runtime_error("Not rosetta binary data");
+        }
+        reader.readBytes(magic, sizeof(magic));
+        if (!std::equal(std::begin(magic), std::end(magic), std::begin(detail::binary_magic))) {
+            throw std::runtime_error("Not rosetta binary data");
+        }
+        const auto version = reader.read<std::uint16_t>();
+        if (version != binary_format_version) {
+            throw std::runtime_error("Unsupported binary format version " +
+                                     std::to_string(version));
+        }
+        if (reader.read<std::uint64_t>() != binarySchemaHash(type_info)) {
+            throw std::runtime_error("Binary data was written for another layout of '" +
+                                     type_info.class_name + "'");
+        }
+    }
+
+    inline void encodeObject(const TypeInfo &type_info, const void *obj, BinaryWriter &writer) {
+        const auto &members = type_info.getMembersInOrder();
+        const auto *base    = static_cast<const std::uint8_t *>(obj);
+        for (std::size_t i = 0; i < members.size();) {
+            std::size_t       bytes = 0;
+            const std::size_t run   = detail::rawRunLength(members, i, bytes);
+            if (run > 0) {
+                writer.writeBytes(base + members[i]->offset, bytes);
+                i += run;
+                continue;
+            }
+            if (!members[i]->encode) {
+                detail::throwNotSerializable(type_info, *members[i]);
+            }
+            members[i]->encode(obj, writer);
+            ++i;
+        }
+    }
+
+    inline void decodeObject(const TypeInfo &type_info, void *obj, BinaryReader &reader) {
+        const auto &members = type_info.getMembersInOrder();
+        auto       *base    = static_cast<std::uint8_t *>(obj);
+        // Property subscribers need the old value of each member: no raw runs
+        const bool subscribed = type_info.hasPropertySubscribers(obj);
+        for (std::size_t i = 0; i < members.size();) {
+            std::size_t       bytes = 0;
+            const std::size_t run   = subscribed ? 0 : detail::rawRunLength(members, i, bytes);
+            if (run > 0) {
+                reader.readBytes(base + members[i]->offset, bytes);
+                for (const std::size_t end = i + run; i < end; ++i) {
+                    type_info.notifyMemberChanged(obj, *members[i]);
+                }
+                continue;
+            }
+            const MemberInfo &member = *members[i];
+            if (!member.decode) {
+                detail::throwNotSerializable(type_info, member);
+            }
+            detail::decodeMember(type_info, obj, member, [&] { member.decode(obj, reader); });
+            ++i;
+        }
+    }
+
+    inline bool isBinarySerializable(const TypeInfo &type_info) {
+        for (const auto *member : type_info.getMembersInOrder()) {
+            if (!member->encode || !member->decode) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+} // namespace rosetta
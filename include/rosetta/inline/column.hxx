@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+
+namespace rosetta {
+
+    template <typename Class, typename M>
+    inline TypedColumn<Class, M>::TypedColumn(M Class::*member) : member_(member) {}
+
+    template <typename Class, typename M>
+    inline const M &TypedColumn<Class, M>::value(const Cell &cell) {
+        if constexpr (std::is_same_v<M, bool>) {
+            return cell.value;
+        } else {
+            return cell;
+        }
+    }
+
+    template <typename Class, typename M> inline M &TypedColumn<Class, M>::value(Cell &cell) {
+        if constexpr (std::is_same_v<M, bool>) {
+            return cell.value;
+        } else {
+            return cell;
+        }
+    }
+
+    template <typename Class, typename M>
+    inline void TypedColumn<Class, M>::erase(std::size_t row) {
+        values_.erase(values_.begin() + static_cast<std::ptrdiff_t>(row));
+    }
+
+    template <typename Class, typename M>
+    inline std::optional<NumericType> TypedColumn<Class, M>::numericType() const {
+        if constexpr (is_vectorizable_v<M>) {
+            return numericTypeOf<M>();
+        } else {
+            return std::nullopt;
+        }
+    }
+
+    template <typename Class, typename M>
+    inline void TypedColumn<Class, M>::pushFrom(const void *obj) {
+        const M &member = static_cast<const Class *>(obj)->*member_;
+        if constexpr (std::is_same_v<M, bool>) {
+            values_.push_back(Cell{member});
+        } else {
+            values_.push_back(member);
+        }
+    }
+
+    template <typename Class, typename M>
+    inline void TypedColumn<Class, M>::storeFrom(std::size_t row, const void *obj) {
+        value(values_[row]) = static_cast<const Class *>(obj)->*member_;
+    }
+
+    template <typename Class, typename M>
+    inline void TypedColumn<Class, M>::loadInto(std::size_t row, void *obj) const {
+        static_cast<Class *>(obj)->*member_ = value(values_[row]);
+    }
+
+    template <typename Class, typename M>
+    inline Arg TypedColumn<Class, M>::get(std::size_t row) const {
+        return Arg{value(values_[row])};
+    }
+
+    template <typename Class, typename M>
+    inline void TypedColumn<Class, M>::set(std::size_t row, const Arg &arg) {
+        value(values_[row]) = std::any_cast<const M &>(arg);
+    }
+
+    template <typename Class, typename M>
+    inline std::unique_ptr<ColumnStorage> TypedColumn<Class, M>::clone() const {
+        return std::make_unique<TypedColumn>(*this);
+    }
+
+} // namespace rosetta
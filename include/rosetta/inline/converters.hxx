@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <atomic>
+#include <stdexcept>
+
+namespace rosetta {
+
+    namespace detail {
+
+        template <typename T> struct is_std_vector : std::false_type {};
+        template <typename T, typename A>
+        struct is_std_vector<std::vector<T, A>> : std::true_type {};
+
+        template <typename Backend>
+        concept ScriptBackendWithContext = requires { typename Backend::Context; };
+
+        // nullptr if not registered (yet); cached once found (EnumInfo entries are
+        // never moved)
+        template <typename EnumType> inline const EnumInfo *findEnumInfo() {
+            static std::atomic<const EnumInfo *> cached{nullptr};
+            const EnumInfo *info = cached.load(std::memory_order_acquire);
+            if (!info) {
+                info = EnumRegistry::instance().getEnumInfo<EnumType>();
+                if (info) {
+                    cached.store(info, std::memory_order_release);
+                }
+            }
+            return info;
+        }
+
+        template <typename EnumType> inline const EnumInfo &enumInfoFor() {
+            const EnumInfo *info = findEnumInfo<EnumType>();
+            if (!info) {
+                throw std::runtime_error("Enum not registered: " + getTypeName<EnumType>());
+            }
+            return *info;
+        }
+
+        // Values of unregistered enums are not checked
+        template <typename EnumType> inline EnumType checkedEnumValue(int64_t value) {
+            const EnumInfo *info = findEnumInfo<EnumType>();
+            if (info && !info->hasValue(value)) {
+                throw std::runtime_error("Invalid value " + std::to_string(value) +
+                                         " for enum '" + info->name + "'");
+            }
+            using Underlying = std::underlying_type_t<EnumType>;
+            return static_cast<EnumType>(static_cast<Underlying>(value));
+        }
+
+    } // namespace detail
+
+    template <typename T> constexpr ValueKind valueKindOf() {
+        using BaseType = std::remove_cv_t<std::remove_reference_t<T>>;
+
+        if constexpr (std::is_same_v<BaseType, bool>) {
+            return ValueKind::Bool;
+        } else if constexpr (std::is_enum_v<BaseType>) {
+            return ValueKind::Enum;
+        } else if constexpr (std::is_integral_v<BaseType>) {
+            return std::is_signed_v<BaseType> ? ValueKind::Integer : ValueKind::Unsigned;
+        } else if constexpr (std::is_floating_point_v<BaseType>) {
+            return ValueKind::Float;
+        } else if constexpr (std::is_same_v<BaseType, std::string>) {
+            return ValueKind::String;
+        } else if constexpr (detail::is_std_vector<BaseType>::value) {
+            return is_numeric_v<typename BaseType::value_type> ? ValueKind::NumericVector
+                                                               : ValueKind::Vector;
+        } else if constexpr (std::is_base_of_v<Introspectable, BaseType>) {
+            return ValueKind::Object;
+        } else {
+            return ValueKind::Other;
+        }
+    }
+
+    template <typename Backend, typename T> inline const ConverterEntry<Backend> &converterFor() {
+        static_assert(has_script_converter_v<Backend, T>,
+                      "No ScriptConverter for this type and backend");
+        using Converter = ScriptConverter<Backend, T>;
+
+        static const ConverterEntry<Backend> entry = [] {
+            ConverterEntry<Backend> result;
+            if constexpr (detail::ScriptBackendWithContext<Backend>) {
+                result.to_script = [](typename Backend::Context context,
+                                      const std::any &value) -> typename Backend::Value {
+                    return Converter::to(context, std::any_cast<const T &>(value));
+                };
+            } else {
+                result.to_script = [](const std::any &value) -> typename Backend::Value {
+                    return Converter::to(std::any_cast<const T &>(value));
+                };
+            }
+            result.from_script = [](typename Backend::Input input) -> std::any {
+                return Converter::from(input);
+            };
+            result.kind = valueKindOf<T>();
+            result.type = &typeid(T);
+            return result;
+        }();
+        return entry;
+    }
+
+    namespace detail {
+
+        template <typename Backend, typename Add, typename... Ts>
+        inline void forEachConverter(Add &add, value_type_list<Ts...>) {
+            (
+                [&add] {
+                    if constexpr (has_script_converter_v<Backend, Ts>) {
+                        add(getTypeName<Ts>(), converterFor<Backend, Ts>());
+                    }
+                }(),
+                ...);
+        }
+
+    } // namespace detail
+
+    template <typename Backend, typename Add> inline void forEachBuiltinConverter(Add &&add) {
+        detail::forEachConverter<Backend>(add, BuiltinValueTypes{});
+    }
+
+} // namespace rosetta
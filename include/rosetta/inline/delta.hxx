@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace rosetta {
+
+    namespace detail {
+
+        inline constexpr std::uint8_t delta_magic[4] = {'R', 'S', 'T', 'D'};
+
+    } // namespace detail
+
+    inline void DirtyBits::set(std::size_t slot) {
+        if (slot / 64 >= words_.size()) {
+            words_.resize(slot / 64 + 1, 0);
+        }
+        words_[slot / 64] |= std::uint64_t(1) << (slot % 64);
+    }
+
+    inline void DirtyBits::reset(std::size_t slot) {
+        if (slot / 64 < words_.size()) {
+            words_[slot / 64] &= ~(std::uint64_t(1) << (slot % 64));
+        }
+    }
+
+    inline bool DirtyBits::test(std::size_t slot) const {
+        return slot / 64 < words_.size() && (words_[slot / 64] >> (slot % 64)) & 1;
+    }
+
+    inline bool DirtyBits::any() const {
+        return std::any_of(words_.begin(), words_.end(), [](std::uint64_t word) { return word; });
+    }
+
+    inline void DirtyBits::clear() { std::fill(words_.begin(), words_.end(), 0); }
+
+    inline std::vector<std::size_t> DirtyBits::slots() const {
+        std::vector<std::size_t> result;
+        for (std::size_t w = 0; w < words_.size(); ++w) {
+            for (std::uint64_t word = words_[w]; word; word &= word - 1) {
+                result.push_back(w * 64 + static_cast<std::size_t>(std::countr_zero(word)));
+            }
+        }
+        return result;
+    }
+
+    // ------------------------------------------------
+
+    inline void encodeDelta(const TypeInfo &type_info, const void *obj,
+                            const std::vector<std::size_t> &slots, BinaryWriter &writer) {
+        const auto &members = type_info.getMembersInOrder();
+        // Checked before writing anything, so that no partial delta is left
+        for (const std::size_t slot : slots) {
+            const MemberInfo *member = members.at(slot);
+            if (!member->encode) {
+                detail::throwNotSerializable(type_info, *member);
+            }
+        }
+        writer.writeBytes(detail::delta_magic, sizeof(detail::delta_magic));
+        writer.write(binary_format_version);
+        writer.write(binarySchemaHash(type_info));
+        writer.write(static_cast<std::uint32_t>(slots.size()));
+        for (const std::size_t slot : slots) {
+            writer.write(static_cast<std::uint32_t>(slot));
+            members[slot]->encode(obj, writer);
+        }
+    }
+
+    namespace detail {
+
+        // Decode the delta at the position of `reader` into `obj`, saving the
+        // value of each member in `previous` before it is written
+        inline void readDelta(const TypeInfo &type_info, void *obj, BinaryReader &reader,
+                              std::vector<std::pair<const MemberInfo *, Arg>> &previous) {
+            std::uint8_t magic[sizeof(delta_magic)];
+            if (reader.remaining() < sizeof(magic)) {
+                throw std::runtime_error("Not rosetta delta data");
+            }
+            reader.readBytes(magic, sizeof(magic));
+            if (!std::equal(std::begin(magic), std::end(magic), std::begin(delta_magic))) {
+                throw std::runtime_error("Not rosetta delta data");
+            }
+            const auto version = reader.read<std::uint16_t>();
+            if (version != binary_format_version) {
+                throw std::runtime_error("Unsupported binary format version " +
+                                         std::to_string(version));
+            }
+            if (reader.read<std::uint64_t>() != binarySchemaHash(type_info)) {
+                throw std::runtime_error("Delta was written for another layout of '" +
+                                         type_info.class_name + "'");
+            }
+
+            const auto &members = type_info.getMembersInOrder();
+            const auto  count   = reader.read<std::uint32_t>();
+            for (std::uint32_t i = 0; i < count; ++i) {
+                const auto slot = reader.read<std::uint32_t>();
+                if (slot >= members.size() || !members[slot]->decode) {
+                    throw std::runtime_error("Invalid member slot " + std::to_string(slot) +
+                                             " in a delta of '" + type_info.class_name + "'");
+                }
+                const MemberInfo &member = *members[slot];
+                previous.emplace_back(&member, member.getter(obj));
+                decodeMember(type_info, obj, member, [&] { member.decode(obj, reader); });
+            }
+        }
+
+    } // namespace detail
+
+    inline void applyDelta(const TypeInfo &type_info, void *obj, const void *data,
+                           std::size_t size) {
+        BinaryReader                                    reader(data, size);
+        std::vector<std::pair<const MemberInfo *, Arg>> previous;
+        try {
+            while (reader.remaining() > 0) { // deltas appended by collectDelta
+                detail::readDelta(type_info, obj, reader, previous);
+            }
+        } catch (...) {
+            // Restore the members already written, the most recent first
+            for (auto it = previous.rbegin(); it != previous.rend(); ++it) {
+                if (it->first->setter) {
+                    it->first->setter(obj, it->second);
+                }
+            }
+            throw;
+        }
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void applyDelta(T &object, const std::vector<std::uint8_t> &delta) {
+        applyDelta(T::getStaticTypeInfo(), std::addressof(object), delta.data(), delta.size());
+    }
+
+    // ------------------------------------------------
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline DirtyTracker<T>::DirtyTracker() {
+        const auto &members = getTypeInfo().getMembersInOrder();
+        for (std::size_t slot = 0; slot < members.size(); ++slot) {
+            slots_.emplace(members[slot], slot);
+        }
+        observer_ = T::getStaticTypeInfo().addMemberObserver(
+            [this](void *object, const MemberInfo &member) { memberChanged(object, member); });
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline DirtyTracker<T>::~DirtyTracker() {
+        T::getStaticTypeInfo().removeMemberObserver(observer_);
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void DirtyTracker<T>::track(const T &object) {
+        objects_.try_emplace(&object);
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void DirtyTracker<T>::untrack(const T &object) {
+        objects_.erase(&object);
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void DirtyTracker<T>::clear() {
+        objects_.clear();
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void DirtyTracker<T>::markDirty(const T &object, std::string_view member) {
+        const std::size_t slot  = slotOf(member);
+        const auto        found = objects_.find(&object);
+        if (found != objects_.end()) {
+            found->second.set(slot);
+        }
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void DirtyTracker<T>::markAllDirty(const T &object) {
+        const auto found = objects_.find(&object);
+        if (found != objects_.end()) {
+            for (std::size_t slot = 0; slot < slots_.size(); ++slot) {
+                found->second.set(slot);
+            }
+        }
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline bool DirtyTracker<T>::isDirty(const T &object) const {
+        const auto found = objects_.find(&object);
+        return found != objects_.end() && found->second.any();
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline bool DirtyTracker<T>::isDirty(const T &object, std::string_view member) const {
+        const std::size_t slot  = slotOf(member);
+        const auto        found = objects_.find(&object);
+        return found != objects_.end() && found->second.test(slot);
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline std::vector<std::string> DirtyTracker<T>::dirtyMembers(const T &object) const {
+        std::vector<std::string> names;
+        const auto               found = objects_.find(&object);
+        if (found != objects_.end()) {
+            const auto &members = getTypeInfo().getMembersInOrder();
+            for (const std::size_t slot : found->second.slots()) {
+                names.push_back(members[slot]->name);
+            }
+        }
+        return names;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline std::vector<const T *> DirtyTracker<T>::dirtyObjects() const {
+        std::vector<const T *> result;
+        for (const auto &[object, bits] : objects_) {
+            if (bits.any()) {
+                result.push_back(object);
+            }
+        }
+        return result;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void DirtyTracker<T>::clean(const T &object) {
+        const auto found = objects_.find(&object);
+        if (found != objects_.end()) {
+            found->second.clear();
+        }
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline std::vector<std::uint8_t> DirtyTracker<T>::collectDelta(const T &object) {
+        std::vector<std::uint8_t> buffer;
+        collectDelta(object, buffer);
+        return buffer;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline bool DirtyTracker<T>::collectDelta(const T &object, std::vector<std::uint8_t> &buffer) {
+        const auto found = objects_.find(&object);
+        if (found == objects_.end() || !found->second.any()) {
+            return false;
+        }
+        // A member encoder may still throw: drop the partial delta
+        const std::size_t size = buffer.size();
+        try {
+            BinaryWriter writer(buffer);
+            encodeDelta(getTypeInfo(), std::addressof(object), found->second.slots(), writer);
+        } catch (...) {
+            buffer.resize(size);
+            throw;
+        }
+        found->second.clear();
+        return true;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline std::size_t DirtyTracker<T>::slotOf(std::string_view member) const {
+        const MemberInfo *info = getTypeInfo().getMember(std::string(member));
+        if (!info) {
+            throw std::runtime_error("No member '" + std::string(member) + "' in " +
+                                     getTypeInfo().class_name);
+        }
+        return slots_.at(info);
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void DirtyTracker<T>::memberChanged(void *object, const MemberInfo &member) {
+        const auto found = objects_.find(static_cast<const T *>(object));
+        if (found != objects_.end()) {
+            found->second.set(slots_.at(&member));
+        }
+    }
+
+} // namespace rosetta
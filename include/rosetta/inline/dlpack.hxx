@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <stdexcept>
+#include <string>
+
+namespace rosetta {
+
+    namespace detail {
+
+        template <typename E>
+        inline constexpr bool is_dlpack_number_v =
+            std::is_arithmetic_v<E> && !std::is_same_v<E, bool> &&
+            !std::is_same_v<E, long double>;
+
+        // Shape of the tensor and the owner of its data (the manager_ctx)
+        struct DLPackContext {
+            std::int64_t                shape[1];
+            std::shared_ptr<const void> owner;
+        };
+
+        inline void deleteDLPackTensor(DLManagedTensor *tensor) {
+            delete static_cast<DLPackContext *>(tensor->manager_ctx);
+            delete tensor;
+        }
+
+    } // namespace detail
+
+    template <typename E> constexpr DLDataType dlpackDataType() {
+        static_assert(detail::is_dlpack_number_v<E>, "No DLPack type for this type");
+        const auto code = std::is_floating_point_v<E> ? kDLFloat
+                          : std::is_signed_v<E>       ? kDLInt
+                                                      : kDLUInt;
+        return DLDataType{static_cast<std::uint8_t>(code), static_cast<std::uint8_t>(sizeof(E) * 8),
+                          1};
+    }
+
+    template <typename E>
+        requires detail::is_dlpack_number_v<E>
+    struct DLPackTraits<std::vector<E>> {
+        static constexpr bool supported = true;
+
+        static DLPackBuffer buffer(void *value) {
+            auto &vector = *static_cast<std::vector<E> *>(value);
+            return {vector.data(), static_cast<std::int64_t>(vector.size()), dlpackDataType<E>()};
+        }
+    };
+
+    template <typename E, std::size_t N>
+        requires detail::is_dlpack_number_v<E>
+    struct DLPackTraits<std::array<E, N>> {
+        static constexpr bool supported = true;
+
+        static DLPackBuffer buffer(void *value) {
+            auto &array = *static_cast<std::array<E, N> *>(value);
+            return {array.data(), static_cast<std::int64_t>(N), dlpackDataType<E>()};
+        }
+    };
+
+    inline DLManagedTensor *toDLPack(const TypeInfo &type_info, void *object,
+                                     std::string_view member_name,
+                                     std::shared_ptr<const void> owner) {
+        const MemberInfo *member = type_info.getMember(std::string(member_name));
+        if (!member) {
+            throw std::runtime_error("No member '" + std::string(member_name) + "' in " +
+                                     type_info.class_name);
+        }
+        if (!member->dlpack_buffer) {
+            throw std::runtime_error("Member '" + member->name + "' of type " + member->type_name +
+                                     " is not a numeric vector or array");
+        }
+        const DLPackBuffer buffer = member->dlpack_buffer(member->address(object));
+
+        auto context      = std::make_unique<detail::DLPackContext>();
+        context->shape[0] = buffer.length;
+        context->owner    = std::move(owner);
+
+        auto *tensor                  = new DLManagedTensor{};
+        tensor->dl_tensor.data        = buffer.data;
+        tensor->dl_tensor.device      = DLDevice{kDLCPU, 0};
+        tensor->dl_tensor.ndim        = 1;
+        tensor->dl_tensor.dtype       = buffer.dtype;
+        tensor->dl_tensor.shape       = context->shape;
+        tensor->dl_tensor.strides     = nullptr;
+        tensor->dl_tensor.byte_offset = 0;
+        tensor->manager_ctx           = context.release();
+        tensor->deleter               = &detail::deleteDLPackTensor;
+        return tensor;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline DLManagedTensor *toDLPack(T &object, std::string_view member) {
+        return toDLPack(T::getStaticTypeInfo(), std::addressof(object), member);
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline DLManagedTensor *toDLPack(std::shared_ptr<T> object, std::string_view member) {
+        T *address = object.get();
+        return toDLPack(T::getStaticTypeInfo(), address, member, std::move(object));
+    }
+
+} // namespace rosetta
@@ -2,8 +2,339 @@
  * Copyright (c) 2025-now fmaerten@gmail.com
  * LGPL v3 license
  */
+#include <algorithm>
+#include <bit>
+#include <mutex>
+
 namespace rosetta {
 
+    namespace detail {
+
+        inline uint64_t enumNameHash(std::string_view name) {
+            uint64_t hash = 14695981039346656037ull; // FNV-1a
+            for (const char c : name) {
+                hash = (hash ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+            }
+            return hash;
+        }
+
+        // Derive an independent hash from the name hash (splitmix64 finalizer)
+        inline uint64_t enumSeededHash(uint64_t hash, uint32_t seed) {
+            hash += 0x9e3779b97f4a7c15ull * (static_cast<uint64_t>(seed) + 1);
+            hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ull;
+            hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebull;
+            return hash ^ (hash >> 31);
+        }
+
+        inline std::string_view enumTrim(std::string_view text) {
+            while (!text.empty() && text.front() == ' ') {
+                text.remove_prefix(1);
+            }
+            while (!text.empty() && text.back() == ' ') {
+                text.remove_suffix(1);
+            }
+            return text;
+        }
+
+    } // namespace detail
+
+    // ------------------------------------------------
+
+    inline void EnumInfo::addValue(const std::string &value_name, int64_t value) {
+        // A name registered twice keeps its last value
+        if (const auto *existing = findValue(value_name)) {
+            values[static_cast<size_t>(existing - values.data())].value = value;
+            all_bits_ = 0;
+            for (const auto &info : values) {
+                all_bits_ |= info.value;
+            }
+            rebuildValueTable();
+            return;
+        }
+
+        values.emplace_back(value_name, value);
+        all_bits_ |= value;
+        indexValue(values.size() - 1);
+        indexName(values.size() - 1);
+    }
+
+    inline void EnumInfo::setFlags(bool flags) { flags_ = flags; }
+
+    // ------------------------------------------------
+    // By value
+
+    inline void EnumInfo::indexValue(size_t index) {
+        const int64_t value = values[index].value;
+        const auto    entry = static_cast<int32_t>(index);
+
+        if (!dense_.empty()) {
+            const uint64_t offset =
+                static_cast<uint64_t>(value) - static_cast<uint64_t>(min_value_);
+            if (offset < dense_.size()) {
+                dense_[static_cast<size_t>(offset)] = entry; // new value or alias
+                return;
+            }
+            if (offset == dense_.size()) {
+                dense_.push_back(entry); // the common case: values declared in order
+                return;
+            }
+        } else if (!sorted_.empty()) {
+            auto it = std::lower_bound(
+                sorted_.begin(), sorted_.end(), value,
+                [](const auto &item, int64_t v) { return item.first < v; });
+            if (it != sorted_.end() && it->first == value) {
+                it->second = entry;
+            } else {
+                sorted_.insert(it, {value, entry});
+            }
+            return;
+        }
+        rebuildValueTable();
+    }
+
+    inline void EnumInfo::rebuildValueTable() {
+        dense_.clear();
+        sorted_.clear();
+        if (values.empty()) {
+            return;
+        }
+
+        const auto [min_it, max_it] = std::minmax_element(
+            values.begin(), values.end(),
+            [](const EnumValueInfo &a, const EnumValueInfo &b) { return a.value < b.value; });
+        const uint64_t span =
+            static_cast<uint64_t>(max_it->value) - static_cast<uint64_t>(min_it->value);
+
+        // Dense when at most about half of the table is holes. Aliases (same value):
+        // the last registered name wins
+        if (span < 2 * values.size() + 8) {
+            min_value_ = min_it->value;
+            dense_.assign(static_cast<size_t>(span) + 1, -1);
+            for (size_t i = 0; i < values.size(); ++i) {
+                dense_[static_cast<size_t>(values[i].value - min_value_)] = static_cast<int32_t>(i);
+            }
+            return;
+        }
+
+        for (size_t i = 0; i < values.size(); ++i) {
+            sorted_.emplace_back(values[i].value, static_cast<int32_t>(i));
+        }
+        std::stable_sort(sorted_.begin(), sorted_.end(),
+                         [](const auto &a, const auto &b) { return a.first < b.first; });
+        std::vector<std::pair<int64_t, int32_t>> unique;
+        for (const auto &entry : sorted_) {
+            if (!unique.empty() && unique.back().first == entry.first) {
+                unique.back().second = entry.second;
+            } else {
+                unique.push_back(entry);
+            }
+        }
+        sorted_ = std::move(unique);
+    }
+
+    // ------------------------------------------------
+    // By name
+
+    inline size_t EnumInfo::nameSlot(uint32_t index, uint32_t seed) const {
+        return detail::enumSeededHash(hashes_[index], seed) & (slots_.size() - 1);
+    }
+
+    inline bool EnumInfo::placeBucket(size_t bucket) {
+        const auto         &names = buckets_[bucket];
+        std::vector<size_t> candidates;
+        candidates.reserve(names.size());
+
+        // First seed sending all the names of the bucket to distinct free slots
+        for (uint32_t seed = 1; seed < 4096; ++seed) {
+            candidates.clear();
+            for (const uint32_t index : names) {
+                const size_t slot = nameSlot(index, seed);
+                if (slots_[slot] != -1 ||
+                    std::find(candidates.begin(), candidates.end(), slot) != candidates.end()) {
+                    break;
+                }
+                candidates.push_back(slot);
+            }
+            if (candidates.size() == names.size()) {
+                seeds_[bucket] = seed;
+                for (size_t k = 0; k < names.size(); ++k) {
+                    slots_[candidates[k]] = static_cast<int32_t>(names[k]);
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    inline void EnumInfo::indexName(size_t index) {
+        hashes_.push_back(detail::enumNameHash(values[index].name));
+
+        // Slots at most 80% full, otherwise rebuild with twice the room
+        if (slots_.empty() || 5 * values.size() > 4 * slots_.size()) {
+            rebuildNameTable();
+            return;
+        }
+
+        // Re-place the bucket of the new name only
+        const size_t bucket = detail::enumSeededHash(hashes_[index], 0) & (buckets_.size() - 1);
+        for (const uint32_t other : buckets_[bucket]) {
+            slots_[nameSlot(other, seeds_[bucket])] = -1;
+        }
+        buckets_[bucket].push_back(static_cast<uint32_t>(index));
+        if (!placeBucket(bucket)) {
+            rebuildNameTable();
+        }
+    }
+
+    inline void EnumInfo::rebuildNameTable() {
+        const size_t count        = values.size();
+        const size_t bucket_count = std::bit_ceil(std::max<size_t>(1, count / 2));
+        size_t       slot_count   = std::bit_ceil(2 * count + 1);
+
+        buckets_.assign(bucket_count, {});
+        for (size_t i = 0; i < count; ++i) {
+            const size_t bucket = detail::enumSeededHash(hashes_[i], 0) & (bucket_count - 1);
+            buckets_[bucket].push_back(static_cast<uint32_t>(i));
+        }
+
+        // Largest buckets first (hash and displace)
+        std::vector<size_t> order(bucket_count);
+        for (size_t b = 0; b < bucket_count; ++b) {
+            order[b] = b;
+        }
+        std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+            return buckets_[a].size() > buckets_[b].size();
+        });
+
+        for (;;) {
+            seeds_.assign(bucket_count, 0);
+            slots_.assign(slot_count, -1);
+            bool placed = true;
+            for (const size_t bucket : order) {
+                if (!buckets_[bucket].empty() && !placeBucket(bucket)) {
+                    placed = false;
+                    break;
+                }
+            }
+            if (placed) {
+                return;
+            }
+            slot_count *= 2; // unlucky: retry with more room
+        }
+    }
+
+    inline const EnumValueInfo *EnumInfo::findValue(std::string_view value_name) const {
+        if (slots_.empty()) {
+            return nullptr;
+        }
+        const uint64_t hash = detail::enumNameHash(value_name);
+        const uint32_t seed = seeds_[detail::enumSeededHash(hash, 0) & (buckets_.size() - 1)];
+        const int32_t  index = slots_[detail::enumSeededHash(hash, seed) & (slots_.size() - 1)];
+        if (index < 0 || values[static_cast<size_t>(index)].name != value_name) {
+            return nullptr;
+        }
+        return &values[static_cast<size_t>(index)];
+    }
+
+    inline const EnumValueInfo *EnumInfo::findName(int64_t value) const {
+        int32_t index = -1;
+        if (!dense_.empty()) {
+            const uint64_t offset =
+                static_cast<uint64_t>(value) - static_cast<uint64_t>(min_value_);
+            if (offset < dense_.size()) {
+                index = dense_[static_cast<size_t>(offset)];
+            }
+        } else {
+            auto it = std::lower_bound(
+                sorted_.begin(), sorted_.end(), value,
+                [](const auto &entry, int64_t v) { return entry.first < v; });
+            if (it != sorted_.end() && it->first == value) {
+                index = it->second;
+            }
+        }
+        return index >= 0 ? &values[static_cast<size_t>(index)] : nullptr;
+    }
+
+    inline bool EnumInfo::hasValue(std::string_view value_name) const {
+        if (flags_ && value_name.find('|') != std::string_view::npos) {
+            try {
+                getValue(value_name);
+                return true;
+            } catch (const std::runtime_error &) {
+                return false;
+            }
+        }
+        return findValue(value_name) != nullptr;
+    }
+
+    inline bool EnumInfo::hasValue(int64_t value) const {
+        if (flags_) {
+            return (value & ~all_bits_) == 0;
+        }
+        return findName(value) != nullptr;
+    }
+
+    inline int64_t EnumInfo::getValue(std::string_view value_name) const {
+        if (const auto *info = findValue(value_name)) {
+            return info->value;
+        }
+
+        if (flags_) {
+            int64_t          result = 0;
+            std::string_view rest   = value_name;
+            for (;;) {
+                const size_t     bar  = rest.find('|');
+                std::string_view part = detail::enumTrim(rest.substr(0, bar));
+                const auto      *info = findValue(part);
+                if (!info) {
+                    break;
+                }
+                result |= info->value;
+                if (bar == std::string_view::npos) {
+                    return result;
+                }
+                rest.remove_prefix(bar + 1);
+            }
+        }
+
+        throw std::runtime_error("Enum value '" + std::string(value_name) +
+                                 "' not found in enum '" + name + "'");
+    }
+
+    inline const std::string &EnumInfo::getName(int64_t value) const {
+        if (const auto *info = findName(value)) {
+            return info->name;
+        }
+        throw std::runtime_error("Enum value " + std::to_string(value) + " not found in enum '" +
+                                 name + "'");
+    }
+
+    inline std::string EnumInfo::format(int64_t value) const {
+        if (const auto *info = findName(value)) {
+            return info->name;
+        }
+        if (!flags_) {
+            return std::to_string(value);
+        }
+
+        // Single bits first (in declaration order), then what is left as a number
+        std::string result;
+        int64_t     rest = value;
+        for (const auto &info : values) {
+            if (info.value != 0 && std::has_single_bit(static_cast<uint64_t>(info.value)) &&
+                (rest & info.value) == info.value) {
+                result += result.empty() ? info.name : "|" + info.name;
+                rest &= ~info.value;
+            }
+        }
+        if (rest != 0 || result.empty()) {
+            result += (result.empty() ? "" : "|") + std::to_string(rest);
+        }
+        return result;
+    }
+
+    // ------------------------------------------------
+
     inline EnumRegistry &EnumRegistry::instance() {
         static EnumRegistry registry;
         return registry;
@@ -13,12 +344,13 @@ namespace rosetta {
     inline void EnumRegistry::registerEnum(const std::string &enum_name) {
         static_assert(std::is_enum_v<EnumType>, "Type must be an enum");
 
-        std::type_index type_idx(typeid(EnumType));
+        std::type_index  type_idx(typeid(EnumType));
+        std::unique_lock lock(mutex);
 
         // Create new EnumInfo if not already registered
         if (enums_by_type.find(type_idx) == enums_by_type.end()) {
             enums_by_type.emplace(type_idx, EnumInfo(enum_name));
-            enums_by_name[enum_name] = type_idx;
+            enums_by_name.insert_or_assign(enum_name, type_idx);
         }
     }
 
@@ -26,8 +358,9 @@ namespace rosetta {
     inline void EnumRegistry::addEnumValue(const std::string &value_name, EnumType value) {
         static_assert(std::is_enum_v<EnumType>, "Type must be an enum");
 
-        std::type_index type_idx(typeid(EnumType));
-        auto            it = enums_by_type.find(type_idx);
+        std::type_index  type_idx(typeid(EnumType));
+        std::unique_lock lock(mutex);
+        auto             it = enums_by_type.find(type_idx);
 
         if (it != enums_by_type.end()) {
             // Cast enum to underlying type
@@ -37,31 +370,46 @@ namespace rosetta {
         }
     }
 
+    template <typename EnumType> inline void EnumRegistry::setFlags(bool flags) {
+        static_assert(std::is_enum_v<EnumType>, "Type must be an enum");
+
+        std::unique_lock lock(mutex);
+        auto             it = enums_by_type.find(std::type_index(typeid(EnumType)));
+        if (it != enums_by_type.end()) {
+            it->second.setFlags(flags);
+        }
+    }
+
     template <typename EnumType> inline const EnumInfo *EnumRegistry::getEnumInfo() const {
         static_assert(std::is_enum_v<EnumType>, "Type must be an enum");
 
-        std::type_index type_idx(typeid(EnumType));
-        auto            it = enums_by_type.find(type_idx);
+        std::type_index  type_idx(typeid(EnumType));
+        std::shared_lock lock(mutex);
+        auto             it = enums_by_type.find(type_idx);
 
         return (it != enums_by_type.end()) ? &it->second : nullptr;
     }
 
     inline const EnumInfo *EnumRegistry::getEnumInfo(const std::string &enum_name) const {
-        auto it = enums_by_name.find(enum_name);
-        if (it != enums_by_name.end()) {
-            return getEnumInfo<int>(); // Placeholder, need type erasure
+        std::shared_lock lock(mutex);
+        auto             it = enums_by_name.find(enum_name);
+        if (it == enums_by_name.end()) {
+            return nullptr;
         }
-        return nullptr;
+        auto info = enums_by_type.find(it->second);
+        return info != enums_by_type.end() ? &info->second : nullptr;
     }
 
     template <typename EnumType> inline bool EnumRegistry::isRegistered() const {
         static_assert(std::is_enum_v<EnumType>, "Type must be an enum");
 
-        std::type_index type_idx(typeid(EnumType));
+        std::type_index  type_idx(typeid(EnumType));
+        std::shared_lock lock(mutex);
         return enums_by_type.find(type_idx) != enums_by_type.end();
     }
 
     inline std::vector<std::string> EnumRegistry::getAllEnumNames() const {
+        std::shared_lock         lock(mutex);
         std::vector<std::string> names;
         names.reserve(enums_by_name.size());
 
@@ -4,6 +4,8 @@
  */
 #pragma once
 #include <functional>
+#include <mutex>
+#include <shared_mutex>
 #include <rosetta/info.h>
 #include <rosetta/types.h>
 #include <string>
@@ -11,6 +13,19 @@
 
 namespace rosetta {
 
+    /**
+     * @brief Element-wise kernel of a function whose parameters and return type
+     * are all numeric. `kernel(inputs, output, n)` runs the function pointer over
+     * n elements: inputs[i] points to n contiguous values of parameter i, output
+     * to n values of the return type.
+     */
+    class VectorizedInvoker {
+    public:
+        std::vector<NumericType>                                       parameter_types;
+        NumericType                                                    return_type;
+        std::function<void(const void *const *, void *, std::size_t)> kernel;
+    };
+
     /**
      * @brief Information about a standalone function
      */
@@ -20,6 +35,8 @@ namespace rosetta {
         std::string                           return_type;
         std::vector<std::string>              parameter_types;
         std::function<std::any(const Args &)> invoker;
+        // Only set for all-numeric signatures (see VectorizedInvoker)
+        std::unique_ptr<VectorizedInvoker> vectorized;
 
         FunctionInfo(const std::string &n, const std::string &ret_type,
                      const std::vector<std::string>       &param_types,
@@ -28,7 +45,7 @@ namespace rosetta {
     };
 
     /**
-     * @brief Registry for standalone functions
+     * @brief Registry for standalone functions (safe for concurrent readers)
      */
     class FunctionRegistry {
     public:
@@ -40,6 +57,7 @@ namespace rosetta {
 
     private:
         std::unordered_map<std::string, std::unique_ptr<FunctionInfo>> functions;
+        mutable std::shared_mutex                                      mutex;
     };
 
     inline FunctionRegistry &FunctionRegistry::instance() {
@@ -48,16 +66,20 @@ namespace rosetta {
     }
 
     inline void FunctionRegistry::registerFunction(std::unique_ptr<FunctionInfo> func) {
+        std::unique_lock lock(mutex);
         functions[func->name] = std::move(func);
     }
 
     inline const FunctionInfo *FunctionRegistry::getFunction(const std::string &name) const {
-        auto it = functions.find(name);
+        std::shared_lock lock(mutex);
+        auto             it = functions.find(name);
         return (it != functions.end()) ? it->second.get() : nullptr;
     }
 
     inline std::vector<std::string> FunctionRegistry::getFunctionNames() const {
+        std::shared_lock         lock(mutex);
         std::vector<std::string> names;
+        names.reserve(functions.size());
         for (const auto &[name, _] : functions) {
             names.push_back(name);
         }
@@ -78,6 +100,17 @@ namespace rosetta {
                 }
                 return callFunctionImpl(func_ptr, args, std::index_sequence_for<Args...>{});
             });
+
+        // long double has no NumericType: such functions keep the scalar path
+        if constexpr (sizeof...(Args) > 0 && is_vectorizable_v<ReturnType> &&
+                      (is_vectorizable_v<std::decay_t<Args>> && ...)) {
+            info->vectorized = std::make_unique<VectorizedInvoker>(VectorizedInvoker{
+                {numericTypeOf<Args>()...}, numericTypeOf<ReturnType>(),
+                [func_ptr](const void *const *inputs, void *output, std::size_t n) {
+                    mapFunctionImpl(func_ptr, inputs, output, n, std::index_sequence_for<Args...>{});
+                }});
+        }
+
         FunctionRegistry::instance().registerFunction(std::move(info));
     }
 
@@ -94,4 +127,15 @@ namespace rosetta {
         }
     }
 
+    template <typename ReturnType, typename... Args>
+    template <std::size_t... I>
+    inline void FunctionRegistrar<ReturnType, Args...>::mapFunctionImpl(
+        ReturnType (*func_ptr)(Args...), const void *const *inputs, void *output, std::size_t n,
+        std::index_sequence<I...>) {
+        auto *out = static_cast<ReturnType *>(output);
+        for (std::size_t k = 0; k < n; ++k) {
+            out[k] = func_ptr(static_cast<const std::decay_t<Args> *>(inputs[I])[k]...);
+        }
+    }
+
 } // namespace rosetta
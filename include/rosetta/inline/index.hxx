@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <variant>
+
+namespace rosetta {
+
+    namespace detail {
+
+        inline std::size_t IndexKeyHash::operator()(const IndexKey &key) const {
+            std::size_t seed = key.size();
+            for (const QueryValue &value : key) {
+                // All the NaNs are equal, whatever their payload
+                const auto       *number = std::get_if<double>(&value);
+                const std::size_t hash =
+                    number && std::isnan(*number)
+                        ? std::hash<double>{}(std::numeric_limits<double>::quiet_NaN())
+                        : std::hash<QueryValue>{}(value);
+                seed ^= hash + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+            }
+            return seed;
+        }
+
+        inline bool IndexKeyEqual::operator()(const IndexKey &a, const IndexKey &b) const {
+            return std::equal(a.begin(), a.end(), b.begin(), b.end(),
+                              [](const QueryValue &x, const QueryValue &y) {
+                                  return !queryValueLess(x, y) && !queryValueLess(y, x);
+                              });
+        }
+
+        inline bool IndexKeyLess::operator()(const IndexKey &a, const IndexKey &b) const {
+            return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end(),
+                                                queryValueLess);
+        }
+
+        template <typename V> inline QueryValue indexValue(const V &value) {
+            if constexpr (std::is_same_v<V, bool>) {
+                return value;
+            } else if constexpr (std::is_arithmetic_v<V>) {
+                return static_cast<double>(value);
+            } else if constexpr (std::is_convertible_v<const V &, std::string_view>) {
+                return std::string(std::string_view(value));
+            } else {
+                static_assert(std::is_same_v<V, QueryValue>,
+                              "Index keys are numbers, bool or strings");
+                return value;
+            }
+        }
+
+        // Is the key, cut to the length of the bound, greater than the bound?
+        inline bool indexKeyAfter(const IndexKey &key, const IndexKey &bound) {
+            const auto length = std::min(key.size(), bound.size());
+            return std::lexicographical_compare(bound.begin(), bound.end(), key.begin(),
+                                                key.begin() + static_cast<std::ptrdiff_t>(length),
+                                                queryValueLess);
+        }
+
+    } // namespace detail
+
+    inline IndexKind indexKindFromName(std::string_view name) {
+        if (name == "hash") {
+            return IndexKind::Hash;
+        }
+        if (name == "ordered") {
+            return IndexKind::Ordered;
+        }
+        throw std::runtime_error("Unknown index kind '" + std::string(name) +
+                                 "' (expected hash or ordered)");
+    }
+
+    template <typename... V> inline IndexKey indexKey(const V &...values) {
+        return IndexKey{detail::indexValue(values)...};
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline Index<T>::Index(IndexKind kind, const std::vector<std::string> &members)
+        : kind_(kind), members_(members) {
+        if (members_.empty()) {
+            throw QueryError("Index of " + getTypeInfo().class_name + " without key members");
+        }
+        for (const std::string &member : members_) {
+            detail::QueryParser parser(getTypeInfo(), slots_, member);
+            readers_.push_back(parser.parseExpression());
+        }
+        observer_ = T::getStaticTypeInfo().addMemberObserver(
+            [this](void *object, const MemberInfo &member) { memberChanged(object, member); });
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline Index<T>::~Index() {
+        T::getStaticTypeInfo().removeMemberObserver(observer_);
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline bool Index<T>::contains(const T &object) const {
+        return keys_.contains(&object);
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void Index<T>::insert(T &object) {
+        if (!contains(object)) {
+            add(object, computeKey(object));
+        }
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    template <std::ranges::input_range R>
+        requires(!std::is_same_v<std::remove_cvref_t<R>, T>)
+    inline void Index<T>::insert(R &&objects) {
+        if constexpr (std::ranges::sized_range<R>) {
+            const auto count = size() + static_cast<std::size_t>(std::ranges::size(objects));
+            keys_.reserve(count);
+            if (kind_ == IndexKind::Hash) {
+                hash_.reserve(count);
+            }
+        }
+        for (auto &&item : objects) {
+            if constexpr (detail::is_query_indirect_v<std::remove_cvref_t<decltype(item)>>) {
+                insert(*item);
+            } else {
+                insert(item);
+            }
+        }
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void Index<T>::erase(const T &object) {
+        const auto found = keys_.find(&object);
+        if (found != keys_.end()) {
+            remove(object, found->second);
+            keys_.erase(found);
+        }
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void Index<T>::clear() {
+        hash_.clear();
+        ordered_.clear();
+        keys_.clear();
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void Index<T>::update(const T &object) {
+        const auto found = keys_.find(&object);
+        if (found == keys_.end()) {
+            return;
+        }
+        IndexKey key = computeKey(object);
+        if (!detail::IndexKeyEqual{}(key, entryKey(found->second))) {
+            remove(object, found->second);
+            keys_.erase(found);
+            add(const_cast<T &>(object), std::move(key));
+        }
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline std::vector<T *> Index<T>::lookup(const IndexKey &key) const {
+        checkKey(key);
+        std::vector<T *> result;
+        const auto       collect = [&](auto range) {
+            for (auto it = range.first; it != range.second; ++it) {
+                result.push_back(it->second);
+            }
+        };
+        if (kind_ == IndexKind::Hash) {
+            collect(hash_.equal_range(key));
+        } else {
+            collect(ordered_.equal_range(key));
+        }
+        return result;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline std::vector<T *> Index<T>::range(const IndexKey &lo, const IndexKey &hi) const {
+        if (kind_ != IndexKind::Ordered) {
+            throw std::runtime_error("Range lookups need an ordered index");
+        }
+        if (lo.size() > members_.size() || hi.size() > members_.size()) {
+            throw std::runtime_error("Range bounds have more values than the index members");
+        }
+        std::vector<T *> result;
+        for (auto it = ordered_.lower_bound(lo);
+             it != ordered_.end() && !detail::indexKeyAfter(it->first, hi); ++it) {
+            result.push_back(it->second);
+        }
+        return result;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline const IndexKey &Index<T>::keyOf(const T &object) const {
+        const auto found = keys_.find(&object);
+        if (found == keys_.end()) {
+            throw std::runtime_error("Object not in the index");
+        }
+        return entryKey(found->second);
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline IndexKey Index<T>::computeKey(const T &object) const {
+        const auto *base = reinterpret_cast<const unsigned char *>(std::addressof(object));
+        std::vector<const void *> values(slots_.size());
+        for (std::size_t k = 0; k < slots_.size(); ++k) {
+            values[k] = base + slots_[k]->offset;
+        }
+        IndexKey key;
+        key.reserve(readers_.size());
+        for (const detail::QueryNode &reader : readers_) {
+            key.push_back(reader.eval(values.data()));
+        }
+        return key;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline const IndexKey &Index<T>::entryKey(const Entry &entry) const {
+        return kind_ == IndexKind::Hash ? entry.key : entry.position->first;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void Index<T>::add(T &object, IndexKey key) {
+        Entry entry;
+        if (kind_ == IndexKind::Hash) {
+            hash_.emplace(key, &object);
+            entry.key = std::move(key);
+        } else {
+            entry.position = ordered_.emplace(std::move(key), &object);
+        }
+        keys_.emplace(&object, std::move(entry));
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void Index<T>::remove(const T &object, const Entry &entry) {
+        if (kind_ == IndexKind::Ordered) {
+            ordered_.erase(entry.position);
+            return;
+        }
+        auto [it, end] = hash_.equal_range(entry.key);
+        for (; it != end; ++it) {
+            if (it->second == &object) {
+                hash_.erase(it);
+                return;
+            }
+        }
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void Index<T>::checkKey(const IndexKey &key) const {
+        if (key.size() != members_.size()) {
+            throw std::runtime_error("Index on " + std::to_string(members_.size()) +
+                                     " members looked up with " + std::to_string(key.size()) +
+                                     " values");
+        }
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void Index<T>::memberChanged(void *object, const MemberInfo &member) {
+        if (std::find(slots_.begin(), slots_.end(), &member) != slots_.end()) {
+            update(*static_cast<const T *>(object));
+        }
+    }
+
+} // namespace rosetta
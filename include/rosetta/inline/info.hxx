@@ -3,6 +3,9 @@
  * LGPL v3 license
  * 
  */
+#include <algorithm>
+#include <mutex>
+
 namespace rosetta {
 
     inline MemberInfo::MemberInfo(const std::string& n, const std::string& t,
@@ -26,7 +29,16 @@ namespace rosetta {
 
     inline void TypeInfo::addMember(std::unique_ptr<MemberInfo> member)
     {
-        members[member->name] = std::move(member);
+        auto& slot = members[member->name];
+        auto it = std::find(member_order.begin(), member_order.end(), slot.get());
+        if (slot && it != member_order.end()) {
+            member->slot = static_cast<std::size_t>(it - member_order.begin());
+            *it = member.get();
+        } else {
+            member->slot = member_order.size();
+            member_order.push_back(member.get());
+        }
+        slot = std::move(member);
     }
 
     inline void TypeInfo::addMethod(std::unique_ptr<MethodInfo> method)
@@ -56,11 +68,17 @@ namespace rosetta {
         return constructors;
     }
 
+    inline const std::vector<const MemberInfo*>& TypeInfo::getMembersInOrder() const
+    {
+        return member_order;
+    }
+
     inline std::vector<std::string> TypeInfo::getMemberNames() const
     {
         std::vector<std::string> names;
-        for (const auto& pair : members) {
-            names.push_back(pair.first);
+        names.reserve(member_order.size());
+        for (const auto* member : member_order) {
+            names.push_back(member->name);
         }
         return names;
     }
@@ -74,4 +92,95 @@ namespace rosetta {
         return names;
     }
 
-}
\ No newline at end of file
+    inline std::size_t TypeInfo::addMemberObserver(MemberObserver observer)
+    {
+        std::unique_lock lock(observers_->mutex);
+        const std::size_t id = observers_->next_id++;
+        observers_->observers.emplace_back(id, std::move(observer));
+        observers_->count = observers_->observers.size();
+        return id;
+    }
+
+    inline void TypeInfo::removeMemberObserver(std::size_t id)
+    {
+        std::unique_lock lock(observers_->mutex);
+        auto& observers = observers_->observers;
+        observers.erase(std::remove_if(observers.begin(), observers.end(),
+                            [id](const auto& entry) { return entry.first == id; }),
+            observers.end());
+        observers_->count = observers.size();
+    }
+
+    inline void TypeInfo::notifyMemberChanged(void* object, const MemberInfo& member) const
+    {
+        if (observers_->count.load(std::memory_order_acquire) == 0) {
+            return;
+        }
+        std::shared_lock lock(observers_->mutex);
+        for (const auto& [id, observer] : observers_->observers) {
+            observer(object, member);
+        }
+    }
+
+    inline std::size_t TypeInfo::subscribePropertyChanged(
+        const void* object, PropertyChangeHandler handler) const
+    {
+        std::unique_lock lock(subscribers_->mutex);
+        const std::size_t id = subscribers_->next_id++;
+        subscribers_->objects[object].emplace_back(id, std::move(handler));
+        ++subscribers_->count;
+        return id;
+    }
+
+    inline void TypeInfo::unsubscribePropertyChanged(const void* object, std::size_t id) const
+    {
+        std::unique_lock lock(subscribers_->mutex);
+        const auto found = subscribers_->objects.find(object);
+        if (found == subscribers_->objects.end()) {
+            return;
+        }
+        auto& handlers = found->second;
+        const auto removed = std::remove_if(handlers.begin(), handlers.end(),
+            [id](const auto& entry) { return entry.first == id; });
+        subscribers_->count -= static_cast<std::size_t>(handlers.end() - removed);
+        handlers.erase(removed, handlers.end());
+        if (handlers.empty()) {
+            subscribers_->objects.erase(found);
+        }
+    }
+
+    inline void TypeInfo::unsubscribePropertyChanged(const void* object) const
+    {
+        std::unique_lock lock(subscribers_->mutex);
+        const auto found = subscribers_->objects.find(object);
+        if (found != subscribers_->objects.end()) {
+            subscribers_->count -= found->second.size();
+            subscribers_->objects.erase(found);
+        }
+    }
+
+    inline bool TypeInfo::hasPropertySubscribers(const void* object) const
+    {
+        if (subscribers_->count.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+        std::shared_lock lock(subscribers_->mutex);
+        return subscribers_->objects.contains(object);
+    }
+
+    inline std::vector<PropertyChangeHandler> TypeInfo::propertyChangeHandlers(
+        const void* object) const
+    {
+        std::vector<PropertyChangeHandler> handlers;
+        std::shared_lock lock(subscribers_->mutex);
+        const auto found = subscribers_->objects.find(object);
+        if (found != subscribers_->objects.end()) {
+            handlers.reserve(found->second.size());
+            for (const auto& [id, handler] : found->second) {
+                handlers.push_back(handler);
+            }
+        }
+        return handlers;
+    }
+
+}
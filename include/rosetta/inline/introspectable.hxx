@@ -4,7 +4,6 @@
  * 
  */
 #include <iostream>
-#include <sstream>
 
 namespace rosetta {
 
@@ -122,70 +121,60 @@ namespace rosetta {
         }
     }
 
-    inline std::string Introspectable::toJSON() const
+    inline std::vector<std::uint8_t> Introspectable::toBinary() const
     {
-        std::stringstream json;
-        const auto& type_info = this->getTypeInfo();
+        std::vector<std::uint8_t> buffer;
+        toBinary(buffer);
+        return buffer;
+    }
 
-        json << "{\n";
-        json << "  \"className\": \"" << type_info.class_name << "\",\n";
-        json << "  \"members\": [\n";
+    inline void Introspectable::toBinary(std::vector<std::uint8_t>& buffer) const
+    {
+        const auto& type_info = getTypeInfo();
+        BinaryWriter writer(buffer);
+        writeBinaryHeader(type_info, writer);
+        // Members are registered relative to the most derived object
+        encodeObject(type_info, dynamic_cast<const void*>(this), writer);
+    }
 
-        auto member_names = type_info.getMemberNames();
-        for (size_t i = 0; i < member_names.size(); ++i) {
-            const auto* member = type_info.getMember(member_names[i]);
-            json << "    {\n";
-            json << "      \"name\": \"" << member->name << "\",\n";
-            json << "      \"type\": \"" << member->type_name << "\",\n";
-            json << "      \"value\": ";
+    inline void Introspectable::fromBinary(const void* data, std::size_t size)
+    {
+        const auto& type_info = getTypeInfo();
+        BinaryReader reader(data, size);
+        readBinaryHeader(type_info, reader);
+        decodeObject(type_info, dynamic_cast<void*>(this), reader);
+    }
 
-            // Serialize current value
-            auto value = member->getter(this);
-            if (member->type_name == "string") {
-                json << "\"" << std::any_cast<std::string>(value) << "\"";
-            } else if (member->type_name == "int") {
-                json << std::any_cast<int>(value);
-            } else if (member->type_name == "double") {
-                json << std::any_cast<double>(value);
-            } else if (member->type_name == "bool") {
-                json << (std::any_cast<bool>(value) ? "true" : "false");
-            } else {
-                json << "null";
-            }
+    inline void Introspectable::fromBinary(const std::vector<std::uint8_t>& data)
+    {
+        fromBinary(data.data(), data.size());
+    }
 
-            json << "\n    }";
-            if (i < member_names.size() - 1)
-                json << ",";
-            json << "\n";
-        }
+    inline std::string Introspectable::toJSON() const
+    {
+        std::string json;
+        JsonWriter writer(json);
+        toJSON(writer);
+        return json;
+    }
 
-        json << "  ],\n";
-        json << "  \"methods\": [\n";
-
-        auto method_names = type_info.getMethodNames();
-        for (size_t i = 0; i < method_names.size(); ++i) {
-            const auto* method = type_info.getMethod(method_names[i]);
-            json << "    {\n";
-            json << "      \"name\": \"" << method->name << "\",\n";
-            json << "      \"returnType\": \"" << method->return_type << "\",\n";
-            json << "      \"parameters\": [";
-
-            for (size_t j = 0; j < method->parameter_types.size(); ++j) {
-                json << "\"" << method->parameter_types[j] << "\"";
-                if (j < method->parameter_types.size() - 1)
-                    json << ", ";
-            }
+    inline void Introspectable::toJSON(JsonWriter& writer) const
+    {
+        writeObjectJSON(getTypeInfo(), dynamic_cast<const void*>(this), writer);
+    }
 
-            json << "]\n    }";
-            if (i < method_names.size() - 1)
-                json << ",";
-            json << "\n";
+    inline void Introspectable::fromJSON(std::string_view json)
+    {
+        JsonReader reader(json);
+        fromJSON(reader);
+        if (!reader.atEnd()) {
+            throw std::runtime_error("Unexpected data after the JSON object");
         }
+    }
 
-        json << "  ]\n";
-        json << "}";
-
-        return json.str();
+    inline void Introspectable::fromJSON(JsonReader& reader)
+    {
+        readObjectJSON(getTypeInfo(), dynamic_cast<void*>(this), reader);
     }
 
 } // namespace rosetta
\ No newline at end of file
@@ -0,0 +1,673 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace rosetta {
+
+    inline JsonWriter::JsonWriter(std::string &buffer, Sink sink, std::size_t flush_threshold)
+        : out_(buffer), sink_(std::move(sink)), threshold_(flush_threshold) {}
+
+    inline void JsonWriter::prefix() {
+        if (after_key_) {
+            after_key_ = false;
+            return;
+        }
+        if (!first_.empty()) {
+            if (!first_.back()) {
+                out_ += ',';
+            }
+            first_.back() = false;
+        }
+    }
+
+    inline void JsonWriter::maybeFlush() {
+        if (sink_ && out_.size() >= threshold_) {
+            flush();
+        }
+    }
+
+    inline void JsonWriter::flush() {
+        if (sink_ && !out_.empty()) {
+            sink_(out_);
+            out_.clear();
+        }
+    }
+
+    inline std::string &JsonWriter::buffer() { return out_; }
+
+    inline void JsonWriter::beginObject() {
+        prefix();
+        out_ += '{';
+        first_.push_back(true);
+    }
+
+    inline void JsonWriter::endObject() {
+        first_.pop_back();
+        out_ += '}';
+        maybeFlush();
+    }
+
+    inline void JsonWriter::key(std::string_view name) {
+        prefix();
+        writeEscaped(name);
+        out_ += ':';
+        after_key_ = true;
+    }
+
+    inline void JsonWriter::beginArray() {
+        prefix();
+        out_ += '[';
+        first_.push_back(true);
+    }
+
+    inline void JsonWriter::endArray() {
+        first_.pop_back();
+        out_ += ']';
+        maybeFlush();
+    }
+
+    inline void JsonWriter::null() {
+        prefix();
+        out_ += "null";
+    }
+
+    inline void JsonWriter::value(bool value) {
+        prefix();
+        out_ += value ? "true" : "false";
+    }
+
+    inline void JsonWriter::value(std::string_view value) {
+        prefix();
+        writeEscaped(value);
+        maybeFlush();
+    }
+
+    template <typename T>
+        requires(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+    inline void JsonWriter::value(T number) {
+        if constexpr (std::is_floating_point_v<T>) {
+            if (!std::isfinite(number)) {
+                null();
+                return;
+            }
+        }
+        prefix();
+        char buffer[64];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), number);
+        out_.append(buffer, result.ptr);
+    }
+
+    inline void JsonWriter::newline() {
+        out_ += '\n';
+        maybeFlush();
+    }
+
+    inline void JsonWriter::writeEscaped(std::string_view text) {
+        static constexpr char hex[] = "0123456789abcdef";
+        out_ += '"';
+        std::size_t start = 0;
+        for (std::size_t i = 0; i < text.size(); ++i) {
+            const auto c = static_cast<unsigned char>(text[i]);
+            if (c >= 0x20 && c != '"' && c != '\\') {
+                continue;
+            }
+            out_.append(text, start, i - start); // unescaped run
+            start = i + 1;
+            switch (c) {
+            case '"':
+                out_ += "\\\"";
+                break;
+            case '\\':
+                out_ += "\\\\";
+                break;
+            case '\n':
+                out_ += "\\n";
+                break;
+            case '\r':
+                out_ += "\\r";
+                break;
+            case '\t':
+                out_ += "\\t";
+                break;
+            case '\b':
+                out_ += "\\b";
+                break;
+            case '\f':
+                out_ += "\\f";
+                break;
+            default:
+                out_ += "\\u00";
+                out_ += hex[c >> 4];
+                out_ += hex[c & 0xf];
+            }
+        }
+        out_.append(text, start, text.size() - start);
+        out_ += '"';
+    }
+
+    // ------------------------------------------------
+
+    inline JsonReader::JsonReader(std::string_view text) : text_(text) {}
+
+    inline void JsonReader::error(const std::string &message) const {
+        throw std::runtime_error("JSON error at offset " + std::to_string(pos_) + ": " + message);
+    }
+
+    inline void JsonReader::skipWhitespace() {
+        while (pos_ < text_.size()) {
+            const char c = text_[pos_];
+            if (c != ' ' && c != '\n' && c != '\r' && c != '\t') {
+                return;
+            }
+            ++pos_;
+        }
+    }
+
+    inline void JsonReader::expect(char c) {
+        skipWhitespace();
+        if (pos_ >= text_.size() || text_[pos_] != c) {
+            error(std::string("expected '") + c + "'");
+        }
+        ++pos_;
+    }
+
+    inline JsonReader::Token JsonReader::peek() {
+        skipWhitespace();
+        if (pos_ >= text_.size()) {
+            return Token::End;
+        }
+        switch (text_[pos_]) {
+        case '{':
+            return Token::Object;
+        case '[':
+            return Token::Array;
+        case '"':
+            return Token::String;
+        case 't':
+        case 'f':
+            return Token::Bool;
+        case 'n':
+            return Token::Null;
+        default:
+            return Token::Number;
+        }
+    }
+
+    inline bool JsonReader::atEnd() { return peek() == Token::End; }
+
+    inline void JsonReader::beginObject() {
+        expect('{');
+        first_.push_back(true);
+    }
+
+    inline bool JsonReader::nextKey(std::string_view &key) {
+        skipWhitespace();
+        if (pos_ < text_.size() && text_[pos_] == '}') {
+            ++pos_;
+            first_.pop_back();
+            return false;
+        }
+        if (!first_.back()) {
+            expect(',');
+        }
+        first_.back() = false;
+        key           = readString();
+        expect(':');
+        return true;
+    }
+
+    inline void JsonReader::beginArray() {
+        expect('[');
+        first_.push_back(true);
+    }
+
+    inline bool JsonReader::nextElement() {
+        skipWhitespace();
+        if (pos_ < text_.size() && text_[pos_] == ']') {
+            ++pos_;
+            first_.pop_back();
+            return false;
+        }
+        if (!first_.back()) {
+            expect(',');
+        }
+        first_.back() = false;
+        return true;
+    }
+
+    inline void JsonReader::readNull() {
+        skipWhitespace();
+        if (text_.substr(pos_, 4) != "null") {
+            error("expected null");
+        }
+        pos_ += 4;
+    }
+
+    inline bool JsonReader::readBool() {
+        skipWhitespace();
+        if (text_.substr(pos_, 4) == "true") {
+            pos_ += 4;
+            return true;
+        }
+        if (text_.substr(pos_, 5) == "false") {
+            pos_ += 5;
+            return false;
+        }
+        error("expected a boolean");
+    }
+
+    inline std::string_view JsonReader::readString() {
+        expect('"');
+        const std::size_t start = pos_;
+
+        // Fast path: no escape, view the input
+        while (pos_ < text_.size() && text_[pos_] != '"' && text_[pos_] != '\\' &&
+               static_cast<unsigned char>(text_[pos_]) >= 0x20) {
+            ++pos_;
+        }
+        if (pos_ >= text_.size()) {
+            error("unterminated string");
+        }
+        if (text_[pos_] == '"') {
+            return text_.substr(start, pos_++ - start);
+        }
+        if (static_cast<unsigned char>(text_[pos_]) < 0x20) {
+            error("unescaped control character in string");
+        }
+
+        scratch_.assign(text_, start, pos_ - start);
+        while (pos_ < text_.size() && text_[pos_] != '"') {
+            const char c = text_[pos_++];
+            if (static_cast<unsigned char>(c) < 0x20) {
+                --pos_;
+                error("unescaped control character in string");
+            }
+            if (c != '\\') {
+                scratch_ += c;
+                continue;
+            }
+            if (pos_ >= text_.size()) {
+                break;
+            }
+            switch (text_[pos_++]) {
+            case '"':
+                scratch_ += '"';
+                break;
+            case '\\':
+                scratch_ += '\\';
+                break;
+            case '/':
+                scratch_ += '/';
+                break;
+            case 'n':
+                scratch_ += '\n';
+                break;
+            case 'r':
+                scratch_ += '\r';
+                break;
+            case 't':
+                scratch_ += '\t';
+                break;
+            case 'b':
+                scratch_ += '\b';
+                break;
+            case 'f':
+                scratch_ += '\f';
+                break;
+            case 'u': {
+                auto hex4 = [this]() {
+                    unsigned code = 0;
+                    auto     end  = text_.data() + std::min(pos_ + 4, text_.size());
+                    auto     res  = std::from_chars(text_.data() + pos_, end, code, 16);
+                    if (res.ptr != text_.data() + pos_ + 4) {
+                        error("invalid \\u escape");
+                    }
+                    pos_ += 4;
+                    return code;
+                };
+                unsigned code = hex4();
+                if (code >= 0xdc00 && code < 0xe000) {
+                    error("unpaired surrogate in \\u escape");
+                }
+                if (code >= 0xd800 && code < 0xdc00) {
+                    if (text_.substr(pos_, 2) != "\\u") {
+                        error("unpaired surrogate in \\u escape");
+                    }
+                    pos_ += 2;
+                    const unsigned low = hex4();
+                    if (low < 0xdc00 || low >= 0xe000) {
+                        error("unpaired surrogate in \\u escape");
+                    }
+                    code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00);
+                }
+                // UTF-8
+                if (code < 0x80) {
+                    scratch_ += static_cast<char>(code);
+                } else if (code < 0x800) {
+                    scratch_ += static_cast<char>(0xc0 | (code >> 6));
+                    scratch_ += static_cast<char>(0x80 | (code & 0x3f));
+                } else if (code < 0x10000) {
+                    scratch_ += static_cast<char>(0xe0 | (code >> 12));
+                    scratch_ += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+                    scratch_ += static_cast<char>(0x80 | (code & 0x3f));
+                } else {
+                    scratch_ += static_cast<char>(0xf0 | (code >> 18));
+                    scratch_ += static_cast<char>(0x80 | ((code >> 12) & 0x3f));
+                    scratch_ += static_cast<char>(0x80 | ((code >> 6) & 0x3f));
+                    scratch_ += static_cast<char>(0x80 | (code & 0x3f));
+                }
+                break;
+            }
+            default:
+                error("invalid escape");
+            }
+        }
+        if (pos_ >= text_.size()) {
+            error("unterminated string");
+        }
+        ++pos_;
+        return scratch_;
+    }
+
+    inline std::string_view JsonReader::numberText() {
+        skipWhitespace();
+        const std::size_t start = pos_;
+        auto              at    = [this](auto... chars) {
+            return pos_ < text_.size() && ((text_[pos_] == chars) || ...);
+        };
+        auto digits = [this]() {
+            const std::size_t first = pos_;
+            while (pos_ < text_.size() && text_[pos_] >= '0' && text_[pos_] <= '9') {
+                ++pos_;
+            }
+            return pos_ > first;
+        };
+        auto invalid = [&]() {
+            while (at('-', '+', '.', 'e', 'E') || digits()) {
+                ++pos_; // the whole token, for the message
+            }
+            const std::string token(text_.substr(start, pos_ - start));
+            pos_ = start;
+            error("invalid number '" + token + "'");
+        };
+
+        // -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+        if (at('-')) {
+            ++pos_;
+        }
+        if (at('0')) {
+            ++pos_;
+        } else if (!digits()) {
+            if (pos_ == start && !at('.', '+')) {
+                error("expected a number");
+            }
+            invalid();
+        }
+        if (at('.')) {
+            ++pos_;
+            if (!digits()) {
+                invalid();
+            }
+        }
+        if (at('e', 'E')) {
+            ++pos_;
+            if (at('+', '-')) {
+                ++pos_;
+            }
+            if (!digits()) {
+                invalid();
+            }
+        }
+        if (at('-', '+', '.', 'e', 'E') || digits()) { // e.g. 01 or 1.2.3
+            invalid();
+        }
+        return text_.substr(start, pos_ - start);
+    }
+
+    template <typename T>
+        requires(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+    inline T JsonReader::readNumber() {
+        if constexpr (std::is_floating_point_v<T>) {
+            // Written for NaN and infinities (see JsonWriter::value)
+            if (peek() == Token::Null) {
+                readNull();
+                return std::numeric_limits<T>::quiet_NaN();
+            }
+        }
+        const std::string_view text = numberText();
+        const char            *end  = text.data() + text.size();
+        T                      number{};
+        const auto             result = std::from_chars(text.data(), end, number);
+        if (result.ec != std::errc() || result.ptr != end) {
+            if constexpr (std::is_integral_v<T>) {
+                // Integral value written as a float (e.g. 1e3 or 2.0), or out of
+                // the range of T (e.g. -1 for an unsigned type)
+                double     real{};
+                const auto fallback = std::from_chars(text.data(), end, real);
+                if (fallback.ec == std::errc() && fallback.ptr == end &&
+                    std::trunc(real) == real) {
+                    // [min, max + 1), bounds exactly representable as double
+                    const double upper = std::ldexp(1.0, std::numeric_limits<T>::digits);
+                    const double lower = std::is_signed_v<T> ? -upper : 0.0;
+                    if (real < lower || real >= upper) {
+                        error("number '" + std::string(text) + "' out of range");
+                    }
+                    return static_cast<T>(real);
+                }
+            }
+            error("invalid number '" + std::string(text) + "'");
+        }
+        return number;
+    }
+
+    inline void JsonReader::skipValue() {
+        switch (peek()) {
+        case Token::Null:
+            readNull();
+            return;
+        case Token::Bool:
+            readBool();
+            return;
+        case Token::String:
+            readString();
+            return;
+        case Token::Number:
+            numberText();
+            return;
+        case Token::Object: {
+            beginObject();
+            std::string_view key;
+            while (nextKey(key)) {
+                skipValue();
+            }
+            return;
+        }
+        case Token::Array:
+            beginArray();
+            while (nextElement()) {
+                skipValue();
+            }
+            return;
+        case Token::End:
+            error("unexpected end of input");
+        }
+    }
+
+    // ------------------------------------------------
+
+    template <typename T>
+        requires(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+    struct JsonTraits<T> {
+        static constexpr bool supported = true;
+        static void           write(JsonWriter &writer, const T &value) { writer.value(value); }
+        static void           read(JsonReader &reader, T &value) {
+            value = reader.readNumber<T>();
+        }
+    };
+
+    template <> struct JsonTraits<bool> {
+        static constexpr bool supported = true;
+        static void           write(JsonWriter &writer, const bool &value) { writer.value(value); }
+        static void           read(JsonReader &reader, bool &value) { value = reader.readBool(); }
+    };
+
+    template <> struct JsonTraits<std::string> {
+        static constexpr bool supported = true;
+        static void write(JsonWriter &writer, const std::string &value) { writer.value(value); }
+        static void read(JsonReader &reader, std::string &value) { value = reader.readString(); }
+    };
+
+    // Value names (e.g. "Read|Write" for flags) when registered, numbers otherwise
+    template <typename T>
+        requires std::is_enum_v<T>
+    struct JsonTraits<T> {
+        static constexpr bool supported = true;
+        using Underlying                = std::underlying_type_t<T>;
+
+        static void write(JsonWriter &writer, const T &value) {
+            const auto  raw  = static_cast<std::int64_t>(static_cast<Underlying>(value));
+            const auto *info = EnumRegistry::instance().getEnumInfo<T>();
+            if (info && info->hasValue(raw)) {
+                writer.value(info->format(raw));
+            } else {
+                writer.value(static_cast<Underlying>(value));
+            }
+        }
+
+        static void read(JsonReader &reader, T &value) {
+            const auto *info = EnumRegistry::instance().getEnumInfo<T>();
+            if (reader.peek() == JsonReader::Token::String) {
+                if (!info) {
+                    throw std::runtime_error("Enum not registered: cannot read value names");
+                }
+                const int64_t number = info->getValue(reader.readString());
+                value                = static_cast<T>(static_cast<Underlying>(number));
+                return;
+            }
+            const auto raw = reader.readNumber<std::int64_t>();
+            if (info && !info->hasValue(raw)) {
+                throw std::runtime_error("Invalid value " + std::to_string(raw) + " for enum '" +
+                                         info->name + "'");
+            }
+            value = static_cast<T>(static_cast<Underlying>(raw));
+        }
+    };
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    struct JsonTraits<T> {
+        static constexpr bool supported = true;
+        static void           write(JsonWriter &writer, const T &value) {
+            writeObjectJSON(T::getStaticTypeInfo(), &value, writer);
+        }
+        static void read(JsonReader &reader, T &value) {
+            readObjectJSON(T::getStaticTypeInfo(), &value, reader);
+        }
+    };
+
+    template <typename T>
+        requires JsonTraits<T>::supported
+    struct JsonTraits<std::vector<T>> {
+        static constexpr bool supported = true;
+
+        static void write(JsonWriter &writer, const std::vector<T> &value) {
+            writer.beginArray();
+            for (const auto &item : value) {
+                JsonTraits<T>::write(writer, item);
+            }
+            writer.endArray();
+        }
+
+        static void read(JsonReader &reader, std::vector<T> &value) {
+            value.clear();
+            reader.beginArray();
+            while (reader.nextElement()) {
+                T item{};
+                JsonTraits<T>::read(reader, item);
+                value.push_back(std::move(item));
+            }
+        }
+    };
+
+    template <typename T, std::size_t N>
+        requires JsonTraits<T>::supported
+    struct JsonTraits<std::array<T, N>> {
+        static constexpr bool supported = true;
+
+        static void write(JsonWriter &writer, const std::array<T, N> &value) {
+            writer.beginArray();
+            for (const auto &item : value) {
+                JsonTraits<T>::write(writer, item);
+            }
+            writer.endArray();
+        }
+
+        // Read into a copy, so that a wrong count leaves the value unchanged
+        static void read(JsonReader &reader, std::array<T, N> &value) {
+            std::array<T, N> items = value;
+            reader.beginArray();
+            std::size_t count = 0;
+            while (reader.nextElement()) {
+                if (count == N) {
+                    throw std::runtime_error("Too many elements for an array of size " +
+                                             std::to_string(N));
+                }
+                JsonTraits<T>::read(reader, items[count++]);
+            }
+            if (count != N) {
+                throw std::runtime_error("Expected " + std::to_string(N) +
+                                         " elements for an array, got " + std::to_string(count));
+            }
+            value = std::move(items);
+        }
+    };
+
+    // ------------------------------------------------
+
+    inline void writeObjectJSON(const TypeInfo &type_info, const void *obj, JsonWriter &writer) {
+        writer.beginObject();
+        for (const auto *member : type_info.getMembersInOrder()) {
+            if (member->write_json) {
+                writer.key(member->name);
+                member->write_json(obj, writer);
+            }
+        }
+        writer.endObject();
+    }
+
+    inline void readObjectJSON(const TypeInfo &type_info, void *obj, JsonReader &reader) {
+        const auto &members = type_info.getMembersInOrder();
+        std::size_t expected = 0; // keys usually come in registration order
+
+        reader.beginObject();
+        std::string_view key;
+        while (reader.nextKey(key)) {
+            const MemberInfo *member = nullptr;
+            if (expected < members.size() && members[expected]->name == key) {
+                member = members[expected];
+            } else {
+                for (std::size_t i = 0; i < members.size(); ++i) {
+                    if (members[i]->name == key) {
+                        member   = members[i];
+                        expected = i;
+                        break;
+                    }
+                }
+            }
+
+            if (member && member->read_json) {
+                ++expected;
+                detail::decodeMember(type_info, obj, *member,
+                                     [&] { member->read_json(obj, reader); });
+            } else {
+                reader.skipValue();
+            }
+        }
+    }
+
+} // namespace rosetta
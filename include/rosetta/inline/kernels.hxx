@@ -0,0 +1,732 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#if ROSETTA_SIMD_DISPATCH
+#define ROSETTA_SIMD_INLINE __attribute__((always_inline)) inline
+#define ROSETTA_SIMD_TARGET(isa) __attribute__((target(isa)))
+#define ROSETTA_SIMD_UNROLL _Pragma("GCC unroll 16")
+#else
+#define ROSETTA_SIMD_INLINE inline
+#endif
+
+// The implementations must round identically, so no fused multiply-add (Clang
+// only fuses within an expression, so products are separate statements). The
+// lanes are passed by value only between always inlined functions, hence no
+// ABI concern.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpsabi"
+#endif
+
+namespace rosetta::kernels {
+
+    inline const char *simdLevelName(SimdLevel level) {
+        switch (level) {
+        case SimdLevel::SSE2:
+            return "SSE2";
+        case SimdLevel::AVX2:
+            return "AVX2";
+        case SimdLevel::AVX512:
+            return "AVX-512";
+        default:
+            return "scalar";
+        }
+    }
+
+    inline SimdLevel detectedSimdLevel() {
+#if ROSETTA_SIMD_DISPATCH
+        static const SimdLevel level = [] {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f")) {
+                return SimdLevel::AVX512;
+            }
+            if (__builtin_cpu_supports("avx2")) {
+                return SimdLevel::AVX2;
+            }
+            if (__builtin_cpu_supports("sse2")) {
+                return SimdLevel::SSE2;
+            }
+            return SimdLevel::Scalar;
+        }();
+        return level;
+#else
+        return SimdLevel::Scalar;
+#endif
+    }
+
+    namespace detail {
+
+        inline std::atomic<SimdLevel> &activeSimdLevel() {
+            static std::atomic<SimdLevel> level{detectedSimdLevel()};
+            return level;
+        }
+
+    } // namespace detail
+
+    inline SimdLevel simdLevel() {
+        return detail::activeSimdLevel().load(std::memory_order_relaxed);
+    }
+
+    inline SimdLevel setSimdLevel(SimdLevel level) {
+        const SimdLevel applied = std::min(level, detectedSimdLevel());
+        detail::activeSimdLevel().store(applied, std::memory_order_relaxed);
+        return applied;
+    }
+
+    namespace detail {
+
+        // Every implementation works on blocks of `lanes` values, each lane
+        // accumulating its own partial result
+        inline constexpr std::size_t lanes = 16;
+
+        template <typename E> struct ArrayPack {
+            E lane[lanes];
+        };
+
+#define ROSETTA_ARRAY_PACK_OPERATOR(op)                                                           \
+    template <typename E> inline ArrayPack<E> operator op(const ArrayPack<E> &a,                 \
+                                                          const ArrayPack<E> &b) {               \
+        ArrayPack<E> result;                                                                      \
+        for (std::size_t i = 0; i < lanes; ++i) {                                                 \
+            result.lane[i] = static_cast<E>(a.lane[i] op b.lane[i]);                              \
+        }                                                                                         \
+        return result;                                                                            \
+    }
+        ROSETTA_ARRAY_PACK_OPERATOR(+)
+        ROSETTA_ARRAY_PACK_OPERATOR(-)
+        ROSETTA_ARRAY_PACK_OPERATOR(*)
+#undef ROSETTA_ARRAY_PACK_OPERATOR
+
+        /**
+         * @brief Lanes as plain arrays (the scalar fallback)
+         */
+        struct ScalarOps {
+            template <typename E> using pack = ArrayPack<E>;
+
+            template <typename E> static pack<E> load(const E *values) {
+                pack<E> result;
+                std::memcpy(result.lane, values, sizeof(result.lane));
+                return result;
+            }
+            template <typename E> static void store(E *values, const pack<E> &p) {
+                std::memcpy(values, p.lane, sizeof(p.lane));
+            }
+            template <typename E> static pack<E> broadcast(E value) {
+                pack<E> result;
+                for (std::size_t i = 0; i < lanes; ++i) {
+                    result.lane[i] = value;
+                }
+                return result;
+            }
+            // Values converted to A (wider than E) when loaded
+            template <typename A, typename E> static pack<A> loadAs(const E *values) {
+                pack<A> result;
+                for (std::size_t i = 0; i < lanes; ++i) {
+                    result.lane[i] = static_cast<A>(values[i]);
+                }
+                return result;
+            }
+            template <typename E> static pack<E> min(const pack<E> &a, const pack<E> &b) {
+                pack<E> result;
+                for (std::size_t i = 0; i < lanes; ++i) {
+                    result.lane[i] = b.lane[i] < a.lane[i] ? b.lane[i] : a.lane[i];
+                }
+                return result;
+            }
+            template <typename E> static pack<E> max(const pack<E> &a, const pack<E> &b) {
+                pack<E> result;
+                for (std::size_t i = 0; i < lanes; ++i) {
+                    result.lane[i] = a.lane[i] < b.lane[i] ? b.lane[i] : a.lane[i];
+                }
+                return result;
+            }
+            template <typename E> static E at(const pack<E> &p, std::size_t i) { return p.lane[i]; }
+        };
+
+#if ROSETTA_SIMD_DISPATCH
+        /**
+         * @brief Lanes as compiler vectors of at most `Width` bytes (the
+         * registers of SSE2, AVX2 or AVX-512), so that they stay in registers
+         */
+        template <typename E, std::size_t Width> struct VectorPack {
+            static constexpr std::size_t bytes    = std::min(Width, lanes * sizeof(E));
+            static constexpr std::size_t per_part = bytes / sizeof(E);
+            static constexpr std::size_t parts    = lanes / per_part;
+            typedef E part_type __attribute__((vector_size(bytes)));
+
+            part_type part[parts];
+        };
+
+#define ROSETTA_VECTOR_PACK_OPERATOR(op)                                                          \
+    template <typename E, std::size_t Width>                                                      \
+    ROSETTA_SIMD_INLINE VectorPack<E, Width> operator op(const VectorPack<E, Width> &a,           \
+                                                         const VectorPack<E, Width> &b) {         \
+        VectorPack<E, Width> result;                                                              \
+        ROSETTA_SIMD_UNROLL                                                                       \
+        for (std::size_t k = 0; k < VectorPack<E, Width>::parts; ++k) {                           \
+            result.part[k] = a.part[k] op b.part[k];                                              \
+        }                                                                                         \
+        return result;                                                                            \
+    }
+        ROSETTA_VECTOR_PACK_OPERATOR(+)
+        ROSETTA_VECTOR_PACK_OPERATOR(-)
+        ROSETTA_VECTOR_PACK_OPERATOR(*)
+#undef ROSETTA_VECTOR_PACK_OPERATOR
+
+        /**
+         * @brief Lanes as VectorPack, lowered to the instruction set of the
+         * function they are inlined in
+         */
+        template <std::size_t Width> struct VectorOps {
+            template <typename E> using pack = VectorPack<E, Width>;
+
+            template <typename E> static ROSETTA_SIMD_INLINE pack<E> load(const E *values) {
+                pack<E> result;
+                ROSETTA_SIMD_UNROLL
+                for (std::size_t k = 0; k < pack<E>::parts; ++k) {
+                    std::memcpy(&result.part[k], values + k * pack<E>::per_part,
+                                sizeof(result.part[k]));
+                }
+                return result;
+            }
+            template <typename A, typename E>
+            static ROSETTA_SIMD_INLINE pack<A> loadAs(const E *values) {
+                using Target = pack<A>;
+                typedef E source_type __attribute__((vector_size(Target::per_part * sizeof(E))));
+                Target result;
+                ROSETTA_SIMD_UNROLL
+                for (std::size_t k = 0; k < Target::parts; ++k) {
+                    source_type source;
+                    std::memcpy(&source, values + k * Target::per_part, sizeof(source));
+                    result.part[k] = __builtin_convertvector(source, typename Target::part_type);
+                }
+                return result;
+            }
+            template <typename E>
+            static ROSETTA_SIMD_INLINE void store(E *values, const pack<E> &p) {
+                ROSETTA_SIMD_UNROLL
+                for (std::size_t k = 0; k < pack<E>::parts; ++k) {
+                    std::memcpy(values + k * pack<E>::per_part, &p.part[k], sizeof(p.part[k]));
+                }
+            }
+            template <typename E> static ROSETTA_SIMD_INLINE pack<E> broadcast(E value) {
+                pack<E> result;
+                ROSETTA_SIMD_UNROLL
+                for (std::size_t k = 0; k < pack<E>::parts; ++k) {
+                    for (std::size_t i = 0; i < pack<E>::per_part; ++i) {
+                        result.part[k][i] = value;
+                    }
+                }
+                return result;
+            }
+            template <typename E>
+            static ROSETTA_SIMD_INLINE pack<E> min(const pack<E> &a, const pack<E> &b) {
+                pack<E> result;
+                ROSETTA_SIMD_UNROLL
+                for (std::size_t k = 0; k < pack<E>::parts; ++k) {
+                    result.part[k] = b.part[k] < a.part[k] ? b.part[k] : a.part[k];
+                }
+                return result;
+            }
+            template <typename E>
+            static ROSETTA_SIMD_INLINE pack<E> max(const pack<E> &a, const pack<E> &b) {
+                pack<E> result;
+                ROSETTA_SIMD_UNROLL
+                for (std::size_t k = 0; k < pack<E>::parts; ++k) {
+                    result.part[k] = a.part[k] < b.part[k] ? b.part[k] : a.part[k];
+                }
+                return result;
+            }
+            template <typename E>
+            static ROSETTA_SIMD_INLINE E at(const pack<E> &p, std::size_t i) {
+                return p.part[i / pack<E>::per_part][i % pack<E>::per_part];
+            }
+        };
+#endif
+
+        // ------------------------------------------------
+        // Kernels, written once for both kinds of lanes. The lanes are always
+        // combined in order, then the remaining values are added one by one.
+        // ------------------------------------------------
+
+        struct SumKernel {
+            template <typename Ops, typename E>
+            static ROSETTA_SIMD_INLINE accumulator_t<E> run(const E *values, std::size_t n) {
+                using A         = accumulator_t<E>;
+                auto        acc = Ops::template broadcast<A>(A(0));
+                std::size_t i   = 0;
+                for (; i + lanes <= n; i += lanes) {
+                    acc = acc + Ops::template loadAs<A>(values + i);
+                }
+                A total = 0;
+                for (std::size_t l = 0; l < lanes; ++l) {
+                    total += Ops::at(acc, l);
+                }
+                for (; i < n; ++i) {
+                    total += static_cast<A>(values[i]);
+                }
+                return total;
+            }
+        };
+
+        struct MinMaxKernel {
+            template <typename Ops, typename E>
+            static ROSETTA_SIMD_INLINE MinMax<E> run(const E *values, std::size_t n) {
+                MinMax<E>   result{values[0], values[0]};
+                std::size_t i = 0;
+                if (n >= lanes) {
+                    auto low  = Ops::load(values);
+                    auto high = low;
+                    for (i = lanes; i + lanes <= n; i += lanes) {
+                        const auto block = Ops::load(values + i);
+                        low              = Ops::min(low, block);
+                        high             = Ops::max(high, block);
+                    }
+                    result = {Ops::at(low, 0), Ops::at(high, 0)};
+                    for (std::size_t l = 1; l < lanes; ++l) {
+                        include(result, Ops::at(low, l), Ops::at(high, l));
+                    }
+                }
+                for (; i < n; ++i) {
+                    include(result, values[i], values[i]);
+                }
+                return result;
+            }
+
+            template <typename E>
+            static ROSETTA_SIMD_INLINE void include(MinMax<E> &result, E low, E high) {
+                result.min = low < result.min ? low : result.min;
+                result.max = result.max < high ? high : result.max;
+            }
+        };
+
+        struct MomentsKernel {
+            template <typename Ops, typename E>
+            static ROSETTA_SIMD_INLINE Moments run(const E *values, std::size_t n) {
+                Moments result;
+                result.mean        = static_cast<double>(SumKernel::run<Ops>(values, n)) / n;
+                const auto  mean   = Ops::template broadcast<double>(result.mean);
+                auto        acc    = Ops::template broadcast<double>(0.0);
+                std::size_t i      = 0;
+                for (; i + lanes <= n; i += lanes) {
+                    const auto delta   = Ops::template loadAs<double>(values + i) - mean;
+                    const auto squared = delta * delta;
+                    acc                = acc + squared;
+                }
+                double total = 0;
+                for (std::size_t l = 0; l < lanes; ++l) {
+                    total += Ops::at(acc, l);
+                }
+                for (; i < n; ++i) {
+                    const double delta   = static_cast<double>(values[i]) - result.mean;
+                    const double squared = delta * delta;
+                    total += squared;
+                }
+                result.variance = total / n;
+                return result;
+            }
+        };
+
+        struct DotKernel {
+            template <typename Ops, typename E>
+            static ROSETTA_SIMD_INLINE accumulator_t<E> run(const E *x, const E *y, std::size_t n) {
+                using A         = accumulator_t<E>;
+                auto        acc = Ops::template broadcast<A>(A(0));
+                std::size_t i   = 0;
+                for (; i + lanes <= n; i += lanes) {
+                    const auto product =
+                        Ops::template loadAs<A>(x + i) * Ops::template loadAs<A>(y + i);
+                    acc = acc + product;
+                }
+                A total = 0;
+                for (std::size_t l = 0; l < lanes; ++l) {
+                    total += Ops::at(acc, l);
+                }
+                for (; i < n; ++i) {
+                    const A product = static_cast<A>(x[i]) * static_cast<A>(y[i]);
+                    total += product;
+                }
+                return total;
+            }
+        };
+
+        struct AxpyKernel {
+            template <typename Ops, typename E>
+            static ROSETTA_SIMD_INLINE void run(E alpha, const E *x, E *y, std::size_t n) {
+                const auto  a = Ops::broadcast(alpha);
+                std::size_t i = 0;
+                for (; i + lanes <= n; i += lanes) {
+                    const auto scaled = a * Ops::load(x + i);
+                    Ops::store(y + i, scaled + Ops::load(y + i));
+                }
+                for (; i < n; ++i) {
+                    const E scaled = static_cast<E>(alpha * x[i]);
+                    y[i]           = static_cast<E>(scaled + y[i]);
+                }
+            }
+        };
+
+        struct ClampKernel {
+            template <typename Ops, typename E>
+            static ROSETTA_SIMD_INLINE void run(E *values, std::size_t n, E lo, E hi) {
+                const auto  low  = Ops::broadcast(lo);
+                const auto  high = Ops::broadcast(hi);
+                std::size_t i    = 0;
+                for (; i + lanes <= n; i += lanes) {
+                    Ops::store(values + i, Ops::min(Ops::max(Ops::load(values + i), low), high));
+                }
+                for (; i < n; ++i) {
+                    const E value = values[i] < lo ? lo : values[i];
+                    values[i]     = hi < value ? hi : value;
+                }
+            }
+        };
+
+        struct HistogramKernel {
+            // The bins are computed in the lanes, the counts one by one
+            template <typename Ops, typename E>
+            static ROSETTA_SIMD_INLINE void run(const E *values, std::size_t n, double lo,
+                                                double hi, std::uint64_t *counts,
+                                                std::size_t bins) {
+                const double scale  = static_cast<double>(bins) / (hi - lo);
+                const auto   low    = Ops::template broadcast<double>(lo);
+                const auto   factor = Ops::template broadcast<double>(scale);
+                std::size_t  i      = 0;
+                for (; i + lanes <= n; i += lanes) {
+                    const auto block    = Ops::template loadAs<double>(values + i);
+                    const auto position = (block - low) * factor;
+                    for (std::size_t l = 0; l < lanes; ++l) {
+                        count(Ops::at(block, l), Ops::at(position, l), lo, hi, counts, bins);
+                    }
+                }
+                for (; i < n; ++i) {
+                    const double value = static_cast<double>(values[i]);
+                    count(value, (value - lo) * scale, lo, hi, counts, bins);
+                }
+            }
+
+            static ROSETTA_SIMD_INLINE void count(double value, double position, double lo,
+                                                  double hi, std::uint64_t *counts,
+                                                  std::size_t bins) {
+                if (value >= lo && value <= hi) {
+                    const auto bin = static_cast<std::size_t>(position);
+                    ++counts[bin < bins ? bin : bins - 1];
+                }
+            }
+        };
+
+        // ------------------------------------------------
+        // Dispatch
+        // ------------------------------------------------
+
+#if ROSETTA_SIMD_DISPATCH
+        template <typename Kernel, typename... Args>
+        ROSETTA_SIMD_TARGET("sse2") auto runSse2(Args... args) {
+            return Kernel::template run<VectorOps<16>>(args...);
+        }
+
+        template <typename Kernel, typename... Args>
+        ROSETTA_SIMD_TARGET("avx2") auto runAvx2(Args... args) {
+            return Kernel::template run<VectorOps<32>>(args...);
+        }
+
+        template <typename Kernel, typename... Args>
+        ROSETTA_SIMD_TARGET("avx512f") auto runAvx512(Args... args) {
+            return Kernel::template run<VectorOps<64>>(args...);
+        }
+#endif
+
+        template <typename Kernel, typename... Args> inline auto dispatch(Args... args) {
+#if ROSETTA_SIMD_DISPATCH
+            switch (simdLevel()) {
+            case SimdLevel::AVX512:
+                return runAvx512<Kernel>(args...);
+            case SimdLevel::AVX2:
+                return runAvx2<Kernel>(args...);
+            case SimdLevel::SSE2:
+                return runSse2<Kernel>(args...);
+            default:
+                break;
+            }
+#endif
+            return Kernel::template run<ScalarOps>(args...);
+        }
+
+        // Objects of the ranges given to gatherMember, held directly or by pointer
+        template <typename Element>
+        inline constexpr bool is_indirect_v =
+            std::is_pointer_v<Element> || requires { typename Element::element_type; };
+
+        template <typename Element> struct pointee {
+            using type = Element;
+        };
+
+        template <typename Element>
+            requires is_indirect_v<Element>
+        struct pointee<Element> {
+            using type = std::remove_cvref_t<decltype(*std::declval<Element>())>;
+        };
+
+        inline void requireNotEmpty(std::size_t size, const char *kernel) {
+            if (size == 0) {
+                throw std::runtime_error(std::string(kernel) + ": empty range");
+            }
+        }
+
+        inline void requireSameSize(std::size_t x, std::size_t y, const char *kernel) {
+            if (x != y) {
+                throw std::runtime_error(std::string(kernel) + ": sizes differ (" +
+                                         std::to_string(x) + " and " + std::to_string(y) + ")");
+            }
+        }
+
+    } // namespace detail
+
+    template <detail::NumericRange R>
+    inline accumulator_t<detail::range_element_t<R>> sum(const R &values) {
+        return detail::dispatch<detail::SumKernel>(std::ranges::data(values),
+                                                   std::ranges::size(values));
+    }
+
+    template <detail::NumericRange R>
+    inline MinMax<detail::range_element_t<R>> minMax(const R &values) {
+        detail::requireNotEmpty(std::ranges::size(values), "minMax");
+        return detail::dispatch<detail::MinMaxKernel>(std::ranges::data(values),
+                                                      std::ranges::size(values));
+    }
+
+    template <detail::NumericRange R> inline Moments meanVariance(const R &values) {
+        detail::requireNotEmpty(std::ranges::size(values), "meanVariance");
+        return detail::dispatch<detail::MomentsKernel>(std::ranges::data(values),
+                                                       std::ranges::size(values));
+    }
+
+    template <detail::NumericRange R1, detail::NumericRange R2>
+        requires std::is_same_v<detail::range_element_t<R1>, detail::range_element_t<R2>>
+    inline accumulator_t<detail::range_element_t<R1>> dot(const R1 &x, const R2 &y) {
+        detail::requireSameSize(std::ranges::size(x), std::ranges::size(y), "dot");
+        return detail::dispatch<detail::DotKernel>(std::ranges::data(x), std::ranges::data(y),
+                                                   std::ranges::size(x));
+    }
+
+    template <detail::NumericRange R1, detail::MutableNumericRange R2>
+        requires std::is_same_v<detail::range_element_t<R1>, detail::range_element_t<R2>>
+    inline void axpy(detail::range_element_t<R1> alpha, const R1 &x, R2 &&y) {
+        detail::requireSameSize(std::ranges::size(x), std::ranges::size(y), "axpy");
+        detail::dispatch<detail::AxpyKernel>(alpha, std::ranges::data(x), std::ranges::data(y),
+                                             std::ranges::size(x));
+    }
+
+    template <detail::MutableNumericRange R>
+    inline void clamp(R &&values, detail::range_element_t<R> lo, detail::range_element_t<R> hi) {
+        detail::dispatch<detail::ClampKernel>(std::ranges::data(values), std::ranges::size(values),
+                                              lo, hi);
+    }
+
+    template <detail::NumericRange R>
+    inline std::vector<std::uint64_t> histogram(const R &values, double lo, double hi,
+                                                std::size_t bins) {
+        if (bins == 0 || !(lo < hi)) {
+            throw std::runtime_error("histogram: needs bins > 0 and lo < hi");
+        }
+        std::vector<std::uint64_t> counts(bins, 0);
+        detail::dispatch<detail::HistogramKernel>(std::ranges::data(values),
+                                                  std::ranges::size(values), lo, hi,
+                                                  counts.data(), bins);
+        return counts;
+    }
+
+    template <typename E, std::ranges::input_range R>
+    inline std::vector<E> gatherMember(const R &objects, std::string_view member_name) {
+        using Element           = std::remove_cvref_t<std::ranges::range_reference_t<const R>>;
+        constexpr bool indirect = detail::is_indirect_v<Element>;
+        using Object            = typename detail::pointee<Element>::type;
+
+        const TypeInfo   &type_info = Object::getStaticTypeInfo();
+        const MemberInfo *member    = type_info.getMember(std::string(member_name));
+        if (!member || member->type != std::type_index(typeid(E))) {
+            throw std::runtime_error("No member '" + std::string(member_name) + "' of type " +
+                                     getTypeName<E>() + " in " + type_info.class_name);
+        }
+
+        std::vector<E> values;
+        if constexpr (std::ranges::sized_range<R>) {
+            values.reserve(std::ranges::size(objects));
+        }
+        for (const auto &item : objects) {
+            const Object *object;
+            if constexpr (indirect) {
+                object = std::addressof(*item);
+            } else {
+                object = std::addressof(item);
+            }
+            E value;
+            if (member->offset != MemberInfo::no_offset) {
+                const auto *bytes = reinterpret_cast<const unsigned char *>(object);
+                std::memcpy(&value, bytes + member->offset, sizeof(E));
+            } else {
+                value = std::any_cast<E>(member->getter(object));
+            }
+            values.push_back(value);
+        }
+        return values;
+    }
+
+    // ------------------------------------------------
+
+    namespace detail {
+
+        inline NumericType requireNumeric(const ColumnStorage &column, const char *kernel) {
+            if (const auto type = column.numericType()) {
+                return *type;
+            }
+            throw std::runtime_error(std::string(kernel) + ": the column does not hold numbers");
+        }
+
+        inline NumericType requireSameType(const ColumnStorage &x, const ColumnStorage &y,
+                                           const char *kernel) {
+            const NumericType type = requireNumeric(x, kernel);
+            if (requireNumeric(y, kernel) != type) {
+                throw std::runtime_error(std::string(kernel) + ": the columns differ in type");
+            }
+            requireSameSize(x.size(), y.size(), kernel);
+            return type;
+        }
+
+        // A double converted to the column type E: out of range values are
+        // limited to E (infinities for floating point), NaN must be excluded
+        template <typename E> inline E saturate(double value) {
+            using Limits = std::numeric_limits<E>;
+            if constexpr (std::is_floating_point_v<E>) {
+                if (value < static_cast<double>(Limits::lowest())) {
+                    return -Limits::infinity();
+                }
+                if (value > static_cast<double>(Limits::max())) {
+                    return Limits::infinity();
+                }
+            } else {
+                if (value <= static_cast<double>(Limits::min())) {
+                    return Limits::min();
+                }
+                if (value >= static_cast<double>(Limits::max())) {
+                    return Limits::max();
+                }
+            }
+            return static_cast<E>(value);
+        }
+
+        // The integral bounds are rounded inwards, so that clamping to [0.5, 9]
+        // gives [1, 9]
+        template <typename E> inline std::pair<E, E> clampBounds(double lo, double hi) {
+            if (std::isnan(lo) || std::isnan(hi) || lo > hi) {
+                throw std::runtime_error("clamp: needs lo <= hi (and no NaN)");
+            }
+            if constexpr (std::is_integral_v<E>) {
+                lo = std::ceil(lo);
+                hi = std::floor(hi);
+                if (lo > hi) {
+                    throw std::runtime_error("clamp: no value of the column type in [lo, hi]");
+                }
+            }
+            return {saturate<E>(lo), saturate<E>(hi)};
+        }
+
+        // Integral columns compute in their own type, so alpha must be one of
+        // their values
+        template <typename E> inline E axpyAlpha(double alpha) {
+            if constexpr (std::is_integral_v<E>) {
+                if (std::isnan(alpha) || static_cast<double>(saturate<E>(alpha)) != alpha) {
+                    throw std::runtime_error(
+                        "axpy: alpha must be an integer in the range of the column type");
+                }
+            }
+            return saturate<E>(alpha);
+        }
+
+        template <typename E> inline std::span<const E> values(const ColumnStorage &column) {
+            return {static_cast<const E *>(column.data()), column.size()};
+        }
+
+        template <typename E> inline std::span<E> values(ColumnStorage &column) {
+            return {static_cast<E *>(column.data()), column.size()};
+        }
+
+    } // namespace detail
+
+    inline double sum(const ColumnStorage &column) {
+        return visitNumericType(detail::requireNumeric(column, "sum"), [&](auto identity) {
+            using E = typename decltype(identity)::type;
+            return static_cast<double>(sum(detail::values<E>(column)));
+        });
+    }
+
+    inline MinMax<double> minMax(const ColumnStorage &column) {
+        return visitNumericType(detail::requireNumeric(column, "minMax"), [&](auto identity) {
+            using E            = typename decltype(identity)::type;
+            const auto extrema = minMax(detail::values<E>(column));
+            return MinMax<double>{static_cast<double>(extrema.min),
+                                  static_cast<double>(extrema.max)};
+        });
+    }
+
+    inline Moments meanVariance(const ColumnStorage &column) {
+        return visitNumericType(detail::requireNumeric(column, "meanVariance"), [&](auto identity) {
+            using E = typename decltype(identity)::type;
+            return meanVariance(detail::values<E>(column));
+        });
+    }
+
+    inline double dot(const ColumnStorage &x, const ColumnStorage &y) {
+        return visitNumericType(detail::requireSameType(x, y, "dot"), [&](auto identity) {
+            using E = typename decltype(identity)::type;
+            return static_cast<double>(dot(detail::values<E>(x), detail::values<E>(y)));
+        });
+    }
+
+    inline void axpy(double alpha, const ColumnStorage &x, ColumnStorage &y) {
+        visitNumericType(detail::requireSameType(x, y, "axpy"), [&](auto identity) {
+            using E = typename decltype(identity)::type;
+            axpy(detail::axpyAlpha<E>(alpha), detail::values<E>(x), detail::values<E>(y));
+        });
+    }
+
+    inline void clamp(ColumnStorage &column, double lo, double hi) {
+        visitNumericType(detail::requireNumeric(column, "clamp"), [&](auto identity) {
+            using E = typename decltype(identity)::type;
+            const auto [low, high] = detail::clampBounds<E>(lo, hi);
+            clamp(detail::values<E>(column), low, high);
+        });
+    }
+
+    inline std::vector<std::uint64_t> histogram(const ColumnStorage &column, double lo, double hi,
+                                                std::size_t bins) {
+        return visitNumericType(detail::requireNumeric(column, "histogram"), [&](auto identity) {
+            using E = typename decltype(identity)::type;
+            return histogram(detail::values<E>(column), lo, hi, bins);
+        });
+    }
+
+} // namespace rosetta::kernels
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#pragma GCC pop_options
+#endif
+
+#undef ROSETTA_SIMD_INLINE
+#undef ROSETTA_SIMD_TARGET
+#undef ROSETTA_SIMD_UNROLL
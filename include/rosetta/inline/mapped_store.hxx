@@ -0,0 +1,523 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <typeindex>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace rosetta {
+
+    namespace detail {
+
+        inline constexpr char          mapped_store_magic[4] = {'R', 'S', 'T', 'M'};
+        inline constexpr std::uint16_t mapped_store_byte_order = 0x0102;
+
+        // File header, followed by the records (at records_offset) then the heap
+        struct MappedStoreHeader {
+            char          magic[4];
+            std::uint16_t version;
+            std::uint16_t byte_order;
+            std::uint64_t fingerprint;
+            std::uint64_t count;
+            std::uint64_t record_size;
+            std::uint64_t records_offset;
+            std::uint64_t heap_offset;
+            std::uint64_t heap_size;
+            std::uint64_t reserved;
+        };
+        static_assert(sizeof(MappedStoreHeader) == 64);
+
+        inline constexpr std::size_t mapped_store_alignment = 8;
+
+        inline std::size_t alignUp(std::size_t value, std::size_t alignment) {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        // NumericType of the elements if `type` is a std::vector of numbers
+        inline bool numericVectorElement(std::type_index type, NumericType &element) {
+            for (int i = 0; i <= static_cast<int>(NumericType::Float64); ++i) {
+                const auto candidate = static_cast<NumericType>(i);
+                const bool match     = visitNumericType(candidate, [type](auto identity) {
+                    using E = typename decltype(identity)::type;
+                    return type == std::type_index(typeid(std::vector<E>));
+                });
+                if (match) {
+                    element = candidate;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        inline void storeHeapRef(std::uint8_t *ref, std::uint64_t offset, std::uint64_t bytes) {
+            std::memcpy(ref, &offset, sizeof(offset));
+            std::memcpy(ref + sizeof(offset), &bytes, sizeof(bytes));
+        }
+
+        // Block referenced by a heap slot, bounds checked
+        inline std::span<const std::uint8_t> heapBlock(const MappedLayout::Slot &slot,
+                                                       const std::uint8_t       *record,
+                                                       const std::uint8_t       *heap,
+                                                       std::size_t               heap_size) {
+            std::uint64_t offset, bytes;
+            std::memcpy(&offset, record + slot.offset, sizeof(offset));
+            std::memcpy(&bytes, record + slot.offset + sizeof(offset), sizeof(bytes));
+            if (offset > heap_size || bytes > heap_size - offset) {
+                throw std::runtime_error("Corrupted store: member '" + slot.member->name +
+                                         "' points outside of the heap");
+            }
+            return {heap + offset, static_cast<std::size_t>(bytes)};
+        }
+
+        // Array blocks hold whole elements
+        inline void checkArrayBlock(const MappedLayout::Slot     &slot,
+                                    std::span<const std::uint8_t> block,
+                                    std::size_t                   element_size) {
+            if (block.size() % element_size != 0) {
+                throw std::runtime_error("Corrupted store: member '" + slot.member->name +
+                                         "' is not a whole number of elements");
+            }
+        }
+
+        // Decode a slot into the member of `obj`
+        inline void readMappedSlot(const MappedLayout::Slot &slot, const std::uint8_t *record,
+                                   const std::uint8_t *heap, std::size_t heap_size, void *obj) {
+            // Encoded members have no offset: only the other kinds address the
+            // member storage
+            const auto target = [&] {
+                return static_cast<std::uint8_t *>(obj) + slot.member->offset;
+            };
+            if (slot.kind == MappedLayout::SlotKind::Raw) {
+                std::memcpy(target(), record + slot.offset, slot.size);
+                return;
+            }
+
+            const auto block = heapBlock(slot, record, heap, heap_size);
+            switch (slot.kind) {
+            case MappedLayout::SlotKind::String:
+                reinterpret_cast<std::string *>(target())->assign(
+                    reinterpret_cast<const char *>(block.data()), block.size());
+                break;
+            case MappedLayout::SlotKind::Array:
+                visitNumericType(slot.element, [&](auto identity) {
+                    using E   = typename decltype(identity)::type;
+                    checkArrayBlock(slot, block, sizeof(E));
+                    auto &vec = *reinterpret_cast<std::vector<E> *>(target());
+                    vec.resize(block.size() / sizeof(E));
+                    if (!vec.empty()) {
+                        std::memcpy(vec.data(), block.data(), vec.size() * sizeof(E));
+                    }
+                });
+                break;
+            default: {
+                BinaryReader reader(block.data(), block.size());
+                slot.member->decode(obj, reader);
+            }
+            }
+        }
+
+        inline void checkMappedStoreHeader(const MappedFile &file, const MappedLayout &layout,
+                                           MappedStoreHeader &header) {
+            if (file.size() < sizeof(MappedStoreHeader)) {
+                throw std::runtime_error("Not a rosetta store (file too small)");
+            }
+            std::memcpy(&header, file.data(), sizeof(header));
+            if (!std::equal(std::begin(header.magic), std::end(header.magic),
+                            std::begin(mapped_store_magic))) {
+                throw std::runtime_error("Not a rosetta store");
+            }
+            if (header.byte_order != mapped_store_byte_order) {
+                throw std::runtime_error("Store written on a platform with another byte order");
+            }
+            if (header.version != mapped_store_format_version) {
+                throw std::runtime_error("Unsupported store format version " +
+                                         std::to_string(header.version));
+            }
+            if (header.fingerprint != layout.fingerprint() ||
+                header.record_size != layout.recordSize()) {
+                throw std::runtime_error(
+                    "Store written for another registration of the class (schema mismatch)");
+            }
+            const std::uint64_t size = file.size();
+            const bool records_fit = header.records_offset >= sizeof(MappedStoreHeader) &&
+                                     header.records_offset <= header.heap_offset &&
+                                     (header.record_size == 0 ||
+                                      header.count <= (header.heap_offset - header.records_offset) /
+                                                          header.record_size);
+            const bool heap_fits =
+                header.heap_offset <= size && header.heap_size <= size - header.heap_offset;
+            if (!records_fit || !heap_fits) {
+                throw std::runtime_error("Corrupted store: truncated file");
+            }
+            // Heap blocks are viewed in place (getArray): keep them aligned
+            if (header.records_offset % mapped_store_alignment != 0 ||
+                header.heap_offset % mapped_store_alignment != 0) {
+                throw std::runtime_error("Corrupted store: misaligned sections");
+            }
+        }
+
+    } // namespace detail
+
+    // ------------------------------------------------
+
+    inline MappedFile::MappedFile(const std::string &path) {
+#ifdef _WIN32
+        HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Cannot open " + path);
+        }
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size)) {
+            CloseHandle(file);
+            throw std::runtime_error("Cannot get the size of " + path);
+        }
+        file_ = file;
+        size_ = static_cast<std::size_t>(size.QuadPart);
+        if (size_ == 0) {
+            return;
+        }
+        mapping_ = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping_ != nullptr) {
+            data_ = static_cast<const std::uint8_t *>(
+                MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+        }
+        if (data_ == nullptr) {
+            unmap();
+            throw std::runtime_error("Cannot map " + path);
+        }
+#else
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Cannot open " + path);
+        }
+        struct stat status;
+        if (::fstat(fd, &status) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Cannot get the size of " + path);
+        }
+        size_ = static_cast<std::size_t>(status.st_size);
+        if (size_ > 0) {
+            void *data = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+            if (data == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("Cannot map " + path);
+            }
+            data_ = static_cast<const std::uint8_t *>(data);
+        }
+        ::close(fd); // the mapping keeps the file referenced
+#endif
+    }
+
+    inline MappedFile::~MappedFile() { unmap(); }
+
+    inline MappedFile::MappedFile(MappedFile &&other) noexcept { *this = std::move(other); }
+
+    inline MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+        if (this != &other) {
+            unmap();
+            std::swap(data_, other.data_);
+            std::swap(size_, other.size_);
+#ifdef _WIN32
+            std::swap(file_, other.file_);
+            std::swap(mapping_, other.mapping_);
+#endif
+        }
+        return *this;
+    }
+
+    inline void MappedFile::unmap() {
+#ifdef _WIN32
+        if (data_ != nullptr) {
+            UnmapViewOfFile(data_);
+        }
+        if (mapping_ != nullptr) {
+            CloseHandle(mapping_);
+        }
+        if (file_ != nullptr) {
+            CloseHandle(file_);
+        }
+        file_    = nullptr;
+        mapping_ = nullptr;
+#else
+        if (data_ != nullptr) {
+            ::munmap(const_cast<std::uint8_t *>(data_), size_);
+        }
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+    // ------------------------------------------------
+
+    inline MappedLayout::MappedLayout(const TypeInfo &type_info) {
+        fingerprint_ = binarySchemaHash(type_info);
+        for (const MemberInfo *member : type_info.getMembersInOrder()) {
+            const bool located = member->offset != MemberInfo::no_offset;
+            Slot       slot{member, SlotKind::Raw, 0, heap_ref_size};
+            if (located && member->binary_raw) {
+                slot.size = member->size;
+            } else if (located && member->type == std::type_index(typeid(std::string))) {
+                slot.kind = SlotKind::String;
+            } else if (located && detail::numericVectorElement(member->type, slot.element)) {
+                slot.kind = SlotKind::Array;
+            } else if (member->encode && member->decode) {
+                slot.kind = SlotKind::Encoded;
+            } else {
+                continue; // not serializable
+            }
+
+            // Natural alignment of the slot (reads go through memcpy anyway)
+            std::size_t alignment = detail::mapped_store_alignment;
+            while (slot.size % alignment != 0) {
+                alignment /= 2;
+            }
+            slot.offset  = detail::alignUp(record_size_, alignment);
+            record_size_ = slot.offset + slot.size;
+            slots_.push_back(slot);
+
+            for (const std::uint64_t value :
+                 {static_cast<std::uint64_t>(slot.kind), static_cast<std::uint64_t>(slot.size),
+                  static_cast<std::uint64_t>(slot.element)}) {
+                fingerprint_ = (fingerprint_ ^ value) * 1099511628211ull;
+            }
+        }
+        record_size_ = detail::alignUp(record_size_, detail::mapped_store_alignment);
+    }
+
+    inline const MappedLayout::Slot *MappedLayout::find(std::string_view member_name) const {
+        for (const Slot &slot : slots_) {
+            if (slot.member->name == member_name) {
+                return &slot;
+            }
+        }
+        return nullptr;
+    }
+
+    // ------------------------------------------------
+
+    inline MappedStoreWriter::MappedStoreWriter(const std::string &path, const TypeInfo &type_info)
+        : layout_(type_info), path_(path),
+          out_(path, std::ios::binary | std::ios::out | std::ios::trunc),
+          record_(layout_.recordSize()) {
+        if (!out_) {
+            throw std::runtime_error("Cannot create " + path);
+        }
+        // Placeholder, written by close()
+        const detail::MappedStoreHeader header{};
+        out_.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    }
+
+    inline MappedStoreWriter::~MappedStoreWriter() {
+        try {
+            close();
+        } catch (...) {
+        }
+    }
+
+    inline void MappedStoreWriter::writeHeapBlock(const void *data, std::size_t bytes,
+                                                  std::uint8_t *ref) {
+        const std::size_t offset = detail::alignUp(heap_.size(), detail::mapped_store_alignment);
+        heap_.resize(offset + bytes);
+        if (bytes > 0) {
+            std::memcpy(heap_.data() + offset, data, bytes);
+        }
+        detail::storeHeapRef(ref, offset, bytes);
+    }
+
+    inline void MappedStoreWriter::append(const void *obj) {
+        if (closed_) {
+            throw std::runtime_error("MappedStoreWriter: append after close");
+        }
+        std::fill(record_.begin(), record_.end(), std::uint8_t{0});
+        for (const auto &slot : layout_.slots()) {
+            // Encoded members have no offset: only the other kinds address the
+            // member storage
+            const auto source = [&] {
+                return static_cast<const std::uint8_t *>(obj) + slot.member->offset;
+            };
+            std::uint8_t *target = record_.data() + slot.offset;
+            switch (slot.kind) {
+            case MappedLayout::SlotKind::Raw:
+                std::memcpy(target, source(), slot.size);
+                break;
+            case MappedLayout::SlotKind::String: {
+                const auto &text = *reinterpret_cast<const std::string *>(source());
+                writeHeapBlock(text.data(), text.size(), target);
+                break;
+            }
+            case MappedLayout::SlotKind::Array:
+                visitNumericType(slot.element, [&](auto identity) {
+                    using E         = typename decltype(identity)::type;
+                    const auto &vec = *reinterpret_cast<const std::vector<E> *>(source());
+                    writeHeapBlock(vec.data(), vec.size() * sizeof(E), target);
+                });
+                break;
+            case MappedLayout::SlotKind::Encoded: {
+                encoded_.clear();
+                BinaryWriter writer(encoded_);
+                slot.member->encode(obj, writer);
+                writeHeapBlock(encoded_.data(), encoded_.size(), target);
+                break;
+            }
+            }
+        }
+        out_.write(reinterpret_cast<const char *>(record_.data()),
+                   static_cast<std::streamsize>(record_.size()));
+        ++count_;
+    }
+
+    inline void MappedStoreWriter::close() {
+        if (closed_) {
+            return;
+        }
+        closed_ = true;
+
+        detail::MappedStoreHeader header{};
+        std::copy(std::begin(detail::mapped_store_magic), std::end(detail::mapped_store_magic),
+                  header.magic);
+        header.version        = mapped_store_format_version;
+        header.byte_order     = detail::mapped_store_byte_order;
+        header.fingerprint    = layout_.fingerprint();
+        header.count          = count_;
+        header.record_size    = layout_.recordSize();
+        header.records_offset = sizeof(header);
+        header.heap_offset    = detail::alignUp(sizeof(header) + count_ * layout_.recordSize(),
+                                                detail::mapped_store_alignment);
+        header.heap_size      = heap_.size();
+
+        const std::size_t padding =
+            header.heap_offset - (sizeof(header) + count_ * layout_.recordSize());
+        const char zeros[detail::mapped_store_alignment] = {};
+        out_.write(zeros, static_cast<std::streamsize>(padding));
+        out_.write(reinterpret_cast<const char *>(heap_.data()),
+                   static_cast<std::streamsize>(heap_.size()));
+        out_.seekp(0);
+        out_.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        out_.close();
+        heap_ = {};
+        if (out_.fail()) {
+            throw std::runtime_error("Cannot write " + path_);
+        }
+    }
+
+    // ------------------------------------------------
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    template <std::ranges::input_range Range>
+    inline void MappedStore<T>::write(const std::string &path, const Range &records) {
+        MappedStoreWriter writer(path, T::getStaticTypeInfo());
+        for (const T &record : records) {
+            writer.append(&record);
+        }
+        writer.close();
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline MappedStore<T>::MappedStore(const std::string &path)
+        : file_(path), layout_(T::getStaticTypeInfo()) {
+        detail::MappedStoreHeader header;
+        detail::checkMappedStoreHeader(file_, layout_, header);
+        count_     = static_cast<std::size_t>(header.count);
+        records_   = file_.data() + header.records_offset;
+        heap_      = file_.data() + header.heap_offset;
+        heap_size_ = static_cast<std::size_t>(header.heap_size);
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline const std::uint8_t *MappedStore<T>::record(std::size_t index) const {
+        if (index >= count_) {
+            throw std::out_of_range("MappedStore: index " + std::to_string(index) +
+                                    " out of range (size " + std::to_string(count_) + ")");
+        }
+        return records_ + index * layout_.recordSize();
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline const MappedLayout::Slot &MappedStore<T>::slot(std::string_view member_name) const {
+        const auto *found = layout_.find(member_name);
+        if (!found) {
+            throw std::runtime_error("Member not stored: " + std::string(member_name));
+        }
+        return *found;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void MappedStore<T>::read(std::size_t index, T &out) const {
+        const std::uint8_t *data = record(index);
+        for (const auto &slot : layout_.slots()) {
+            detail::readMappedSlot(slot, data, heap_, heap_size_, &out);
+        }
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline T MappedStore<T>::get(std::size_t index) const {
+        T result{};
+        read(index, result);
+        return result;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline Arg MappedStore<T>::getMemberValue(std::size_t index,
+                                              std::string_view member_name) const {
+        const auto &found = slot(member_name);
+        T           scratch{};
+        detail::readMappedSlot(found, record(index), heap_, heap_size_, &scratch);
+        return found.member->getter(&scratch);
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline std::string_view MappedStore<T>::getString(std::size_t      index,
+                                                      std::string_view member_name) const {
+        const auto &found = slot(member_name);
+        if (found.kind != MappedLayout::SlotKind::String) {
+            throw std::runtime_error("Member '" + found.member->name + "' is not a string");
+        }
+        const auto block = detail::heapBlock(found, record(index), heap_, heap_size_);
+        return {reinterpret_cast<const char *>(block.data()), block.size()};
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    template <typename E>
+    inline std::span<const E> MappedStore<T>::getArray(std::size_t      index,
+                                                       std::string_view member_name) const {
+        static_assert(is_vectorizable_v<E>, "getArray needs a numeric element type");
+        const auto &found = slot(member_name);
+        if (found.kind != MappedLayout::SlotKind::Array || found.element != numericTypeOf<E>()) {
+            throw std::runtime_error("Member '" + found.member->name + "' is not a std::vector<" +
+                                     getTypeName<E>() + ">");
+        }
+        const auto block = detail::heapBlock(found, record(index), heap_, heap_size_);
+        // Heap blocks are 8-byte aligned in a page-aligned mapping
+        if (reinterpret_cast<std::uintptr_t>(block.data()) % alignof(E) != 0) {
+            throw std::runtime_error("Corrupted store: member '" + found.member->name +
+                                     "' is misaligned in the heap");
+        }
+        detail::checkArrayBlock(found, block, sizeof(E));
+        return {reinterpret_cast<const E *>(block.data()), block.size() / sizeof(E)};
+    }
+
+} // namespace rosetta
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <exception>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace rosetta {
+
+    namespace detail {
+
+        struct QueuedPropertyChange {
+            const TypeInfo *type_info;
+            const void     *object;
+            PropertyChange  change;
+        };
+
+        struct PropertyChangeKeyHash {
+            std::size_t operator()(const std::pair<const void *, const MemberInfo *> &key) const {
+                const std::size_t h = std::hash<const void *>{}(key.first);
+                return h ^ (std::hash<const void *>{}(key.second) + 0x9e3779b97f4a7c15ULL +
+                            (h << 6) + (h >> 2));
+            }
+        };
+
+        // Changes queued by the open batches of the thread, with the position
+        // of each (object, member) in the queue to coalesce them
+        struct PropertyBatchState {
+            std::size_t                       depth = 0;
+            std::vector<QueuedPropertyChange> queue;
+            std::unordered_map<std::pair<const void *, const MemberInfo *>, std::size_t,
+                               PropertyChangeKeyHash>
+                positions;
+        };
+
+        inline PropertyBatchState &propertyBatchState() {
+            thread_local PropertyBatchState state;
+            return state;
+        }
+
+        inline void deliverPropertyChanges(const TypeInfo &type_info, const void *object,
+                                           std::span<const PropertyChange> changes,
+                                           std::exception_ptr             &error) {
+            for (const auto &handler : type_info.propertyChangeHandlers(object)) {
+                try {
+                    handler(changes);
+                } catch (...) {
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+            }
+        }
+
+        template <typename Decode>
+        inline void decodeMember(const TypeInfo &type_info, void *object, const MemberInfo &member,
+                                 Decode &&decode) {
+            if (member.observable && type_info.hasPropertySubscribers(object)) {
+                Arg old_value = member.getter(object);
+                decode();
+                type_info.notifyMemberChanged(object, member);
+                emitPropertyChange(type_info, object, member, std::move(old_value),
+                                   member.getter(object));
+                return;
+            }
+            decode();
+            type_info.notifyMemberChanged(object, member);
+        }
+
+    } // namespace detail
+
+    inline void emitPropertyChange(const TypeInfo &type_info, const void *object,
+                                   const MemberInfo &member, Arg old_value, Arg new_value) {
+        auto &state = detail::propertyBatchState();
+        if (state.depth > 0) {
+            const auto [found, inserted] =
+                state.positions.try_emplace({object, &member}, state.queue.size());
+            if (inserted) {
+                state.queue.push_back({&type_info, object,
+                                       {&member, member.slot, std::move(old_value),
+                                        std::move(new_value)}});
+            } else {
+                state.queue[found->second].change.new_value = std::move(new_value);
+            }
+            return;
+        }
+
+        const PropertyChange change{&member, member.slot, std::move(old_value),
+                                    std::move(new_value)};
+        std::exception_ptr   error;
+        detail::deliverPropertyChanges(type_info, object, {&change, 1}, error);
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void notifyPropertyChanged(T &object, std::string_view member, Arg old_value) {
+        const TypeInfo   &type_info = T::getStaticTypeInfo();
+        const MemberInfo *info      = type_info.getMember(std::string(member));
+        if (!info) {
+            throw std::runtime_error("No member '" + std::string(member) + "' in " +
+                                     type_info.class_name);
+        }
+        void *address = std::addressof(object);
+        type_info.notifyMemberChanged(address, *info);
+        if (info->observable && type_info.hasPropertySubscribers(address)) {
+            emitPropertyChange(type_info, address, *info, std::move(old_value),
+                               info->getter(address));
+        }
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline std::size_t subscribePropertyChanged(const T &object, PropertyChangeHandler handler) {
+        return T::getStaticTypeInfo().subscribePropertyChanged(std::addressof(object),
+                                                               std::move(handler));
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void unsubscribePropertyChanged(const T &object, std::size_t id) {
+        T::getStaticTypeInfo().unsubscribePropertyChanged(std::addressof(object), id);
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline PropertySubscription subscribePropertyChangedScoped(const T &object,
+                                                               PropertyChangeHandler handler) {
+        const TypeInfo &type_info = T::getStaticTypeInfo();
+        const void     *address   = std::addressof(object);
+        const std::size_t id      = type_info.subscribePropertyChanged(address, std::move(handler));
+        return PropertySubscription(type_info, address, id);
+    }
+
+    inline PropertySubscription::PropertySubscription(PropertySubscription &&other) noexcept
+        : type_info_(std::exchange(other.type_info_, nullptr)), object_(other.object_),
+          id_(other.id_) {}
+
+    inline PropertySubscription &
+    PropertySubscription::operator=(PropertySubscription &&other) noexcept {
+        if (this != &other) {
+            reset();
+            type_info_ = std::exchange(other.type_info_, nullptr);
+            object_    = other.object_;
+            id_        = other.id_;
+        }
+        return *this;
+    }
+
+    inline void PropertySubscription::reset() {
+        if (type_info_) {
+            std::exchange(type_info_, nullptr)->unsubscribePropertyChanged(object_, id_);
+        }
+    }
+
+    inline std::size_t PropertySubscription::release() {
+        type_info_ = nullptr;
+        return id_;
+    }
+
+    inline void beginPropertyBatch() {
+        ++detail::propertyBatchState().depth;
+    }
+
+    inline void endPropertyBatch() {
+        auto &state = detail::propertyBatchState();
+        if (state.depth == 0) {
+            throw std::runtime_error("No property batch is open");
+        }
+        if (--state.depth == 0) {
+            flushPropertyChanges();
+        }
+    }
+
+    inline bool propertyBatchOpen() {
+        return detail::propertyBatchState().depth > 0;
+    }
+
+    inline void flushPropertyChanges() {
+        auto &state = detail::propertyBatchState();
+        // Handlers may set members: their changes go to a new queue
+        std::vector<detail::QueuedPropertyChange> queue = std::move(state.queue);
+        state.queue.clear();
+        state.positions.clear();
+
+        // The changes of each object, objects in the order of their first change
+        std::unordered_map<const void *, std::size_t>          group_of;
+        std::vector<std::pair<const TypeInfo *, const void *>> objects;
+        std::vector<std::vector<PropertyChange>>               groups;
+        for (auto &queued : queue) {
+            const auto [found, inserted] = group_of.try_emplace(queued.object, groups.size());
+            if (inserted) {
+                objects.emplace_back(queued.type_info, queued.object);
+                groups.emplace_back();
+            }
+            groups[found->second].push_back(std::move(queued.change));
+        }
+
+        std::exception_ptr error;
+        for (std::size_t i = 0; i < groups.size(); ++i) {
+            detail::deliverPropertyChanges(*objects[i].first, objects[i].second, groups[i], error);
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    inline PropertyBatch::~PropertyBatch() {
+        if (open_) {
+            try {
+                end();
+            } catch (...) {
+                // Handler errors cannot leave a destructor: use end() to get them
+            }
+        }
+    }
+
+    inline void PropertyBatch::end() {
+        if (open_) {
+            open_ = false;
+            endPropertyBatch();
+        }
+    }
+
+} // namespace rosetta
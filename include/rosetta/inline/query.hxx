@@ -0,0 +1,811 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <map>
+#include <numeric>
+#include <rosetta/worker_pool.h>
+
+namespace rosetta {
+
+    namespace detail {
+
+        // Order of the group keys (and of the index keys): NaN equals itself and
+        // comes after all the numbers, as in orderBy
+        inline bool queryValueLess(const QueryValue &a, const QueryValue &b) {
+            if (a.index() != b.index()) {
+                return a.index() < b.index();
+            }
+            if (const auto *x = std::get_if<double>(&a)) {
+                const double y = std::get<double>(b);
+                if (std::isnan(*x) || std::isnan(y)) {
+                    return !std::isnan(*x);
+                }
+                return *x < y;
+            }
+            return a < b;
+        }
+
+        inline QueryValue QueryNode::eval(QuerySlots slots) const {
+            switch (type) {
+            case QueryType::Number:
+                return number(slots);
+            case QueryType::String:
+                return std::string(string(slots));
+            default:
+                return boolean(slots);
+            }
+        }
+
+        inline std::size_t querySlot(std::vector<const MemberInfo *> &slots,
+                                     const MemberInfo                *member) {
+            const auto found = std::find(slots.begin(), slots.end(), member);
+            if (found != slots.end()) {
+                return static_cast<std::size_t>(found - slots.begin());
+            }
+            slots.push_back(member);
+            return slots.size() - 1;
+        }
+
+        inline bool isWordChar(char c) {
+            return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+        }
+
+        inline const char *queryTypeName(QueryType type) {
+            switch (type) {
+            case QueryType::Number:
+                return "a number";
+            case QueryType::String:
+                return "a string";
+            default:
+                return "a boolean";
+            }
+        }
+
+        inline QueryNode queryBool(std::function<bool(QuerySlots)> fn) {
+            QueryNode node;
+            node.type    = QueryType::Bool;
+            node.boolean = std::move(fn);
+            return node;
+        }
+
+        inline QueryNode queryNumber(std::function<double(QuerySlots)> fn) {
+            QueryNode node;
+            node.type   = QueryType::Number;
+            node.number = std::move(fn);
+            return node;
+        }
+
+        inline QueryNode queryString(std::function<std::string_view(QuerySlots)> fn) {
+            QueryNode node;
+            node.type   = QueryType::String;
+            node.string = std::move(fn);
+            return node;
+        }
+
+        template <typename Compare, typename Fn>
+        inline std::function<bool(QuerySlots)> queryCompare(Fn a, Fn b) {
+            return [a = std::move(a), b = std::move(b)](QuerySlots slots) {
+                return Compare{}(a(slots), b(slots));
+            };
+        }
+
+        // Comparison of two operands of the same type (op is a comparison token)
+        template <typename Fn>
+        inline std::function<bool(QuerySlots)> queryCompare(std::string_view op, Fn a, Fn b) {
+            if (op == "==") {
+                return queryCompare<std::equal_to<>>(std::move(a), std::move(b));
+            }
+            if (op == "!=") {
+                return queryCompare<std::not_equal_to<>>(std::move(a), std::move(b));
+            }
+            if (op == "<") {
+                return queryCompare<std::less<>>(std::move(a), std::move(b));
+            }
+            if (op == "<=") {
+                return queryCompare<std::less_equal<>>(std::move(a), std::move(b));
+            }
+            if (op == ">") {
+                return queryCompare<std::greater<>>(std::move(a), std::move(b));
+            }
+            return queryCompare<std::greater_equal<>>(std::move(a), std::move(b));
+        }
+
+        // Reader of a member of one of the types Es (as a number)
+        template <typename... Es>
+        inline bool queryNumberReader(const MemberInfo &member, std::size_t slot,
+                                      QueryNode &node) {
+            return ((member.type == std::type_index(typeid(Es))
+                         ? (node = queryNumber([slot](QuerySlots slots) {
+                                return static_cast<double>(*static_cast<const Es *>(slots[slot]));
+                            }),
+                            true)
+                         : false) ||
+                    ...);
+        }
+
+        // ------------------------------------------------
+
+        inline QueryParser::QueryParser(const TypeInfo &type_info,
+                                        std::vector<const MemberInfo *> &slots,
+                                        std::string_view                 text)
+            : type_info_(type_info), slots_(slots), text_(text) {}
+
+        inline QueryNode QueryParser::parseExpression() {
+            QueryNode node = parseOr();
+            expectEnd();
+            return node;
+        }
+
+        inline std::vector<QuerySortKey> QueryParser::parseSortKeys() {
+            std::vector<QuerySortKey> keys;
+            do {
+                QuerySortKey key{parseOr()};
+                if (acceptWord("desc")) {
+                    key.descending = true;
+                } else {
+                    acceptWord("asc");
+                }
+                keys.push_back(std::move(key));
+            } while (accept(","));
+            expectEnd();
+            return keys;
+        }
+
+        inline QueryNode QueryParser::parseOr() {
+            QueryNode left = parseAnd();
+            while (accept("||") || acceptWord("or")) {
+                QueryNode right = parseAnd();
+                expect(QueryType::Bool, left, "'||'");
+                expect(QueryType::Bool, right, "'||'");
+                left = queryBool([a = std::move(left.boolean),
+                                  b = std::move(right.boolean)](QuerySlots slots) {
+                    return a(slots) || b(slots);
+                });
+            }
+            return left;
+        }
+
+        inline QueryNode QueryParser::parseAnd() {
+            QueryNode left = parseNot();
+            while (accept("&&") || acceptWord("and")) {
+                QueryNode right = parseNot();
+                expect(QueryType::Bool, left, "'&&'");
+                expect(QueryType::Bool, right, "'&&'");
+                left = queryBool([a = std::move(left.boolean),
+                                  b = std::move(right.boolean)](QuerySlots slots) {
+                    return a(slots) && b(slots);
+                });
+            }
+            return left;
+        }
+
+        inline QueryNode QueryParser::parseNot() {
+            if (accept("!") || acceptWord("not")) {
+                QueryNode operand = parseNot();
+                expect(QueryType::Bool, operand, "'!'");
+                return queryBool([a = std::move(operand.boolean)](QuerySlots slots) {
+                    return !a(slots);
+                });
+            }
+            return parseCompare();
+        }
+
+        inline QueryNode QueryParser::parseCompare() {
+            QueryNode left = parseSum();
+            for (const std::string_view op : {"==", "!=", "<=", ">=", "<", ">"}) {
+                if (!accept(op)) {
+                    continue;
+                }
+                QueryNode right = parseSum();
+                if (left.type != right.type) {
+                    fail("cannot compare " + std::string(queryTypeName(left.type)) + " with " +
+                         queryTypeName(right.type));
+                }
+                switch (left.type) {
+                case QueryType::Number:
+                    return queryBool(
+                        queryCompare(op, std::move(left.number), std::move(right.number)));
+                case QueryType::String:
+                    return queryBool(
+                        queryCompare(op, std::move(left.string), std::move(right.string)));
+                default:
+                    if (op != "==" && op != "!=") {
+                        fail("booleans are only compared with == and !=");
+                    }
+                    return queryBool(
+                        queryCompare(op, std::move(left.boolean), std::move(right.boolean)));
+                }
+            }
+            return left;
+        }
+
+        inline QueryNode QueryParser::parseSum() {
+            QueryNode left = parseProduct();
+            for (;;) {
+                const bool add = accept("+");
+                if (!add && !accept("-")) {
+                    return left;
+                }
+                QueryNode right = parseProduct();
+                expect(QueryType::Number, left, add ? "'+'" : "'-'");
+                expect(QueryType::Number, right, add ? "'+'" : "'-'");
+                auto a = std::move(left.number);
+                auto b = std::move(right.number);
+                if (add) {
+                    left = queryNumber([a, b](QuerySlots slots) { return a(slots) + b(slots); });
+                } else {
+                    left = queryNumber([a, b](QuerySlots slots) { return a(slots) - b(slots); });
+                }
+            }
+        }
+
+        inline QueryNode QueryParser::parseProduct() {
+            QueryNode left = parseUnary();
+            for (;;) {
+                char op = 0;
+                for (const char candidate : {'*', '/', '%'}) {
+                    if (accept(std::string_view(&candidate, 1))) {
+                        op = candidate;
+                        break;
+                    }
+                }
+                if (!op) {
+                    return left;
+                }
+                QueryNode right = parseUnary();
+                expect(QueryType::Number, left, "arithmetic");
+                expect(QueryType::Number, right, "arithmetic");
+                auto a = std::move(left.number);
+                auto b = std::move(right.number);
+                if (op == '*') {
+                    left = queryNumber([a, b](QuerySlots slots) { return a(slots) * b(slots); });
+                } else if (op == '/') {
+                    left = queryNumber([a, b](QuerySlots slots) { return a(slots) / b(slots); });
+                } else {
+                    left = queryNumber(
+                        [a, b](QuerySlots slots) { return std::fmod(a(slots), b(slots)); });
+                }
+            }
+        }
+
+        inline QueryNode QueryParser::parseUnary() {
+            if (accept("-")) {
+                QueryNode operand = parseUnary();
+                expect(QueryType::Number, operand, "'-'");
+                return queryNumber(
+                    [a = std::move(operand.number)](QuerySlots slots) { return -a(slots); });
+            }
+            return parsePrimary();
+        }
+
+        inline QueryNode QueryParser::parsePrimary() {
+            skipSpace();
+            if (pos_ >= text_.size()) {
+                fail("unexpected end");
+            }
+            const char c = text_[pos_];
+            if (accept("(")) {
+                QueryNode node = parseOr();
+                if (!accept(")")) {
+                    fail("expected ')'");
+                }
+                return node;
+            }
+            if (c == '\'' || c == '"') {
+                return parseString(c);
+            }
+            if (std::isdigit(static_cast<unsigned char>(c)) || c == '.') {
+                return parseNumber();
+            }
+            if (isWordChar(c) && !std::isdigit(static_cast<unsigned char>(c))) {
+                const std::size_t start = pos_;
+                while (pos_ < text_.size() && isWordChar(text_[pos_])) {
+                    ++pos_;
+                }
+                const std::string word(text_.substr(start, pos_ - start));
+                if (word == "true" || word == "false") {
+                    const bool value = word == "true";
+                    return queryBool([value](QuerySlots) { return value; });
+                }
+                pos_ = start; // for the error position
+                QueryNode node = member(word);
+                pos_ += word.size();
+                return node;
+            }
+            fail(std::string("unexpected '") + c + "'");
+        }
+
+        inline QueryNode QueryParser::parseString(char quote) {
+            std::string value;
+            for (++pos_; pos_ < text_.size() && text_[pos_] != quote; ++pos_) {
+                char c = text_[pos_];
+                if (c == '\\' && pos_ + 1 < text_.size()) {
+                    c = text_[++pos_];
+                    c = c == 'n' ? '\n' : c == 't' ? '\t' : c;
+                }
+                value += c;
+            }
+            if (pos_ >= text_.size()) {
+                fail("unterminated string");
+            }
+            ++pos_;
+            return queryString([value = std::move(value)](QuerySlots) -> std::string_view {
+                return value;
+            });
+        }
+
+        inline QueryNode QueryParser::parseNumber() {
+            const std::size_t start = pos_;
+            const auto        digits = [&] {
+                while (pos_ < text_.size() &&
+                       std::isdigit(static_cast<unsigned char>(text_[pos_]))) {
+                    ++pos_;
+                }
+            };
+            digits();
+            if (pos_ < text_.size() && text_[pos_] == '.') {
+                ++pos_;
+                digits();
+            }
+            if (pos_ < text_.size() && (text_[pos_] == 'e' || text_[pos_] == 'E')) {
+                ++pos_;
+                if (pos_ < text_.size() && (text_[pos_] == '+' || text_[pos_] == '-')) {
+                    ++pos_;
+                }
+                digits();
+            }
+            const std::string token(text_.substr(start, pos_ - start));
+            char             *end   = nullptr;
+            const double      value = std::strtod(token.c_str(), &end);
+            if (end != token.c_str() + token.size()) {
+                pos_ = start;
+                fail("invalid number '" + token + "'");
+            }
+            return queryNumber([value](QuerySlots) { return value; });
+        }
+
+        inline QueryNode QueryParser::member(const std::string &name) {
+            const MemberInfo *info = type_info_.getMember(name);
+            if (!info) {
+                fail("unknown member '" + name + "' of " + type_info_.class_name);
+            }
+            if (info->offset == MemberInfo::no_offset) {
+                fail("member '" + name + "' has no storage");
+            }
+            const std::size_t slot = querySlot(slots_, info);
+            if (info->type == std::type_index(typeid(bool))) {
+                return queryBool(
+                    [slot](QuerySlots slots) { return *static_cast<const bool *>(slots[slot]); });
+            }
+            if (info->type == std::type_index(typeid(std::string))) {
+                return queryString([slot](QuerySlots slots) -> std::string_view {
+                    return *static_cast<const std::string *>(slots[slot]);
+                });
+            }
+            QueryNode node;
+            if (!queryNumberReader<char, signed char, unsigned char, short, unsigned short, int,
+                                   unsigned int, long, unsigned long, long long,
+                                   unsigned long long, float, double, long double>(*info, slot,
+                                                                                   node)) {
+                fail("member '" + name + "' of type " + info->type_name +
+                     " can only be tested with a C++ predicate");
+            }
+            return node;
+        }
+
+        inline void QueryParser::skipSpace() {
+            while (pos_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[pos_]))) {
+                ++pos_;
+            }
+        }
+
+        inline bool QueryParser::accept(std::string_view token) {
+            skipSpace();
+            if (text_.substr(pos_, token.size()) != token) {
+                return false;
+            }
+            // '<' is not the start of '<=', nor '!' of '!='
+            const std::size_t next = pos_ + token.size();
+            if (token.size() == 1 && std::string_view("!<>=").find(token[0]) != token.npos &&
+                next < text_.size() && text_[next] == '=') {
+                return false;
+            }
+            pos_ = next;
+            return true;
+        }
+
+        inline bool QueryParser::acceptWord(std::string_view word) {
+            skipSpace();
+            const std::size_t next = pos_ + word.size();
+            if (text_.substr(pos_, word.size()) != word ||
+                (next < text_.size() && isWordChar(text_[next]))) {
+                return false;
+            }
+            pos_ = next;
+            return true;
+        }
+
+        inline void QueryParser::expect(QueryType type, const QueryNode &node,
+                                        const char *what) const {
+            if (node.type != type) {
+                fail(std::string(what) + " needs " + queryTypeName(type) + ", not " +
+                     queryTypeName(node.type));
+            }
+        }
+
+        inline void QueryParser::expectEnd() {
+            skipSpace();
+            if (pos_ < text_.size()) {
+                fail(std::string("unexpected '") + text_[pos_] + "'");
+            }
+        }
+
+        inline void QueryParser::fail(const std::string &message) const {
+            throw QueryError("Query: " + message + " at " + std::to_string(pos_) + " in \"" +
+                             std::string(text_) + "\"");
+        }
+
+        // ------------------------------------------------
+
+        inline void QueryRows::fill(std::size_t row, const void **slots) const {
+            if (objects.empty()) {
+                for (std::size_t k = 0; k < bases.size(); ++k) {
+                    slots[k] = bases[k] + row * strides[k];
+                }
+            } else {
+                const auto *object = static_cast<const unsigned char *>(objects[row]);
+                for (std::size_t k = 0; k < offsets.size(); ++k) {
+                    slots[k] = object + offsets[k];
+                }
+            }
+        }
+
+        inline bool QueryPlan::matches(QuerySlots slots) const {
+            for (const QueryNode &filter : filters) {
+                if (!filter.boolean(slots)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        inline std::size_t QueryPlan::chunkCount(std::size_t size) const {
+            constexpr std::size_t min_chunk = 16384;
+            const std::size_t     threads   = WorkerPool::shared().size() + 1;
+            if (size < parallel || size < 2 * min_chunk || threads < 2) {
+                return 1;
+            }
+            return std::min(size / min_chunk, 4 * threads);
+        }
+
+        inline void QueryPlan::forEachChunk(std::size_t size, std::size_t chunks,
+                                            const ChunkBody &body) const {
+            if (chunks == 1) {
+                body(0, 0, size);
+                return;
+            }
+            WorkerPool::shared().parallelFor(chunks, [&](std::size_t chunk) {
+                body(chunk, size * chunk / chunks, size * (chunk + 1) / chunks);
+            });
+        }
+
+        inline std::vector<std::size_t> QueryPlan::run(const QueryRows &rows) const {
+            // Without sort keys, each chunk can stop at the limit
+            const std::size_t chunk_limit = keys.empty() ? limit : static_cast<std::size_t>(-1);
+            const std::size_t chunks      = chunkCount(rows.size);
+            std::vector<std::vector<std::size_t>> parts(chunks);
+            const auto scan = [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                std::vector<const void *> values(slots.size());
+                auto                     &part = parts[chunk];
+                for (std::size_t row = begin; row < end && part.size() < chunk_limit; ++row) {
+                    rows.fill(row, values.data());
+                    if (matches(values.data())) {
+                        part.push_back(row);
+                    }
+                }
+            };
+            forEachChunk(rows.size, chunks, scan);
+
+            std::vector<std::size_t> selected = std::move(parts[0]);
+            for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+                selected.insert(selected.end(), parts[chunk].begin(), parts[chunk].end());
+            }
+            if (!keys.empty()) {
+                sort(rows, selected);
+            }
+            if (selected.size() > limit) {
+                selected.resize(limit);
+            }
+            return selected;
+        }
+
+        inline void QueryPlan::sort(const QueryRows         &rows,
+                                    std::vector<std::size_t> &selected) const {
+            // The keys are evaluated once per row
+            struct KeyValues {
+                std::vector<double>           numbers;
+                std::vector<std::string_view> strings;
+            };
+            const std::size_t      n = selected.size();
+            std::vector<KeyValues> values(keys.size());
+            for (std::size_t k = 0; k < keys.size(); ++k) {
+                if (keys[k].node.type == QueryType::String) {
+                    values[k].strings.resize(n);
+                } else {
+                    values[k].numbers.resize(n);
+                }
+            }
+            forEachChunk(n, chunkCount(n), [&](std::size_t, std::size_t begin, std::size_t end) {
+                std::vector<const void *> slot_values(slots.size());
+                for (std::size_t i = begin; i < end; ++i) {
+                    rows.fill(selected[i], slot_values.data());
+                    for (std::size_t k = 0; k < keys.size(); ++k) {
+                        const QueryNode &node = keys[k].node;
+                        if (node.type == QueryType::String) {
+                            values[k].strings[i] = node.string(slot_values.data());
+                        } else if (node.type == QueryType::Number) {
+                            values[k].numbers[i] = node.number(slot_values.data());
+                        } else {
+                            values[k].numbers[i] = node.boolean(slot_values.data()) ? 1 : 0;
+                        }
+                    }
+                }
+            });
+
+            // NaNs sort last (also in descending order), ties keep the source order
+            const auto less = [&](std::size_t a, std::size_t b) {
+                for (std::size_t k = 0; k < keys.size(); ++k) {
+                    const bool flip = keys[k].descending;
+                    if (keys[k].node.type == QueryType::String) {
+                        const auto &strings = values[k].strings;
+                        if (strings[a] != strings[b]) {
+                            return (strings[a] < strings[b]) != flip;
+                        }
+                    } else {
+                        const double x = values[k].numbers[a];
+                        const double y = values[k].numbers[b];
+                        if (std::isnan(x) != std::isnan(y)) {
+                            return std::isnan(y);
+                        }
+                        if (x != y && !std::isnan(x)) {
+                            return (x < y) != flip;
+                        }
+                    }
+                }
+                return a < b;
+            };
+            std::vector<std::size_t> order(n);
+            std::iota(order.begin(), order.end(), std::size_t(0));
+            if (limit < n) {
+                std::partial_sort(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(limit),
+                                  order.end(), less);
+                order.resize(limit);
+            } else {
+                std::sort(order.begin(), order.end(), less);
+            }
+            std::vector<std::size_t> sorted(order.size());
+            for (std::size_t i = 0; i < order.size(); ++i) {
+                sorted[i] = selected[order[i]];
+            }
+            selected = std::move(sorted);
+        }
+
+        inline std::size_t QueryPlan::count(const QueryRows &rows) const {
+            const std::size_t        chunks = chunkCount(rows.size);
+            std::vector<std::size_t> counts(chunks, 0);
+            const auto scan = [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                std::vector<const void *> values(slots.size());
+                for (std::size_t row = begin; row < end; ++row) {
+                    rows.fill(row, values.data());
+                    counts[chunk] += matches(values.data()) ? 1 : 0;
+                }
+            };
+            forEachChunk(rows.size, chunks, scan);
+            return std::min(std::accumulate(counts.begin(), counts.end(), std::size_t(0)), limit);
+        }
+
+        inline std::vector<QueryGroup>
+        QueryPlan::group(const QueryRows &rows, const QueryNode &key,
+                         const std::vector<std::size_t> &selected) const {
+            std::map<QueryValue, std::vector<std::size_t>, decltype(&queryValueLess)> groups(
+                &queryValueLess);
+            std::vector<const void *> values(slots.size());
+            for (const std::size_t row : selected) {
+                rows.fill(row, values.data());
+                groups[key.eval(values.data())].push_back(row);
+            }
+            std::vector<QueryGroup> result;
+            result.reserve(groups.size());
+            for (auto &[value, group_rows] : groups) {
+                result.push_back({value, std::move(group_rows)});
+            }
+            return result;
+        }
+
+    } // namespace detail
+
+    // ------------------------------------------------
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline Query<T> &Query<T>::where(std::string_view expression) {
+        detail::QueryParser parser(getTypeInfo(), plan_.slots, expression);
+        detail::QueryNode   node = parser.parseExpression();
+        if (node.type != detail::QueryType::Bool) {
+            throw QueryError("Query: \"" + std::string(expression) + "\" is not a condition");
+        }
+        plan_.filters.push_back(std::move(node));
+        return *this;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    template <typename M>
+    inline Query<T> &Query<T>::where(std::string_view                member_name,
+                                     std::function<bool(const M &)> predicate) {
+        const MemberInfo *member = getTypeInfo().getMember(std::string(member_name));
+        if (!member || member->type != std::type_index(typeid(M)) ||
+            member->offset == MemberInfo::no_offset) {
+            throw QueryError("Query: no member '" + std::string(member_name) + "' of type " +
+                             getTypeName<M>() + " in " + getTypeInfo().class_name);
+        }
+        const std::size_t slot = detail::querySlot(plan_.slots, member);
+        plan_.filters.push_back(detail::queryBool(
+            [slot, predicate = std::move(predicate)](detail::QuerySlots slots) {
+                return predicate(*static_cast<const M *>(slots[slot]));
+            }));
+        return *this;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline Query<T> &Query<T>::orderBy(std::string_view keys) {
+        detail::QueryParser parser(getTypeInfo(), plan_.slots, keys);
+        for (auto &key : parser.parseSortKeys()) {
+            plan_.keys.push_back(std::move(key));
+        }
+        return *this;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline Query<T> &Query<T>::limit(std::size_t count) {
+        plan_.limit = count;
+        return *this;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline Query<T> &Query<T>::parallelFrom(std::size_t rows) {
+        plan_.parallel = rows;
+        return *this;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline detail::QueryRows Query<T>::rows(const Table<T>                        &table,
+                                            const std::vector<const MemberInfo *> &slots) const {
+        detail::QueryRows result;
+        result.size = table.size();
+        for (const MemberInfo *member : slots) {
+            const ColumnStorage &column = table.columnStorage(member->name);
+            result.bases.push_back(static_cast<const unsigned char *>(column.data()));
+            result.strides.push_back(member->size);
+        }
+        return result;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    template <std::ranges::input_range R>
+    inline detail::QueryRows Query<T>::rows(const R                               &objects,
+                                            const std::vector<const MemberInfo *> &slots) const {
+        using Element = std::remove_cvref_t<std::ranges::range_reference_t<const R>>;
+        detail::QueryRows result;
+        if constexpr (std::ranges::contiguous_range<const R> && std::is_same_v<Element, T>) {
+            const auto *data = reinterpret_cast<const unsigned char *>(std::ranges::data(objects));
+            result.size      = static_cast<std::size_t>(std::ranges::size(objects));
+            for (const MemberInfo *member : slots) {
+                result.bases.push_back(data + member->offset);
+                result.strides.push_back(sizeof(T));
+            }
+        } else {
+            for (const T *object : objectsOf(objects)) {
+                result.objects.push_back(object);
+            }
+            result.size = result.objects.size();
+            for (const MemberInfo *member : slots) {
+                result.offsets.push_back(member->offset);
+            }
+        }
+        return result;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    template <std::ranges::input_range R>
+    inline std::vector<const T *> Query<T>::objectsOf(const R &objects) {
+        using Element = std::remove_cvref_t<std::ranges::range_reference_t<const R>>;
+        std::vector<const T *> result;
+        if constexpr (std::ranges::sized_range<const R>) {
+            result.reserve(static_cast<std::size_t>(std::ranges::size(objects)));
+        }
+        for (const auto &item : objects) {
+            if constexpr (detail::is_query_indirect_v<Element>) {
+                result.push_back(static_cast<const T *>(std::addressof(*item)));
+            } else {
+                result.push_back(static_cast<const T *>(std::addressof(item)));
+            }
+        }
+        return result;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline std::vector<std::size_t> Query<T>::indices(const Table<T> &table) const {
+        return plan_.run(rows(table, plan_.slots));
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    template <std::ranges::input_range R>
+    inline std::vector<std::size_t> Query<T>::indices(const R &objects) const {
+        return plan_.run(rows(objects, plan_.slots));
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline std::size_t Query<T>::count(const Table<T> &table) const {
+        return plan_.count(rows(table, plan_.slots));
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    template <std::ranges::input_range R>
+    inline std::size_t Query<T>::count(const R &objects) const {
+        return plan_.count(rows(objects, plan_.slots));
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    template <std::ranges::input_range R>
+    inline std::vector<const T *> Query<T>::select(const R &objects) const {
+        const std::vector<const T *> all = objectsOf(objects);
+        std::vector<const T *>       result;
+        for (const std::size_t row : indices(objects)) {
+            result.push_back(all[row]);
+        }
+        return result;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    template <typename Source>
+    inline std::vector<QueryGroup> Query<T>::groupRows(const Source    &source,
+                                                       std::string_view key) const {
+        detail::QueryPlan   plan = plan_;
+        detail::QueryParser parser(getTypeInfo(), plan.slots, key);
+        const auto          key_node    = parser.parseExpression();
+        const auto          source_rows = rows(source, plan.slots);
+        return plan.group(source_rows, key_node, plan.run(source_rows));
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline std::vector<QueryGroup> Query<T>::groupBy(const Table<T> &table,
+                                                     std::string_view key) const {
+        return groupRows(table, key);
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    template <std::ranges::input_range R>
+    inline std::vector<QueryGroup> Query<T>::groupBy(const R &objects, std::string_view key) const {
+        return groupRows(objects, key);
+    }
+
+} // namespace rosetta
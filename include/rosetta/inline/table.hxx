@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <stdexcept>
+#include <utility>
+
+namespace rosetta {
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline Table<T>::Table() {
+        for (const MemberInfo *member : getTypeInfo().getMembersInOrder()) {
+            if (member->make_column) {
+                columns_.push_back({member, member->make_column()});
+            }
+        }
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline Table<T>::Table(const Table &other) : size_(other.size_) {
+        columns_.reserve(other.columns_.size());
+        for (const Column &column : other.columns_) {
+            columns_.push_back({column.member, column.storage->clone()});
+        }
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline Table<T> &Table<T>::operator=(const Table &other) {
+        if (this != &other) {
+            Table copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void Table<T>::reserve(std::size_t rows) {
+        for (const Column &column : columns_) {
+            column.storage->reserve(rows);
+        }
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void Table<T>::clear() {
+        for (const Column &column : columns_) {
+            column.storage->clear();
+        }
+        size_ = 0;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void Table<T>::push_back(const T &value) {
+        std::size_t pushed = 0;
+        try {
+            for (; pushed < columns_.size(); ++pushed) {
+                columns_[pushed].storage->pushFrom(&value);
+            }
+        } catch (...) {
+            // Keep the columns aligned: drop the row from those already pushed
+            for (std::size_t i = 0; i < pushed; ++i) {
+                columns_[i].storage->erase(size_);
+            }
+            throw;
+        }
+        ++size_;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void Table<T>::erase(std::size_t row) {
+        checkRow(row);
+        for (const Column &column : columns_) {
+            column.storage->erase(row);
+        }
+        --size_;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void Table<T>::checkRow(std::size_t row) const {
+        if (row >= size_) {
+            throw std::out_of_range("Table: row " + std::to_string(row) + " out of range (size " +
+                                    std::to_string(size_) + ")");
+        }
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void Table<T>::read(std::size_t row, T &out) const {
+        checkRow(row);
+        for (const Column &column : columns_) {
+            column.storage->loadInto(row, &out);
+        }
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline T Table<T>::get(std::size_t row) const {
+        T result{};
+        read(row, result);
+        return result;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline void Table<T>::set(std::size_t row, const T &value) {
+        checkRow(row);
+        for (const Column &column : columns_) {
+            column.storage->storeFrom(row, &value);
+        }
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline const typename Table<T>::Column *Table<T>::find(std::string_view member_name) const {
+        for (const Column &column : columns_) {
+            if (column.member->name == member_name) {
+                return &column;
+            }
+        }
+        return nullptr;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline const typename Table<T>::Column &Table<T>::require(std::string_view member_name) const {
+        const Column *column = find(member_name);
+        if (!column) {
+            throw std::runtime_error("No column '" + std::string(member_name) + "' in table of " +
+                                     getTypeInfo().class_name);
+        }
+        return *column;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline ColumnStorage &Table<T>::columnStorage(std::string_view member_name) {
+        return *require(member_name).storage;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline const ColumnStorage &Table<T>::columnStorage(std::string_view member_name) const {
+        return *require(member_name).storage;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    template <typename M>
+    inline std::span<M> Table<T>::column(std::string_view member_name) {
+        const auto span = std::as_const(*this).template column<M>(member_name);
+        return {const_cast<M *>(span.data()), span.size()};
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    template <typename M>
+    inline std::span<const M> Table<T>::column(std::string_view member_name) const {
+        const Column &found = require(member_name);
+        if (found.storage->elementType() != std::type_index(typeid(M))) {
+            throw std::runtime_error("Column '" + found.member->name + "' holds " +
+                                     found.member->type_name + ", not " + getTypeName<M>());
+        }
+        // bool cells are a struct holding the bool
+        return {static_cast<const M *>(found.storage->data()), size_};
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline bool Table<T>::hasColumn(std::string_view member_name) const {
+        return find(member_name) != nullptr;
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    inline std::vector<std::string> Table<T>::columnNames() const {
+        std::vector<std::string> names;
+        names.reserve(columns_.size());
+        for (const Column &column : columns_) {
+            names.push_back(column.member->name);
+        }
+        return names;
+    }
+
+    // ------------------------------------------------
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    template <bool Const>
+    inline std::any
+    Table<T>::BasicRow<Const>::getMemberValue(const std::string &member_name) const {
+        table_->checkRow(index_);
+        return table_->columnStorage(member_name).get(index_);
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    template <bool Const>
+    inline void Table<T>::BasicRow<Const>::setMemberValue(const std::string &member_name,
+                                                          const Arg         &value) const
+        requires(!Const)
+    {
+        table_->checkRow(index_);
+        table_->columnStorage(member_name).set(index_, value);
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    template <bool Const>
+    inline bool Table<T>::BasicRow<Const>::hasMember(const std::string &name) const {
+        return table_->hasColumn(name);
+    }
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    template <bool Const>
+    template <typename M>
+    inline auto &Table<T>::BasicRow<Const>::get(std::string_view member_name) const {
+        table_->checkRow(index_);
+        return table_->template column<M>(member_name)[index_];
+    }
+
+} // namespace rosetta
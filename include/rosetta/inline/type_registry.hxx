@@ -3,6 +3,7 @@
  * LGPL v3 license
  *
  */
+#include <mutex>
 #include <typeinfo>
 
 namespace rosetta {
@@ -46,12 +47,14 @@ namespace rosetta {
     template <typename T> inline void TypeNameRegistry::register_type(const std::string& name)
     {
         using BaseType = std::remove_cv_t<std::remove_reference_t<T>>;
+        std::unique_lock lock(mutex);
         type_names[std::type_index(typeid(BaseType))] = name;
     }
 
     template <typename T> inline std::string TypeNameRegistry::get_name() const
     {
         using BaseType = std::remove_cv_t<std::remove_reference_t<T>>;
+        std::shared_lock lock(mutex);
         auto it = type_names.find(std::type_index(typeid(BaseType)));
         return (it != type_names.end()) ? it->second : "";
     }
@@ -59,11 +62,13 @@ namespace rosetta {
     template <typename T> inline bool TypeNameRegistry::is_registered() const
     {
         using BaseType = std::remove_cv_t<std::remove_reference_t<T>>;
+        std::shared_lock lock(mutex);
         return type_names.find(std::type_index(typeid(BaseType))) != type_names.end();
     }
 
     inline std::vector<std::string> TypeNameRegistry::get_all_registered_types() const
     {
+        std::shared_lock lock(mutex);
         std::vector<std::string> names;
         names.reserve(type_names.size());
         for (const auto& [idx, name] : type_names) {
@@ -3,6 +3,7 @@
  * LGPL v3 license
  * 
  */
+#include <cstdint>
 #include <stdexcept>
 
 namespace rosetta {
@@ -20,8 +21,8 @@ namespace rosetta {
         using BaseType = std::remove_cv_t<std::remove_reference_t<T>>;
 
         // First, check if type is registered in the user registry
-        if (TypeNameRegistry::instance().is_registered<BaseType>()) {
-            return TypeNameRegistry::instance().get_name<BaseType>();
+        if (auto name = TypeNameRegistry::instance().get_name<BaseType>(); !name.empty()) {
+            return name;
         }
 
         // Built-in string types
@@ -96,6 +97,89 @@ namespace rosetta {
         return "vector<string>";
     }
 
+    template <typename T> constexpr NumericType numericTypeOf()
+    {
+        using BaseType = std::remove_cv_t<std::remove_reference_t<T>>;
+        static_assert(is_vectorizable_v<BaseType>,
+            "Type must be arithmetic (and not bool or long double)");
+
+        if constexpr (std::is_floating_point_v<BaseType>) {
+            static_assert(sizeof(BaseType) == 4 || sizeof(BaseType) == 8,
+                "Only 32 and 64 bits floating point types are supported");
+            return sizeof(BaseType) == 4 ? NumericType::Float32 : NumericType::Float64;
+        } else if constexpr (sizeof(BaseType) == 1) {
+            return std::is_signed_v<BaseType> ? NumericType::Int8 : NumericType::UInt8;
+        } else if constexpr (sizeof(BaseType) == 2) {
+            return std::is_signed_v<BaseType> ? NumericType::Int16 : NumericType::UInt16;
+        } else if constexpr (sizeof(BaseType) == 4) {
+            return std::is_signed_v<BaseType> ? NumericType::Int32 : NumericType::UInt32;
+        } else {
+            return std::is_signed_v<BaseType> ? NumericType::Int64 : NumericType::UInt64;
+        }
+    }
+
+    constexpr std::size_t numericTypeSize(NumericType type)
+    {
+        switch (type) {
+        case NumericType::Int8:
+        case NumericType::UInt8:
+            return 1;
+        case NumericType::Int16:
+        case NumericType::UInt16:
+            return 2;
+        case NumericType::Int32:
+        case NumericType::UInt32:
+        case NumericType::Float32:
+            return 4;
+        default:
+            return 8;
+        }
+    }
+
+    template <typename Visitor>
+    inline decltype(auto) visitNumericType(NumericType type, Visitor&& visitor)
+    {
+        switch (type) {
+        case NumericType::Int8:
+            return visitor(std::type_identity<int8_t> {});
+        case NumericType::UInt8:
+            return visitor(std::type_identity<uint8_t> {});
+        case NumericType::Int16:
+            return visitor(std::type_identity<int16_t> {});
+        case NumericType::UInt16:
+            return visitor(std::type_identity<uint16_t> {});
+        case NumericType::Int32:
+            return visitor(std::type_identity<int32_t> {});
+        case NumericType::UInt32:
+            return visitor(std::type_identity<uint32_t> {});
+        case NumericType::Int64:
+            return visitor(std::type_identity<int64_t> {});
+        case NumericType::UInt64:
+            return visitor(std::type_identity<uint64_t> {});
+        case NumericType::Float32:
+            return visitor(std::type_identity<float> {});
+        default:
+            return visitor(std::type_identity<double> {});
+        }
+    }
+
+    namespace detail {
+
+        /**
+         * @brief Offset of a data member from the start of the object, computed
+         * from the member pointer on uninitialized storage (no instance needed)
+         */
+        template <typename Class, typename MemberType>
+        inline std::size_t memberOffset(MemberType Class::* member_ptr)
+        {
+            alignas(Class) static unsigned char storage[sizeof(Class)];
+            const auto* obj = reinterpret_cast<const Class*>(storage);
+            return static_cast<std::size_t>(
+                reinterpret_cast<const unsigned char*>(&(obj->*member_ptr)) - storage);
+        }
+
+    } // namespace detail
+
     // Rest of the file remains the same...
 
     template <typename Class>
@@ -103,16 +187,82 @@ namespace rosetta {
     inline TypeRegistrar<Class>& TypeRegistrar<Class>::member(
         const std::string& name, MemberType Class::* member_ptr)
     {
-        info.addMember(std::make_unique<MemberInfo>(
+        auto member = std::make_unique<MemberInfo>(
             name, getTypeName<MemberType>(),
             [member_ptr](const void* obj) -> std::any {
                 const auto* typed_obj = static_cast<const Class*>(obj);
                 return std::any { typed_obj->*member_ptr };
             },
-            [member_ptr](void* obj, const std::any& value) {
-                auto* typed_obj = static_cast<Class*>(obj);
+            nullptr);
+        member->setter = [member_ptr, type_info = &info, self = member.get()](
+                             void* obj, const std::any& value) {
+            auto* typed_obj = static_cast<Class*>(obj);
+            typed_obj->*member_ptr = std::any_cast<MemberType>(value);
+            type_info->notifyMemberChanged(obj, *self);
+        };
+        member->address = [member_ptr](void* obj) -> void* {
+            return &(static_cast<Class*>(obj)->*member_ptr);
+        };
+        member->type = typeid(MemberType);
+        member->member_pointer = member_ptr;
+        member->offset = detail::memberOffset(member_ptr);
+        member->size = sizeof(MemberType);
+        member->trivially_copyable = std::is_trivially_copyable_v<MemberType>;
+        if constexpr (is_binary_serializable_v<MemberType>) {
+            member->encode = [member_ptr](const void* obj, BinaryWriter& writer) {
+                BinaryTraits<MemberType>::encode(
+                    writer, static_cast<const Class*>(obj)->*member_ptr);
+            };
+            member->decode = [member_ptr](void* obj, BinaryReader& reader) {
+                BinaryTraits<MemberType>::decode(reader, static_cast<Class*>(obj)->*member_ptr);
+            };
+            member->binary_raw = detail::is_binary_raw_v<MemberType>;
+        }
+        if constexpr (is_json_serializable_v<MemberType>) {
+            member->write_json = [member_ptr](const void* obj, JsonWriter& writer) {
+                JsonTraits<MemberType>::write(writer, static_cast<const Class*>(obj)->*member_ptr);
+            };
+            member->read_json = [member_ptr](void* obj, JsonReader& reader) {
+                JsonTraits<MemberType>::read(reader, static_cast<Class*>(obj)->*member_ptr);
+            };
+        }
+        if constexpr (is_arrow_exportable_v<MemberType>) {
+            member->to_arrow = &ArrowTraits<MemberType>::exportValues;
+            member->from_arrow = &ArrowTraits<MemberType>::importValues;
+        }
+        if constexpr (is_dlpack_exportable_v<MemberType>) {
+            member->dlpack_buffer = &DLPackTraits<MemberType>::buffer;
+        }
+        if constexpr (std::is_default_constructible_v<MemberType>
+            && std::is_copy_assignable_v<MemberType>) {
+            member->make_column = [member_ptr]() -> std::unique_ptr<ColumnStorage> {
+                return std::make_unique<TypedColumn<Class, MemberType>>(member_ptr);
+            };
+        }
+        info.addMember(std::move(member));
+        return *this;
+    }
+
+    template <typename Class>
+    template <typename MemberType>
+    inline TypeRegistrar<Class>& TypeRegistrar<Class>::member_observable(
+        const std::string& name, MemberType Class::* member_ptr)
+    {
+        member(name, member_ptr);
+        MemberInfo* self = info.members.at(name).get();
+        self->observable = true;
+        self->setter = [member_ptr, type_info = &info, self](void* obj, const std::any& value) {
+            auto* typed_obj = static_cast<Class*>(obj);
+            if (!type_info->hasPropertySubscribers(obj)) {
                 typed_obj->*member_ptr = std::any_cast<MemberType>(value);
-            }));
+                type_info->notifyMemberChanged(obj, *self);
+                return;
+            }
+            std::any old_value { typed_obj->*member_ptr };
+            typed_obj->*member_ptr = std::any_cast<MemberType>(value);
+            type_info->notifyMemberChanged(obj, *self);
+            emitPropertyChange(*type_info, obj, *self, std::move(old_value), value);
+        };
         return *this;
     }
 
@@ -158,7 +308,7 @@ namespace rosetta {
     inline TypeRegistrar<Class>& TypeRegistrar<Class>::method(
         const std::string& name, ReturnType (Class::*method_ptr)(Args...))
     {
-        info.addMethod(std::make_unique<MethodInfo>(name, getTypeName<ReturnType>(),
+        auto method = std::make_unique<MethodInfo>(name, getTypeName<ReturnType>(),
             createParameterTypeVector<Args...>(),
             [method_ptr, name](void* obj, const std::vector<std::any>& args) -> std::any {
                 auto* typed_obj = static_cast<Class*>(obj);
@@ -173,7 +323,9 @@ namespace rosetta {
                 // Use index_sequence to unpack arguments
                 return callMethodImpl(
                     typed_obj, method_ptr, args, std::index_sequence_for<Args...> {});
-            }));
+            });
+        method->method_pointer = method_ptr;
+        info.addMethod(std::move(method));
         return *this;
     }
 
@@ -183,7 +335,7 @@ namespace rosetta {
     inline TypeRegistrar<Class>& TypeRegistrar<Class>::method(
         const std::string& name, ReturnType (Class::*method_ptr)(Args...) const)
     {
-        info.addMethod(std::make_unique<MethodInfo>(name, getTypeName<ReturnType>(),
+        auto method = std::make_unique<MethodInfo>(name, getTypeName<ReturnType>(),
             createParameterTypeVector<Args...>(),
             [method_ptr, name](void* obj, const std::vector<std::any>& args) -> std::any {
                 auto* typed_obj = static_cast<Class*>(obj);
@@ -198,7 +350,29 @@ namespace rosetta {
                 // Use index_sequence to unpack arguments
                 return callConstMethodImpl(
                     typed_obj, method_ptr, args, std::index_sequence_for<Args...> {});
-            }));
+            });
+        method->method_pointer = method_ptr;
+        info.addMethod(std::move(method));
+        return *this;
+    }
+
+    template <typename Class>
+    template <typename ReturnType, typename... Args>
+    inline TypeRegistrar<Class>& TypeRegistrar<Class>::method(
+        const std::string& name, ReturnType (Class::*method_ptr)(Args...), AsyncMethod)
+    {
+        method(name, method_ptr);
+        info.methods.at(name)->async = true;
+        return *this;
+    }
+
+    template <typename Class>
+    template <typename ReturnType, typename... Args>
+    inline TypeRegistrar<Class>& TypeRegistrar<Class>::method(
+        const std::string& name, ReturnType (Class::*method_ptr)(Args...) const, AsyncMethod)
+    {
+        method(name, method_ptr);
+        info.methods.at(name)->async = true;
         return *this;
     }
 
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+namespace rosetta {
+
+    inline WorkerPool::WorkerPool(std::size_t threads) {
+        threads = std::max<std::size_t>(threads, 1);
+        workers.reserve(threads);
+        for (std::size_t i = 0; i < threads; ++i) {
+            workers.emplace_back([this] { run(); });
+        }
+    }
+
+    inline WorkerPool::~WorkerPool() {
+        {
+            std::lock_guard lock(mutex);
+            stopping = true;
+        }
+        available.notify_all();
+        for (auto &worker : workers) {
+            worker.join();
+        }
+    }
+
+    inline WorkerPool &WorkerPool::shared() {
+        static WorkerPool pool;
+        return pool;
+    }
+
+    inline void WorkerPool::submit(std::function<void()> task) {
+        {
+            std::lock_guard lock(mutex);
+            tasks.push_back(std::move(task));
+        }
+        available.notify_one();
+    }
+
+    inline void WorkerPool::parallelFor(std::size_t                              count,
+                                        const std::function<void(std::size_t)> &body) {
+        if (count == 0) {
+            return;
+        }
+        // Shared with the helper tasks, which may start after the loop is over:
+        // they then find no index left and never touch `body`
+        struct Loop {
+            std::atomic<std::size_t>                next{0};
+            std::size_t                             count;
+            std::size_t                             completed = 0;
+            const std::function<void(std::size_t)> *body;
+            std::exception_ptr                      error;
+            std::mutex                              mutex;
+            std::condition_variable                 done;
+        };
+        auto loop   = std::make_shared<Loop>();
+        loop->count = count;
+        loop->body  = &body;
+
+        const auto work = [](Loop &state) {
+            for (std::size_t i; (i = state.next.fetch_add(1)) < state.count;) {
+                std::exception_ptr error;
+                try {
+                    (*state.body)(i);
+                } catch (...) {
+                    error = std::current_exception();
+                }
+                std::lock_guard lock(state.mutex);
+                if (error && !state.error) {
+                    state.error = error;
+                }
+                if (++state.completed == state.count) {
+                    state.done.notify_all();
+                }
+            }
+        };
+
+        const std::size_t helpers = std::min(count, workers.size() + 1) - 1;
+        for (std::size_t i = 0; i < helpers; ++i) {
+            submit([loop, work] { work(*loop); });
+        }
+        work(*loop);
+
+        std::unique_lock lock(loop->mutex);
+        loop->done.wait(lock, [&] { return loop->completed == loop->count; });
+        if (loop->error) {
+            std::rethrow_exception(loop->error);
+        }
+    }
+
+    inline std::size_t WorkerPool::size() const { return workers.size(); }
+
+    inline void WorkerPool::run() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(mutex);
+                available.wait(lock, [this] { return stopping || !tasks.empty(); });
+                if (tasks.empty()) {
+                    return; // stopping, and nothing left to run
+                }
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            try {
+                task();
+            } catch (...) {
+            }
+        }
+    }
+
+} // namespace rosetta
@@ -34,7 +34,35 @@ namespace rosetta {
         void printMemberValue(const std::string &member_name) const;
         void printClassInfo() const;
 
+        /**
+         * @brief The members as a JSON object (nested objects and vectors included,
+         * see json.h)
+         */
         std::string toJSON() const;
+        void        toJSON(JsonWriter &writer) const;
+
+        /**
+         * @brief Set the members from a JSON object (unknown keys are ignored)
+         * @throws std::runtime_error on malformed JSON or mismatching values
+         */
+        void fromJSON(std::string_view json);
+        void fromJSON(JsonReader &reader);
+
+        /**
+         * @brief Binary encoding of the members, after a header with the format
+         * version and a hash of the layout (see binary.h)
+         * @throws std::runtime_error if a member is not binary serializable
+         */
+        std::vector<std::uint8_t> toBinary() const;
+        void toBinary(std::vector<std::uint8_t> &buffer) const; // appends to `buffer`
+
+        /**
+         * @brief Restore the members from toBinary() data
+         * @throws std::runtime_error if the data was written for another layout,
+         * or is truncated
+         */
+        void fromBinary(const void *data, std::size_t size);
+        void fromBinary(const std::vector<std::uint8_t> &data);
     };
 
 } // namespace rosetta
@@ -44,7 +72,8 @@ namespace rosetta {
  * This macro should be placed in the public section of the class definition. It
  * defines the necessary static and instance methods to provide TypeInfo for
  * the class. The static method getStaticTypeInfo() initializes and returns a
- * singleton TypeInfo instance for the class. The instance method getTypeInfo()
+ * singleton TypeInfo instance for the class (thread-safe: the registration runs
+ * once, in a static initializer). The instance method getTypeInfo()
  * overrides the pure virtual method from Introspectable to return the static
  * TypeInfo. The macro also declares a private static method
  * registerIntrospection() that must be implemented by the user to register the
@@ -57,11 +86,11 @@ namespace rosetta {
 public:                                                                       \
     static rosetta::TypeInfo &getStaticTypeInfo() {                           \
         static rosetta::TypeInfo info(#ClassName);                            \
-        static bool              initialized = false;                         \
-        if (!initialized) {                                                   \
+        static const bool        initialized = [] {                           \
             registerIntrospection(rosetta::TypeRegistrar<ClassName>(info));   \
-            initialized = true;                                               \
-        }                                                                     \
+            return true;                                                      \
+        }();                                                                  \
+        (void)initialized;                                                    \
         return info;                                                          \
     }                                                                         \
     const rosetta::TypeInfo &getTypeInfo() const override {                   \
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <rosetta/binary.h>
+#include <rosetta/enum_registry.h>
+#include <rosetta/info.h>
+#include <rosetta/observable.h>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace rosetta {
+
+    /**
+     * @brief Streaming JSON encoder.
+     *
+     * Appends compact JSON to a caller-provided string. With a sink, the text is
+     * handed over each time the buffer grows past a threshold (and by flush()),
+     * so that writing any number of documents (e.g. NDJSON, one per line) takes
+     * bounded memory. Numbers are formatted with std::to_chars (shortest
+     * round-trip representation); NaN and infinities are written as null.
+     */
+    class JsonWriter {
+    public:
+        using Sink = std::function<void(std::string_view text)>;
+
+        explicit JsonWriter(std::string &buffer, Sink sink = nullptr,
+                            std::size_t flush_threshold = 64 * 1024);
+
+        void beginObject();
+        void endObject();
+        void key(std::string_view name);
+        void beginArray();
+        void endArray();
+
+        void null();
+        void value(bool value);
+        void value(std::string_view value);
+        void value(const char *value) { this->value(std::string_view(value)); }
+        void value(const std::string &value) { this->value(std::string_view(value)); }
+
+        /**
+         * @brief Integers and floating point numbers
+         */
+        template <typename T>
+            requires(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+        void value(T number);
+
+        /**
+         * @brief End a top-level value with a newline (NDJSON)
+         */
+        void newline();
+
+        /**
+         * @brief Hand the buffered text to the sink (no-op without sink). Must be
+         * called once done writing.
+         */
+        void flush();
+
+        std::string &buffer();
+
+    private:
+        void prefix(); // separator before a value or a key
+        void maybeFlush();
+        void writeEscaped(std::string_view text);
+
+        std::string      &out_;
+        Sink              sink_;
+        std::size_t       threshold_;
+        std::vector<bool> first_; // per open object / array: nothing written yet
+        bool              after_key_ = false;
+    };
+
+    /**
+     * @brief Pull (SAX-style) JSON parser: values are read in document order,
+     * without building a tree.
+     *
+     * Strings returned by readString() and nextKey() view either the input or an
+     * internal scratch buffer (escaped strings), and are valid until the next
+     * read. Errors throw std::runtime_error with the offset in the input.
+     *
+     * @example
+     * ```cpp
+     * JsonReader reader(text);
+     * reader.beginObject();
+     * std::string_view key;
+     * while (reader.nextKey(key)) {
+     *     if (key == "x") x = reader.readNumber<double>();
+     *     else reader.skipValue();
+     * }
+     * ```
+     */
+    class JsonReader {
+    public:
+        enum class Token { Null, Bool, Number, String, Object, Array, End };
+
+        explicit JsonReader(std::string_view text);
+
+        /**
+         * @brief Type of the next value (End: no more input)
+         */
+        Token peek();
+
+        void beginObject();
+        /**
+         * @brief Read the next key of the current object
+         * @return false at the end of the object (which is consumed)
+         */
+        bool nextKey(std::string_view &key);
+
+        void beginArray();
+        /**
+         * @brief Move to the next element of the current array
+         * @return false at the end of the array (which is consumed)
+         */
+        bool nextElement();
+
+        void             readNull();
+        bool             readBool();
+        std::string_view readString();
+        /**
+         * @brief Read a number (strict JSON syntax). A floating point T also
+         * accepts null, written for NaN and infinities, and reads it as NaN.
+         */
+        template <typename T>
+            requires(std::is_arithmetic_v<T> && !std::is_same_v<T, bool>)
+        T readNumber();
+
+        /**
+         * @brief Skip the next value (nested objects and arrays included)
+         */
+        void skipValue();
+
+        /**
+         * @brief True if only whitespace is left (e.g. after the last NDJSON line)
+         */
+        bool atEnd();
+
+        std::size_t position() const { return pos_; }
+
+    private:
+        [[noreturn]] void error(const std::string &message) const;
+        void              skipWhitespace();
+        void              expect(char c);
+        std::string_view  numberText();
+
+        std::string_view  text_;
+        std::size_t       pos_ = 0;
+        std::string       scratch_;
+        std::vector<bool> first_; // per open object / array: no element read yet
+    };
+
+    /**
+     * @brief JSON codec of a C++ type, selected at compile time (see BinaryTraits).
+     * Specializations provide `write(JsonWriter&, const T&)` and
+     * `read(JsonReader&, T&)`. Supported: arithmetic types, enums (value names
+     * when registered, numbers otherwise), std::string, introspectable classes
+     * (nested objects), std::vector and std::array of supported types.
+     */
+    template <typename T> struct JsonTraits {
+        static constexpr bool supported = false;
+    };
+
+    template <typename T>
+    inline constexpr bool is_json_serializable_v = JsonTraits<std::remove_cv_t<T>>::supported;
+
+    /**
+     * @brief Write the members of `obj` as a JSON object (members whose type has
+     * no JSON codec are skipped)
+     */
+    void writeObjectJSON(const TypeInfo &type_info, const void *obj, JsonWriter &writer);
+
+    /**
+     * @brief Read a JSON object into the members of `obj`. Unknown keys are
+     * skipped, missing members keep their value.
+     */
+    void readObjectJSON(const TypeInfo &type_info, void *obj, JsonReader &reader);
+
+} // namespace rosetta
+
+#include "inline/json.hxx"
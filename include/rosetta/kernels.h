@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <rosetta/types.h>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define ROSETTA_SIMD_DISPATCH 1
+#else
+#define ROSETTA_SIMD_DISPATCH 0
+#endif
+
+/**
+ * @brief Vectorised reductions and transforms over numeric columns.
+ *
+ * The kernels run over contiguous ranges of numbers (e.g. `Table::column()`,
+ * std::vector or the result of gatherMember()) and over type-erased
+ * ColumnStorage (used by the bindings). On x86 with GCC or Clang the
+ * implementation is selected at runtime among SSE2, AVX2 and AVX-512, with a
+ * portable scalar fallback elsewhere.
+ *
+ * All the implementations process the values in blocks of the same number of
+ * lanes and combine the lanes in the same order, so the results do not depend
+ * on the instruction set (setSimdLevel(SimdLevel::Scalar) gives the reference
+ * results). Floating point sums, dot products and moments are accumulated in
+ * double, integer ones in 64 bits.
+ *
+ * @example
+ * ```cpp
+ * Table<GameObject> objects = ...;
+ * float total = kernels::sum(objects.column<float>("health"));
+ * auto [lowest, highest] = kernels::minMax(objects.column<float>("health"));
+ * kernels::clamp(objects.column<float>("health"), 0.0f, 100.0f);
+ * ```
+ */
+namespace rosetta::kernels {
+
+    enum class SimdLevel : unsigned char { Scalar, SSE2, AVX2, AVX512 };
+
+    const char *simdLevelName(SimdLevel level);
+
+    /**
+     * @brief Best instruction set supported by both the build and the CPU
+     */
+    SimdLevel detectedSimdLevel();
+
+    /**
+     * @brief Instruction set used by the kernels (detectedSimdLevel() by default)
+     */
+    SimdLevel simdLevel();
+
+    /**
+     * @brief Select the instruction set, e.g. Scalar to compare the results.
+     * Levels not supported by the CPU are lowered to detectedSimdLevel().
+     * @return the level in use
+     */
+    SimdLevel setSimdLevel(SimdLevel level);
+
+    /**
+     * @brief Type of the sums and dot products of values of type E
+     */
+    template <typename E>
+    using accumulator_t =
+        std::conditional_t<std::is_floating_point_v<E>, double,
+                           std::conditional_t<std::is_signed_v<E>, std::int64_t, std::uint64_t>>;
+
+    template <typename E> struct MinMax {
+        E min;
+        E max;
+    };
+
+    /**
+     * @brief Mean and population variance
+     */
+    struct Moments {
+        double mean     = 0;
+        double variance = 0;
+    };
+
+    namespace detail {
+
+        template <typename R>
+        using range_element_t = std::remove_cv_t<std::ranges::range_value_t<R>>;
+
+        template <typename R>
+        concept NumericRange =
+            std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+            is_numeric_v<range_element_t<R>>;
+
+        template <typename R>
+        concept MutableNumericRange =
+            NumericRange<R> &&
+            !std::is_const_v<std::remove_reference_t<std::ranges::range_reference_t<R>>>;
+
+    } // namespace detail
+
+    // ------------------------------------------------
+    // Contiguous ranges of numbers
+    // ------------------------------------------------
+
+    template <detail::NumericRange R>
+    accumulator_t<detail::range_element_t<R>> sum(const R &values);
+
+    /**
+     * @throws std::runtime_error if values is empty
+     */
+    template <detail::NumericRange R>
+    MinMax<detail::range_element_t<R>> minMax(const R &values);
+
+    /**
+     * @throws std::runtime_error if values is empty
+     */
+    template <detail::NumericRange R> Moments meanVariance(const R &values);
+
+    /**
+     * @throws std::runtime_error if the sizes differ
+     */
+    template <detail::NumericRange R1, detail::NumericRange R2>
+        requires std::is_same_v<detail::range_element_t<R1>, detail::range_element_t<R2>>
+    accumulator_t<detail::range_element_t<R1>> dot(const R1 &x, const R2 &y);
+
+    /**
+     * @brief y = alpha * x + y (computed in the element type)
+     * @throws std::runtime_error if the sizes differ
+     */
+    template <detail::NumericRange R1, detail::MutableNumericRange R2>
+        requires std::is_same_v<detail::range_element_t<R1>, detail::range_element_t<R2>>
+    void axpy(detail::range_element_t<R1> alpha, const R1 &x, R2 &&y);
+
+    /**
+     * @brief Clamp the values to [lo, hi] in place
+     */
+    template <detail::MutableNumericRange R>
+    void clamp(R &&values, detail::range_element_t<R> lo, detail::range_element_t<R> hi);
+
+    /**
+     * @brief Counts of the values in `bins` equal bins over [lo, hi] (the last
+     * bin includes hi). Values outside of [lo, hi] and NaNs are not counted.
+     * @throws std::runtime_error if bins is 0 or hi <= lo
+     */
+    template <detail::NumericRange R>
+    std::vector<std::uint64_t> histogram(const R &values, double lo, double hi, std::size_t bins);
+
+    /**
+     * @brief Copy a numeric member of many registered objects into a contiguous
+     * array, to run the kernels on it. The range holds objects or pointers.
+     * @throws std::runtime_error if the member does not exist or is not an E
+     */
+    template <typename E, std::ranges::input_range R>
+    std::vector<E> gatherMember(const R &objects, std::string_view member_name);
+
+    // ------------------------------------------------
+    // Type-erased columns (e.g. for the bindings). They throw
+    // std::runtime_error if a column is not numeric, and the binary kernels if
+    // the columns differ in type or size. The bounds of clamp are limited to
+    // the column type (rounded inwards for integers), and it throws if lo > hi
+    // or a bound is NaN. On integral columns, axpy throws if alpha is not an
+    // integer of the column type.
+    // ------------------------------------------------
+
+    double                     sum(const ColumnStorage &column);
+    MinMax<double>             minMax(const ColumnStorage &column);
+    Moments                    meanVariance(const ColumnStorage &column);
+    double                     dot(const ColumnStorage &x, const ColumnStorage &y);
+    void                       axpy(double alpha, const ColumnStorage &x, ColumnStorage &y);
+    void                       clamp(ColumnStorage &column, double lo, double hi);
+    std::vector<std::uint64_t> histogram(const ColumnStorage &column, double lo, double hi,
+                                         std::size_t bins);
+
+} // namespace rosetta::kernels
+
+#include "inline/kernels.hxx"
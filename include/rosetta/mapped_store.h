@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <ranges>
+#include <rosetta/binary.h>
+#include <rosetta/info.h>
+#include <rosetta/types.h>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace rosetta {
+
+    /**
+     * @brief Version of the file layout written by MappedStoreWriter
+     */
+    inline constexpr std::uint16_t mapped_store_format_version = 1;
+
+    /**
+     * @brief Read-only memory mapping of a whole file (mmap, or a file mapping
+     * on Windows). The pages are shared with the other processes mapping the
+     * same file.
+     */
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        /**
+         * @throws std::runtime_error if the file cannot be opened or mapped
+         */
+        explicit MappedFile(const std::string &path);
+        ~MappedFile();
+
+        MappedFile(MappedFile &&other) noexcept;
+        MappedFile &operator=(MappedFile &&other) noexcept;
+        MappedFile(const MappedFile &)            = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        const std::uint8_t *data() const { return data_; }
+        std::size_t         size() const { return size_; }
+
+    private:
+        void unmap();
+
+        const std::uint8_t *data_ = nullptr;
+        std::size_t         size_ = 0;
+#ifdef _WIN32
+        void *file_    = nullptr;
+        void *mapping_ = nullptr;
+#endif
+    };
+
+    /**
+     * @brief Fixed-size record layout of a registered class, in registration
+     * order. Each member gets a slot:
+     * - Raw: the bytes of a member whose binary encoding is its bytes
+     *   (arithmetic, or a class opted in with REGISTER_BINARY_RAW)
+     * - String: the characters of a std::string, in the heap
+     * - Array: the elements of a std::vector of numbers, in the heap
+     * - Encoded: the binary encoding (encodeObject) of any other serializable
+     *   member, in the heap
+     *
+     * Heap slots hold the offset and the byte length of their block. Members
+     * without binary codec are not stored.
+     */
+    class MappedLayout {
+    public:
+        enum class SlotKind : std::uint8_t { Raw, String, Array, Encoded };
+
+        struct Slot {
+            const MemberInfo *member;
+            SlotKind          kind;
+            std::size_t       offset; // in the record
+            std::size_t       size;   // Raw: size of the member, otherwise a heap reference
+            NumericType       element = NumericType::Float64; // Array
+        };
+
+        static constexpr std::size_t heap_ref_size = 2 * sizeof(std::uint64_t);
+
+        explicit MappedLayout(const TypeInfo &type_info);
+
+        const std::vector<Slot> &slots() const { return slots_; }
+        std::size_t              recordSize() const { return record_size_; }
+
+        /**
+         * @brief Schema hash (see binarySchemaHash) combined with the slot layout
+         */
+        std::uint64_t fingerprint() const { return fingerprint_; }
+
+        const Slot *find(std::string_view member_name) const;
+
+    private:
+        std::vector<Slot> slots_;
+        std::size_t       record_size_ = 0;
+        std::uint64_t     fingerprint_ = 0;
+    };
+
+    /**
+     * @brief Writes records of a registered class to a MappedStore file.
+     *
+     * Records are streamed to the file as they are appended; the heap of the
+     * strings and vectors is kept in memory until close().
+     */
+    class MappedStoreWriter {
+    public:
+        /**
+         * @throws std::runtime_error if the file cannot be created
+         */
+        MappedStoreWriter(const std::string &path, const TypeInfo &type_info);
+        ~MappedStoreWriter(); // closes, ignoring errors
+
+        MappedStoreWriter(const MappedStoreWriter &)            = delete;
+        MappedStoreWriter &operator=(const MappedStoreWriter &) = delete;
+
+        /**
+         * @brief Append the members of `obj` (an instance of the class of the
+         * TypeInfo) as the next record
+         */
+        void append(const void *obj);
+
+        /**
+         * @brief Write the heap and the header
+         * @throws std::runtime_error on write failure
+         */
+        void close();
+
+        std::size_t size() const { return count_; }
+
+    private:
+        void writeHeapBlock(const void *data, std::size_t bytes, std::uint8_t *ref);
+
+        MappedLayout              layout_;
+        std::string               path_;
+        std::ofstream             out_;
+        std::vector<std::uint8_t> record_;
+        std::vector<std::uint8_t> heap_;
+        std::vector<std::uint8_t> encoded_;
+        std::size_t               count_  = 0;
+        bool                      closed_ = false;
+    };
+
+    /**
+     * @brief Memory-mapped, read-only collection of records of a registered class.
+     *
+     * Opening a store only maps the file and checks its header, whatever the
+     * number of records: records are decoded on access, and the OS pages the
+     * file in and shares it between processes. Strings and numeric vectors can
+     * be viewed in place (getString, getArray), any member can be read through
+     * the reflection API (getMemberValue), and whole records can be
+     * materialized (get).
+     *
+     * The file layout is the native one (byte order, type sizes), so a store is
+     * meant to be reopened on the same platform. It is checked against the
+     * current registration of the class when opened.
+     *
+     * @example
+     * ```cpp
+     * MappedStore<Particle>::write("particles.rst", particles);
+     *
+     * MappedStore<Particle> store("particles.rst"); // constant time
+     * std::string_view name = store.getString(42, "name");
+     * std::span<const double> samples = store.getArray<double>(42, "samples");
+     * Particle p = store.get(42);
+     * ```
+     */
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    class MappedStore {
+    public:
+        /**
+         * @brief Write a range of T to a new store file
+         */
+        template <std::ranges::input_range Range>
+        static void write(const std::string &path, const Range &records);
+
+        /**
+         * @throws std::runtime_error if the file is not a store of T, or was
+         * written for another registration of T
+         */
+        explicit MappedStore(const std::string &path);
+
+        std::size_t size() const { return count_; }
+        bool        empty() const { return count_ == 0; }
+
+        /**
+         * @brief Materialize a record
+         * @throws std::out_of_range if index >= size()
+         */
+        T    get(std::size_t index) const;
+        void read(std::size_t index, T &out) const;
+
+        /**
+         * @brief Value of a member of a record, as returned by the member getter
+         * @throws std::runtime_error if the member is not stored
+         */
+        Arg getMemberValue(std::size_t index, std::string_view member_name) const;
+
+        /**
+         * @brief View of a std::string member, valid while the store is open
+         */
+        std::string_view getString(std::size_t index, std::string_view member_name) const;
+
+        /**
+         * @brief View of a std::vector<E> member, valid while the store is open
+         */
+        template <typename E>
+        std::span<const E> getArray(std::size_t index, std::string_view member_name) const;
+
+        const MappedLayout &layout() const { return layout_; }
+
+    private:
+        const std::uint8_t *record(std::size_t index) const;
+        const MappedLayout::Slot &slot(std::string_view member_name) const;
+
+        MappedFile          file_;
+        MappedLayout        layout_;
+        std::size_t         count_     = 0;
+        const std::uint8_t *records_   = nullptr;
+        const std::uint8_t *heap_      = nullptr;
+        std::size_t         heap_size_ = 0;
+    };
+
+} // namespace rosetta
+
+#include "inline/mapped_store.hxx"
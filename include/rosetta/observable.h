@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <cstddef>
+#include <rosetta/info.h>
+#include <string_view>
+
+namespace rosetta {
+
+    /**
+     * @brief Send the change of an observable member of `object` to the
+     * subscribers of the object, or queue it while a batch is open on this
+     * thread. Called by the setters of observable members, after the write.
+     *
+     * Every handler is called, even if one throws; the first exception is then
+     * rethrown.
+     */
+    void emitPropertyChange(const TypeInfo &type_info, const void *object,
+                            const MemberInfo &member, Arg old_value, Arg new_value);
+
+    namespace detail {
+
+        /**
+         * @brief Write `member` of `object` in place with `decode` (binary,
+         * JSON, delta...), then report it as a set through the reflection
+         * layer: to the member observers (indexes, dirty trackers) and, for an
+         * observable member, to the property subscribers with the old and new
+         * values
+         */
+        template <typename Decode>
+        void decodeMember(const TypeInfo &type_info, void *object, const MemberInfo &member,
+                          Decode &&decode);
+
+    } // namespace detail
+
+    /**
+     * @brief Report a direct write (in C++) of an observable member to the
+     * member observers and the property subscribers of the object, as if it
+     * was set through the reflection layer
+     * @throws std::runtime_error if there is no such member
+     * @example
+     * ```cpp
+     * const std::string old_name = person.name;
+     * person.name = "Bob";
+     * notifyPropertyChanged(person, "name", old_name);
+     * ```
+     */
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    void notifyPropertyChanged(T &object, std::string_view member, Arg old_value);
+
+    /**
+     * @brief TypeInfo::subscribePropertyChanged() for an object of a registered
+     * class. The handler must be unsubscribed before the object is destroyed
+     * (see PropertySubscription to do it automatically).
+     */
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    std::size_t subscribePropertyChanged(const T &object, PropertyChangeHandler handler);
+
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    void unsubscribePropertyChanged(const T &object, std::size_t id);
+
+    /**
+     * @brief A property subscription removed when the handle is destroyed or
+     * reset. Declared as a member of the subscribed object (or of an owner
+     * that does not outlive it), it ties the handler to the object lifetime.
+     * @example
+     * ```cpp
+     * class HealthBar {
+     *     rosetta::PropertySubscription subscription_;
+     * public:
+     *     explicit HealthBar(Player &player)
+     *         : subscription_(rosetta::subscribePropertyChangedScoped(player, [this](auto) {
+     *               redraw();
+     *           })) {}
+     * };
+     * ```
+     */
+    class PropertySubscription {
+    public:
+        PropertySubscription() = default;
+        PropertySubscription(const TypeInfo &type_info, const void *object, std::size_t id)
+            : type_info_(&type_info), object_(object), id_(id) {}
+        ~PropertySubscription() { reset(); }
+
+        PropertySubscription(PropertySubscription &&other) noexcept;
+        PropertySubscription &operator=(PropertySubscription &&other) noexcept;
+        PropertySubscription(const PropertySubscription &)            = delete;
+        PropertySubscription &operator=(const PropertySubscription &) = delete;
+
+        /**
+         * @brief Unsubscribe now (no effect if already done)
+         */
+        void reset();
+
+        /**
+         * @brief Leave the handler subscribed, and return its id
+         */
+        std::size_t release();
+
+        explicit operator bool() const { return type_info_ != nullptr; }
+
+    private:
+        const TypeInfo *type_info_ = nullptr;
+        const void     *object_    = nullptr;
+        std::size_t     id_        = 0;
+    };
+
+    /**
+     * @brief subscribePropertyChanged() returning a PropertySubscription
+     */
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    [[nodiscard]] PropertySubscription
+    subscribePropertyChangedScoped(const T &object, PropertyChangeHandler handler);
+
+    /**
+     * @brief Batches of property changes, per thread. While a batch is open,
+     * the changes are queued and coalesced: a member set several times is
+     * reported once, with its first old value and its last new value. When
+     * the outermost batch ends (or on flushPropertyChanges()), each handler is
+     * called once with all the changes of its object, in the order they were
+     * first made.
+     */
+    void beginPropertyBatch();
+    void endPropertyBatch();
+    bool propertyBatchOpen();
+
+    /**
+     * @brief Deliver the queued changes now, leaving the batch open (e.g. at
+     * the end of each frame of a batch spanning the session)
+     */
+    void flushPropertyChanges();
+
+    /**
+     * @brief A batch (see beginPropertyBatch) open for the lifetime of the
+     * scope, e.g. a transaction or a frame
+     * @example
+     * ```cpp
+     * subscribePropertyChanged(player, [](std::span<const PropertyChange> changes) {
+     *     for (const PropertyChange &change : changes) {
+     *         ui.update(change.member->name, change.new_value);
+     *     }
+     * });
+     * {
+     *     PropertyBatch frame;
+     *     player.setMemberValue("health", 50.0f);
+     *     player.setMemberValue("health", 40.0f);
+     *     player.setMemberValue("name", std::string("Hero"));
+     * } // one call: health (100 -> 40) and name
+     * ```
+     */
+    class PropertyBatch {
+    public:
+        PropertyBatch() { beginPropertyBatch(); }
+        ~PropertyBatch();
+
+        PropertyBatch(const PropertyBatch &)            = delete;
+        PropertyBatch &operator=(const PropertyBatch &) = delete;
+
+        /**
+         * @brief End the batch before the end of the scope, letting the
+         * exceptions of the handlers propagate (the destructor drops them)
+         */
+        void end();
+
+    private:
+        bool open_ = true;
+    };
+
+} // namespace rosetta
+
+#include "inline/observable.hxx"
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <ranges>
+#include <rosetta/table.h>
+#include <rosetta/types.h>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <variant>
+#include <vector>
+
+namespace rosetta {
+
+    /**
+     * @brief Error in a query expression: syntax, unknown member, or operands of
+     * the wrong type
+     */
+    class QueryError : public std::runtime_error {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    /**
+     * @brief Value of a query expression (numbers are doubles)
+     */
+    using QueryValue = std::variant<bool, double, std::string>;
+
+    /**
+     * @brief Rows sharing the same key, see Query::groupBy
+     */
+    struct QueryGroup {
+        QueryValue               key;
+        std::vector<std::size_t> rows;
+    };
+
+    namespace detail {
+
+        // Addresses of the members read by a query (its slots), for one row
+        using QuerySlots = const void *const *;
+
+        enum class QueryType { Bool, Number, String };
+
+        /**
+         * @brief Compiled expression: a tree of closures reading the slots
+         */
+        struct QueryNode {
+            QueryType                                    type = QueryType::Bool;
+            std::function<bool(QuerySlots)>              boolean;
+            std::function<double(QuerySlots)>            number;
+            std::function<std::string_view(QuerySlots)> string;
+
+            QueryValue eval(QuerySlots slots) const;
+        };
+
+        struct QuerySortKey {
+            QueryNode node;
+            bool      descending = false;
+        };
+
+        /**
+         * @brief Recursive descent compiler of query expressions. Members are
+         * resolved to slots (appended to `slots`) when compiling.
+         */
+        class QueryParser {
+        public:
+            QueryParser(const TypeInfo &type_info, std::vector<const MemberInfo *> &slots,
+                        std::string_view text);
+
+            QueryNode                 parseExpression();
+            std::vector<QuerySortKey> parseSortKeys();
+
+        private:
+            QueryNode parseOr();
+            QueryNode parseAnd();
+            QueryNode parseNot();
+            QueryNode parseCompare();
+            QueryNode parseSum();
+            QueryNode parseProduct();
+            QueryNode parseUnary();
+            QueryNode parsePrimary();
+            QueryNode parseString(char quote);
+            QueryNode parseNumber();
+            QueryNode member(const std::string &name);
+
+            void             skipSpace();
+            bool             accept(std::string_view token);
+            bool             acceptWord(std::string_view word);
+            void             expect(QueryType type, const QueryNode &node, const char *what) const;
+            void             expectEnd();
+            [[noreturn]] void fail(const std::string &message) const;
+
+            const TypeInfo                  &type_info_;
+            std::vector<const MemberInfo *> &slots_;
+            std::string_view                 text_;
+            std::size_t                      pos_ = 0;
+        };
+
+        /**
+         * @brief Rows of a query source: the address of slot k in row r is
+         * `bases[k] + r * strides[k]` (objects in an array, table columns), or
+         * `objects[r] + offsets[k]` (objects held by pointer)
+         */
+        struct QueryRows {
+            std::size_t                        size = 0;
+            std::vector<const unsigned char *> bases;
+            std::vector<std::size_t>           strides;
+            std::vector<const void *>          objects;
+            std::vector<std::size_t>           offsets;
+
+            void fill(std::size_t row, const void **slots) const;
+        };
+
+        /**
+         * @brief Type-erased part of Query
+         */
+        class QueryPlan {
+        public:
+            std::vector<const MemberInfo *> slots;
+            std::vector<QueryNode>          filters; // all must hold
+            std::vector<QuerySortKey>       keys;
+            std::size_t                     limit    = static_cast<std::size_t>(-1);
+            std::size_t                     parallel = 100000; // rows
+
+            std::vector<std::size_t> run(const QueryRows &rows) const;
+            std::size_t              count(const QueryRows &rows) const;
+            std::vector<QueryGroup>  group(const QueryRows &rows, const QueryNode &key,
+                                           const std::vector<std::size_t> &selected) const;
+
+        private:
+            using ChunkBody = std::function<void(std::size_t, std::size_t, std::size_t)>;
+
+            bool matches(QuerySlots slots) const;
+            void sort(const QueryRows &rows, std::vector<std::size_t> &selected) const;
+            // Split [0, size) in chunks (several for large sizes only)
+            std::size_t chunkCount(std::size_t size) const;
+            // body(chunk, begin, end) for each chunk, in parallel if several
+            void forEachChunk(std::size_t size, std::size_t chunks, const ChunkBody &body) const;
+        };
+
+        // Slot of a member, added to the slots if needed
+        std::size_t querySlot(std::vector<const MemberInfo *> &slots, const MemberInfo *member);
+
+        template <typename Element>
+        inline constexpr bool is_query_indirect_v =
+            std::is_pointer_v<Element> || requires { typename Element::element_type; };
+
+    } // namespace detail
+
+    /**
+     * @brief Filter, sort and group collections of a registered class by its
+     * members.
+     *
+     * Conditions and sort keys are expressions over the members (numbers, bool
+     * and std::string), compiled against the TypeInfo of T when they are added:
+     * each member is resolved once to its offset and type, so running the query
+     * never looks up names nor goes through std::any. Large inputs are filtered
+     * in parallel on WorkerPool::shared().
+     *
+     * Expressions use C-like operators (`&&` `||` `!`, also `and` `or` `not`,
+     * comparisons, `+ - * / %`), parentheses, numbers, 'text' or "text", true
+     * and false. Sort keys are comma-separated expressions, each optionally
+     * followed by asc or desc.
+     *
+     * A query runs over a Table<T>, a contiguous range of T (e.g. std::vector),
+     * or a range of pointers (raw or smart) to T. Results are row positions in
+     * the source.
+     *
+     * @example
+     * ```cpp
+     * auto weak = Query<GameObject>()
+     *                 .where("health < 50 && name != ''")
+     *                 .orderBy("health, name desc")
+     *                 .limit(10)
+     *                 .select(objects); // std::vector<const GameObject *>
+     *
+     * auto far = Query<GameObject>()
+     *                .where<Vector3D>("position", [](const Vector3D &p) { return p.x > 100; })
+     *                .indices(objects);
+     * ```
+     */
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    class Query {
+    public:
+        Query() = default;
+
+        /**
+         * @brief Add a condition (all the conditions must hold)
+         * @throws QueryError if the expression is invalid or not a boolean
+         */
+        Query &where(std::string_view expression);
+
+        /**
+         * @brief Add a condition on a member of type M, checked by a C++ predicate
+         * @throws QueryError if there is no member of type M with that name
+         */
+        template <typename M>
+        Query &where(std::string_view member_name, std::function<bool(const M &)> predicate);
+
+        /**
+         * @brief Sort the results by comma-separated keys (after the keys of
+         * previous calls), e.g. "level desc, name". NaNs come last in both orders
+         * and ties keep the source order.
+         * @throws QueryError if a key is invalid
+         */
+        Query &orderBy(std::string_view keys);
+
+        /**
+         * @brief Keep the first `count` results
+         */
+        Query &limit(std::size_t count);
+
+        /**
+         * @brief Minimum number of rows to run in parallel (default 100000)
+         */
+        Query &parallelFrom(std::size_t rows);
+
+        /**
+         * @brief Positions of the matching rows, in the requested order
+         */
+        std::vector<std::size_t> indices(const Table<T> &table) const;
+        template <std::ranges::input_range R>
+        std::vector<std::size_t> indices(const R &objects) const;
+
+        std::size_t count(const Table<T> &table) const;
+        template <std::ranges::input_range R> std::size_t count(const R &objects) const;
+
+        /**
+         * @brief Matching objects, in the requested order
+         */
+        template <std::ranges::input_range R> std::vector<const T *> select(const R &objects) const;
+
+        /**
+         * @brief Matching rows grouped by the value of an expression, groups in
+         * increasing key order (NaNs in one last group) and rows in the
+         * requested order
+         * @throws QueryError if the key expression is invalid
+         */
+        std::vector<QueryGroup> groupBy(const Table<T> &table, std::string_view key) const;
+        template <std::ranges::input_range R>
+        std::vector<QueryGroup> groupBy(const R &objects, std::string_view key) const;
+
+        const TypeInfo &getTypeInfo() const { return T::getStaticTypeInfo(); }
+
+    private:
+        detail::QueryRows rows(const Table<T> &table,
+                               const std::vector<const MemberInfo *> &slots) const;
+        template <std::ranges::input_range R>
+        detail::QueryRows rows(const R &objects,
+                               const std::vector<const MemberInfo *> &slots) const;
+        template <std::ranges::input_range R>
+        static std::vector<const T *> objectsOf(const R &objects);
+
+        template <typename Source>
+        std::vector<QueryGroup> groupRows(const Source &source, std::string_view key) const;
+
+        detail::QueryPlan plan_;
+    };
+
+} // namespace rosetta
+
+#include "inline/query.hxx"
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <rosetta/column.h>
+#include <rosetta/types.h>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace rosetta {
+
+    /**
+     * @brief Columnar (struct-of-arrays) container of a registered class.
+     *
+     * Each registered member of T is stored in its own contiguous column, so that
+     * scanning one member over all the rows (summing, filtering) reads a single
+     * dense array. Rows are accessed as a whole (push_back, get, set) or through
+     * row proxies, which expose the members with the same reflection API as
+     * Introspectable. Members whose type is not copyable have no column.
+     *
+     * Spans returned by column() are invalidated when rows are added or removed.
+     *
+     * @example
+     * ```cpp
+     * Table<GameObject> objects;
+     * objects.push_back(GameObject("Player", {0, 0, 0}));
+     *
+     * float total = 0;
+     * for (float health : objects.column<float>("health")) {
+     *     total += health;
+     * }
+     * objects[0].setMemberValue("health", 50.0f);
+     * ```
+     */
+    template <typename T>
+        requires detail::IntrospectableClass<T>
+    class Table {
+    public:
+        /**
+         * @brief A row of a table, accessed like an instance of T
+         */
+        template <bool Const> class BasicRow {
+        public:
+            using TableType = std::conditional_t<Const, const Table, Table>;
+
+            BasicRow(TableType &table, std::size_t index) : table_(&table), index_(index) {}
+
+            std::size_t index() const { return index_; }
+
+            std::any getMemberValue(const std::string &member_name) const;
+            void     setMemberValue(const std::string &member_name, const Arg &value) const
+                requires(!Const);
+
+            /**
+             * @brief Reference to the value of a member (M must be its exact type)
+             */
+            template <typename M> auto &get(std::string_view member_name) const;
+
+            std::vector<std::string> getMemberNames() const { return table_->columnNames(); }
+            bool                     hasMember(const std::string &name) const;
+            const TypeInfo          &getTypeInfo() const { return table_->getTypeInfo(); }
+            std::string              getClassName() const { return getTypeInfo().class_name; }
+
+            /**
+             * @brief Copy of the row as a T
+             */
+            T materialize() const { return table_->get(index_); }
+
+            const BasicRow &operator=(const T &value) const
+                requires(!Const)
+            {
+                table_->set(index_, value);
+                return *this;
+            }
+
+        private:
+            TableType  *table_;
+            std::size_t index_;
+        };
+
+        using Row      = BasicRow<false>;
+        using ConstRow = BasicRow<true>;
+
+        /**
+         * @brief Iterator over the rows (yields row proxies)
+         */
+        template <bool Const> class BasicIterator {
+        public:
+            using TableType         = std::conditional_t<Const, const Table, Table>;
+            using value_type        = BasicRow<Const>;
+            using difference_type   = std::ptrdiff_t;
+            using iterator_category = std::input_iterator_tag;
+
+            BasicIterator() = default;
+            BasicIterator(TableType *table, std::size_t index) : table_(table), index_(index) {}
+
+            value_type     operator*() const { return value_type(*table_, index_); }
+            BasicIterator &operator++() {
+                ++index_;
+                return *this;
+            }
+            BasicIterator operator++(int) {
+                BasicIterator previous = *this;
+                ++index_;
+                return previous;
+            }
+            bool operator==(const BasicIterator &other) const { return index_ == other.index_; }
+
+        private:
+            TableType  *table_ = nullptr;
+            std::size_t index_ = 0;
+        };
+
+        using iterator       = BasicIterator<false>;
+        using const_iterator = BasicIterator<true>;
+
+        Table();
+        Table(const Table &other);
+        Table &operator=(const Table &other);
+        Table(Table &&) noexcept            = default;
+        Table &operator=(Table &&) noexcept = default;
+
+        std::size_t size() const { return size_; }
+        bool        empty() const { return size_ == 0; }
+        void        reserve(std::size_t rows);
+        void        clear();
+
+        /**
+         * @brief Append a row. If a column throws, the table is left as it was
+         */
+        void push_back(const T &value);
+        /**
+         * @brief Remove a row (the following rows are moved up)
+         */
+        void erase(std::size_t row);
+
+        /**
+         * @brief Copy of a row
+         * @throws std::out_of_range if row >= size()
+         */
+        T    get(std::size_t row) const;
+        void read(std::size_t row, T &out) const;
+        void set(std::size_t row, const T &value);
+
+        Row      operator[](std::size_t row) { return Row(*this, row); }
+        ConstRow operator[](std::size_t row) const { return ConstRow(*this, row); }
+
+        iterator       begin() { return iterator(this, 0); }
+        iterator       end() { return iterator(this, size_); }
+        const_iterator begin() const { return const_iterator(this, 0); }
+        const_iterator end() const { return const_iterator(this, size_); }
+
+        /**
+         * @brief All the values of a member, contiguous
+         * @throws std::runtime_error if there is no column of type M with that name
+         */
+        template <typename M> std::span<M>       column(std::string_view member_name);
+        template <typename M> std::span<const M> column(std::string_view member_name) const;
+
+        /**
+         * @brief Type-erased column, e.g. for bindings
+         * @throws std::runtime_error if there is no column with that name
+         */
+        ColumnStorage       &columnStorage(std::string_view member_name);
+        const ColumnStorage &columnStorage(std::string_view member_name) const;
+
+        bool                     hasColumn(std::string_view member_name) const;
+        std::vector<std::string> columnNames() const; // in registration order
+
+        const TypeInfo &getTypeInfo() const { return T::getStaticTypeInfo(); }
+
+    private:
+        struct Column {
+            const MemberInfo              *member;
+            std::unique_ptr<ColumnStorage> storage;
+        };
+
+        const Column *find(std::string_view member_name) const;
+        const Column &require(std::string_view member_name) const;
+        void          checkRow(std::size_t row) const;
+
+        std::vector<Column> columns_;
+        std::size_t         size_ = 0;
+    };
+
+} // namespace rosetta
+
+#include "inline/table.hxx"
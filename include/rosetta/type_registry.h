@@ -5,6 +5,7 @@
  */
 #pragma once
 #include <functional>
+#include <shared_mutex>
 #include <string>
 #include <type_traits>
 #include <typeindex>
@@ -17,7 +18,8 @@ namespace rosetta {
      * @brief Registry for user-defined type names
      *
      * This singleton class allows registration of custom type names instead of
-     * relying on typeid(T).name() which produces mangled names.
+     * relying on typeid(T).name() which produces mangled names. Lookups can run
+     * concurrently (e.g. bindings created on worker threads).
      */
     class TypeNameRegistry {
     public:
@@ -56,6 +58,7 @@ namespace rosetta {
     private:
         TypeNameRegistry();
         std::unordered_map<std::type_index, std::string> type_names;
+        mutable std::shared_mutex                        mutex;
     };
 
     // ----------------------------------------------------------------
@@ -4,7 +4,13 @@
  *
  */
 #pragma once
+#include <rosetta/arrow_traits.h>
+#include <rosetta/binary.h>
+#include <rosetta/column.h>
+#include <rosetta/dlpack.h>
 #include <rosetta/info.h>
+#include <rosetta/json.h>
+#include <rosetta/observable.h>
 #include <rosetta/type_registry.h>
 
 namespace rosetta {
@@ -19,6 +25,53 @@ namespace rosetta {
      */
     template <typename T> std::string getTypeName();
 
+    /**
+     * @brief Fixed-width numeric element type, as seen by bulk (array) code paths.
+     * Every arithmetic C++ type except bool maps onto one of these values, which
+     * lets generators pick the matching native buffer type (TypedArray, NumPy
+     * dtype, ...) without going through type names.
+     */
+    enum class NumericType : unsigned char {
+        Int8,
+        UInt8,
+        Int16,
+        UInt16,
+        Int32,
+        UInt32,
+        Int64,
+        UInt64,
+        Float32,
+        Float64
+    };
+
+    /**
+     * @brief Get the NumericType of an arithmetic C++ type
+     */
+    template <typename T> constexpr NumericType numericTypeOf();
+
+    /**
+     * @brief Size in bytes of one element of the given NumericType
+     */
+    constexpr std::size_t numericTypeSize(NumericType type);
+
+    /**
+     * @brief Call `visitor(std::type_identity<T>{})` with the C++ type T matching
+     * the given NumericType (e.g. float for Float32)
+     */
+    template <typename Visitor> decltype(auto) visitNumericType(NumericType type, Visitor &&visitor);
+
+    /**
+     * @brief Tag for TypeRegistrar::method marking a long running method, that
+     * bindings may run on a worker thread (see MethodInfo::async). Such a method
+     * must not touch state that scripts can modify while it runs.
+     * @example
+     * ```cpp
+     * reg.method("findPath", &World::findPath, rosetta::async_method);
+     * ```
+     */
+    struct AsyncMethod { };
+    inline constexpr AsyncMethod async_method {};
+
     /**
      * @brief Helper class to register members and methods of a class.
      * This class is used in conjunction with the INTROSPECTABLE macro to
@@ -40,11 +93,23 @@ namespace rosetta {
          * pointer. It creates a MemberInfo instance with appropriate getter and
          * setter functions. The getter retrieves the member's value from an
          * instance of the class, and the setter updates the member's value. The
-         * member's type is deduced using the getTypeName function.
+         * member's type is deduced using the getTypeName function. An address
+         * accessor is also recorded so that bindings can expose the member
+         * storage by reference instead of copying it through std::any.
          */
         template <typename MemberType>
         TypeRegistrar &member(const std::string &name, MemberType Class::*member_ptr);
 
+        /**
+         * @brief Register a member whose changes are sent to the property
+         * subscribers of the object (see TypeInfo::subscribePropertyChanged),
+         * with its old and new values. Its setter only copies the old value
+         * when the object has subscribers: otherwise it costs a single atomic
+         * load more than member().
+         */
+        template <typename MemberType>
+        TypeRegistrar &member_observable(const std::string &name, MemberType Class::*member_ptr);
+
         /**
          * @brief Register a method based on C++ variadic method registration
          * (handles any number of parameters). This method registers a method of the
@@ -64,6 +129,20 @@ namespace rosetta {
         TypeRegistrar &method(const std::string &name,
                               ReturnType (Class::*method_ptr)(Args...) const);
 
+        /**
+         * @brief Register a long running method (see AsyncMethod). The object
+         * is used from a worker thread while the call runs: scripts must not
+         * touch it (read or set its members, call its methods, let it be
+         * collected) until the call returns.
+         */
+        template <typename ReturnType, typename... Args>
+        TypeRegistrar &method(const std::string &name, ReturnType (Class::*method_ptr)(Args...),
+                              AsyncMethod);
+
+        template <typename ReturnType, typename... Args>
+        TypeRegistrar &method(const std::string &name,
+                              ReturnType (Class::*method_ptr)(Args...) const, AsyncMethod);
+
         /**
          * @brief Register a constructor with specific parameter types.
          * This creates a factory function that constructs the object.
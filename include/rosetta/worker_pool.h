@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#pragma once
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rosetta {
+
+    /**
+     * @brief Fixed size pool of worker threads running tasks in FIFO order.
+     *
+     * Used by the bindings to run methods registered with `async_method`
+     * without blocking the scripting thread. The destructor runs the tasks
+     * still queued, then joins the threads.
+     */
+    class WorkerPool {
+    public:
+        explicit WorkerPool(std::size_t threads = std::thread::hardware_concurrency());
+        ~WorkerPool();
+
+        WorkerPool(const WorkerPool &)            = delete;
+        WorkerPool &operator=(const WorkerPool &) = delete;
+
+        /**
+         * @brief Process wide pool, created on first use
+         */
+        static WorkerPool &shared();
+
+        /**
+         * @brief Queue a task. Exceptions escaping a task are swallowed, so tasks
+         * are expected to report their own errors.
+         */
+        void submit(std::function<void()> task);
+
+        /**
+         * @brief Run body(i) for i in [0, count) on the pool and on the calling
+         * thread, and return once all calls completed. The first exception
+         * thrown by a call is rethrown. The calling thread takes part, so this
+         * also completes when called from a task of the pool.
+         */
+        void parallelFor(std::size_t count, const std::function<void(std::size_t)> &body);
+
+        std::size_t size() const;
+
+    private:
+        void run();
+
+        std::vector<std::thread>          workers;
+        std::deque<std::function<void()>> tasks;
+        std::mutex                        mutex;
+        std::condition_variable           available;
+        bool                              stopping = false;
+    };
+
+} // namespace rosetta
+
+#include "inline/worker_pool.hxx"
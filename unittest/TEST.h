@@ -5,10 +5,15 @@
  */
 #pragma once
 
+#include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <functional>
 #include <iostream>
 #include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 /**
 * @brief A la Google test framework: that is to say, GTEST using `cmake`.
@@ -285,12 +290,6 @@ template <typename F> double TIMING(F&& func)
     return std::chrono::duration<double, std::milli>(end - start).count();
 }
 
-// Helper function to generate random series
-template <typename T> df::Serie<T> RANDOM(size_t size, T min_val, T max_val)
-{
-    return df::random_uniform(size, min_val, max_val);
-}
-
 #define CONTAINS(container1, container2)                                                           \
     {                                                                                              \
         for (const auto& item : container2) {                                                      \
@@ -302,19 +301,6 @@ template <typename T> df::Serie<T> RANDOM(size_t size, T min_val, T max_val)
         }                                                                                          \
     }
 
-template <typename T>
-void COMPARE_SERIE_VECTOR(const df::Serie<T>& actual, const std::vector<T>& expected)
-{
-    EXPECT_ARRAY_EQ(actual.asArray(), expected);
-}
-
-template <typename T> void COMPARE_SERIES(const df::Serie<T>& actual, const df::Serie<T>& expected)
-{
-    EXPECT_EQ(actual.size(), expected.size());
-    EXPECT_STREQ(actual.type(), expected.type());
-    EXPECT_ARRAY_EQ(actual.asArray(), expected.asArray());
-}
-
 template <typename T> struct ParsedSerie {
     std::string type;
     size_t size;
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include "TEST.h"
+#include <cstdint>
+#include <memory>
+#include <rosetta/arrow.h>
+#include <rosetta/introspectable.h>
+#include <rosetta/table.h>
+
+class Record : public rosetta::Introspectable {
+    INTROSPECTABLE(Record)
+public:
+    std::string name = "none";
+    bool active = false;
+    double score = -1;
+    int level = 0;
+    std::vector<float> samples;
+};
+
+void Record::registerIntrospection(rosetta::TypeRegistrar<Record> reg)
+{
+    reg.member("name", &Record::name)
+        .member("active", &Record::active)
+        .member("score", &Record::score)
+        .member("level", &Record::level)
+        .member("samples", &Record::samples);
+}
+
+static rosetta::Table<Record> makeTable()
+{
+    rosetta::Table<Record> table;
+    for (int i = 0; i < 10; ++i) {
+        Record record;
+        record.name = "record " + std::to_string(i);
+        record.active = i % 3 == 0;
+        record.score = i * 1.5;
+        record.level = 100 - i;
+        record.samples.assign(static_cast<std::size_t>(i % 4), static_cast<float>(i));
+        table.push_back(record);
+    }
+    return table;
+}
+
+static void expectRecord(const Record &record, int i)
+{
+    EXPECT_STREQ(record.name, "record " + std::to_string(i));
+    EXPECT_EQ(record.active, i % 3 == 0);
+    EXPECT_EQ(record.score, i * 1.5);
+    EXPECT_EQ(record.level, 100 - i);
+    EXPECT_EQ(record.samples.size(), static_cast<std::size_t>(i % 4));
+}
+
+static void expectDefault(const Record &record)
+{
+    EXPECT_STREQ(record.name, "none");
+    EXPECT_EQ(record.active, false);
+    EXPECT_EQ(record.score, -1.0);
+    EXPECT_EQ(record.level, 0);
+    EXPECT_TRUE(record.samples.empty());
+}
+
+// Exported arrays own their buffers, the validity bitmaps of the tests are
+// set on top of them
+static void setNulls(ArrowArray &array, std::vector<std::uint8_t> &bitmap,
+                     const std::vector<std::int64_t> &nulls)
+{
+    bitmap.assign(static_cast<std::size_t>(array.offset + array.length + 7) / 8, 0xff);
+    for (const std::int64_t row : nulls) {
+        bitmap[static_cast<std::size_t>(row / 8)] &= static_cast<std::uint8_t>(~(1u << (row % 8)));
+    }
+    array.buffers[0] = bitmap.data();
+    array.null_count = static_cast<std::int64_t>(nulls.size());
+}
+
+TEST(Arrow, tableRoundTrip)
+{
+    const auto table = makeTable();
+    for (const bool shared : { false, true }) {
+        ArrowSchema schema;
+        ArrowArray array;
+        rosetta::toArrow(table, &schema, &array,
+                         shared ? std::make_shared<int>(0) : std::shared_ptr<const void>());
+        EXPECT_EQ(schema.n_children, 5);
+        EXPECT_EQ(array.length, 10);
+
+        rosetta::Table<Record> copy;
+        copy.push_back(Record{});
+        rosetta::appendFromArrow(copy, &schema, &array);
+        EXPECT_EQ(copy.size(), 11u);
+        expectDefault(copy.get(0));
+        for (int i = 0; i < 10; ++i) {
+            expectRecord(copy.get(static_cast<std::size_t>(i) + 1), i);
+        }
+        EXPECT_ARRAY_EQ(copy.get(8).samples, std::vector<float>({ 7, 7, 7 }));
+
+        const auto objects = rosetta::fromArrow<Record>(&schema, &array);
+        EXPECT_EQ(objects.size(), 10u);
+        for (int i = 0; i < 10; ++i) {
+            expectRecord(objects[static_cast<std::size_t>(i)], i);
+        }
+        array.release(&array);
+        schema.release(&schema);
+    }
+}
+
+TEST(Arrow, nullRows)
+{
+    const auto table = makeTable();
+    ArrowSchema schema;
+    ArrowArray array;
+    rosetta::toArrow(table, &schema, &array);
+
+    // Null rows of the struct are default objects, null values keep the default
+    // of their member
+    std::vector<std::uint8_t> rows, names, flags;
+    setNulls(array, rows, { 1, 8 });
+    setNulls(*array.children[0], names, { 2 });
+    setNulls(*array.children[1], flags, { 3 });
+
+    rosetta::Table<Record> copy;
+    rosetta::appendFromArrow(copy, &schema, &array);
+    const auto objects = rosetta::fromArrow<Record>(&schema, &array);
+    EXPECT_EQ(copy.size(), 10u);
+    for (std::size_t i = 0; i < 10; ++i) {
+        const Record from_table = copy.get(i);
+        for (const Record *record : { &from_table, &objects[i] }) {
+            if (i == 1 || i == 8) {
+                expectDefault(*record);
+                continue;
+            }
+            EXPECT_STREQ(record->name, i == 2 ? "none" : "record " + std::to_string(i));
+            EXPECT_EQ(record->active, i == 3 ? false : i % 3 == 0);
+            EXPECT_EQ(record->score, static_cast<double>(i) * 1.5);
+        }
+    }
+    array.release(&array);
+    schema.release(&schema);
+}
+
+TEST(Arrow, slicedArray)
+{
+    const auto table = makeTable();
+    ArrowSchema schema;
+    ArrowArray array;
+    rosetta::toArrow(table, &schema, &array);
+
+    // Rows [3, 8) of the table, as a consumer slicing the struct array would
+    // pass them, with a null row whose bit is past the offset
+    array.offset = 3;
+    array.length = 5;
+    std::vector<std::uint8_t> rows;
+    setNulls(array, rows, { 5 });
+
+    rosetta::Table<Record> copy;
+    rosetta::appendFromArrow(copy, &schema, &array);
+    const auto objects = rosetta::fromArrow<Record>(&schema, &array);
+    EXPECT_EQ(copy.size(), 5u);
+    EXPECT_EQ(objects.size(), 5u);
+    for (int i = 0; i < 5; ++i) {
+        const Record from_table = copy.get(static_cast<std::size_t>(i));
+        for (const Record *record : { &from_table, &objects[static_cast<std::size_t>(i)] }) {
+            if (i + 3 == 5) {
+                expectDefault(*record);
+            } else {
+                expectRecord(*record, i + 3);
+            }
+        }
+    }
+    EXPECT_ARRAY_EQ(copy.get(4).samples, std::vector<float>({ 7, 7, 7 }));
+
+    // A child sliced on its own adds its offset to the one of the struct
+    array.offset = 0;
+    array.length = 4;
+    array.null_count = 0;
+    array.children[0]->offset = 6;
+    array.children[0]->length = 4;
+    const auto shifted = rosetta::fromArrow<Record>(&schema, &array);
+    EXPECT_STREQ(shifted[0].name, "record 6");
+    EXPECT_STREQ(shifted[3].name, "record 9");
+    EXPECT_EQ(shifted[3].level, 97);
+
+    array.release(&array);
+    schema.release(&schema);
+}
+
+RUN_TESTS()
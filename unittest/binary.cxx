@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include "TEST.h"
+#include <rosetta/introspectable.h>
+#include <span>
+#include <string_view>
+
+struct Vec2 {
+    float x, y;
+};
+REGISTER_BINARY_RAW(Vec2);
+
+struct Handle {
+    const char* name;
+};
+
+class Shape : public rosetta::Introspectable {
+    INTROSPECTABLE(Shape)
+public:
+    std::string name;
+    int sides = 0;
+    double area = 0;
+    std::vector<double> weights;
+    std::vector<Vec2> points;
+    std::array<int, 3> color {};
+};
+
+void Shape::registerIntrospection(rosetta::TypeRegistrar<Shape> reg)
+{
+    reg.member("name", &Shape::name)
+        .member("sides", &Shape::sides)
+        .member("area", &Shape::area)
+        .member("weights", &Shape::weights)
+        .member("points", &Shape::points)
+        .member("color", &Shape::color);
+}
+
+static Shape makeShape()
+{
+    Shape shape;
+    shape.name = "triangle";
+    shape.sides = 3;
+    shape.area = 0.5;
+    shape.weights = { 1.0, 2.5, -3.0 };
+    shape.points = { { 0, 0 }, { 1, 0 }, { 0, 1 } };
+    shape.color = { 255, 128, 0 };
+    return shape;
+}
+
+TEST(Binary, roundTrip)
+{
+    const Shape shape = makeShape();
+    Shape copy;
+    copy.fromBinary(shape.toBinary());
+    EXPECT_STREQ(copy.name, "triangle");
+    EXPECT_EQ(copy.sides, 3);
+    EXPECT_EQ(copy.area, 0.5);
+    EXPECT_ARRAY_EQ(copy.weights, shape.weights);
+    EXPECT_EQ(copy.points.size(), 3u);
+    EXPECT_EQ(copy.points[2].y, 1.0f);
+    EXPECT_ARRAY_EQ(copy.color, shape.color);
+}
+
+TEST(Binary, rawClassesAreOptIn)
+{
+    static_assert(rosetta::is_binary_serializable_v<Vec2>);
+    static_assert(rosetta::is_binary_serializable_v<std::vector<Vec2>>);
+    static_assert(!rosetta::is_binary_serializable_v<Handle>);
+    static_assert(!rosetta::is_binary_serializable_v<std::string_view>);
+    static_assert(!rosetta::is_binary_serializable_v<std::span<const double>>);
+}
+
+TEST(Binary, truncatedData)
+{
+    const auto data = makeShape().toBinary();
+    for (std::size_t size = 0; size < data.size(); ++size) {
+        Shape copy;
+        EXPECT_THROW(copy.fromBinary(std::vector<std::uint8_t>(data.begin(), data.begin() + size)),
+            std::runtime_error);
+    }
+}
+
+TEST(Binary, corruptLengths)
+{
+    std::vector<std::uint8_t> buffer;
+    rosetta::BinaryWriter writer(buffer);
+    writer.write<std::uint64_t>(0x7fffffffffffULL);
+    writer.write<std::uint8_t>(0);
+
+    rosetta::BinaryReader string_reader(buffer.data(), buffer.size());
+    EXPECT_THROW(string_reader.readString(), std::runtime_error);
+
+    std::vector<double> values;
+    rosetta::BinaryReader vector_reader(buffer.data(), buffer.size());
+    EXPECT_THROW(rosetta::BinaryTraits<std::vector<double>>::decode(vector_reader, values),
+        std::runtime_error);
+
+    std::vector<std::string> strings;
+    rosetta::BinaryReader strings_reader(buffer.data(), buffer.size());
+    EXPECT_THROW(rosetta::BinaryTraits<std::vector<std::string>>::decode(strings_reader, strings),
+        std::runtime_error);
+}
+
+RUN_TESTS()
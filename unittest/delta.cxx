@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include "TEST.h"
+#include <rosetta/delta.h>
+#include <rosetta/index.h>
+#include <rosetta/introspectable.h>
+
+class Unit : public rosetta::Introspectable {
+    INTROSPECTABLE(Unit)
+public:
+    std::string name = "unit";
+    int level = 1;
+    float health = 100;
+    std::vector<double> path;
+};
+
+void Unit::registerIntrospection(rosetta::TypeRegistrar<Unit> reg)
+{
+    reg.member("name", &Unit::name)
+        .member("level", &Unit::level)
+        .member_observable("health", &Unit::health)
+        .member("path", &Unit::path);
+}
+
+// Not binary serializable (no TypeInfo, not opted in with BinaryRaw)
+struct Handle {
+    int id = 0;
+};
+
+class Sprite : public rosetta::Introspectable {
+    INTROSPECTABLE(Sprite)
+public:
+    int frame = 0;
+    Handle texture;
+};
+
+void Sprite::registerIntrospection(rosetta::TypeRegistrar<Sprite> reg)
+{
+    reg.member("frame", &Sprite::frame).member("texture", &Sprite::texture);
+}
+
+TEST(Delta, onlyDirtyMembers)
+{
+    Unit unit, mirror;
+    rosetta::DirtyTracker<Unit> tracker;
+    tracker.track(unit);
+    unit.setMemberValue("level", 5);
+    unit.path = { 1, 2, 3 };
+    tracker.markDirty(unit, "path");
+    EXPECT_ARRAY_EQ(tracker.dirtyMembers(unit), std::vector<std::string>({ "level", "path" }));
+
+    unit.name = "not sent";
+    rosetta::applyDelta(mirror, tracker.collectDelta(unit));
+    EXPECT_EQ(mirror.level, 5);
+    EXPECT_ARRAY_EQ(mirror.path, unit.path);
+    EXPECT_STREQ(mirror.name, "unit");
+    EXPECT_TRUE(!tracker.isDirty(unit));
+    EXPECT_EQ(tracker.collectDelta(unit).size(), 0u);
+}
+
+TEST(Delta, appendedDeltas)
+{
+    Unit unit, mirror;
+    rosetta::DirtyTracker<Unit> tracker;
+    tracker.track(unit);
+    std::vector<std::uint8_t> buffer;
+
+    unit.setMemberValue("level", 2);
+    unit.setMemberValue("health", 50.0f);
+    tracker.collectDelta(unit, buffer);
+    unit.setMemberValue("level", 3);
+    unit.setMemberValue("name", std::string("hero"));
+    tracker.collectDelta(unit, buffer);
+
+    rosetta::applyDelta(mirror, buffer);
+    EXPECT_EQ(mirror.level, 3);
+    EXPECT_EQ(mirror.health, 50.0f);
+    EXPECT_STREQ(mirror.name, "hero");
+}
+
+TEST(Delta, atomicOnError)
+{
+    Unit unit;
+    rosetta::DirtyTracker<Unit> tracker;
+    tracker.track(unit);
+    std::vector<std::uint8_t> buffer;
+    unit.setMemberValue("level", 9);
+    unit.setMemberValue("name", std::string("hero"));
+    unit.path = { 4, 5, 6, 7 };
+    tracker.markDirty(unit, "path");
+    tracker.collectDelta(unit, buffer);
+    const std::size_t first = buffer.size();
+    unit.setMemberValue("health", 1.0f);
+    tracker.collectDelta(unit, buffer);
+
+    Unit mirror;
+    rosetta::Index<Unit> by_level(rosetta::IndexKind::Hash, { "level" });
+    by_level.insert(mirror);
+    std::size_t changes = 0;
+    rosetta::subscribePropertyChanged(mirror,
+        [&](std::span<const rosetta::PropertyChange>) { ++changes; });
+
+    // Every truncation but the end of the first delta
+    for (std::size_t size = 1; size < buffer.size(); ++size) {
+        if (size == first) {
+            continue;
+        }
+        const std::vector<std::uint8_t> truncated(buffer.begin(), buffer.begin() + size);
+        EXPECT_THROW(rosetta::applyDelta(mirror, truncated), std::runtime_error);
+        EXPECT_STREQ(mirror.name, "unit");
+        EXPECT_EQ(mirror.level, 1);
+        EXPECT_EQ(mirror.health, 100.0f);
+        EXPECT_EQ(mirror.path.size(), 0u);
+        EXPECT_EQ(by_level.lookup(1).size(), 1u);
+    }
+
+    // Trailing data that is not a delta
+    std::vector<std::uint8_t> trailing = buffer;
+    trailing.push_back(0);
+    EXPECT_THROW(rosetta::applyDelta(mirror, trailing), std::runtime_error);
+    EXPECT_EQ(mirror.level, 1);
+    EXPECT_EQ(mirror.health, 100.0f);
+    EXPECT_EQ(by_level.lookup(9).size(), 0u);
+
+    changes = 0;
+    rosetta::applyDelta(mirror, buffer);
+    EXPECT_EQ(mirror.level, 9);
+    EXPECT_EQ(mirror.health, 1.0f);
+    EXPECT_EQ(by_level.lookup(9).size(), 1u);
+    EXPECT_EQ(changes, 1u);
+}
+
+TEST(Delta, nothingWrittenOnError)
+{
+    Sprite sprite;
+    rosetta::DirtyTracker<Sprite> tracker;
+    tracker.track(sprite);
+    std::vector<std::uint8_t> buffer;
+    sprite.setMemberValue("frame", 1);
+    tracker.collectDelta(sprite, buffer);
+    const std::size_t size = buffer.size();
+
+    sprite.setMemberValue("frame", 2);
+    tracker.markDirty(sprite, "texture");
+    EXPECT_THROW(tracker.collectDelta(sprite, buffer), std::runtime_error);
+    EXPECT_EQ(buffer.size(), size);
+    EXPECT_TRUE(tracker.isDirty(sprite, "frame"));
+
+    // The buffer still holds whole deltas only
+    tracker.clean(sprite);
+    sprite.setMemberValue("frame", 3);
+    tracker.collectDelta(sprite, buffer);
+    Sprite mirror;
+    rosetta::applyDelta(mirror, buffer);
+    EXPECT_EQ(mirror.frame, 3);
+}
+
+RUN_TESTS()
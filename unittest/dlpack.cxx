@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include "TEST.h"
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <rosetta/dlpack.h>
+#include <rosetta/introspectable.h>
+
+class Mesh : public rosetta::Introspectable {
+    INTROSPECTABLE(Mesh)
+public:
+    std::vector<double> weights = { 0.5, 1.5, 2.5 };
+    std::array<std::int16_t, 4> ids = { 1, -2, 3, -4 };
+    std::vector<std::uint8_t> mask = { 1, 0 };
+    std::vector<bool> flags = { true };
+    std::string name = "mesh";
+};
+
+void Mesh::registerIntrospection(rosetta::TypeRegistrar<Mesh> reg)
+{
+    reg.member("weights", &Mesh::weights)
+        .member("ids", &Mesh::ids)
+        .member("mask", &Mesh::mask)
+        .member("flags", &Mesh::flags)
+        .member("name", &Mesh::name);
+}
+
+static void expectTensor(const DLManagedTensor* tensor, const void* data, std::int64_t length,
+    DLDataTypeCode code, int bits)
+{
+    const DLTensor& view = tensor->dl_tensor;
+    EXPECT_TRUE(view.data == data);
+    EXPECT_EQ(view.device.device_type, kDLCPU);
+    EXPECT_EQ(view.ndim, 1);
+    EXPECT_EQ(view.shape[0], length);
+    EXPECT_TRUE(view.strides == nullptr);
+    EXPECT_EQ(view.byte_offset, 0u);
+    EXPECT_EQ(int(view.dtype.code), int(code));
+    EXPECT_EQ(int(view.dtype.bits), bits);
+    EXPECT_EQ(int(view.dtype.lanes), 1);
+}
+
+TEST(DLPack, vectorAndArrayMembers)
+{
+    Mesh mesh;
+    DLManagedTensor* weights = rosetta::toDLPack(mesh, "weights");
+    expectTensor(weights, mesh.weights.data(), 3, kDLFloat, 64);
+    static_cast<double*>(weights->dl_tensor.data)[1] = 9; // shared, not copied
+    EXPECT_EQ(mesh.weights[1], 9.0);
+    weights->deleter(weights);
+
+    DLManagedTensor* ids = rosetta::toDLPack(mesh, "ids");
+    expectTensor(ids, mesh.ids.data(), 4, kDLInt, 16);
+    ids->deleter(ids);
+
+    DLManagedTensor* mask = rosetta::toDLPack(mesh, "mask");
+    expectTensor(mask, mesh.mask.data(), 2, kDLUInt, 8);
+    mask->deleter(mask);
+}
+
+TEST(DLPack, deleterReleasesOwner)
+{
+    auto mesh = std::make_shared<Mesh>();
+    std::weak_ptr<Mesh> watch = mesh;
+    DLManagedTensor* tensor = rosetta::toDLPack(mesh, "weights");
+    expectTensor(tensor, mesh->weights.data(), 3, kDLFloat, 64);
+
+    // The tensor keeps the object alive until its deleter runs
+    mesh.reset();
+    EXPECT_FALSE(watch.expired());
+    EXPECT_EQ(static_cast<const double*>(tensor->dl_tensor.data)[2], 2.5);
+    tensor->deleter(tensor);
+    EXPECT_TRUE(watch.expired());
+}
+
+TEST(DLPack, unsupportedMembers)
+{
+    Mesh mesh;
+    EXPECT_THROW(rosetta::toDLPack(mesh, "name"), std::runtime_error);
+    EXPECT_THROW(rosetta::toDLPack(mesh, "flags"), std::runtime_error);
+    EXPECT_THROW(rosetta::toDLPack(mesh, "missing"), std::runtime_error);
+}
+
+RUN_TESTS()
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include "TEST.h"
+#include <rosetta/enum_registry.h>
+
+enum class Access { None = 0, Read = 1, Write = 2, Exec = 4 };
+ROSETTA_ENUM_FLAGS(Access)
+
+BEGIN_ENUM_REGISTRATION(Access)
+    ENUM_FLAGS()
+    ENUM_VALUE(None)
+    ENUM_VALUE(Read)
+    ENUM_VALUE(Write)
+    ENUM_VALUE(Exec)
+END_ENUM_REGISTRATION()
+
+enum class Mode { Off, On };
+REGISTER_ENUM_2(Mode, Off, On)
+
+TEST(EnumRegistry, incrementalNames)
+{
+    // Grows past the 80% threshold of the name table several times
+    rosetta::EnumInfo info("Many");
+    for (int64_t i = 0; i < 200; ++i) {
+        info.addValue("V" + std::to_string(i), i);
+        for (int64_t j = 0; j <= i; ++j) {
+            const auto* value = info.findValue("V" + std::to_string(j));
+            CHECK(value != nullptr);
+            EXPECT_EQ(value->value, j);
+        }
+        CHECK(info.findValue("V" + std::to_string(i + 1)) == nullptr);
+    }
+    EXPECT_EQ(info.getValue("V123"), 123);
+    EXPECT_STREQ(info.getName(77), "V77");
+    EXPECT_FALSE(info.hasValue("v1"));
+    EXPECT_THROW(info.getValue("V200"), std::runtime_error);
+}
+
+TEST(EnumRegistry, denseThenSortedValues)
+{
+    rosetta::EnumInfo info("Codes");
+    info.addValue("A", 10);
+    info.addValue("B", 11);
+    info.addValue("C", 12);
+    EXPECT_STREQ(info.getName(11), "B");
+    CHECK(info.findName(13) == nullptr);
+    CHECK(info.findName(9) == nullptr);
+
+    // Far values fall back to the sorted table
+    info.addValue("Far", 1000000);
+    info.addValue("Negative", -5000);
+    EXPECT_STREQ(info.getName(10), "A");
+    EXPECT_STREQ(info.getName(12), "C");
+    EXPECT_STREQ(info.getName(1000000), "Far");
+    EXPECT_STREQ(info.getName(-5000), "Negative");
+    CHECK(info.findName(13) == nullptr);
+    EXPECT_THROW(info.getName(999), std::runtime_error);
+
+    // Added in place in the sorted table
+    info.addValue("Mid", 500);
+    EXPECT_STREQ(info.getName(500), "Mid");
+    EXPECT_STREQ(info.getName(1000000), "Far");
+    EXPECT_EQ(info.getValue("Mid"), 500);
+}
+
+TEST(EnumRegistry, aliasesAndReRegistration)
+{
+    rosetta::EnumInfo info("Colors");
+    info.addValue("Red", 0);
+    info.addValue("Green", 1);
+    info.addValue("Crimson", 0); // alias: the last name wins by value
+    EXPECT_STREQ(info.getName(0), "Crimson");
+    EXPECT_EQ(info.getValue("Red"), 0);
+    EXPECT_EQ(info.getValue("Crimson"), 0);
+
+    // A name registered twice keeps its last value
+    info.addValue("Green", 7);
+    EXPECT_EQ(info.values.size(), 3u);
+    EXPECT_EQ(info.getValue("Green"), 7);
+    EXPECT_STREQ(info.getName(7), "Green");
+    CHECK(info.findName(1) == nullptr);
+    EXPECT_STREQ(info.getName(0), "Crimson");
+}
+
+TEST(EnumRegistry, flags)
+{
+    const auto* info = rosetta::EnumRegistry::instance().getEnumInfo<Access>();
+    CHECK(info != nullptr);
+    CHECK(info->isFlags());
+
+    EXPECT_STREQ(info->format(3), "Read|Write");
+    EXPECT_STREQ(info->format(7), "Read|Write|Exec");
+    EXPECT_STREQ(info->format(0), "None");
+    EXPECT_STREQ(info->format(4), "Exec");
+    EXPECT_STREQ(info->format(1 | 8), "Read|8");
+    EXPECT_STREQ(info->format(16), "16");
+
+    EXPECT_EQ(info->getValue("Read | Exec"), 5);
+    EXPECT_EQ(info->getValue("Write|Read"), 3);
+    EXPECT_THROW(info->getValue("Read|Delete"), std::runtime_error);
+    EXPECT_TRUE(info->hasValue("Read | Write"));
+    EXPECT_FALSE(info->hasValue("Read|Delete"));
+
+    EXPECT_TRUE(info->hasValue(int64_t(0)));
+    EXPECT_TRUE(info->hasValue(int64_t(7)));
+    EXPECT_FALSE(info->hasValue(int64_t(8)));
+    EXPECT_FALSE(info->hasValue(int64_t(5 | 16)));
+    EXPECT_TRUE(hasFlag(Access::Read | Access::Exec, Access::Exec));
+
+    // Not flags: combinations are not values
+    const auto* mode = rosetta::EnumRegistry::instance().getEnumInfo<Mode>();
+    CHECK(mode != nullptr);
+    EXPECT_FALSE(mode->hasValue(int64_t(2)));
+    EXPECT_STREQ(mode->format(2), "2");
+    EXPECT_THROW(mode->getValue("Off|On"), std::runtime_error);
+}
+
+TEST(EnumRegistry, infoByName)
+{
+    auto& registry = rosetta::EnumRegistry::instance();
+    EXPECT_TRUE(registry.getEnumInfo("Access") == registry.getEnumInfo<Access>());
+    EXPECT_TRUE(registry.getEnumInfo("Mode") == registry.getEnumInfo<Mode>());
+    EXPECT_TRUE(registry.getEnumInfo("Unknown") == nullptr);
+    EXPECT_STREQ(registry.getEnumInfo("Mode")->getName(1), "On");
+    EXPECT_TRUE(registry.isRegistered<Mode>());
+}
+
+RUN_TESTS()
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include "TEST.h"
+#include <rosetta/function_registry.h>
+
+static double scale(double value, int factor) { return value * factor; }
+static long double precise(long double value, double factor) { return value * factor; }
+
+REGISTER_FUNCTION(scale);
+REGISTER_FUNCTION(precise);
+
+TEST(Functions, vectorizedNumericFunction)
+{
+    const auto* info = rosetta::FunctionRegistry::instance().getFunction("scale");
+    CHECK(info != nullptr);
+    CHECK(info->vectorized != nullptr);
+    EXPECT_EQ(info->vectorized->parameter_types.size(), 2u);
+    CHECK(info->vectorized->return_type == rosetta::NumericType::Float64);
+
+    const std::vector<double> values = { 1.5, -2, 4 };
+    const std::vector<int> factors = { 2, 3, -1 };
+    std::vector<double> results(3);
+    const void* inputs[] = { values.data(), factors.data() };
+    info->vectorized->kernel(inputs, results.data(), results.size());
+    EXPECT_ARRAY_EQ(results, std::vector<double>({ 3, -6, -4 }));
+}
+
+TEST(Functions, longDoubleKeepsScalarPath)
+{
+    static_assert(!rosetta::is_vectorizable_v<long double>);
+    const auto* info = rosetta::FunctionRegistry::instance().getFunction("precise");
+    CHECK(info != nullptr);
+    CHECK(info->vectorized == nullptr);
+    const auto result = info->invoker({ std::any(2.0L), std::any(1.5) });
+    EXPECT_EQ(std::any_cast<long double>(result), 3.0L);
+}
+
+RUN_TESTS()
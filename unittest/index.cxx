@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include "TEST.h"
+#include <cmath>
+#include <limits>
+#include <rosetta/index.h>
+#include <rosetta/introspectable.h>
+
+class Hero : public rosetta::Introspectable {
+    INTROSPECTABLE(Hero)
+public:
+    std::string name = "hero";
+    int level = 1;
+    bool alive = true;
+};
+
+void Hero::registerIntrospection(rosetta::TypeRegistrar<Hero> reg)
+{
+    reg.member("name", &Hero::name).member("level", &Hero::level).member("alive", &Hero::alive);
+}
+
+class Probe : public rosetta::Introspectable {
+    INTROSPECTABLE(Probe)
+public:
+    double x = 0;
+};
+
+void Probe::registerIntrospection(rosetta::TypeRegistrar<Probe> reg)
+{
+    reg.member("x", &Probe::x);
+}
+
+static std::vector<Hero> makeHeroes()
+{
+    std::vector<Hero> heroes(5);
+    const char *names[] = { "Player", "Monster", "Player", "Npc", "Player" };
+    const int levels[] = { 3, 1, 1, 2, 2 };
+    for (std::size_t i = 0; i < heroes.size(); ++i) {
+        heroes[i].name = names[i];
+        heroes[i].level = levels[i];
+    }
+    return heroes;
+}
+
+TEST(Index, lookupAfterSetMemberValue)
+{
+    auto heroes = makeHeroes();
+    rosetta::Index<Hero> by_name(rosetta::IndexKind::Hash, { "name" });
+    by_name.insert(heroes);
+    EXPECT_EQ(by_name.size(), 5u);
+    EXPECT_EQ(by_name.lookup("Player").size(), 3u);
+
+    heroes[0].setMemberValue("name", std::string("Boss"));
+    EXPECT_EQ(by_name.lookup("Player").size(), 2u);
+    auto bosses = by_name.lookup("Boss");
+    EXPECT_EQ(bosses.size(), 1u);
+    EXPECT_TRUE(bosses[0] == &heroes[0]);
+    EXPECT_TRUE(by_name.keyOf(heroes[0]) == rosetta::indexKey("Boss"));
+
+    // Members outside the key do not re-key
+    heroes[0].setMemberValue("level", 9);
+    EXPECT_EQ(by_name.lookup("Boss").size(), 1u);
+
+    // Direct writes need update()
+    heroes[1].name = "Player";
+    EXPECT_EQ(by_name.lookup("Player").size(), 2u);
+    by_name.update(heroes[1]);
+    EXPECT_EQ(by_name.lookup("Player").size(), 3u);
+    EXPECT_EQ(by_name.lookup("Monster").size(), 0u);
+
+    EXPECT_THROW(by_name.lookup(rosetta::indexKey("Player", 1)), std::runtime_error);
+}
+
+TEST(Index, erase)
+{
+    auto heroes = makeHeroes();
+    rosetta::Index<Hero> by_level(rosetta::IndexKind::Ordered, { "level" });
+    by_level.insert(heroes);
+    by_level.erase(heroes[3]);
+    EXPECT_EQ(by_level.size(), 4u);
+    EXPECT_TRUE(!by_level.contains(heroes[3]));
+    EXPECT_TRUE(by_level.contains(heroes[4]));
+    EXPECT_EQ(by_level.lookup(2).size(), 1u);
+    EXPECT_THROW(by_level.keyOf(heroes[3]), std::runtime_error);
+
+    // Erased objects are no longer re-keyed, and erasing twice has no effect
+    heroes[3].setMemberValue("level", 1);
+    EXPECT_EQ(by_level.lookup(1).size(), 2u);
+    by_level.erase(heroes[3]);
+    EXPECT_EQ(by_level.size(), 4u);
+
+    by_level.clear();
+    EXPECT_TRUE(by_level.empty());
+    EXPECT_EQ(by_level.range(0, 10).size(), 0u);
+}
+
+TEST(Index, compositePrefixRange)
+{
+    auto heroes = makeHeroes();
+    rosetta::Index<Hero> by_name_level(rosetta::IndexKind::Ordered, { "name", "level" });
+    by_name_level.insert(heroes);
+
+    auto players = by_name_level.range(rosetta::indexKey("Player"), rosetta::indexKey("Player"));
+    EXPECT_EQ(players.size(), 3u);
+    EXPECT_TRUE(players[0] == &heroes[2]); // increasing level
+    EXPECT_TRUE(players[1] == &heroes[4]);
+    EXPECT_TRUE(players[2] == &heroes[0]);
+
+    auto low = by_name_level.range(rosetta::indexKey("Player", 1), rosetta::indexKey("Player", 2));
+    EXPECT_EQ(low.size(), 2u);
+
+    auto from_n = by_name_level.range(rosetta::indexKey("N"), rosetta::indexKey("Npc"));
+    EXPECT_EQ(from_n.size(), 1u);
+    EXPECT_TRUE(from_n[0] == &heroes[3]);
+
+    heroes[4].setMemberValue("level", 7);
+    players = by_name_level.range(rosetta::indexKey("Player"), rosetta::indexKey("Player"));
+    EXPECT_TRUE(players[2] == &heroes[4]);
+    EXPECT_EQ(by_name_level.lookup("Player", 7).size(), 1u);
+
+    rosetta::Index<Hero> by_name(rosetta::IndexKind::Hash, { "name" });
+    EXPECT_THROW(by_name.range("A", "Z"), std::runtime_error);
+    EXPECT_THROW(rosetta::Index<Hero>(rosetta::IndexKind::Hash, { "missing" }),
+                 rosetta::QueryError);
+}
+
+TEST(Index, keysAfterDeserialization)
+{
+    auto heroes = makeHeroes();
+    rosetta::Index<Hero> by_name_level(rosetta::IndexKind::Ordered, { "name", "level" });
+    rosetta::Index<Hero> by_alive(rosetta::IndexKind::Hash, { "alive" });
+    by_name_level.insert(heroes);
+    by_alive.insert(heroes);
+
+    heroes[1].fromJSON(R"({"name": "Player", "level": 4, "alive": false})");
+    EXPECT_TRUE(by_name_level.keyOf(heroes[1]) == rosetta::indexKey("Player", 4));
+    EXPECT_EQ(by_name_level.lookup("Monster", 1).size(), 0u);
+    EXPECT_EQ(by_name_level.range(rosetta::indexKey("Player"), rosetta::indexKey("Player")).size(),
+              4u);
+    EXPECT_EQ(by_alive.lookup(false).size(), 1u);
+
+    Hero source;
+    source.name = "Monster";
+    source.level = 5;
+    heroes[1].fromBinary(source.toBinary());
+    EXPECT_TRUE(by_name_level.keyOf(heroes[1]) == rosetta::indexKey("Monster", 5));
+    auto monsters = by_name_level.lookup("Monster", 5);
+    EXPECT_EQ(monsters.size(), 1u);
+    EXPECT_TRUE(monsters[0] == &heroes[1]);
+    EXPECT_EQ(by_alive.lookup(true).size(), 5u);
+    EXPECT_EQ(by_alive.lookup(false).size(), 0u);
+}
+
+TEST(Index, nanKeys)
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<Probe> probes(6);
+    const double values[] = { nan, 4, nan, 5, 1, nan };
+    for (std::size_t i = 0; i < probes.size(); ++i) {
+        probes[i].x = values[i];
+    }
+
+    // NaN sorts after all the numbers and equals itself
+    rosetta::Index<Probe> ordered(rosetta::IndexKind::Ordered, { "x" });
+    ordered.insert(probes);
+    EXPECT_EQ(ordered.lookup(4.0).size(), 1u);
+    EXPECT_EQ(ordered.lookup(5.0).size(), 1u);
+    EXPECT_EQ(ordered.lookup(nan).size(), 3u);
+    auto in_range = ordered.range(0.0, 10.0);
+    EXPECT_EQ(in_range.size(), 3u);
+    EXPECT_EQ(in_range[0]->x, 1.0);
+    EXPECT_EQ(in_range[2]->x, 5.0);
+    EXPECT_EQ(ordered.range(0.0, nan).size(), 6u);
+
+    rosetta::Index<Probe> hashed(rosetta::IndexKind::Hash, { "x" });
+    hashed.insert(probes);
+    EXPECT_EQ(hashed.lookup(4.0).size(), 1u);
+    EXPECT_EQ(hashed.lookup(nan).size(), 3u);
+
+    // Setting NaN again keeps the entry, setting a number re-keys it
+    probes[0].setMemberValue("x", nan);
+    EXPECT_EQ(hashed.size(), 6u);
+    EXPECT_EQ(hashed.lookup(nan).size(), 3u);
+    probes[0].setMemberValue("x", 4.0);
+    EXPECT_EQ(hashed.lookup(nan).size(), 2u);
+    EXPECT_EQ(hashed.lookup(4.0).size(), 2u);
+    EXPECT_EQ(ordered.lookup(nan).size(), 2u);
+    EXPECT_EQ(ordered.lookup(4.0).size(), 2u);
+
+    hashed.erase(probes[2]);
+    ordered.erase(probes[2]);
+    EXPECT_EQ(hashed.lookup(nan).size(), 1u);
+    EXPECT_EQ(ordered.lookup(nan).size(), 1u);
+}
+
+RUN_TESTS()
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include "TEST.h"
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <rosetta/introspectable.h>
+
+class Counter : public rosetta::Introspectable {
+    INTROSPECTABLE(Counter)
+public:
+    std::string label;
+    std::size_t count = 0;
+    int age = 0;
+    std::int64_t big = 0;
+};
+
+void Counter::registerIntrospection(rosetta::TypeRegistrar<Counter> reg)
+{
+    reg.member("label", &Counter::label)
+        .member("count", &Counter::count)
+        .member("age", &Counter::age)
+        .member("big", &Counter::big);
+}
+
+class Sample : public rosetta::Introspectable {
+    INTROSPECTABLE(Sample)
+public:
+    double x = 0;
+    float y = 0;
+    std::vector<double> values;
+};
+
+void Sample::registerIntrospection(rosetta::TypeRegistrar<Sample> reg)
+{
+    reg.member("x", &Sample::x).member("y", &Sample::y).member("values", &Sample::values);
+}
+
+class Triple : public rosetta::Introspectable {
+    INTROSPECTABLE(Triple)
+public:
+    std::array<int, 3> arr = { 7, 8, 9 };
+};
+
+void Triple::registerIntrospection(rosetta::TypeRegistrar<Triple> reg)
+{
+    reg.member("arr", &Triple::arr);
+}
+
+TEST(Json, roundTrip)
+{
+    Counter counter;
+    counter.label = "caf\xc3\xa9 \"x\"";
+    counter.count = 42;
+    counter.age = -7;
+    counter.big = -9000000000LL;
+    Counter copy;
+    copy.fromJSON(counter.toJSON());
+    EXPECT_STREQ(copy.label, counter.label);
+    EXPECT_EQ(copy.count, 42u);
+    EXPECT_EQ(copy.age, -7);
+    EXPECT_EQ(copy.big, -9000000000LL);
+}
+
+TEST(Json, integralWrittenAsFloat)
+{
+    Counter counter;
+    counter.fromJSON(R"({"count": 1e3, "age": -2.0})");
+    EXPECT_EQ(counter.count, 1000u);
+    EXPECT_EQ(counter.age, -2);
+}
+
+TEST(Json, integralOutOfRange)
+{
+    Counter counter;
+    EXPECT_THROW(counter.fromJSON(R"({"count": -1})"), std::runtime_error);
+    EXPECT_THROW(counter.fromJSON(R"({"count": -1e3})"), std::runtime_error);
+    EXPECT_THROW(counter.fromJSON(R"({"age": 1e30})"), std::runtime_error);
+    EXPECT_THROW(counter.fromJSON(R"({"age": 2147483648})"), std::runtime_error);
+    EXPECT_THROW(counter.fromJSON(R"({"big": 9.3e18})"), std::runtime_error);
+    EXPECT_THROW(counter.fromJSON(R"({"age": 1.5})"), std::runtime_error);
+
+    counter.fromJSON(R"({"age": -2147483648, "big": -9.2e18})");
+    EXPECT_EQ(counter.age, -2147483647 - 1);
+    EXPECT_EQ(counter.big, -9200000000000000000LL);
+}
+
+TEST(Json, surrogatePairs)
+{
+    Counter counter;
+    counter.fromJSON(R"({"label": "\ud83d\ude00"})");
+    EXPECT_STREQ(counter.label, "\xf0\x9f\x98\x80");
+
+    EXPECT_THROW(counter.fromJSON(R"({"label": "\ud800\u0041"})"), std::runtime_error);
+    EXPECT_THROW(counter.fromJSON(R"({"label": "\ud800A"})"), std::runtime_error);
+    EXPECT_THROW(counter.fromJSON(R"({"label": "\ud800"})"), std::runtime_error);
+    EXPECT_THROW(counter.fromJSON(R"({"label": "\udc00"})"), std::runtime_error);
+}
+
+TEST(Json, nonFiniteAsNull)
+{
+    Sample sample;
+    sample.x = std::numeric_limits<double>::quiet_NaN();
+    sample.y = std::numeric_limits<float>::infinity();
+    sample.values = { 1.5, -std::numeric_limits<double>::infinity(), 2 };
+    const std::string json = sample.toJSON();
+    EXPECT_STREQ(json, R"({"x":null,"y":null,"values":[1.5,null,2]})");
+
+    Sample copy;
+    copy.fromJSON(json);
+    EXPECT_TRUE(std::isnan(copy.x));
+    EXPECT_TRUE(std::isnan(copy.y));
+    EXPECT_EQ(copy.values.size(), 3u);
+    EXPECT_EQ(copy.values[0], 1.5);
+    EXPECT_TRUE(std::isnan(copy.values[1]));
+    EXPECT_EQ(copy.values[2], 2.0);
+
+    Counter counter; // null is not an integer
+    EXPECT_THROW(counter.fromJSON(R"({"age": null})"), std::runtime_error);
+}
+
+TEST(Json, strictSyntax)
+{
+    Sample sample;
+    EXPECT_THROW(sample.fromJSON(R"({"x": .5})"), std::runtime_error);
+    EXPECT_THROW(sample.fromJSON(R"({"x": 01})"), std::runtime_error);
+    EXPECT_THROW(sample.fromJSON(R"({"x": -01.5})"), std::runtime_error);
+    EXPECT_THROW(sample.fromJSON(R"({"x": 1.})"), std::runtime_error);
+    EXPECT_THROW(sample.fromJSON(R"({"x": 1e})"), std::runtime_error);
+    EXPECT_THROW(sample.fromJSON(R"({"x": +1})"), std::runtime_error);
+    EXPECT_THROW(sample.fromJSON(R"({"x": 1.2.3})"), std::runtime_error);
+    EXPECT_THROW(sample.fromJSON(R"({"x": -})"), std::runtime_error);
+    EXPECT_THROW(sample.fromJSON(R"({"unknown": 00})"), std::runtime_error); // skipped too
+
+    sample.fromJSON(R"({"x": -0.25e+2, "y": 0, "values": [0, 10, 1E-1]})");
+    EXPECT_EQ(sample.x, -25.0);
+    EXPECT_EQ(sample.y, 0.0f);
+    EXPECT_EQ(sample.values[2], 0.1);
+
+    Counter counter;
+    EXPECT_THROW(counter.fromJSON("{\"label\": \"a\tb\"}"), std::runtime_error);
+    EXPECT_THROW(counter.fromJSON("{\"label\": \"\\n\nx\"}"), std::runtime_error);
+    EXPECT_THROW(counter.fromJSON(std::string("{\"label\": \"a\0b\"}", 16)),
+        std::runtime_error);
+    counter.fromJSON(R"({"label": "a\tb"})");
+    EXPECT_STREQ(counter.label, "a\tb");
+}
+
+TEST(Json, fixedSizeArrays)
+{
+    Triple sample;
+    EXPECT_THROW(sample.fromJSON(R"({"arr": [1]})"), std::runtime_error);
+    EXPECT_ARRAY_EQ(sample.arr, (std::array<int, 3> { 7, 8, 9 }));
+    EXPECT_THROW(sample.fromJSON(R"({"arr": [1, 2, 3, 4]})"), std::runtime_error);
+    EXPECT_ARRAY_EQ(sample.arr, (std::array<int, 3> { 7, 8, 9 }));
+    EXPECT_THROW(sample.fromJSON(R"({"arr": []})"), std::runtime_error);
+
+    sample.fromJSON(R"({"arr": [1, 2, 3]})");
+    EXPECT_ARRAY_EQ(sample.arr, (std::array<int, 3> { 1, 2, 3 }));
+    Triple copy;
+    copy.fromJSON(sample.toJSON());
+    EXPECT_ARRAY_EQ(copy.arr, sample.arr);
+}
+
+RUN_TESTS()
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include "TEST.h"
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <rosetta/introspectable.h>
+#include <rosetta/kernels.h>
+#include <rosetta/table.h>
+
+using namespace rosetta;
+using namespace rosetta::kernels;
+
+class Pixel : public rosetta::Introspectable {
+    INTROSPECTABLE(Pixel)
+public:
+    std::uint8_t level = 0;
+    float weight = 0;
+};
+
+void Pixel::registerIntrospection(rosetta::TypeRegistrar<Pixel> reg)
+{
+    reg.member("level", &Pixel::level).member("weight", &Pixel::weight);
+}
+
+static Table<Pixel> makePixels(std::initializer_list<int> levels)
+{
+    Table<Pixel> pixels;
+    for (const int level : levels) {
+        Pixel pixel;
+        pixel.level = static_cast<std::uint8_t>(level);
+        pixel.weight = float(level);
+        pixels.push_back(pixel);
+    }
+    return pixels;
+}
+
+static const std::size_t sizes[] = { 0, 1, 15, 16, 17, 4097 };
+static const SimdLevel levels[] = { SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::AVX512 };
+
+// Deterministic values in [-limit, limit] (or [0, limit] for unsigned types),
+// small enough for axpy(3, x, y) not to overflow
+template <typename E> static std::vector<E> makeValues(std::size_t size, std::uint32_t seed)
+{
+    const double limit = std::min(100.0, double(std::numeric_limits<E>::max()) / 4);
+    std::vector<E> values(size);
+    std::uint32_t state = seed;
+    for (auto& value : values) {
+        state = state * 1664525u + 1013904223u;
+        const double unit = (state >> 8) / double(1u << 24);
+        const double real = std::is_signed_v<E> ? (unit * 2 - 1) * limit : unit * limit;
+        value = static_cast<E>(std::is_floating_point_v<E> ? real * 1.37 : std::round(real));
+    }
+    return values;
+}
+
+template <typename V> static bool sameBits(const V& a, const V& b)
+{
+    if constexpr (std::is_floating_point_v<V>) {
+        using Bits = std::conditional_t<sizeof(V) == 8, std::uint64_t, std::uint32_t>;
+        return std::bit_cast<Bits>(a) == std::bit_cast<Bits>(b);
+    } else {
+        return a == b;
+    }
+}
+
+// Everything the kernels compute on `size` values of type E, at the current
+// SIMD level
+template <typename E> struct Results {
+    accumulator_t<E> sum {};
+    MinMax<E> min_max {};
+    Moments moments;
+    accumulator_t<E> dot {};
+    std::vector<E> axpy;
+    std::vector<E> clamped;
+    std::vector<std::uint64_t> histogram;
+
+    explicit Results(std::size_t size)
+    {
+        const std::vector<E> x = makeValues<E>(size, 1);
+        const std::vector<E> y = makeValues<E>(size, 2);
+        sum = kernels::sum(x);
+        if (size > 0) {
+            min_max = minMax(x);
+            moments = meanVariance(x);
+        } else {
+            EXPECT_THROW(minMax(x), std::runtime_error);
+            EXPECT_THROW(meanVariance(x), std::runtime_error);
+        }
+        dot = kernels::dot(x, y);
+        axpy = y;
+        kernels::axpy(static_cast<E>(3), x, axpy);
+        clamped = x;
+        clamp(clamped, static_cast<E>(10), static_cast<E>(50));
+        histogram = kernels::histogram(x, -50.0, 150.0, 7);
+    }
+
+    void expectSame(const Results& other) const
+    {
+        CHECK(sameBits(sum, other.sum));
+        CHECK(sameBits(min_max.min, other.min_max.min));
+        CHECK(sameBits(min_max.max, other.min_max.max));
+        CHECK(sameBits(moments.mean, other.moments.mean));
+        CHECK(sameBits(moments.variance, other.moments.variance));
+        CHECK(sameBits(dot, other.dot));
+        EXPECT_EQ(axpy.size(), other.axpy.size());
+        for (std::size_t i = 0; i < axpy.size(); ++i) {
+            CHECK(sameBits(axpy[i], other.axpy[i]));
+            CHECK(sameBits(clamped[i], other.clamped[i]));
+        }
+        EXPECT_ARRAY_EQ(histogram, other.histogram);
+    }
+};
+
+template <typename E> static void compareLevels()
+{
+    const SimdLevel detected = detectedSimdLevel();
+    for (const std::size_t size : sizes) {
+        setSimdLevel(SimdLevel::Scalar);
+        const Results<E> reference(size);
+        for (const SimdLevel level : levels) {
+            setSimdLevel(level);
+            Results<E>(size).expectSame(reference);
+        }
+    }
+    setSimdLevel(detected);
+}
+
+TEST(Kernels, sameResultsAtEveryLevel)
+{
+    std::cout << "detected: " << simdLevelName(detectedSimdLevel()) << std::endl;
+    compareLevels<float>();
+    compareLevels<double>();
+    compareLevels<std::int8_t>();
+    compareLevels<std::uint8_t>();
+    compareLevels<std::int16_t>();
+    compareLevels<std::int32_t>();
+    compareLevels<std::uint32_t>();
+    compareLevels<std::int64_t>();
+}
+
+TEST(Kernels, referenceValues)
+{
+    setSimdLevel(SimdLevel::Scalar);
+    const std::vector<int> values = { 4, -2, 7, 1 };
+    EXPECT_EQ(sum(values), 10);
+    EXPECT_EQ(minMax(values).min, -2);
+    EXPECT_EQ(minMax(values).max, 7);
+    EXPECT_EQ(meanVariance(values).mean, 2.5);
+    EXPECT_EQ(meanVariance(values).variance, 11.25);
+    EXPECT_EQ(dot(values, values), 70);
+    setSimdLevel(detectedSimdLevel());
+}
+
+TEST(Kernels, columnBounds)
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+
+    // Bounds out of the column type are limited to it
+    auto pixels = makePixels({ 0, 44, 200, 255 });
+    clamp(pixels.columnStorage("level"), -1.0, 300.0);
+    EXPECT_ARRAY_EQ(pixels.column<std::uint8_t>("level"),
+        (std::vector<std::uint8_t> { 0, 44, 200, 255 }));
+    clamp(pixels.columnStorage("level"), 0.5, 199.5);
+    EXPECT_ARRAY_EQ(pixels.column<std::uint8_t>("level"),
+        (std::vector<std::uint8_t> { 1, 44, 199, 199 }));
+    clamp(pixels.columnStorage("weight"), -1e300, 1e300);
+    EXPECT_EQ(pixels.column<float>("weight")[3], 255.0f);
+
+    EXPECT_THROW(clamp(pixels.columnStorage("level"), 10.0, 5.0), std::runtime_error);
+    EXPECT_THROW(clamp(pixels.columnStorage("level"), nan, 5.0), std::runtime_error);
+    EXPECT_THROW(clamp(pixels.columnStorage("weight"), 0.0, nan), std::runtime_error);
+    EXPECT_THROW(clamp(pixels.columnStorage("level"), 0.2, 0.8), std::runtime_error);
+
+    // Integral columns need an integral alpha of their type
+    auto deltas = makePixels({ 1, 2, 3, 4 });
+    axpy(2.0, deltas.columnStorage("level"), pixels.columnStorage("level"));
+    EXPECT_ARRAY_EQ(pixels.column<std::uint8_t>("level"),
+        (std::vector<std::uint8_t> { 3, 48, 205, 207 }));
+    EXPECT_THROW(axpy(0.5, deltas.columnStorage("level"), pixels.columnStorage("level")),
+        std::runtime_error);
+    EXPECT_THROW(axpy(-1.0, deltas.columnStorage("level"), pixels.columnStorage("level")),
+        std::runtime_error);
+    EXPECT_THROW(axpy(nan, deltas.columnStorage("level"), pixels.columnStorage("level")),
+        std::runtime_error);
+    axpy(0.5, deltas.columnStorage("weight"), pixels.columnStorage("weight"));
+    EXPECT_EQ(pixels.column<float>("weight")[0], 0.5f);
+}
+
+RUN_TESTS()
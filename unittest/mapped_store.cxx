@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include "TEST.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <rosetta/introspectable.h>
+#include <rosetta/mapped_store.h>
+
+struct Point {
+    float x, y;
+};
+REGISTER_BINARY_RAW(Point);
+
+class Particle : public rosetta::Introspectable {
+    INTROSPECTABLE(Particle)
+public:
+    std::string name;
+    int id = 0;
+    Point position {};
+    std::array<int, 3> color {};
+    std::vector<double> samples;
+};
+
+void Particle::registerIntrospection(rosetta::TypeRegistrar<Particle> reg)
+{
+    reg.member("name", &Particle::name)
+        .member("id", &Particle::id)
+        .member("position", &Particle::position)
+        .member("color", &Particle::color)
+        .member("samples", &Particle::samples);
+}
+
+static std::string storePath()
+{
+    return (std::filesystem::temp_directory_path() / "rosetta_unittest_store.rst").string();
+}
+
+static std::vector<Particle> makeParticles()
+{
+    std::vector<Particle> particles(3);
+    for (int i = 0; i < 3; ++i) {
+        particles[i].name = "p" + std::to_string(i);
+        particles[i].id = i * 10;
+        particles[i].position = { float(i), -float(i) };
+        particles[i].color = { i, i + 1, i + 2 };
+        particles[i].samples.assign(static_cast<std::size_t>(i + 1), 0.5 * i);
+    }
+    return particles;
+}
+
+// Message of the exception thrown when opening the store
+static std::string openError(const std::string& path)
+{
+    try {
+        rosetta::MappedStore<Particle> store(path);
+    } catch (const std::runtime_error& e) {
+        return e.what();
+    }
+    return "";
+}
+
+static void patchHeader(const std::string& path, std::size_t offset, std::uint64_t value)
+{
+    std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+    file.seekp(static_cast<std::streamoff>(offset));
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+static std::uint64_t readHeader(const std::string& path, std::size_t offset)
+{
+    std::ifstream file(path, std::ios::binary);
+    file.seekg(static_cast<std::streamoff>(offset));
+    std::uint64_t value = 0;
+    file.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return value;
+}
+
+TEST(MappedStore, rawSlotsAreOptIn)
+{
+    using Kind = rosetta::MappedLayout::SlotKind;
+    const rosetta::MappedLayout layout(Particle::getStaticTypeInfo());
+    CHECK(layout.find("name")->kind == Kind::String);
+    CHECK(layout.find("id")->kind == Kind::Raw);
+    CHECK(layout.find("position")->kind == Kind::Raw);
+    CHECK(layout.find("color")->kind == Kind::Encoded); // not opted in
+    CHECK(layout.find("samples")->kind == Kind::Array);
+}
+
+TEST(MappedStore, roundTrip)
+{
+    const std::string path = storePath();
+    const auto particles = makeParticles();
+    rosetta::MappedStore<Particle>::write(path, particles);
+    {
+        rosetta::MappedStore<Particle> store(path);
+        EXPECT_EQ(store.size(), 3u);
+        for (std::size_t i = 0; i < particles.size(); ++i) {
+            const Particle particle = store.get(i);
+            EXPECT_STREQ(particle.name, particles[i].name);
+            EXPECT_EQ(particle.id, particles[i].id);
+            EXPECT_EQ(particle.position.x, particles[i].position.x);
+            EXPECT_ARRAY_EQ(particle.color, particles[i].color);
+            EXPECT_ARRAY_EQ(particle.samples, particles[i].samples);
+            EXPECT_EQ(store.getArray<double>(i, "samples").size(), i + 1);
+        }
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(MappedStore, misalignedSections)
+{
+    // Header: records_offset at byte 32, heap_offset at 40, heap_size at 48
+    const std::string path = storePath();
+    rosetta::MappedStore<Particle>::write(path, makeParticles());
+    const std::uint64_t heap_offset = readHeader(path, 40);
+    const std::uint64_t heap_size = readHeader(path, 48);
+    CHECK(openError(path).empty());
+
+    patchHeader(path, 40, heap_offset + 4);
+    patchHeader(path, 48, heap_size - 4);
+    CHECK(openError(path).find("misaligned") != std::string::npos);
+
+    patchHeader(path, 40, heap_offset);
+    patchHeader(path, 48, heap_size);
+    patchHeader(path, 16, 0); // count
+    patchHeader(path, 32, 68);
+    CHECK(openError(path).find("misaligned") != std::string::npos);
+    std::filesystem::remove(path);
+}
+
+TEST(MappedStore, partialArrayElements)
+{
+    const std::string path = storePath();
+    rosetta::MappedStore<Particle>::write(path, makeParticles());
+
+    // The heap reference of a slot is (offset, bytes): one double in the first
+    // record, cut to 7 bytes
+    const rosetta::MappedLayout layout(Particle::getStaticTypeInfo());
+    const std::uint64_t records_offset = readHeader(path, 32);
+    const std::size_t bytes_at = records_offset + layout.find("samples")->offset + 8;
+    EXPECT_EQ(readHeader(path, bytes_at), 8u);
+    patchHeader(path, bytes_at, 7);
+    {
+        rosetta::MappedStore<Particle> store(path);
+        EXPECT_THROW(store.get(0), std::runtime_error);
+        EXPECT_THROW(store.getArray<double>(0, "samples"), std::runtime_error);
+        EXPECT_EQ(store.getArray<double>(1, "samples").size(), 2u);
+    }
+    std::filesystem::remove(path);
+}
+
+RUN_TESTS()
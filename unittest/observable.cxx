@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include "TEST.h"
+#include <rosetta/delta.h>
+#include <rosetta/index.h>
+#include <memory>
+#include <rosetta/introspectable.h>
+
+class Player : public rosetta::Introspectable {
+    INTROSPECTABLE(Player)
+public:
+    std::string name;
+    int level = 0;
+    float health = 100;
+    float mana = 50;
+};
+
+void Player::registerIntrospection(rosetta::TypeRegistrar<Player> reg)
+{
+    reg.member("name", &Player::name)
+        .member("level", &Player::level)
+        .member_observable("health", &Player::health)
+        .member("mana", &Player::mana);
+}
+
+TEST(Observable, setEmitsChange)
+{
+    Player player;
+    std::vector<std::string> names;
+    float old_health = 0, new_health = 0;
+    const auto id = rosetta::subscribePropertyChanged(player,
+        [&](std::span<const rosetta::PropertyChange> changes) {
+            for (const auto& change : changes) {
+                names.push_back(change.member->name);
+                old_health = std::any_cast<float>(change.old_value);
+                new_health = std::any_cast<float>(change.new_value);
+            }
+        });
+    player.setMemberValue("health", 40.0f);
+    player.setMemberValue("mana", 10.0f); // not observable
+    EXPECT_EQ(names.size(), 1u);
+    EXPECT_EQ(old_health, 100.0f);
+    EXPECT_EQ(new_health, 40.0f);
+
+    rosetta::unsubscribePropertyChanged(player, id);
+    player.setMemberValue("health", 30.0f);
+    EXPECT_EQ(names.size(), 1u);
+}
+
+TEST(Observable, scopedSubscription)
+{
+    const auto& type_info = Player::getStaticTypeInfo();
+    std::size_t calls = 0;
+    const auto count = [&](std::span<const rosetta::PropertyChange>) { ++calls; };
+
+    // Unsubscribed with the object that holds the handle
+    struct Watched {
+        Player player;
+        rosetta::PropertySubscription subscription;
+    };
+    auto watched = std::make_unique<Watched>();
+    watched->subscription = rosetta::subscribePropertyChangedScoped(watched->player, count);
+    const void* address = &watched->player;
+    watched->player.setMemberValue("health", 40.0f);
+    EXPECT_EQ(calls, 1u);
+    EXPECT_TRUE(type_info.hasPropertySubscribers(address));
+    watched.reset();
+    EXPECT_FALSE(type_info.hasPropertySubscribers(address));
+
+    // Moved, reset, released
+    Player player;
+    rosetta::PropertySubscription moved;
+    {
+        auto subscription = rosetta::subscribePropertyChangedScoped(player, count);
+        moved = std::move(subscription);
+        EXPECT_FALSE(subscription);
+    }
+    EXPECT_TRUE(moved);
+    player.setMemberValue("health", 30.0f);
+    EXPECT_EQ(calls, 2u);
+    moved.reset();
+    player.setMemberValue("health", 20.0f);
+    EXPECT_EQ(calls, 2u);
+
+    auto kept = rosetta::subscribePropertyChangedScoped(player, count);
+    const std::size_t id = kept.release();
+    kept.reset();
+    player.setMemberValue("health", 10.0f);
+    EXPECT_EQ(calls, 3u);
+    rosetta::unsubscribePropertyChanged(player, id);
+    EXPECT_FALSE(type_info.hasPropertySubscribers(&player));
+}
+
+TEST(Observable, batchCoalesces)
+{
+    Player player;
+    std::size_t calls = 0;
+    float old_health = 0, new_health = 0;
+    const auto subscription = rosetta::subscribePropertyChangedScoped(player,
+        [&](std::span<const rosetta::PropertyChange> changes) {
+            ++calls;
+            EXPECT_EQ(changes.size(), 1u);
+            old_health = std::any_cast<float>(changes[0].old_value);
+            new_health = std::any_cast<float>(changes[0].new_value);
+        });
+    {
+        rosetta::PropertyBatch batch;
+        player.setMemberValue("health", 50.0f);
+        player.setMemberValue("health", 20.0f);
+        EXPECT_EQ(calls, 0u);
+    }
+    EXPECT_EQ(calls, 1u);
+    EXPECT_EQ(old_health, 100.0f);
+    EXPECT_EQ(new_health, 20.0f);
+}
+
+TEST(Observable, decodeEmitsChange)
+{
+    Player source;
+    source.health = 25;
+    Player player;
+    std::vector<float> old_values, new_values;
+    const auto subscription = rosetta::subscribePropertyChangedScoped(player,
+        [&](std::span<const rosetta::PropertyChange> changes) {
+            for (const auto& change : changes) {
+                old_values.push_back(std::any_cast<float>(change.old_value));
+                new_values.push_back(std::any_cast<float>(change.new_value));
+            }
+        });
+
+    player.fromBinary(source.toBinary());
+    player.fromJSON(R"({"health": 5})");
+    EXPECT_EQ(old_values.size(), 2u);
+    EXPECT_EQ(old_values[0], 100.0f);
+    EXPECT_EQ(new_values[0], 25.0f);
+    EXPECT_EQ(old_values[1], 25.0f);
+    EXPECT_EQ(new_values[1], 5.0f);
+}
+
+TEST(Observable, decodeUpdatesIndex)
+{
+    std::vector<Player> players(3);
+    players[0].name = "a";
+    players[1].name = "b";
+    players[2].name = "c";
+    rosetta::Index<Player> by_name(rosetta::IndexKind::Hash, { "name" });
+    by_name.insert(players);
+    rosetta::Index<Player> by_level(rosetta::IndexKind::Ordered, { "level" });
+    by_level.insert(players);
+
+    players[0].fromJSON(R"({"name": "z", "level": 7})");
+    EXPECT_EQ(by_name.lookup(std::string("a")).size(), 0u);
+    EXPECT_EQ(by_name.lookup(std::string("z")).size(), 1u);
+    EXPECT_EQ(by_level.range(5, 10).size(), 1u);
+
+    Player source;
+    source.name = "y";
+    source.level = 9;
+    players[1].fromBinary(source.toBinary());
+    EXPECT_EQ(by_name.lookup(std::string("b")).size(), 0u);
+    EXPECT_EQ(by_name.lookup(std::string("y")).size(), 1u);
+    EXPECT_EQ(by_level.range(5, 10).size(), 2u);
+}
+
+TEST(Observable, decodeMarksDirty)
+{
+    Player player;
+    rosetta::DirtyTracker<Player> tracker;
+    tracker.track(player);
+    player.fromJSON(R"({"level": 3})");
+    EXPECT_TRUE(tracker.isDirty(player, "level"));
+    EXPECT_TRUE(!tracker.isDirty(player, "mana"));
+
+    tracker.clean(player);
+    Player source;
+    player.fromBinary(source.toBinary());
+    EXPECT_TRUE(tracker.isDirty(player, "mana"));
+}
+
+RUN_TESTS()
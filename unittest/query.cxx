@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include "TEST.h"
+#include <cmath>
+#include <limits>
+#include <rosetta/introspectable.h>
+#include <rosetta/query.h>
+
+class Mob : public rosetta::Introspectable {
+    INTROSPECTABLE(Mob)
+public:
+    std::string name = "mob";
+    int level = 1;
+    double health = 100;
+    bool alive = true;
+};
+
+void Mob::registerIntrospection(rosetta::TypeRegistrar<Mob> reg)
+{
+    reg.member("name", &Mob::name)
+        .member("level", &Mob::level)
+        .member("health", &Mob::health)
+        .member("alive", &Mob::alive);
+}
+
+static Mob makeMob(const std::string &name, int level, double health, bool alive)
+{
+    Mob mob;
+    mob.name = name;
+    mob.level = level;
+    mob.health = health;
+    mob.alive = alive;
+    return mob;
+}
+
+static std::vector<Mob> makeMobs()
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    return { makeMob("a", 1, 50, true),  makeMob("b", 2, nan, true), makeMob("a", 3, 20, false),
+             makeMob("c", 2, 50, false), makeMob("b", 1, 80, true) };
+}
+
+static std::vector<std::size_t> rows(std::string_view where, std::string_view order = "")
+{
+    rosetta::Query<Mob> query;
+    query.where(where);
+    if (!order.empty()) {
+        query.orderBy(order);
+    }
+    return query.indices(makeMobs());
+}
+
+TEST(Query, precedence)
+{
+    // && binds tighter than ||, ! tighter than &&, * tighter than +
+    EXPECT_ARRAY_EQ(rows("level > 2 || name == 'a' && alive"), std::vector<std::size_t>({ 0, 2 }));
+    EXPECT_ARRAY_EQ(rows("(level > 2 || name == 'a') && alive"), std::vector<std::size_t>({ 0 }));
+    EXPECT_ARRAY_EQ(rows("not alive and level == 2 or name == 'b' and level == 1"),
+                    std::vector<std::size_t>({ 3, 4 }));
+    EXPECT_ARRAY_EQ(rows("!alive || level == 1"), std::vector<std::size_t>({ 0, 2, 3, 4 }));
+    EXPECT_ARRAY_EQ(rows("1 + level * 2 == 7"), std::vector<std::size_t>({ 2 }));
+    EXPECT_ARRAY_EQ(rows("(1 + level) * 2 == 6"), std::vector<std::size_t>({ 1, 3 }));
+    EXPECT_ARRAY_EQ(rows("-level + 10 % 4 == 0"), std::vector<std::size_t>({ 1, 3 }));
+}
+
+TEST(Query, comparisonTokens)
+{
+    EXPECT_ARRAY_EQ(rows("level<=2"), std::vector<std::size_t>({ 0, 1, 3, 4 }));
+    EXPECT_ARRAY_EQ(rows("level<2"), std::vector<std::size_t>({ 0, 4 }));
+    EXPECT_ARRAY_EQ(rows("level>=3"), std::vector<std::size_t>({ 2 }));
+    EXPECT_ARRAY_EQ(rows("name!='a'"), std::vector<std::size_t>({ 1, 3, 4 }));
+    EXPECT_ARRAY_EQ(rows("!alive"), std::vector<std::size_t>({ 2, 3 }));
+    EXPECT_ARRAY_EQ(rows("alive != false && name <= \"b\""), std::vector<std::size_t>({ 0, 1, 4 }));
+    // NaN compares false, except with !=
+    EXPECT_ARRAY_EQ(rows("health != health"), std::vector<std::size_t>({ 1 }));
+}
+
+TEST(Query, typeErrors)
+{
+    rosetta::Query<Mob> query;
+    EXPECT_THROW(query.where("level + name > 1"), rosetta::QueryError);
+    EXPECT_THROW(query.where("name < 3"), rosetta::QueryError);
+    EXPECT_THROW(query.where("alive < true"), rosetta::QueryError);
+    EXPECT_THROW(query.where("!level"), rosetta::QueryError);
+    EXPECT_THROW(query.where("alive && name"), rosetta::QueryError);
+    EXPECT_THROW(query.where("level"), rosetta::QueryError); // not a condition
+    EXPECT_THROW(query.where("missing > 1"), rosetta::QueryError);
+    EXPECT_THROW(query.where("level >"), rosetta::QueryError);
+    EXPECT_THROW(query.where("(level > 1"), rosetta::QueryError);
+    EXPECT_THROW(query.where("name == 'a"), rosetta::QueryError);
+    EXPECT_THROW(query.orderBy("level up"), rosetta::QueryError);
+    EXPECT_THROW(query.groupBy(makeMobs(), "level +"), rosetta::QueryError);
+    EXPECT_EQ(query.count(makeMobs()), 5u); // failed conditions are not added
+}
+
+TEST(Query, orderBy)
+{
+    // Ties keep the source order, in both directions
+    EXPECT_ARRAY_EQ(rows("true", "level"), std::vector<std::size_t>({ 0, 4, 1, 3, 2 }));
+    EXPECT_ARRAY_EQ(rows("true", "level desc"), std::vector<std::size_t>({ 2, 1, 3, 0, 4 }));
+    EXPECT_ARRAY_EQ(rows("true", "name desc, level"), std::vector<std::size_t>({ 3, 4, 1, 0, 2 }));
+    EXPECT_ARRAY_EQ(rows("true", "alive, name asc, level desc"),
+                    std::vector<std::size_t>({ 2, 3, 0, 1, 4 }));
+
+    // NaNs come last in both directions
+    EXPECT_ARRAY_EQ(rows("true", "health"), std::vector<std::size_t>({ 2, 0, 3, 4, 1 }));
+    EXPECT_ARRAY_EQ(rows("true", "health desc"), std::vector<std::size_t>({ 4, 0, 3, 2, 1 }));
+    EXPECT_ARRAY_EQ(rows("true", "-health"), std::vector<std::size_t>({ 4, 0, 3, 2, 1 }));
+
+    // Keys of successive calls follow each other
+    auto query = rosetta::Query<Mob>().orderBy("level desc").orderBy("health");
+    EXPECT_ARRAY_EQ(query.indices(makeMobs()), std::vector<std::size_t>({ 2, 3, 1, 0, 4 }));
+}
+
+TEST(Query, limit)
+{
+    const auto mobs = makeMobs();
+    auto unsorted = rosetta::Query<Mob>().where("alive").limit(2);
+    EXPECT_ARRAY_EQ(unsorted.indices(mobs), std::vector<std::size_t>({ 0, 1 }));
+    EXPECT_EQ(unsorted.count(mobs), 2u);
+
+    auto sorted = rosetta::Query<Mob>().where("alive").orderBy("health desc").limit(2);
+    EXPECT_ARRAY_EQ(sorted.indices(mobs), std::vector<std::size_t>({ 4, 0 }));
+    auto selected = sorted.select(mobs);
+    EXPECT_EQ(selected.size(), 2u);
+    EXPECT_TRUE(selected[0] == &mobs[4]);
+
+    EXPECT_EQ(rosetta::Query<Mob>().limit(10).indices(mobs).size(), 5u);
+    EXPECT_EQ(rosetta::Query<Mob>().orderBy("name").limit(0).indices(mobs).size(), 0u);
+}
+
+TEST(Query, groupByNaN)
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    std::vector<Mob> mobs;
+    for (const double health : { 1.0, nan, 2.0, nan, 1.0, 3.0, 2.0 }) {
+        mobs.push_back(makeMob("m", 1, health, true));
+    }
+    const auto groups = rosetta::Query<Mob>().groupBy(mobs, "health");
+    EXPECT_EQ(groups.size(), 4u);
+    EXPECT_EQ(std::get<double>(groups[0].key), 1.0);
+    EXPECT_ARRAY_EQ(groups[0].rows, (std::vector<std::size_t> { 0, 4 }));
+    EXPECT_EQ(std::get<double>(groups[1].key), 2.0);
+    EXPECT_ARRAY_EQ(groups[1].rows, (std::vector<std::size_t> { 2, 6 }));
+    EXPECT_ARRAY_EQ(groups[2].rows, (std::vector<std::size_t> { 5 }));
+    EXPECT_TRUE(std::isnan(std::get<double>(groups[3].key)));
+    EXPECT_ARRAY_EQ(groups[3].rows, (std::vector<std::size_t> { 1, 3 }));
+}
+
+TEST(Query, parallelMatchesSerial)
+{
+    std::vector<Mob> mobs(100000);
+    for (std::size_t i = 0; i < mobs.size(); ++i) {
+        mobs[i].name = std::string(1, static_cast<char>('a' + i % 7));
+        mobs[i].level = static_cast<int>((i * 7919) % 101);
+        mobs[i].health = i % 13 == 0 ? std::numeric_limits<double>::quiet_NaN()
+                                     : static_cast<double>((i * 31) % 997);
+        mobs[i].alive = i % 3 != 0;
+    }
+    const auto run = [&](std::size_t parallel_from, std::string_view order, std::size_t count) {
+        auto query = rosetta::Query<Mob>()
+                         .where("alive && level % 5 != 0")
+                         .parallelFrom(parallel_from);
+        if (!order.empty()) {
+            query.orderBy(order);
+        }
+        query.limit(count);
+        return query.indices(mobs);
+    };
+    const std::size_t all = static_cast<std::size_t>(-1);
+    for (const std::string_view order : { "", "health desc, name", "name, level desc" }) {
+        for (const std::size_t count : { all, std::size_t(1000) }) {
+            const auto serial = run(all, order, count);
+            const auto parallel = run(1, order, count);
+            EXPECT_TRUE(!serial.empty());
+            EXPECT_ARRAY_EQ(parallel, serial);
+        }
+    }
+
+    auto counter = rosetta::Query<Mob>().where("health >= 500");
+    const std::size_t serial = counter.count(mobs);
+    EXPECT_EQ(counter.parallelFrom(1).count(mobs), serial);
+}
+
+RUN_TESTS()
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2025-now fmaerten@gmail.com
+ * LGPL v3 license
+ */
+#include "TEST.h"
+#include <rosetta/introspectable.h>
+#include <rosetta/table.h>
+
+// Copying it throws when `fail` is set, to interrupt a push_back
+struct Payload {
+    bool fail = false;
+    Payload() = default;
+    Payload(const Payload& other)
+        : fail(other.fail)
+    {
+        if (fail) {
+            throw std::runtime_error("Payload copy failed");
+        }
+    }
+    Payload& operator=(const Payload&) = default;
+};
+
+class Unit : public rosetta::Introspectable {
+    INTROSPECTABLE(Unit)
+public:
+    std::string name = "unit";
+    float health = 100;
+    bool alive = true;
+    Payload payload;
+};
+
+void Unit::registerIntrospection(rosetta::TypeRegistrar<Unit> reg)
+{
+    reg.member("name", &Unit::name)
+        .member("health", &Unit::health)
+        .member("alive", &Unit::alive)
+        .member("payload", &Unit::payload);
+}
+
+static Unit makeUnit(const std::string& name, float health, bool alive)
+{
+    Unit unit;
+    unit.name = name;
+    unit.health = health;
+    unit.alive = alive;
+    return unit;
+}
+
+static rosetta::Table<Unit> makeUnits()
+{
+    rosetta::Table<Unit> units;
+    units.push_back(makeUnit("a", 10, true));
+    units.push_back(makeUnit("b", 20, false));
+    units.push_back(makeUnit("c", 30, true));
+    return units;
+}
+
+TEST(Table, columns)
+{
+    auto units = makeUnits();
+    EXPECT_EQ(units.size(), 3u);
+    EXPECT_FALSE(units.empty());
+    std::vector<std::string> names = { "name", "health", "alive", "payload" };
+    EXPECT_TRUE(units.columnNames() == names);
+    EXPECT_TRUE(units.hasColumn("health"));
+    EXPECT_FALSE(units.hasColumn("missing"));
+
+    std::span<float> health = units.column<float>("health");
+    EXPECT_EQ(health.size(), 3u);
+    EXPECT_ARRAY_EQ(std::vector<float>(health.begin(), health.end()),
+        std::vector<float>({ 10, 20, 30 }));
+    health[1] = 25; // writes through to the table
+    EXPECT_EQ(units.get(1).health, 25.0f);
+
+    const auto& view = units;
+    std::span<const std::string> labels = view.column<std::string>("name");
+    EXPECT_STREQ(labels[2], "c");
+
+    EXPECT_THROW(units.column<double>("health"), std::runtime_error);
+    EXPECT_THROW(units.column<float>("missing"), std::runtime_error);
+    EXPECT_THROW(units.columnStorage("missing"), std::runtime_error);
+    EXPECT_TRUE(units.columnStorage("health").numericType() == rosetta::NumericType::Float32);
+    EXPECT_FALSE(units.columnStorage("name").numericType().has_value());
+}
+
+TEST(Table, boolColumns)
+{
+    auto units = makeUnits();
+    EXPECT_FALSE(units.columnStorage("alive").numericType().has_value());
+
+    std::span<bool> alive = units.column<bool>("alive");
+    EXPECT_EQ(alive.size(), 3u);
+    EXPECT_TRUE(alive[0]);
+    EXPECT_FALSE(alive[1]);
+    EXPECT_TRUE(alive[2]);
+
+    alive[0] = false;
+    EXPECT_FALSE(units.get(0).alive);
+    units[1].setMemberValue("alive", true);
+    EXPECT_TRUE(std::any_cast<bool>(units[1].getMemberValue("alive")));
+    EXPECT_TRUE(units[1].get<bool>("alive"));
+}
+
+TEST(Table, rowProxies)
+{
+    auto units = makeUnits();
+    auto row = units[2];
+    EXPECT_EQ(row.index(), 2u);
+    EXPECT_STREQ(row.getClassName(), "Unit");
+    EXPECT_TRUE(row.hasMember("name"));
+    EXPECT_FALSE(row.hasMember("missing"));
+    EXPECT_EQ(std::any_cast<float>(row.getMemberValue("health")), 30.0f);
+
+    row.setMemberValue("health", 35.0f);
+    EXPECT_EQ(units.column<float>("health")[2], 35.0f);
+    EXPECT_THROW(row.setMemberValue("health", 35.0), std::bad_any_cast);
+
+    row.get<std::string>("name") = "z";
+    EXPECT_STREQ(units.get(2).name, "z");
+    EXPECT_THROW(row.get<int>("name"), std::runtime_error);
+
+    row = makeUnit("d", 40, false);
+    Unit copy = row.materialize();
+    EXPECT_STREQ(copy.name, "d");
+    EXPECT_EQ(copy.health, 40.0f);
+    EXPECT_FALSE(copy.alive);
+
+    EXPECT_THROW(units[3].getMemberValue("name"), std::out_of_range);
+
+    float total = 0;
+    for (auto unit : std::as_const(units)) {
+        total += unit.get<float>("health");
+    }
+    EXPECT_EQ(total, 70.0f);
+}
+
+TEST(Table, getSetErase)
+{
+    auto units = makeUnits();
+    Unit unit = units.get(1);
+    EXPECT_STREQ(unit.name, "b");
+    EXPECT_EQ(unit.health, 20.0f);
+    EXPECT_FALSE(unit.alive);
+
+    units.set(1, makeUnit("B", 21, true));
+    units.read(1, unit);
+    EXPECT_STREQ(unit.name, "B");
+    EXPECT_TRUE(unit.alive);
+
+    units.erase(0);
+    EXPECT_EQ(units.size(), 2u);
+    EXPECT_STREQ(units.get(0).name, "B");
+    EXPECT_STREQ(units.get(1).name, "c");
+    EXPECT_EQ(units.column<bool>("alive").size(), 2u);
+
+    EXPECT_THROW(units.get(2), std::out_of_range);
+    EXPECT_THROW(units.set(2, unit), std::out_of_range);
+    EXPECT_THROW(units.erase(2), std::out_of_range);
+
+    units.clear();
+    EXPECT_TRUE(units.empty());
+    EXPECT_EQ(units.column<float>("health").size(), 0u);
+}
+
+TEST(Table, copyAndAssign)
+{
+    auto units = makeUnits();
+    rosetta::Table<Unit> copy(units);
+    copy.column<float>("health")[0] = 99;
+    copy.push_back(makeUnit("d", 40, true));
+    EXPECT_EQ(units.size(), 3u);
+    EXPECT_EQ(units.get(0).health, 10.0f);
+    EXPECT_EQ(copy.size(), 4u);
+    EXPECT_EQ(copy.get(0).health, 99.0f);
+
+    units = copy;
+    EXPECT_EQ(units.size(), 4u);
+    EXPECT_STREQ(units.get(3).name, "d");
+    units.column<float>("health")[3] = 45;
+    EXPECT_EQ(copy.get(3).health, 40.0f);
+
+    auto& self = units;
+    units = self;
+    EXPECT_EQ(units.size(), 4u);
+
+    rosetta::Table<Unit> moved(std::move(copy));
+    EXPECT_EQ(moved.size(), 4u);
+    EXPECT_EQ(moved.get(0).health, 99.0f);
+}
+
+TEST(Table, pushBackRollback)
+{
+    auto units = makeUnits();
+    Unit bad = makeUnit("bad", 1, false);
+    bad.payload.fail = true;
+    EXPECT_THROW(units.push_back(bad), std::runtime_error);
+
+    // The columns pushed before the failing one dropped the row
+    EXPECT_EQ(units.size(), 3u);
+    EXPECT_EQ(units.column<std::string>("name").size(), 3u);
+    EXPECT_EQ(units.columnStorage("health").size(), 3u);
+    EXPECT_EQ(units.columnStorage("alive").size(), 3u);
+    EXPECT_EQ(units.columnStorage("payload").size(), 3u);
+
+    units.push_back(makeUnit("d", 40, true));
+    EXPECT_EQ(units.size(), 4u);
+    EXPECT_STREQ(units.get(3).name, "d");
+    EXPECT_EQ(units.get(3).health, 40.0f);
+}
+
+RUN_TESTS()